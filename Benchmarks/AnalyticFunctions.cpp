@@ -0,0 +1,86 @@
+#include "./BenchCommon.hpp"
+
+// Random n x n matrix with eigenvalues close to n (away from the negative real axis).
+template<typename T>
+static auto random_shifted_matrix(long n)
+{
+    auto a = enda::matrix<T>(enda::array<T, 2>::rand(n, n));
+    for (long i = 0; i < n; ++i)
+        a(i, i) += T(n);
+    return a;
+}
+
+// ------------------------------- general matrices ----------------------------------------
+
+template<typename T>
+static void expm(benchmark::State& state)
+{
+    const long n = state.range(0);
+    auto const a = enda::matrix<T>(enda::array<T, 2>::rand(n, n));
+
+    while (state.KeepRunning())
+    {
+        auto e = enda::expm(a);
+        benchmark::DoNotOptimize(e.data());
+    }
+}
+BENCHMARK(expm<double>)->RangeMultiplier(4)->Range(4, 256)->Unit(benchmark::kMicrosecond);
+BENCHMARK(expm<dcomplex>)->RangeMultiplier(4)->Range(4, 256)->Unit(benchmark::kMicrosecond);
+
+static void sqrtm(benchmark::State& state)
+{
+    const long n = state.range(0);
+    auto const a = random_shifted_matrix<double>(n);
+
+    while (state.KeepRunning())
+    {
+        auto x = enda::sqrtm(a);
+        benchmark::DoNotOptimize(x.data());
+    }
+}
+BENCHMARK(sqrtm)->RangeMultiplier(4)->Range(4, 256)->Unit(benchmark::kMicrosecond);
+
+static void logm(benchmark::State& state)
+{
+    const long n = state.range(0);
+    auto const a = random_shifted_matrix<double>(n);
+
+    while (state.KeepRunning())
+    {
+        auto x = enda::logm(a);
+        benchmark::DoNotOptimize(x.data());
+    }
+}
+BENCHMARK(logm)->RangeMultiplier(4)->Range(4, 256)->Unit(benchmark::kMicrosecond);
+
+// ------------------------------- time evolution operator ----------------------------------------
+
+static void expm_hermitian(benchmark::State& state)
+{
+    const long n = state.range(0);
+    auto       b = enda::matrix<dcomplex>(enda::array<dcomplex, 2>::rand(n, n));
+    auto const h = enda::matrix<dcomplex>(dcomplex(0, -0.1) * (b + enda::dagger(b)));
+
+    while (state.KeepRunning())
+    {
+        auto u = enda::expm(h);
+        benchmark::DoNotOptimize(u.data());
+    }
+}
+BENCHMARK(expm_hermitian)->RangeMultiplier(4)->Range(4, 256)->Unit(benchmark::kMicrosecond);
+
+// ------------------------------- stacks of small matrices ----------------------------------------
+
+static void batched_expm(benchmark::State& state)
+{
+    const long n = state.range(0), batch = 1024;
+    auto const a = enda::array<double, 3>(enda::array<double, 3>::rand(batch, n, n));
+
+    while (state.KeepRunning())
+    {
+        auto e = enda::expm(a);
+        benchmark::DoNotOptimize(e.data());
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK(batched_expm)->RangeMultiplier(2)->Range(4, 16)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,116 @@
+#include "./BenchCommon.hpp"
+
+// Random, well conditioned n x n matrix.
+static auto random_matrix(long n)
+{
+    auto a = enda::matrix<dcomplex>(enda::array<dcomplex, 2>::rand(n, n));
+    for (long i = 0; i < n; ++i)
+        a(i, i) += n;
+    return a;
+}
+
+// Stack of random, well conditioned n x n matrices.
+template<typename Layout = enda::C_layout>
+static auto random_stack(long batch, long n)
+{
+    auto a = enda::array<dcomplex, 3, Layout>(batch, n, n);
+    for (long k = 0; k < batch; ++k)
+        a(k, _, _) = random_matrix(n);
+    return a;
+}
+
+static constexpr long batch = 4096;
+
+// ------------------------------- stacks of matrix products ----------------------------------------
+
+static void batched_gemm_views(benchmark::State& state)
+{
+    const long n = state.range(0);
+    auto const a = random_stack(batch, n);
+    auto const b = random_stack(batch, n);
+    auto       c = enda::array<dcomplex, 3>(batch, n, n);
+
+    // one view and one call to the general routine per matrix
+    while (state.KeepRunning())
+    {
+        for (long k = 0; k < batch; ++k)
+            enda::linalg::gemm(dcomplex(1), enda::matrix_const_view<dcomplex>(a(k, _, _)), enda::matrix_const_view<dcomplex>(b(k, _, _)), dcomplex(0),
+                               enda::matrix_view<dcomplex>(c(k, _, _)));
+        benchmark::DoNotOptimize(c.data());
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK(batched_gemm_views)->RangeMultiplier(2)->Range(4, 32);
+
+template<typename Layout>
+static void batched_gemm(benchmark::State& state)
+{
+    const long n = state.range(0);
+    auto const a = random_stack<Layout>(batch, n);
+    auto const b = random_stack<Layout>(batch, n);
+    auto       c = enda::array<dcomplex, 3, Layout>(batch, n, n);
+
+    while (state.KeepRunning())
+    {
+        enda::linalg::gemm(dcomplex(1), a, b, dcomplex(0), c);
+        benchmark::DoNotOptimize(c.data());
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK(batched_gemm<enda::C_layout>)->RangeMultiplier(2)->Range(4, 32);
+BENCHMARK(batched_gemm<enda::linalg::batch_interleaved_layout>)->RangeMultiplier(2)->Range(4, 32);
+
+template<int N>
+static void batched_gemm_static(benchmark::State& state)
+{
+    using layout_t = enda::linalg::static_matrix_stack_layout<N>;
+    auto const a   = random_stack<layout_t>(batch, N);
+    auto const b   = random_stack<layout_t>(batch, N);
+    auto       c   = enda::array<dcomplex, 3, layout_t>(batch, N, N);
+
+    while (state.KeepRunning())
+    {
+        enda::linalg::gemm(dcomplex(1), a, b, dcomplex(0), c);
+        benchmark::DoNotOptimize(c.data());
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK(batched_gemm_static<4>);
+BENCHMARK(batched_gemm_static<8>);
+
+// ------------------------------- stacks of inverses ----------------------------------------
+
+template<typename Layout>
+static void batched_inverse(benchmark::State& state)
+{
+    const long n = state.range(0);
+    auto const a = random_stack<Layout>(batch, n);
+    auto       b = a;
+
+    while (state.KeepRunning())
+    {
+        b = a;
+        enda::inverse_in_place(b);
+        benchmark::DoNotOptimize(b.data());
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK(batched_inverse<enda::C_layout>)->RangeMultiplier(2)->Range(4, 32);
+BENCHMARK(batched_inverse<enda::linalg::batch_interleaved_layout>)->RangeMultiplier(2)->Range(4, 32);
+
+template<int N>
+static void batched_inverse_static(benchmark::State& state)
+{
+    auto const a = random_stack<enda::linalg::static_matrix_stack_layout<N>>(batch, N);
+    auto       b = a;
+
+    while (state.KeepRunning())
+    {
+        b = a;
+        enda::inverse_in_place(b);
+        benchmark::DoNotOptimize(b.data());
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK(batched_inverse_static<4>);
+BENCHMARK(batched_inverse_static<8>);
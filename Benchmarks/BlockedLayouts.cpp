@@ -0,0 +1,78 @@
+#include "./BenchCommon.hpp"
+
+// Transpose b(i, j) = a(j, i) of n x n arrays with a given layout, traversed with for_each
+template<typename Layout>
+static void transpose(benchmark::State& state)
+{
+    long const                     n = state.range(0);
+    enda::array<double, 2, Layout> a(enda::array<double, 2>::rand(n, n)), b(n, n);
+    while (state.KeepRunning())
+    {
+        enda::for_each(b.shape(), [&](long i, long j) { b(i, j) = a(j, i); });
+        benchmark::DoNotOptimize(b.data());
+    }
+    state.SetBytesProcessed(state.iterations() * 2 * n * n * sizeof(double));
+}
+BENCHMARK(transpose<enda::C_layout>)->Arg(1024)->Arg(2048);
+BENCHMARK(transpose<enda::morton_layout>)->Arg(1024)->Arg(2048);
+BENCHMARK(transpose<enda::tiled_layout<16>>)->Arg(1024)->Arg(2048);
+
+// Same as above but traversed tile by tile (32 x 32 tiles for C-order, the blocks otherwise)
+template<typename Layout>
+static void transpose_tiled_loop(benchmark::State& state)
+{
+    long const                     n = state.range(0);
+    enda::array<double, 2, Layout> a(enda::array<double, 2>::rand(n, n)), b(n, n);
+    std::array<long, 2>            tile {32, 32};
+    if constexpr (enda::is_blocked_idx_map_v<typename decltype(b)::layout_t>)
+        tile = enda::detail::block_traversal_tile(b.indexmap());
+    while (state.KeepRunning())
+    {
+        enda::for_each_tile(b.shape(), tile, [&](long i, long j) { b(i, j) = a(j, i); });
+        benchmark::DoNotOptimize(b.data());
+    }
+    state.SetBytesProcessed(state.iterations() * 2 * n * n * sizeof(double));
+}
+BENCHMARK(transpose_tiled_loop<enda::C_layout>)->Arg(1024)->Arg(2048);
+BENCHMARK(transpose_tiled_loop<enda::morton_layout>)->Arg(1024)->Arg(2048);
+BENCHMARK(transpose_tiled_loop<enda::tiled_layout<16>>)->Arg(1024)->Arg(2048);
+
+// 5-point stencil on the interior of n x n arrays with a given layout, traversed tile by tile
+template<typename Layout>
+static void stencil5(benchmark::State& state)
+{
+    long const                     n = state.range(0);
+    enda::array<double, 2, Layout> a(enda::array<double, 2>::rand(n, n)), b(n, n);
+    std::array<long, 2>            tile = enda::default_tile_shape(std::array {n - 2, n - 2});
+    if constexpr (enda::is_blocked_idx_map_v<typename decltype(b)::layout_t>)
+        tile = enda::detail::block_traversal_tile(b.indexmap());
+    while (state.KeepRunning())
+    {
+        enda::for_each_tile(std::array {n - 2, n - 2}, tile, [&](long i, long j) {
+            b(i + 1, j + 1) = a(i, j + 1) + a(i + 2, j + 1) + a(i + 1, j) + a(i + 1, j + 2) - 4 * a(i + 1, j + 1);
+        });
+        benchmark::DoNotOptimize(b.data());
+    }
+    state.SetItemsProcessed(state.iterations() * (n - 2) * (n - 2));
+}
+BENCHMARK(stencil5<enda::C_layout>)->Arg(1024)->Arg(2048);
+BENCHMARK(stencil5<enda::morton_layout>)->Arg(1024)->Arg(2048);
+BENCHMARK(stencil5<enda::tiled_layout<16>>)->Arg(1024)->Arg(2048);
+
+// Conversion between C-order and a blocked layout
+template<typename Layout>
+static void convert(benchmark::State& state)
+{
+    long const                     n = state.range(0);
+    enda::array<double, 2>         a = enda::array<double, 2>::rand(n, n);
+    enda::array<double, 2, Layout> b(n, n);
+    while (state.KeepRunning())
+    {
+        b = a;
+        a = b;
+        benchmark::DoNotOptimize(a.data());
+    }
+    state.SetBytesProcessed(state.iterations() * 4 * n * n * sizeof(double));
+}
+BENCHMARK(convert<enda::morton_layout>)->Arg(1024)->Arg(2048);
+BENCHMARK(convert<enda::tiled_layout<16>>)->Arg(1024)->Arg(2048);
@@ -0,0 +1,101 @@
+#include "./BenchCommon.hpp"
+
+// views a(_, range(0, n - 1), _) of a contiguous rank 3 array with a short last dimension: the two inner dimensions are
+// jointly contiguous and collapse into a single run
+
+static void copy_view_nested(benchmark::State& state)
+{
+    const long             n = state.range(0);
+    enda::array<double, 3> a(n, n, 4), b(n, n, 4);
+    a       = 1.0;
+    auto va = a(_, range(0, n - 1), _);
+    auto vb = b(_, range(0, n - 1), _);
+
+    while (state.KeepRunning())
+    {
+        enda::for_each(vb.shape(), [&va, &vb](auto i, auto j, auto k) { vb(i, j, k) = va(i, j, k); });
+        benchmark::DoNotOptimize(b.data());
+    }
+    state.SetBytesProcessed(state.iterations() * 2 * va.size() * sizeof(double));
+}
+BENCHMARK(copy_view_nested)->RangeMultiplier(4)->Range(16, 1024);
+
+static void copy_view(benchmark::State& state)
+{
+    const long             n = state.range(0);
+    enda::array<double, 3> a(n, n, 4), b(n, n, 4);
+    a       = 1.0;
+    auto va = a(_, range(0, n - 1), _);
+    auto vb = b(_, range(0, n - 1), _);
+
+    while (state.KeepRunning())
+    {
+        vb = va;
+        benchmark::DoNotOptimize(b.data());
+    }
+    state.SetBytesProcessed(state.iterations() * 2 * va.size() * sizeof(double));
+}
+BENCHMARK(copy_view)->RangeMultiplier(4)->Range(16, 1024);
+
+static void fill_view_nested(benchmark::State& state)
+{
+    const long             n = state.range(0);
+    enda::array<double, 3> a(n, n, 4);
+    auto                   va = a(_, range(0, n - 1), _);
+
+    while (state.KeepRunning())
+    {
+        enda::for_each(va.shape(), [&va](auto i, auto j, auto k) { va(i, j, k) = 1.0; });
+        benchmark::DoNotOptimize(a.data());
+    }
+    state.SetBytesProcessed(state.iterations() * va.size() * sizeof(double));
+}
+BENCHMARK(fill_view_nested)->RangeMultiplier(4)->Range(16, 1024);
+
+static void fill_view(benchmark::State& state)
+{
+    const long             n = state.range(0);
+    enda::array<double, 3> a(n, n, 4);
+    auto                   va = a(_, range(0, n - 1), _);
+
+    while (state.KeepRunning())
+    {
+        va = 1.0;
+        benchmark::DoNotOptimize(a.data());
+    }
+    state.SetBytesProcessed(state.iterations() * va.size() * sizeof(double));
+}
+BENCHMARK(fill_view)->RangeMultiplier(4)->Range(16, 1024);
+
+static void sum_view_nested(benchmark::State& state)
+{
+    const long             n = state.range(0);
+    enda::array<double, 3> a(n, n, 4);
+    a       = 1.0;
+    auto va = a(_, range(0, n - 1), _);
+
+    while (state.KeepRunning())
+    {
+        double s = 0;
+        enda::for_each(va.shape(), [&va, &s](auto i, auto j, auto k) { s += va(i, j, k); });
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetBytesProcessed(state.iterations() * va.size() * sizeof(double));
+}
+BENCHMARK(sum_view_nested)->RangeMultiplier(4)->Range(16, 1024);
+
+static void sum_view(benchmark::State& state)
+{
+    const long             n = state.range(0);
+    enda::array<double, 3> a(n, n, 4);
+    a       = 1.0;
+    auto va = a(_, range(0, n - 1), _);
+
+    while (state.KeepRunning())
+    {
+        auto s = enda::sum(va);
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetBytesProcessed(state.iterations() * va.size() * sizeof(double));
+}
+BENCHMARK(sum_view)->RangeMultiplier(4)->Range(16, 1024);
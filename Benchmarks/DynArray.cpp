@@ -0,0 +1,72 @@
+#include "./BenchCommon.hpp"
+
+// Sum of a contiguous rank 3 array with a static rank
+static void sum_static(benchmark::State& state)
+{
+    long const             n = state.range(0);
+    enda::array<double, 3> a = enda::array<double, 3>::rand(n, n, n);
+    while (state.KeepRunning())
+        benchmark::DoNotOptimize(enda::sum(a));
+    state.SetBytesProcessed(state.iterations() * a.size() * sizeof(double));
+}
+BENCHMARK(sum_static)->Arg(16)->Arg(128);
+
+// Same with a runtime rank
+static void sum_dyn(benchmark::State& state)
+{
+    long const              n = state.range(0);
+    enda::dyn_array<double> a(enda::array<double, 3>::rand(n, n, n));
+    while (state.KeepRunning())
+        benchmark::DoNotOptimize(enda::sum(a));
+    state.SetBytesProcessed(state.iterations() * a.size() * sizeof(double));
+}
+BENCHMARK(sum_dyn)->Arg(16)->Arg(128);
+
+// Copy of a strided sub-view of a rank 3 array with a static rank
+static void copy_strided_static(benchmark::State& state)
+{
+    long const             n = state.range(0);
+    enda::array<double, 3> a = enda::array<double, 3>::rand(n, n, n), b(n, n, n / 2);
+    auto                   v = a(enda::range::all, enda::range::all, enda::range(0, n, 2));
+    while (state.KeepRunning())
+    {
+        b = v;
+        benchmark::DoNotOptimize(b.data());
+    }
+    state.SetBytesProcessed(state.iterations() * 2 * b.size() * sizeof(double));
+}
+BENCHMARK(copy_strided_static)->Arg(16)->Arg(128);
+
+// Same with a runtime rank
+static void copy_strided_dyn(benchmark::State& state)
+{
+    long const              n = state.range(0);
+    enda::array<double, 3>  a = enda::array<double, 3>::rand(n, n, n);
+    enda::dyn_array<double> b({n, n, n / 2});
+    auto                    v = enda::dyn_array_view<double const>(a(enda::range::all, enda::range::all, enda::range(0, n, 2)));
+    while (state.KeepRunning())
+    {
+        b.as_view() = v;
+        benchmark::DoNotOptimize(b.data());
+    }
+    state.SetBytesProcessed(state.iterations() * 2 * b.size() * sizeof(double));
+}
+BENCHMARK(copy_strided_dyn)->Arg(16)->Arg(128);
+
+// Element access through operator() of a rank 3 array with a runtime rank
+static void access_dyn(benchmark::State& state)
+{
+    long const              n = state.range(0);
+    enda::dyn_array<double> a({n, n, n}, 1.0);
+    while (state.KeepRunning())
+    {
+        double s = 0;
+        for (long i = 0; i < n; ++i)
+            for (long j = 0; j < n; ++j)
+                for (long k = 0; k < n; ++k)
+                    s += a(i, j, k);
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetItemsProcessed(state.iterations() * a.size());
+}
+BENCHMARK(access_dyn)->Arg(16)->Arg(128);
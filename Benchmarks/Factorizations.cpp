@@ -0,0 +1,148 @@
+#include "./BenchCommon.hpp"
+
+// Random, well conditioned n x n matrix.
+static auto random_matrix(long n)
+{
+    auto a = enda::matrix<double>(enda::array<double, 2>::rand(n, n));
+    for (long i = 0; i < n; ++i)
+        a(i, i) += n;
+    return a;
+}
+
+// ------------------------------- LU ----------------------------------------
+
+static void lu_loops(benchmark::State& state)
+{
+    const long n = state.range(0);
+    auto const a = random_matrix(n);
+    auto       lu = a;
+
+    // textbook right-looking LU with partial pivoting
+    while (state.KeepRunning())
+    {
+        lu = a;
+        for (long j = 0; j < n; ++j)
+        {
+            long p = j;
+            for (long i = j + 1; i < n; ++i)
+                if (std::abs(lu(i, j)) > std::abs(lu(p, j)))
+                    p = i;
+            for (long k = 0; k < n; ++k)
+                std::swap(lu(j, k), lu(p, k));
+            for (long i = j + 1; i < n; ++i)
+            {
+                lu(i, j) /= lu(j, j);
+                for (long k = j + 1; k < n; ++k)
+                    lu(i, k) -= lu(i, j) * lu(j, k);
+            }
+        }
+        benchmark::DoNotOptimize(lu.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * n * n * n / 3);
+}
+BENCHMARK(lu_loops)->RangeMultiplier(2)->Range(32, 1024);
+
+static void lu_getrf(benchmark::State& state)
+{
+    const long n    = state.range(0);
+    auto const a    = random_matrix(n);
+    auto       lu   = a;
+    auto       ipiv = enda::vector<int>(n);
+
+    while (state.KeepRunning())
+    {
+        lu = a;
+        enda::linalg::getrf(lu, ipiv);
+        benchmark::DoNotOptimize(lu.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * n * n * n / 3);
+}
+BENCHMARK(lu_getrf)->RangeMultiplier(2)->Range(32, 1024);
+
+static void cholesky_potrf(benchmark::State& state)
+{
+    const long n = state.range(0);
+    auto       b = random_matrix(n);
+    auto const a = enda::matrix<double>(b * enda::transpose(b));
+    auto       l = a;
+
+    while (state.KeepRunning())
+    {
+        l = a;
+        enda::linalg::potrf(l);
+        benchmark::DoNotOptimize(l.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n * n * n / 3);
+}
+BENCHMARK(cholesky_potrf)->RangeMultiplier(2)->Range(32, 1024);
+
+static void qr_geqrf(benchmark::State& state)
+{
+    const long n   = state.range(0);
+    auto const a   = random_matrix(n);
+    auto       q   = a;
+    auto       tau = enda::vector<double>(n);
+
+    while (state.KeepRunning())
+    {
+        q = a;
+        enda::linalg::geqrf(q, tau);
+        benchmark::DoNotOptimize(q.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 4 * n * n * n / 3);
+}
+BENCHMARK(qr_geqrf)->RangeMultiplier(2)->Range(32, 1024);
+
+static void inverse(benchmark::State& state)
+{
+    const long n = state.range(0);
+    auto const a = random_matrix(n);
+
+    while (state.KeepRunning())
+    {
+        auto inv = enda::inverse(a);
+        benchmark::DoNotOptimize(inv.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * n * n * n);
+}
+BENCHMARK(inverse)->RangeMultiplier(2)->Range(32, 1024);
+
+// ------------------------------- stacks of small matrices ----------------------------------------
+
+static void batched_inverse_views(benchmark::State& state)
+{
+    const long n = state.range(0), batch = 4096;
+    auto       a = enda::array<dcomplex, 3>(batch, n, n);
+    for (long k = 0; k < batch; ++k)
+        a(k, _, _) = random_matrix(n);
+    auto b = a;
+
+    // one view and one call to the general routine per matrix
+    while (state.KeepRunning())
+    {
+        b = a;
+        for (long k = 0; k < batch; ++k)
+            enda::inverse_in_place(enda::matrix_view<dcomplex>(b(k, _, _)));
+        benchmark::DoNotOptimize(b.data());
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK(batched_inverse_views)->RangeMultiplier(2)->Range(4, 32);
+
+static void batched_inverse(benchmark::State& state)
+{
+    const long n = state.range(0), batch = 4096;
+    auto       a = enda::array<dcomplex, 3>(batch, n, n);
+    for (long k = 0; k < batch; ++k)
+        a(k, _, _) = random_matrix(n);
+    auto b = a;
+
+    while (state.KeepRunning())
+    {
+        b = a;
+        enda::inverse_in_place(b);
+        benchmark::DoNotOptimize(b.data());
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK(batched_inverse)->RangeMultiplier(2)->Range(4, 32);
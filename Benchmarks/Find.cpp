@@ -0,0 +1,101 @@
+#include "./BenchCommon.hpp"
+
+// ------------------------------- any(isnan(a)) ----------------------------------------
+
+static void any_isnan_fold(benchmark::State& state)
+{
+    const long             n = state.range(0);
+    enda::array<double, 1> a(n);
+    a = 1.0;
+
+    while (state.KeepRunning())
+    {
+        auto r = enda::fold([](bool r, bool x) { return r or x; }, enda::isnan(a), false);
+        benchmark::DoNotOptimize(r);
+    }
+    state.SetBytesProcessed(state.iterations() * n * sizeof(double));
+}
+BENCHMARK(any_isnan_fold)->RangeMultiplier(8)->Range(1 << 10, 1 << 25);
+
+static void any_isnan(benchmark::State& state)
+{
+    const long             n = state.range(0);
+    enda::array<double, 1> a(n);
+    a = 1.0;
+
+    // no hit: the whole array is scanned
+    while (state.KeepRunning())
+    {
+        auto r = enda::any(enda::isnan(a));
+        benchmark::DoNotOptimize(r);
+    }
+    state.SetBytesProcessed(state.iterations() * n * sizeof(double));
+}
+BENCHMARK(any_isnan)->RangeMultiplier(8)->Range(1 << 10, 1 << 25);
+
+static void any_isnan_early(benchmark::State& state)
+{
+    const long             n = state.range(0);
+    enda::array<double, 1> a(n);
+    a         = 1.0;
+    a(n / 10) = std::nan("");
+
+    // hit after 10% of the array
+    while (state.KeepRunning())
+    {
+        auto r = enda::any(enda::isnan(a));
+        benchmark::DoNotOptimize(r);
+    }
+    state.SetBytesProcessed(state.iterations() * n * sizeof(double));
+}
+BENCHMARK(any_isnan_early)->RangeMultiplier(8)->Range(1 << 10, 1 << 25);
+
+// ------------------------------- find_if / count_if / argmax ----------------------------------------
+
+static void find_if_view(benchmark::State& state)
+{
+    const long             n = state.range(0);
+    enda::array<double, 2> a(n, n + 3);
+    a           = 1.0;
+    a(n - 1, 0) = 2.0;
+    auto va     = a(_, range(0, n));
+
+    while (state.KeepRunning())
+    {
+        auto r = enda::find_if(va, [](double x) { return x > 1.5; });
+        benchmark::DoNotOptimize(r);
+    }
+    state.SetBytesProcessed(state.iterations() * n * n * sizeof(double));
+}
+BENCHMARK(find_if_view)->RangeMultiplier(4)->Range(64, 4096);
+
+static void count_if(benchmark::State& state)
+{
+    const long             n = state.range(0);
+    enda::array<double, 1> a(n);
+    a = 1.0;
+
+    while (state.KeepRunning())
+    {
+        auto r = enda::count_if(a, [](double x) { return x > 0.5; });
+        benchmark::DoNotOptimize(r);
+    }
+    state.SetBytesProcessed(state.iterations() * n * sizeof(double));
+}
+BENCHMARK(count_if)->RangeMultiplier(8)->Range(1 << 10, 1 << 25);
+
+static void argmax(benchmark::State& state)
+{
+    const long             n = state.range(0);
+    enda::array<double, 2> a(n, n);
+    a               = 1.0;
+    a(n / 2, n / 3) = 2.0;
+
+    while (state.KeepRunning())
+    {
+        auto r = enda::argmax(a);
+        benchmark::DoNotOptimize(r);
+    }
+    state.SetBytesProcessed(state.iterations() * n * n * sizeof(double));
+}
+BENCHMARK(argmax)->RangeMultiplier(4)->Range(64, 4096);
@@ -0,0 +1,103 @@
+#include "./BenchCommon.hpp"
+
+// ------------------------------- fill ----------------------------------------
+
+static void fill_F_view_c_order(benchmark::State& state)
+{
+    const long                       n = state.range(0);
+    enda::array<double, 3, F_layout> a(n, n, n + 1);
+    auto                             v = a(range::all, range::all, range(0, n));
+
+    while (state.KeepRunning())
+    {
+        enda::for_each(v.shape(), [&v](auto i, auto j, auto k) { v(i, j, k) = 1.0; });
+        benchmark::DoNotOptimize(a.data());
+    }
+    state.SetBytesProcessed(state.iterations() * n * n * n * sizeof(double));
+}
+BENCHMARK(fill_F_view_c_order)->RangeMultiplier(2)->Range(16, 256);
+
+static void fill_F_view(benchmark::State& state)
+{
+    const long                       n = state.range(0);
+    enda::array<double, 3, F_layout> a(n, n, n + 1);
+    auto                             v = a(range::all, range::all, range(0, n));
+
+    while (state.KeepRunning())
+    {
+        v = 1.0;
+        benchmark::DoNotOptimize(a.data());
+    }
+    state.SetBytesProcessed(state.iterations() * n * n * n * sizeof(double));
+}
+BENCHMARK(fill_F_view)->RangeMultiplier(2)->Range(16, 256);
+
+// ------------------------------- sum ----------------------------------------
+
+static void sum_transposed_c_order(benchmark::State& state)
+{
+    const long             n = state.range(0);
+    enda::array<double, 2> a(n, n);
+    a       = 1.0;
+    auto at = transpose(a);
+
+    while (state.KeepRunning())
+    {
+        double s = 0;
+        enda::for_each(at.shape(), [&at, &s](auto i, auto j) { s += at(i, j); });
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetBytesProcessed(state.iterations() * n * n * sizeof(double));
+}
+BENCHMARK(sum_transposed_c_order)->RangeMultiplier(4)->Range(64, 4096);
+
+static void sum_transposed(benchmark::State& state)
+{
+    const long             n = state.range(0);
+    enda::array<double, 2> a(n, n);
+    a       = 1.0;
+    auto at = transpose(a);
+
+    while (state.KeepRunning())
+    {
+        auto s = enda::sum(at);
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetBytesProcessed(state.iterations() * n * n * sizeof(double));
+}
+BENCHMARK(sum_transposed)->RangeMultiplier(4)->Range(64, 4096);
+
+// ------------------------------- expression ----------------------------------------
+
+static void assign_F_expression_c_order(benchmark::State& state)
+{
+    const long                       n = state.range(0);
+    enda::array<double, 2, F_layout> a(n, n), b(n, n), c(n, n);
+    a = 1.0;
+    b = 2.0;
+
+    while (state.KeepRunning())
+    {
+        enda::for_each(c.shape(), [&](auto i, auto j) { c(i, j) = a(i, j) + 2 * b(i, j); });
+        benchmark::DoNotOptimize(c.data());
+    }
+    state.SetBytesProcessed(state.iterations() * 3 * n * n * sizeof(double));
+}
+BENCHMARK(assign_F_expression_c_order)->RangeMultiplier(4)->Range(64, 4096);
+
+static void assign_F_view_expression(benchmark::State& state)
+{
+    const long                       n = state.range(0);
+    enda::array<double, 2, F_layout> a(n, n + 1), b(n, n + 1), c(n, n + 1);
+    a       = 1.0;
+    b       = 2.0;
+    auto va = a(range::all, range(0, n)), vb = b(range::all, range(0, n)), vc = c(range::all, range(0, n));
+
+    while (state.KeepRunning())
+    {
+        vc = va + 2 * vb;
+        benchmark::DoNotOptimize(c.data());
+    }
+    state.SetBytesProcessed(state.iterations() * 3 * n * n * sizeof(double));
+}
+BENCHMARK(assign_F_view_expression)->RangeMultiplier(4)->Range(64, 4096);
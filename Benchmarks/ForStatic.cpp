@@ -42,3 +42,46 @@ static void foreach_static2(benchmark::State& state)
     }
 }
 BENCHMARK(foreach_static2);
+
+// ------------------------- static vs dynamic extents ------------------------
+
+// Element access in explicit loops: a(i, j) = i + j followed by a weighted sum over all elements
+template<typename A>
+static void access2(benchmark::State& state, A a)
+{
+    while (state.KeepRunning())
+    {
+        for (long i = 0; i < 3; ++i)
+            for (long j = 0; j < 3; ++j)
+                a(i, j) = i + j;
+        benchmark::ClobberMemory();
+        double s = 0;
+        for (long i = 0; i < 3; ++i)
+            for (long j = 0; j < 3; ++j)
+                s += a(i, j) * a(j, i);
+        benchmark::DoNotOptimize(s);
+    }
+}
+BENCHMARK_CAPTURE(access2, static_3x3, enda::stack_array<double, 3, 3> {});
+BENCHMARK_CAPTURE(access2, dynamic_3x3, enda::array<double, 2>(3, 3));
+
+template<typename A>
+static void access3(benchmark::State& state, A a)
+{
+    while (state.KeepRunning())
+    {
+        for (long i = 0; i < 4; ++i)
+            for (long j = 0; j < 4; ++j)
+                for (long k = 0; k < 4; ++k)
+                    a(i, j, k) = i + j + k;
+        benchmark::ClobberMemory();
+        double s = 0;
+        for (long i = 0; i < 4; ++i)
+            for (long j = 0; j < 4; ++j)
+                for (long k = 0; k < 4; ++k)
+                    s += a(i, j, k) * a(k, j, i);
+        benchmark::DoNotOptimize(s);
+    }
+}
+BENCHMARK_CAPTURE(access3, static_4x4x4, enda::stack_array<double, 4, 4, 4> {});
+BENCHMARK_CAPTURE(access3, dynamic_4x4x4, enda::array<double, 3>(4, 4, 4));
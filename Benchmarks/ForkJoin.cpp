@@ -0,0 +1,116 @@
+#include "./BenchCommon.hpp"
+
+#include <atomic>
+#include <thread>
+
+// fork-join overheads of the work-stealing thread pool as a function of the number of threads (last argument)
+
+static void threads_args(benchmark::internal::Benchmark* b)
+{
+    const long n_max = std::max(1u, std::thread::hardware_concurrency());
+    for (long n = 1; n <= n_max; n *= 2)
+        b->Arg(n);
+}
+
+// naive recursive Fibonacci numbers: one task per call above a cutoff
+static long fib_seq(long n) { return n < 2 ? n : fib_seq(n - 1) + fib_seq(n - 2); }
+
+static long fib_par(long n)
+{
+    if (n < 12)
+        return fib_seq(n);
+    long                       a = 0, b = 0;
+    enda::parallel::task_group g;
+    g.run([&]() { a = fib_par(n - 1); });
+    g.run_and_wait([&]() { b = fib_par(n - 2); });
+    return a + b;
+}
+
+static void fib_sequential(benchmark::State& state)
+{
+    while (state.KeepRunning())
+        benchmark::DoNotOptimize(fib_seq(30));
+}
+BENCHMARK(fib_sequential)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+static void fib_task_group(benchmark::State& state)
+{
+    enda::parallel::set_num_threads(state.range(0));
+    while (state.KeepRunning())
+        benchmark::DoNotOptimize(fib_par(30));
+}
+BENCHMARK(fib_task_group)->Apply(threads_args)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+// latency of an (almost) empty fork-join
+static void empty_parallel_invoke(benchmark::State& state)
+{
+    enda::parallel::set_num_threads(state.range(0));
+    std::atomic<long> n = 0;
+    while (state.KeepRunning())
+        enda::parallel::parallel_invoke([&]() { ++n; }, [&]() { ++n; });
+    benchmark::DoNotOptimize(n.load());
+}
+BENCHMARK(empty_parallel_invoke)->Apply(threads_args)->UseRealTime();
+
+static void empty_pool_run(benchmark::State& state)
+{
+    enda::parallel::set_num_threads(state.range(0));
+    auto&             pool = enda::parallel::thread_pool::instance();
+    std::atomic<long> n    = 0;
+    while (state.KeepRunning())
+        pool.run(pool.size(), [&](long) { ++n; });
+    benchmark::DoNotOptimize(n.load());
+}
+BENCHMARK(empty_pool_run)->Apply(threads_args)->UseRealTime();
+
+// fine-grained parallel_for: overhead per index
+static void parallel_for_fine(benchmark::State& state)
+{
+    enda::parallel::set_num_threads(state.range(0));
+    const long             n = 1 << 16;
+    enda::array<double, 1> a(n);
+    while (state.KeepRunning())
+    {
+        enda::parallel::parallel_for(0, n, [&a](long i) { a(i) = double(i); }, 256);
+        benchmark::DoNotOptimize(a.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(parallel_for_fine)->Apply(threads_args)->UseRealTime();
+
+// irregular work: the cost of an index grows linearly with it, balanced by stealing
+static void parallel_for_triangular(benchmark::State& state)
+{
+    enda::parallel::set_num_threads(state.range(0));
+    const long             n = 4000;
+    enda::array<double, 1> a(n);
+    while (state.KeepRunning())
+    {
+        enda::parallel::parallel_for(0, n, [&a](long i) {
+            double s = 0;
+            for (long j = 0; j <= i; ++j)
+                s += 1.0 / double(j + 1);
+            a(i) = s;
+        });
+        benchmark::DoNotOptimize(a.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n * (n + 1) / 2);
+}
+BENCHMARK(parallel_for_triangular)->Apply(threads_args)->UseRealTime();
+
+// nested parallelism: parallel loops inside parallel loops share the same threads
+static void nested_parallel_for(benchmark::State& state)
+{
+    enda::parallel::set_num_threads(state.range(0));
+    const long             n = 64;
+    enda::array<double, 2> a(n, 1024);
+    while (state.KeepRunning())
+    {
+        enda::parallel::parallel_for(0, n, [&a](long i) {
+            enda::parallel::parallel_for(0, 1024, [&a, i](long j) { a(i, j) = double(i * j); }, 128);
+        });
+        benchmark::DoNotOptimize(a.data());
+    }
+    state.SetItemsProcessed(state.iterations() * a.size());
+}
+BENCHMARK(nested_parallel_for)->Apply(threads_args)->UseRealTime();
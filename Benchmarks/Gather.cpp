@@ -0,0 +1,101 @@
+#include "./BenchCommon.hpp"
+
+#include <algorithm>
+#include <random>
+
+// Index array with n random indices in [0, n) or, if run > 1, with random runs of run consecutive indices
+static enda::array<long, 1> make_indices(long n, long run)
+{
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<long> dist(0, n / run - 1);
+    enda::array<long, 1> idx(n);
+    for (long i = 0; i < n; i += run)
+    {
+        long const start = dist(gen) * run;
+        for (long k = 0; k < run and i + k < n; ++k)
+            idx(i + k) = start + k;
+    }
+    return idx;
+}
+
+// Gather b(i) = a(idx(i)) with a hand-written loop
+static void gather_loop(benchmark::State& state)
+{
+    long const n   = state.range(0);
+    auto       a   = enda::array<double, 1>::rand(n);
+    auto       idx = make_indices(n, state.range(1));
+    auto       b   = enda::array<double, 1>(n);
+    while (state.KeepRunning())
+    {
+        for (long i = 0; i < n; ++i)
+            b(i) = a(idx(i));
+        benchmark::DoNotOptimize(b.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(gather_loop)->Args({1 << 12, 1})->Args({1 << 20, 1})->Args({1 << 20, 64});
+
+// Same with a gather view whose offsets are computed once
+static void gather_fancy(benchmark::State& state)
+{
+    long const n   = state.range(0);
+    auto       a   = enda::array<double, 1>::rand(n);
+    auto       g   = a(make_indices(n, state.range(1)));
+    auto       b   = enda::array<double, 1>(n);
+    while (state.KeepRunning())
+    {
+        b = g;
+        benchmark::DoNotOptimize(b.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(gather_fancy)->Args({1 << 12, 1})->Args({1 << 20, 1})->Args({1 << 20, 64});
+
+// Scatter a(idx(i)) = b(i) with a hand-written loop
+static void scatter_loop(benchmark::State& state)
+{
+    long const n   = state.range(0);
+    auto       a   = enda::array<double, 1>(n);
+    auto       idx = make_indices(n, state.range(1));
+    auto       b   = enda::array<double, 1>::rand(n);
+    while (state.KeepRunning())
+    {
+        for (long i = 0; i < n; ++i)
+            a(idx(i)) = b(i);
+        benchmark::DoNotOptimize(a.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(scatter_loop)->Args({1 << 12, 1})->Args({1 << 20, 1})->Args({1 << 20, 64});
+
+// Same with a gather view whose offsets are computed once
+static void scatter_fancy(benchmark::State& state)
+{
+    long const n = state.range(0);
+    auto       a = enda::array<double, 1>(n);
+    auto       g = a(make_indices(n, state.range(1)));
+    auto       b = enda::array<double, 1>::rand(n);
+    while (state.KeepRunning())
+    {
+        g = b;
+        benchmark::DoNotOptimize(a.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(scatter_fancy)->Args({1 << 12, 1})->Args({1 << 20, 1})->Args({1 << 20, 64});
+
+// Select the elements of a 2d array with a boolean mask (including the computation of the offsets)
+static void mask_select(benchmark::State& state)
+{
+    long const n    = state.range(0);
+    auto       a    = enda::array<double, 2>::rand(n, n);
+    auto       mask = enda::array<bool, 2>(n, n);
+    enda::for_each(a.shape(), [&](long i, long j) { mask(i, j) = a(i, j) > 0.5; });
+    while (state.KeepRunning())
+    {
+        auto b = enda::array<double, 1>(a(mask));
+        benchmark::DoNotOptimize(b.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n * n);
+}
+BENCHMARK(mask_select)->Arg(256)->Arg(1024);
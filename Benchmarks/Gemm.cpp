@@ -0,0 +1,163 @@
+#include "./BenchCommon.hpp"
+
+// ------------------------------- matrix * matrix ----------------------------------------
+
+template<typename T>
+static void gemm_loops(benchmark::State& state)
+{
+    const long   n = state.range(0);
+    enda::matrix<T> a(n, n), b(n, n), c(n, n);
+    a = T(1);
+    b = T(2);
+
+    // naive i-k-j loops (inner loop is contiguous in b and c)
+    while (state.KeepRunning())
+    {
+        c = T(0);
+        for (long i = 0; i < n; ++i)
+            for (long k = 0; k < n; ++k)
+            {
+                const T aik = a(i, k);
+                for (long j = 0; j < n; ++j)
+                    c(i, j) += aik * b(k, j);
+            }
+        benchmark::DoNotOptimize(c.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n * n * n);
+}
+BENCHMARK(gemm_loops<double>)->RangeMultiplier(2)->Range(32, 1024);
+BENCHMARK(gemm_loops<dcomplex>)->RangeMultiplier(2)->Range(32, 512);
+
+template<typename T>
+static void gemm_matmul(benchmark::State& state)
+{
+    const long   n = state.range(0);
+    enda::matrix<T> a(n, n), b(n, n), c(n, n);
+    a = T(1);
+    b = T(2);
+
+    while (state.KeepRunning())
+    {
+        enda::linalg::gemm(T(1), a, b, T(0), c);
+        benchmark::DoNotOptimize(c.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n * n * n);
+}
+BENCHMARK(gemm_matmul<float>)->RangeMultiplier(2)->Range(32, 1024);
+BENCHMARK(gemm_matmul<double>)->RangeMultiplier(2)->Range(32, 1024);
+BENCHMARK(gemm_matmul<dcomplex>)->RangeMultiplier(2)->Range(32, 512);
+
+static void gemm_dagger(benchmark::State& state)
+{
+    const long          n = state.range(0);
+    enda::matrix<dcomplex> a(n, n), b(n, n);
+    a = dcomplex(1, 2);
+    b = dcomplex(2, 1);
+
+    // the conjugate transposed view is consumed directly by the packing routines
+    while (state.KeepRunning())
+    {
+        enda::matrix<dcomplex> c = enda::dagger(a) * b;
+        benchmark::DoNotOptimize(c.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n * n * n);
+}
+BENCHMARK(gemm_dagger)->RangeMultiplier(2)->Range(32, 512);
+
+// ------------------------------- fused updates ----------------------------------------
+
+static void gemm_update_temporary(benchmark::State& state)
+{
+    const long           n = state.range(0);
+    enda::matrix<double> a(n, n), b(n, n), c(n, n);
+    a = 1.0;
+    b = 2.0;
+    c = 0.0;
+
+    // the product is evaluated into a temporary which is then combined with c in a second pass
+    while (state.KeepRunning())
+    {
+        auto ab = enda::matrix<double>(a * b);
+        c       = enda::map([](double x) { return std::exp(x); })(2.0 * ab - 0.5 * c);
+        benchmark::DoNotOptimize(c.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n * n * n);
+}
+BENCHMARK(gemm_update_temporary)->RangeMultiplier(4)->Range(32, 2048);
+
+static void gemm_update_fused(benchmark::State& state)
+{
+    const long           n = state.range(0);
+    enda::matrix<double> a(n, n), b(n, n), c(n, n);
+    a = 1.0;
+    b = 2.0;
+    c = 0.0;
+
+    // scaling, accumulation and the exponential are applied in the write-back of the GEMM kernel
+    while (state.KeepRunning())
+    {
+        c = enda::map([](double x) { return std::exp(x); })(2.0 * a * b - 0.5 * c);
+        benchmark::DoNotOptimize(c.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n * n * n);
+}
+BENCHMARK(gemm_update_fused)->RangeMultiplier(4)->Range(32, 2048);
+
+// ------------------------------- matrix * vector ----------------------------------------
+
+static void gemv_loops(benchmark::State& state)
+{
+    const long             n = state.range(0);
+    enda::matrix<double>   a(n, n);
+    enda::vector<double>   x(n), y(n);
+    a = 1.0;
+    x = 2.0;
+
+    while (state.KeepRunning())
+    {
+        for (long i = 0; i < n; ++i)
+        {
+            double s = 0;
+            for (long j = 0; j < n; ++j)
+                s += a(i, j) * x(j);
+            y(i) = s;
+        }
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetBytesProcessed(state.iterations() * n * n * sizeof(double));
+}
+BENCHMARK(gemv_loops)->RangeMultiplier(4)->Range(64, 4096);
+
+static void gemv_row_major(benchmark::State& state)
+{
+    const long           n = state.range(0);
+    enda::matrix<double> a(n, n);
+    enda::vector<double> x(n), y(n);
+    a = 1.0;
+    x = 2.0;
+
+    while (state.KeepRunning())
+    {
+        enda::linalg::gemv(1.0, a, x, 0.0, y);
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetBytesProcessed(state.iterations() * n * n * sizeof(double));
+}
+BENCHMARK(gemv_row_major)->RangeMultiplier(4)->Range(64, 4096);
+
+static void gemv_col_major(benchmark::State& state)
+{
+    const long                             n = state.range(0);
+    enda::matrix<double, enda::F_layout> a(n, n);
+    enda::vector<double>                   x(n), y(n);
+    a = 1.0;
+    x = 2.0;
+
+    while (state.KeepRunning())
+    {
+        enda::linalg::gemv(1.0, a, x, 0.0, y);
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetBytesProcessed(state.iterations() * n * n * sizeof(double));
+}
+BENCHMARK(gemv_col_major)->RangeMultiplier(4)->Range(64, 4096);
@@ -139,6 +139,86 @@ static void iterators2_strided(benchmark::State& state)
 }
 BENCHMARK(iterators2_strided);
 
+static void segments2_strided(benchmark::State& state)
+{
+    enda::array<double, 2>                                   a(N1, N2);
+    enda::basic_array_view<double, 2, enda::C_stride_layout> v(a);
+    while (state.KeepRunning())
+    {
+        enda::for_each_segment(v, [](double* p, long n, long s) {
+            if (s == 1)
+                std::fill(p, p + n, 10.0);
+            else
+                for (long i = 0; i < n; ++i)
+                    p[i * s] = 10;
+        });
+        benchmark::DoNotOptimize(a.data());
+    }
+}
+BENCHMARK(segments2_strided);
+
+static void iterators2_sliced(benchmark::State& state)
+{
+    enda::array<double, 2> a(N1, 2 * N2);
+    auto                   v = a(enda::range::all, enda::range(0, 2 * N2, 2));
+    while (state.KeepRunning())
+    {
+        for (auto& x : v)
+        {
+            benchmark::DoNotOptimize(x = 10);
+        }
+    }
+}
+BENCHMARK(iterators2_sliced);
+
+static void segments2_sliced(benchmark::State& state)
+{
+    enda::array<double, 2> a(N1, 2 * N2);
+    auto                   v = a(enda::range::all, enda::range(0, 2 * N2, 2));
+    while (state.KeepRunning())
+    {
+        enda::for_each_segment(v, [](double* p, long n, long s) {
+            for (long i = 0; i < n; ++i)
+                p[i * s] = 10;
+        });
+        benchmark::DoNotOptimize(a.data());
+    }
+}
+BENCHMARK(segments2_sliced);
+
+// std::sort through the random access iterator of a strided 2d view
+static void sort2_sliced(benchmark::State& state)
+{
+    const long             n = state.range(0);
+    enda::array<double, 2> a(n, 2 * n);
+    auto                   v = a(enda::range::all, enda::range(0, 2 * n, 2));
+    auto const             r = enda::array<double, 2>(enda::rand<>(n, n));
+    while (state.KeepRunning())
+    {
+        v = r;
+        std::sort(v.begin(), v.end());
+        benchmark::DoNotOptimize(a.data());
+    }
+}
+BENCHMARK(sort2_sliced)->Arg(100)->Arg(300);
+
+// Same as above with the elements copied to contiguous memory
+static void sort2_copy(benchmark::State& state)
+{
+    const long             n = state.range(0);
+    enda::array<double, 2> a(n, 2 * n);
+    auto                   v = a(enda::range::all, enda::range(0, 2 * n, 2));
+    auto const             r = enda::array<double, 2>(enda::rand<>(n, n));
+    while (state.KeepRunning())
+    {
+        auto c = enda::array<double, 2>(r);
+        std::sort(c.data(), c.data() + c.size());
+        v = c;
+        benchmark::DoNotOptimize(a.data());
+    }
+}
+BENCHMARK(sort2_copy)->Arg(100)->Arg(300);
+
 static void pointer_2A(benchmark::State& state)
 {
     enda::array<double, 2> a(N1, N2);
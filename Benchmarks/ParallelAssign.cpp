@@ -0,0 +1,93 @@
+#include "./BenchCommon.hpp"
+
+#include <thread>
+
+// bandwidth of fill/copy kernels as a function of the number of threads (second argument)
+
+static void threads_args(benchmark::internal::Benchmark* b)
+{
+    const long n_max = std::max(1u, std::thread::hardware_concurrency());
+    for (long n = 1; n <= n_max; n *= 2)
+        b->Args({1l << 25, n});
+}
+
+static void parallel_fill(benchmark::State& state)
+{
+    const long n = state.range(0);
+    enda::parallel::set_num_threads(state.range(1));
+    enda::array<double, 1> a(n);
+
+    while (state.KeepRunning())
+    {
+        enda::fill(enda::execution::par, a, 1.0);
+        benchmark::DoNotOptimize(a.data());
+    }
+    state.SetBytesProcessed(state.iterations() * n * sizeof(double));
+}
+BENCHMARK(parallel_fill)->Apply(threads_args)->UseRealTime();
+
+static void parallel_copy(benchmark::State& state)
+{
+    const long n = state.range(0);
+    enda::parallel::set_num_threads(state.range(1));
+    enda::array<double, 1> a(n), b(n);
+    a = 1.0;
+
+    while (state.KeepRunning())
+    {
+        enda::assign(enda::execution::par, b, a);
+        benchmark::DoNotOptimize(b.data());
+    }
+    state.SetBytesProcessed(state.iterations() * 2 * n * sizeof(double));
+}
+BENCHMARK(parallel_copy)->Apply(threads_args)->UseRealTime();
+
+static void parallel_copy_strided(benchmark::State& state)
+{
+    const long n = 1l << 12;
+    enda::parallel::set_num_threads(state.range(1));
+    enda::array<double, 2> a(n, n + 8), b(n, n + 8);
+    a       = 1.0;
+    auto va = a(_, range(0, n)), vb = b(_, range(0, n));
+
+    while (state.KeepRunning())
+    {
+        enda::assign(enda::execution::par, vb, va);
+        benchmark::DoNotOptimize(b.data());
+    }
+    state.SetBytesProcessed(state.iterations() * 2 * n * n * sizeof(double));
+}
+BENCHMARK(parallel_copy_strided)->Apply(threads_args)->UseRealTime();
+
+static void parallel_transpose(benchmark::State& state)
+{
+    const long n = 1l << 12;
+    enda::parallel::set_num_threads(state.range(1));
+    enda::array<double, 2> a(n, n), b(n, n);
+    a = 1.0;
+
+    while (state.KeepRunning())
+    {
+        enda::assign(enda::execution::par, b, transpose(a));
+        benchmark::DoNotOptimize(b.data());
+    }
+    state.SetBytesProcessed(state.iterations() * 2 * n * n * sizeof(double));
+}
+BENCHMARK(parallel_transpose)->Apply(threads_args)->UseRealTime();
+
+static void parallel_expression(benchmark::State& state)
+{
+    const long n = state.range(0);
+    enda::parallel::set_num_threads(state.range(1));
+    enda::array<double, 1> a(n), b(n), c(n);
+    a = 1.0;
+    b = 2.0;
+
+    while (state.KeepRunning())
+    {
+        enda::assign(enda::execution::par, c, a + 2 * b);
+        benchmark::DoNotOptimize(c.data());
+    }
+    state.SetBytesProcessed(state.iterations() * 3 * n * sizeof(double));
+}
+BENCHMARK(parallel_expression)->Apply(threads_args)->UseRealTime();
@@ -0,0 +1,94 @@
+#include "./BenchCommon.hpp"
+
+#include <cmath>
+#include <thread>
+
+// parallel_for_each with different schedules as a function of the number of threads (first argument)
+
+using enda::parallel::schedule;
+
+static void threads_args(benchmark::internal::Benchmark* b)
+{
+    const long n_max = std::max(1u, std::thread::hardware_concurrency());
+    for (long n = 1; n <= n_max; n *= 2)
+        b->Arg(n);
+}
+
+static schedule const schedules[] = {schedule::static_chunks(), schedule::dynamic_chunks(), schedule::guided_chunks()};
+
+// uniform work: a(i, j, k) = i + j + k on a shape with a short slowest dimension
+template<int S>
+static void uniform(benchmark::State& state)
+{
+    enda::parallel::set_num_threads(state.range(0));
+    enda::parallel::policy_guard guard {enda::execution::par};
+    enda::array<double, 3>       a(2, 1000, 1000);
+
+    while (state.KeepRunning())
+    {
+        enda::parallel::parallel_for_each(a.shape(), [&a](long i, long j, long k) { a(i, j, k) = double(i + j + k); }, schedules[S]);
+        benchmark::DoNotOptimize(a.data());
+    }
+    state.SetItemsProcessed(state.iterations() * a.size());
+}
+BENCHMARK(uniform<0>)->Apply(threads_args)->UseRealTime();
+BENCHMARK(uniform<1>)->Apply(threads_args)->UseRealTime();
+BENCHMARK(uniform<2>)->Apply(threads_args)->UseRealTime();
+
+// sequential baseline
+static void uniform_for_each(benchmark::State& state)
+{
+    enda::array<double, 3> a(2, 1000, 1000);
+
+    while (state.KeepRunning())
+    {
+        enda::for_each(a.shape(), [&a](long i, long j, long k) { a(i, j, k) = double(i + j + k); });
+        benchmark::DoNotOptimize(a.data());
+    }
+    state.SetItemsProcessed(state.iterations() * a.size());
+}
+BENCHMARK(uniform_for_each)->UseRealTime();
+
+// irregular work: the cost of a row grows with its index (triangular)
+template<int S>
+static void triangular(benchmark::State& state)
+{
+    enda::parallel::set_num_threads(state.range(0));
+    enda::parallel::policy_guard guard {enda::execution::par};
+    const long                   n = 2000;
+    enda::array<double, 1>       a(n);
+
+    while (state.KeepRunning())
+    {
+        enda::parallel::parallel_for_each(
+            a.shape(),
+            [&a](long i) {
+                double s = 0;
+                for (long j = 0; j <= i; ++j)
+                    s += std::sqrt(double(j));
+                a(i) = s;
+            },
+            schedule {schedules[S].kind, 1, 1});
+        benchmark::DoNotOptimize(a.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n * (n + 1) / 2);
+}
+BENCHMARK(triangular<0>)->Apply(threads_args)->UseRealTime();
+BENCHMARK(triangular<1>)->Apply(threads_args)->UseRealTime();
+BENCHMARK(triangular<2>)->Apply(threads_args)->UseRealTime();
+
+// per-thread reduction
+static void reduce_sum(benchmark::State& state)
+{
+    enda::parallel::set_num_threads(state.range(0));
+    enda::parallel::policy_guard guard {enda::execution::par};
+    auto const                   a = enda::array<double, 3>(enda::rand<>(2, 1000, 1000));
+
+    while (state.KeepRunning())
+    {
+        auto s = enda::parallel::parallel_reduce_each(a.shape(), 0.0, [&a](double& acc, long i, long j, long k) { acc += a(i, j, k); }, std::plus<> {});
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetItemsProcessed(state.iterations() * a.size());
+}
+BENCHMARK(reduce_sum)->Apply(threads_args)->UseRealTime();
@@ -0,0 +1,148 @@
+#include "./BenchCommon.hpp"
+
+// ------------------------------- 2d ----------------------------------------
+
+static void naive_transpose2(benchmark::State& state)
+{
+    const long             n = state.range(0);
+    enda::array<double, 2> a(n, n), b(n, n);
+    a = 1.0;
+    auto at = transpose(a);
+
+    while (state.KeepRunning())
+    {
+        enda::for_each(b.shape(), [&b, &at](auto i, auto j) { b(i, j) = at(i, j); });
+        benchmark::DoNotOptimize(b.data());
+    }
+    state.SetBytesProcessed(state.iterations() * 2 * n * n * sizeof(double));
+}
+BENCHMARK(naive_transpose2)->RangeMultiplier(4)->Range(64, 4096);
+
+static void assign_transpose2(benchmark::State& state)
+{
+    const long             n = state.range(0);
+    enda::array<double, 2> a(n, n), b(n, n);
+    a = 1.0;
+
+    while (state.KeepRunning())
+    {
+        b = transpose(a);
+        benchmark::DoNotOptimize(b.data());
+    }
+    state.SetBytesProcessed(state.iterations() * 2 * n * n * sizeof(double));
+}
+BENCHMARK(assign_transpose2)->RangeMultiplier(4)->Range(64, 4096);
+
+static void assign_C_to_F2_complex(benchmark::State& state)
+{
+    const long                                   n = state.range(0);
+    enda::array<std::complex<double>, 2>         a(n, n);
+    enda::array<std::complex<double>, 2, F_layout> b(n, n);
+    a = 1.0;
+
+    while (state.KeepRunning())
+    {
+        b = a;
+        benchmark::DoNotOptimize(b.data());
+    }
+    state.SetBytesProcessed(state.iterations() * 2 * n * n * sizeof(std::complex<double>));
+}
+BENCHMARK(assign_C_to_F2_complex)->RangeMultiplier(4)->Range(64, 4096);
+
+// ------------------------------- 3d ----------------------------------------
+
+static void naive_permuted3(benchmark::State& state)
+{
+    const long             n = state.range(0);
+    enda::array<double, 3> a(n, n, n), b(n, n, n);
+    a      = 1.0;
+    auto p = permuted_indices_view<encode(std::array {2, 0, 1})>(a);
+
+    while (state.KeepRunning())
+    {
+        enda::for_each(b.shape(), [&b, &p](auto i, auto j, auto k) { b(i, j, k) = p(i, j, k); });
+        benchmark::DoNotOptimize(b.data());
+    }
+    state.SetBytesProcessed(state.iterations() * 2 * n * n * n * sizeof(double));
+}
+BENCHMARK(naive_permuted3)->RangeMultiplier(2)->Range(32, 256);
+
+static void assign_permuted3(benchmark::State& state)
+{
+    const long             n = state.range(0);
+    enda::array<double, 3> a(n, n, n), b(n, n, n);
+    a      = 1.0;
+    auto p = permuted_indices_view<encode(std::array {2, 0, 1})>(a);
+
+    while (state.KeepRunning())
+    {
+        b = p;
+        benchmark::DoNotOptimize(b.data());
+    }
+    state.SetBytesProcessed(state.iterations() * 2 * n * n * n * sizeof(double));
+}
+BENCHMARK(assign_permuted3)->RangeMultiplier(2)->Range(32, 256);
+
+// ------------------------------- conjugate transpose ----------------------------------------
+
+static void naive_dagger2(benchmark::State& state)
+{
+    const long             n = state.range(0);
+    enda::matrix<dcomplex> a(n, n), b(n, n);
+    a = dcomplex(1.0, 2.0);
+
+    while (state.KeepRunning())
+    {
+        enda::for_each(b.shape(), [&b, &a](auto i, auto j) { b(i, j) = std::conj(a(j, i)); });
+        benchmark::DoNotOptimize(b.data());
+    }
+    state.SetBytesProcessed(state.iterations() * 2 * n * n * sizeof(dcomplex));
+}
+BENCHMARK(naive_dagger2)->RangeMultiplier(4)->Range(64, 4096);
+
+static void assign_dagger2(benchmark::State& state)
+{
+    const long             n = state.range(0);
+    enda::matrix<dcomplex> a(n, n), b(n, n);
+    a = dcomplex(1.0, 2.0);
+
+    while (state.KeepRunning())
+    {
+        b = dagger(a);
+        benchmark::DoNotOptimize(b.data());
+    }
+    state.SetBytesProcessed(state.iterations() * 2 * n * n * sizeof(dcomplex));
+}
+BENCHMARK(assign_dagger2)->RangeMultiplier(4)->Range(64, 4096);
+
+// ------------------------------- in-place transpose ----------------------------------------
+
+static void transpose_inplace_square(benchmark::State& state)
+{
+    const long           n = state.range(0);
+    enda::matrix<double> a(n, n);
+    a = 1.0;
+
+    while (state.KeepRunning())
+    {
+        enda::transpose_inplace(a);
+        benchmark::DoNotOptimize(a.data());
+    }
+    state.SetBytesProcessed(state.iterations() * 2 * n * n * sizeof(double));
+}
+BENCHMARK(transpose_inplace_square)->RangeMultiplier(4)->Range(64, 4096);
+
+static void transpose_inplace_rectangular(benchmark::State& state)
+{
+    const long           n = state.range(0);
+    enda::matrix<double> a(n, 2 * n + 1);
+    a = 1.0;
+
+    while (state.KeepRunning())
+    {
+        enda::transpose_inplace(a);
+        benchmark::DoNotOptimize(a.data());
+    }
+    state.SetBytesProcessed(state.iterations() * 2 * n * (2 * n + 1) * sizeof(double));
+}
+BENCHMARK(transpose_inplace_rectangular)->RangeMultiplier(4)->Range(64, 1024);
@@ -0,0 +1,216 @@
+#include "./BenchCommon.hpp"
+
+// ------------------------------- sum ----------------------------------------
+
+static void sum_fold(benchmark::State& state)
+{
+    const long             n = state.range(0);
+    enda::array<double, 1> a(n);
+    a = 1.0;
+
+    while (state.KeepRunning())
+    {
+        auto s = enda::fold(std::plus<> {}, a);
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetBytesProcessed(state.iterations() * n * sizeof(double));
+}
+BENCHMARK(sum_fold)->RangeMultiplier(8)->Range(1 << 10, 1 << 25);
+
+static void sum_standard(benchmark::State& state)
+{
+    const long             n = state.range(0);
+    enda::array<double, 1> a(n);
+    a = 1.0;
+
+    while (state.KeepRunning())
+    {
+        auto s = enda::sum(a);
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetBytesProcessed(state.iterations() * n * sizeof(double));
+}
+BENCHMARK(sum_standard)->RangeMultiplier(8)->Range(1 << 10, 1 << 25);
+
+static void sum_pairwise(benchmark::State& state)
+{
+    const long             n = state.range(0);
+    enda::array<double, 1> a(n);
+    a = 1.0;
+
+    while (state.KeepRunning())
+    {
+        auto s = enda::sum(a, enda::summation::pairwise);
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetBytesProcessed(state.iterations() * n * sizeof(double));
+}
+BENCHMARK(sum_pairwise)->RangeMultiplier(8)->Range(1 << 10, 1 << 25);
+
+static void sum_kahan(benchmark::State& state)
+{
+    const long             n = state.range(0);
+    enda::array<double, 1> a(n);
+    a = 1.0;
+
+    while (state.KeepRunning())
+    {
+        auto s = enda::sum(a, enda::summation::kahan);
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetBytesProcessed(state.iterations() * n * sizeof(double));
+}
+BENCHMARK(sum_kahan)->RangeMultiplier(8)->Range(1 << 10, 1 << 25);
+
+// ------------------------------- strided views ----------------------------------------
+
+static void sum_fold_view(benchmark::State& state)
+{
+    const long             n = state.range(0);
+    enda::array<double, 2> a(n, n + 3);
+    a       = 1.0;
+    auto va = a(_, range(0, n));
+
+    while (state.KeepRunning())
+    {
+        auto s = enda::fold(std::plus<> {}, va);
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetBytesProcessed(state.iterations() * n * n * sizeof(double));
+}
+BENCHMARK(sum_fold_view)->RangeMultiplier(4)->Range(64, 4096);
+
+static void sum_view(benchmark::State& state)
+{
+    const long             n = state.range(0);
+    enda::array<double, 2> a(n, n + 3);
+    a       = 1.0;
+    auto va = a(_, range(0, n));
+
+    while (state.KeepRunning())
+    {
+        auto s = enda::sum(va);
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetBytesProcessed(state.iterations() * n * n * sizeof(double));
+}
+BENCHMARK(sum_view)->RangeMultiplier(4)->Range(64, 4096);
+
+// ------------------------------- max / norm ----------------------------------------
+
+static void max_fold(benchmark::State& state)
+{
+    const long             n = state.range(0);
+    enda::array<double, 1> a(n);
+    a = 1.0;
+
+    while (state.KeepRunning())
+    {
+        auto s = enda::fold([](double r, double x) { return std::max(r, x); }, a, a(0));
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetBytesProcessed(state.iterations() * n * sizeof(double));
+}
+BENCHMARK(max_fold)->RangeMultiplier(8)->Range(1 << 10, 1 << 25);
+
+static void max_element(benchmark::State& state)
+{
+    const long             n = state.range(0);
+    enda::array<double, 1> a(n);
+    a = 1.0;
+
+    while (state.KeepRunning())
+    {
+        auto s = enda::max_element(a);
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetBytesProcessed(state.iterations() * n * sizeof(double));
+}
+BENCHMARK(max_element)->RangeMultiplier(8)->Range(1 << 10, 1 << 25);
+
+static void frobenius_norm_complex(benchmark::State& state)
+{
+    const long               n = state.range(0);
+    enda::array<dcomplex, 2> a(n, n);
+    a = dcomplex(1.0, 2.0);
+
+    while (state.KeepRunning())
+    {
+        auto s = enda::frobenius_norm(a);
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetBytesProcessed(state.iterations() * n * n * sizeof(dcomplex));
+}
+BENCHMARK(frobenius_norm_complex)->RangeMultiplier(4)->Range(64, 4096);
+
+// ------------------------------- axis reductions ----------------------------------------
+
+static void sum_axis_loops(benchmark::State& state)
+{
+    const long             n = state.range(0);
+    enda::array<double, 2> a(n, n);
+    a = 1.0;
+    enda::array<double, 1> r(n);
+
+    // naive loop over the kept dimension (reduces along the slow dimension, i.e. against memory order)
+    while (state.KeepRunning())
+    {
+        for (long j = 0; j < n; ++j)
+        {
+            double s = 0;
+            for (long i = 0; i < n; ++i)
+                s += a(i, j);
+            r(j) = s;
+        }
+        benchmark::DoNotOptimize(r.data());
+    }
+    state.SetBytesProcessed(state.iterations() * n * n * sizeof(double));
+}
+BENCHMARK(sum_axis_loops)->RangeMultiplier(4)->Range(64, 4096);
+
+static void sum_axis_slow(benchmark::State& state)
+{
+    const long             n = state.range(0);
+    enda::array<double, 2> a(n, n);
+    a = 1.0;
+
+    // vertical kernel: rows are accumulated into the result
+    while (state.KeepRunning())
+    {
+        auto r = enda::sum<0>(a);
+        benchmark::DoNotOptimize(r.data());
+    }
+    state.SetBytesProcessed(state.iterations() * n * n * sizeof(double));
+}
+BENCHMARK(sum_axis_slow)->RangeMultiplier(4)->Range(64, 4096);
+
+static void sum_axis_fast(benchmark::State& state)
+{
+    const long             n = state.range(0);
+    enda::array<double, 2> a(n, n);
+    a = 1.0;
+
+    // horizontal kernel: each contiguous row is reduced to a single element
+    while (state.KeepRunning())
+    {
+        auto r = enda::sum<1>(a);
+        benchmark::DoNotOptimize(r.data());
+    }
+    state.SetBytesProcessed(state.iterations() * n * n * sizeof(double));
+}
+BENCHMARK(sum_axis_fast)->RangeMultiplier(4)->Range(64, 4096);
+
+static void max_axis_rank4(benchmark::State& state)
+{
+    const long             n = state.range(0);
+    enda::array<double, 4> a(n, n, n, n);
+    a = 1.0;
+
+    while (state.KeepRunning())
+    {
+        auto r = enda::max_element<1>(a);
+        benchmark::DoNotOptimize(r.data());
+    }
+    state.SetBytesProcessed(state.iterations() * n * n * n * n * sizeof(double));
+}
+BENCHMARK(max_axis_rank4)->RangeMultiplier(2)->Range(8, 64);
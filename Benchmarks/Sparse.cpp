@@ -0,0 +1,97 @@
+#include "./BenchCommon.hpp"
+
+#include <random>
+
+// n x n banded matrix with 2 * w + 1 diagonals
+static enda::coo_matrix<double> make_banded(long n, long w)
+{
+    auto coo = enda::coo_matrix<double>(n, n);
+    coo.reserve(n * (2 * w + 1));
+    for (long i = 0; i < n; ++i)
+        for (long j = std::max(0l, i - w); j < std::min(n, i + w + 1); ++j)
+            coo.push_back(i, j, 1.0 / (1 + i + j));
+    return coo;
+}
+
+// n x n matrix with (on average) nnz_per_row non-zeros per row at random positions
+static enda::coo_matrix<double> make_random(long n, long nnz_per_row)
+{
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<long> dist(0, n - 1);
+    auto coo = enda::coo_matrix<double>(n, n);
+    coo.reserve(n * nnz_per_row);
+    for (long k = 0; k < n * nnz_per_row; ++k)
+        coo.push_back(dist(gen), dist(gen), 1.0 / (1 + k % 7));
+    return coo;
+}
+
+static enda::coo_matrix<double> make_matrix(benchmark::State const& state)
+{
+    return (state.range(1) == 0 ? make_banded(state.range(0), 8) : make_random(state.range(0), 17));
+}
+
+// SpMV y = A x with a CSR, CSC or COO matrix (range(1) == 0: banded, otherwise random)
+template<typename S>
+static void spmv(benchmark::State& state)
+{
+    auto const coo = make_matrix(state);
+    auto const a   = S(coo);
+    auto x         = enda::vector<double>(enda::array<double, 1>::rand(coo.extent(1)));
+    auto y         = enda::vector<double>(coo.extent(0));
+    while (state.KeepRunning())
+    {
+        enda::linalg::spmv(1.0, a, x, 0.0, y);
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations() * coo.nnz());
+}
+BENCHMARK(spmv<enda::csr_matrix<double>>)->Args({1 << 14, 0})->Args({1 << 14, 1})->Args({1 << 20, 0})->Args({1 << 20, 1});
+BENCHMARK(spmv<enda::csc_matrix<double>>)->Args({1 << 14, 0})->Args({1 << 14, 1})->Args({1 << 20, 0})->Args({1 << 20, 1});
+BENCHMARK(spmv<enda::coo_matrix<double>>)->Args({1 << 14, 0})->Args({1 << 14, 1})->Args({1 << 20, 0})->Args({1 << 20, 1});
+
+// Dense matrix-vector product of the same (banded) matrix for comparison
+static void spmv_dense(benchmark::State& state)
+{
+    auto const d = make_banded(state.range(0), 8).to_dense();
+    auto x       = enda::vector<double>(enda::array<double, 1>::rand(d.extent(1)));
+    auto y       = enda::vector<double>(d.extent(0));
+    while (state.KeepRunning())
+    {
+        enda::linalg::gemv(1.0, d, x, 0.0, y);
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations() * d.size());
+}
+BENCHMARK(spmv_dense)->Arg(1 << 12);
+
+// SpMM C = A B with a CSR matrix and 32 right hand sides in C or Fortran layout
+template<typename Layout>
+static void spmm(benchmark::State& state)
+{
+    auto const coo = make_matrix(state);
+    auto const a   = enda::csr_matrix<double>(coo);
+    long const k   = 32;
+    auto b         = enda::matrix<double, Layout>(enda::array<double, 2>::rand(coo.extent(1), k));
+    auto c         = enda::matrix<double, Layout>(coo.extent(0), k);
+    while (state.KeepRunning())
+    {
+        enda::linalg::spmm(1.0, a, b, 0.0, c);
+        benchmark::DoNotOptimize(c.data());
+    }
+    state.SetItemsProcessed(state.iterations() * coo.nnz() * k);
+}
+BENCHMARK(spmm<enda::C_layout>)->Args({1 << 14, 0})->Args({1 << 14, 1})->Args({1 << 18, 0})->Args({1 << 18, 1});
+BENCHMARK(spmm<enda::F_layout>)->Args({1 << 14, 0})->Args({1 << 14, 1})->Args({1 << 18, 0})->Args({1 << 18, 1});
+
+// Construction of a CSR matrix from (unsorted) triplets
+static void build_csr(benchmark::State& state)
+{
+    auto const coo = make_matrix(state);
+    while (state.KeepRunning())
+    {
+        auto a = enda::csr_matrix<double>(coo);
+        benchmark::DoNotOptimize(a.values().data());
+    }
+    state.SetItemsProcessed(state.iterations() * coo.nnz());
+}
+BENCHMARK(build_csr)->Args({1 << 14, 0})->Args({1 << 14, 1})->Args({1 << 20, 1});
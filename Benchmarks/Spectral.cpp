@@ -0,0 +1,74 @@
+#include "./BenchCommon.hpp"
+
+// Random Hermitian n x n matrix.
+template<typename T>
+static auto random_hermitian_matrix(long n)
+{
+    auto b = enda::matrix<T>(enda::array<T, 2>::rand(n, n));
+    return enda::matrix<T>(b + enda::dagger(b));
+}
+
+// ------------------------------- Hermitian eigenproblems ----------------------------------------
+
+template<typename T>
+static void eigh(benchmark::State& state)
+{
+    const long n = state.range(0);
+    auto const a = random_hermitian_matrix<T>(n);
+
+    while (state.KeepRunning())
+    {
+        auto [w, v] = enda::linalg::eigh(a);
+        benchmark::DoNotOptimize(v.data());
+    }
+}
+BENCHMARK(eigh<double>)->RangeMultiplier(4)->Range(16, 1024)->Unit(benchmark::kMicrosecond);
+BENCHMARK(eigh<dcomplex>)->RangeMultiplier(4)->Range(16, 1024)->Unit(benchmark::kMicrosecond);
+
+static void eigvalsh(benchmark::State& state)
+{
+    const long n = state.range(0);
+    auto const a = random_hermitian_matrix<double>(n);
+
+    while (state.KeepRunning())
+    {
+        auto w = enda::linalg::eigvalsh(a);
+        benchmark::DoNotOptimize(w.data());
+    }
+}
+BENCHMARK(eigvalsh)->RangeMultiplier(4)->Range(16, 1024)->Unit(benchmark::kMicrosecond);
+
+// ------------------------------- singular value decompositions ----------------------------------------
+
+template<typename T>
+static void svd(benchmark::State& state)
+{
+    const long n = state.range(0);
+    auto const a = enda::matrix<T>(enda::array<T, 2>::rand(2 * n, n));
+
+    while (state.KeepRunning())
+    {
+        auto [u, s, vh] = enda::linalg::svd(a);
+        benchmark::DoNotOptimize(u.data());
+    }
+}
+BENCHMARK(svd<double>)->RangeMultiplier(4)->Range(16, 256)->Unit(benchmark::kMicrosecond);
+BENCHMARK(svd<dcomplex>)->RangeMultiplier(4)->Range(16, 256)->Unit(benchmark::kMicrosecond);
+
+// ------------------------------- stacks of small problems ----------------------------------------
+
+static void batched_eigh(benchmark::State& state)
+{
+    const long n = state.range(0), batch = 1024;
+    auto       a = enda::array<double, 3>(batch, n, n);
+    for (long k = 0; k < batch; ++k)
+        a(k, _, _) = random_hermitian_matrix<double>(n);
+
+    while (state.KeepRunning())
+    {
+        auto [w, v] = enda::linalg::eigh(a);
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK(batched_eigh)->RangeMultiplier(2)->Range(4, 16)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,152 @@
+#include "./BenchCommon.hpp"
+
+static constexpr int N = 3;
+
+// ------------------------------- matrix * matrix ----------------------------------------
+
+static void matmul_hand_written(benchmark::State& state)
+{
+    double a[N][N], b[N][N], c[N][N];
+    for (int i = 0; i < N; ++i)
+        for (int j = 0; j < N; ++j)
+        {
+            a[i][j] = i + j;
+            b[i][j] = i - j;
+        }
+
+    while (state.KeepRunning())
+    {
+        benchmark::DoNotOptimize(a);
+        for (int i = 0; i < N; ++i)
+            for (int j = 0; j < N; ++j)
+            {
+                double s = 0;
+                for (int k = 0; k < N; ++k)
+                    s += a[i][k] * b[k][j];
+                c[i][j] = s;
+            }
+        benchmark::DoNotOptimize(c);
+    }
+}
+BENCHMARK(matmul_hand_written);
+
+static void matmul_stack(benchmark::State& state)
+{
+    enda::stack_matrix<double, N, N> a, b;
+    for (int i = 0; i < N; ++i)
+        for (int j = 0; j < N; ++j)
+        {
+            a(i, j) = i + j;
+            b(i, j) = i - j;
+        }
+
+    while (state.KeepRunning())
+    {
+        benchmark::DoNotOptimize(a.data());
+        auto c = a * b;
+        benchmark::DoNotOptimize(c.data());
+    }
+}
+BENCHMARK(matmul_stack);
+
+static void matmul_heap(benchmark::State& state)
+{
+    enda::matrix<double> a(N, N), b(N, N);
+    for (int i = 0; i < N; ++i)
+        for (int j = 0; j < N; ++j)
+        {
+            a(i, j) = i + j;
+            b(i, j) = i - j;
+        }
+
+    while (state.KeepRunning())
+    {
+        auto c = enda::matrix<double>(a * b);
+        benchmark::DoNotOptimize(c.data());
+    }
+}
+BENCHMARK(matmul_heap);
+
+// ------------------------------- inverse ----------------------------------------
+
+static void inverse_stack(benchmark::State& state)
+{
+    enda::stack_matrix<double, N, N> a;
+    a = 4.0;
+    for (int i = 0; i < N; ++i)
+        for (int j = 0; j < N; ++j)
+            a(i, j) += i - j;
+
+    while (state.KeepRunning())
+    {
+        benchmark::DoNotOptimize(a.data());
+        auto inv = enda::inverse(a);
+        benchmark::DoNotOptimize(inv.data());
+    }
+}
+BENCHMARK(inverse_stack);
+
+static void inverse_heap(benchmark::State& state)
+{
+    enda::matrix<double> a(N, N);
+    a = 4.0;
+    for (int i = 0; i < N; ++i)
+        for (int j = 0; j < N; ++j)
+            a(i, j) += i - j;
+
+    while (state.KeepRunning())
+    {
+        auto inv = enda::inverse(a);
+        benchmark::DoNotOptimize(inv.data());
+    }
+}
+BENCHMARK(inverse_heap);
+
+// ------------------------------- arithmetic, trace and identity ----------------------------------------
+
+static void axpy_hand_written(benchmark::State& state)
+{
+    double a[N][N], b[N][N];
+    for (int i = 0; i < N; ++i)
+        for (int j = 0; j < N; ++j)
+            a[i][j] = b[i][j] = i + j;
+
+    while (state.KeepRunning())
+    {
+        benchmark::DoNotOptimize(a);
+        for (int i = 0; i < N; ++i)
+            for (int j = 0; j < N; ++j)
+                b[i][j] = 2 * a[i][j] + b[i][j];
+        double t = 0;
+        for (int i = 0; i < N; ++i)
+            t += b[i][i];
+        benchmark::DoNotOptimize(t);
+    }
+}
+BENCHMARK(axpy_hand_written);
+
+static void axpy_stack(benchmark::State& state)
+{
+    enda::stack_matrix<double, N, N> a, b;
+    for (int i = 0; i < N; ++i)
+        for (int j = 0; j < N; ++j)
+            a(i, j) = b(i, j) = i + j;
+
+    while (state.KeepRunning())
+    {
+        benchmark::DoNotOptimize(a.data());
+        b = 2 * a + b;
+        benchmark::DoNotOptimize(enda::trace(b));
+    }
+}
+BENCHMARK(axpy_stack);
+
+static void eye_stack(benchmark::State& state)
+{
+    while (state.KeepRunning())
+    {
+        auto id = enda::eye<double, N>();
+        benchmark::DoNotOptimize(id.data());
+    }
+}
+BENCHMARK(eye_stack);
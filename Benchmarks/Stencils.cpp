@@ -0,0 +1,112 @@
+#include "./BenchCommon.hpp"
+
+// 5-point stencil in 2D on the interior of an n x n array
+template<typename A, typename B>
+FORCEINLINE void stencil5(A const& a, B& b, long i, long j)
+{
+    b(i, j) = a(i - 1, j) + a(i + 1, j) + a(i, j - 1) + a(i, j + 1) - 4 * a(i, j);
+}
+
+// 27-point stencil in 3D on the interior of an n x n x n array
+template<typename A, typename B>
+FORCEINLINE void stencil27(A const& a, B& b, long i, long j, long k)
+{
+    double s = 0;
+    for (long di = -1; di <= 1; ++di)
+        for (long dj = -1; dj <= 1; ++dj)
+            for (long dk = -1; dk <= 1; ++dk)
+                s += a(i + di, j + dj, k + dk);
+    b(i, j, k) = s / 27;
+}
+
+// Untiled traversal with for_each
+static void stencil5_for_each(benchmark::State& state)
+{
+    long const             n = state.range(0);
+    enda::array<double, 2> a = enda::rand<double>(n, n), b(n, n);
+    while (state.KeepRunning())
+    {
+        enda::for_each(std::array {n - 2, n - 2}, [&](long i, long j) { stencil5(a, b, i + 1, j + 1); });
+        benchmark::DoNotOptimize(b.data());
+    }
+    state.SetItemsProcessed(state.iterations() * (n - 2) * (n - 2));
+}
+BENCHMARK(stencil5_for_each)->Arg(256)->Arg(2048)->Arg(4096);
+
+// Tiled traversal with the default tile shape
+static void stencil5_for_each_tile(benchmark::State& state)
+{
+    long const             n = state.range(0);
+    enda::array<double, 2> a = enda::rand<double>(n, n), b(n, n);
+    while (state.KeepRunning())
+    {
+        enda::for_each_tile(std::array {n - 2, n - 2}, [&](long i, long j) { stencil5(a, b, i + 1, j + 1); });
+        benchmark::DoNotOptimize(b.data());
+    }
+    state.SetItemsProcessed(state.iterations() * (n - 2) * (n - 2));
+}
+BENCHMARK(stencil5_for_each_tile)->Arg(256)->Arg(2048)->Arg(4096);
+
+// Tiled traversal with the default tile shape in Z-order
+static void stencil5_for_each_tile_morton(benchmark::State& state)
+{
+    long const             n = state.range(0);
+    enda::array<double, 2> a = enda::rand<double>(n, n), b(n, n);
+    while (state.KeepRunning())
+    {
+        enda::for_each_tile(std::array {n - 2, n - 2}, [&](long i, long j) { stencil5(a, b, i + 1, j + 1); }, enda::tile_order::morton);
+        benchmark::DoNotOptimize(b.data());
+    }
+    state.SetItemsProcessed(state.iterations() * (n - 2) * (n - 2));
+}
+BENCHMARK(stencil5_for_each_tile_morton)->Arg(256)->Arg(2048)->Arg(4096);
+
+// Untiled traversal with for_each
+static void stencil27_for_each(benchmark::State& state)
+{
+    long const             n = state.range(0);
+    enda::array<double, 3> a = enda::rand<double>(n, n, n), b(n, n, n);
+    while (state.KeepRunning())
+    {
+        enda::for_each(std::array {n - 2, n - 2, n - 2}, [&](long i, long j, long k) { stencil27(a, b, i + 1, j + 1, k + 1); });
+        benchmark::DoNotOptimize(b.data());
+    }
+    state.SetItemsProcessed(state.iterations() * (n - 2) * (n - 2) * (n - 2));
+}
+BENCHMARK(stencil27_for_each)->Arg(64)->Arg(256);
+
+// Tiled traversal with the default tile shape
+static void stencil27_for_each_tile(benchmark::State& state)
+{
+    long const             n = state.range(0);
+    enda::array<double, 3> a = enda::rand<double>(n, n, n), b(n, n, n);
+    while (state.KeepRunning())
+    {
+        enda::for_each_tile(std::array {n - 2, n - 2, n - 2}, [&](long i, long j, long k) { stencil27(a, b, i + 1, j + 1, k + 1); });
+        benchmark::DoNotOptimize(b.data());
+    }
+    state.SetItemsProcessed(state.iterations() * (n - 2) * (n - 2) * (n - 2));
+}
+BENCHMARK(stencil27_for_each_tile)->Arg(64)->Arg(256);
+
+// Tiled traversal over the sub-views returned by tiles() in Z-order
+static void stencil27_tiles_morton(benchmark::State& state)
+{
+    long const             n = state.range(0);
+    enda::array<double, 3> a = enda::rand<double>(n, n, n), b(n, n, n);
+    auto                   r = enda::range(1, n - 1);
+    auto                   tr = enda::tiles(b(r, r, r), enda::tile_order::morton);
+    while (state.KeepRunning())
+    {
+        for (long t = 0; t < tr.size(); ++t)
+        {
+            auto [r0, r1, r2] = tr.ranges(t);
+            auto bt           = tr[t];
+            auto at           = a(enda::range(r0.first(), r0.last() + 2), enda::range(r1.first(), r1.last() + 2), enda::range(r2.first(), r2.last() + 2));
+            enda::for_each(bt.shape(), [&](long i, long j, long k) { stencil27(at, bt, i + 1, j + 1, k + 1); });
+        }
+        benchmark::DoNotOptimize(b.data());
+    }
+    state.SetItemsProcessed(state.iterations() * (n - 2) * (n - 2) * (n - 2));
+}
+BENCHMARK(stencil27_tiles_morton)->Arg(64)->Arg(256);
@@ -0,0 +1,121 @@
+#include "./BenchCommon.hpp"
+
+#include <random>
+
+// Random linear indices of the elements of a n x n x n array (or of a strided view into it)
+template<typename M>
+static std::vector<long> random_linear_indices(M const& m, long count)
+{
+    std::mt19937                        gen(42);
+    std::uniform_int_distribution<long> dist(0, m.size() - 1);
+    std::vector<long>                   lin(count);
+    for (auto& f : lin)
+    {
+        auto const a = dist(gen);
+        f            = m(a / (m.lengths()[1] * m.lengths()[2]), (a / m.lengths()[2]) % m.lengths()[1], a % m.lengths()[2]);
+    }
+    return lin;
+}
+
+const long count = 1 << 16;
+
+// One call to to_idx (hardware division) per linear index
+static void to_idx_div(benchmark::State& state)
+{
+    enda::array<double, 3> a(state.range(0), state.range(0), state.range(0));
+    auto const&            m   = a.indexmap();
+    auto const             lin = random_linear_indices(m, count);
+    std::vector<std::array<long, 3>> idx(count);
+    while (state.KeepRunning())
+    {
+        for (long n = 0; n < count; ++n)
+            idx[n] = m.to_idx(lin[n]);
+        benchmark::DoNotOptimize(idx.data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(to_idx_div)->Arg(10)->Arg(100);
+
+// Batched to_idx (precomputed reciprocals)
+static void to_idx_batched(benchmark::State& state)
+{
+    enda::array<double, 3> a(state.range(0), state.range(0), state.range(0));
+    auto const&            m   = a.indexmap();
+    auto const             lin = random_linear_indices(m, count);
+    std::vector<std::array<long, 3>> idx(count);
+    while (state.KeepRunning())
+    {
+        m.to_idx(lin, idx);
+        benchmark::DoNotOptimize(idx.data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(to_idx_batched)->Arg(10)->Arg(100);
+
+// Same as above for a strided view
+static void to_idx_div_strided(benchmark::State& state)
+{
+    enda::array<double, 3> a(state.range(0), state.range(0), 2 * state.range(0));
+    auto const             m   = a(_, _, enda::range(0, 2 * state.range(0), 2)).indexmap();
+    auto const             lin = random_linear_indices(m, count);
+    std::vector<std::array<long, 3>> idx(count);
+    while (state.KeepRunning())
+    {
+        for (long n = 0; n < count; ++n)
+            idx[n] = m.to_idx(lin[n]);
+        benchmark::DoNotOptimize(idx.data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(to_idx_div_strided)->Arg(100);
+
+static void to_idx_batched_strided(benchmark::State& state)
+{
+    enda::array<double, 3> a(state.range(0), state.range(0), 2 * state.range(0));
+    auto const             m   = a(_, _, enda::range(0, 2 * state.range(0), 2)).indexmap();
+    auto const             lin = random_linear_indices(m, count);
+    std::vector<std::array<long, 3>> idx(count);
+    while (state.KeepRunning())
+    {
+        m.to_idx(lin, idx);
+        benchmark::DoNotOptimize(idx.data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(to_idx_batched_strided)->Arg(100);
+
+// Consecutive indices: to_idx for every element vs. the incremental next_idx
+static void to_idx_sequential(benchmark::State& state)
+{
+    enda::array<double, 3> a(state.range(0), state.range(0), state.range(0));
+    auto const&            m = a.indexmap();
+    long                   s = 0;
+    while (state.KeepRunning())
+    {
+        for (long f = 0; f < m.size(); ++f)
+        {
+            auto idx = m.to_idx(f);
+            s += idx[0] + idx[1] + idx[2];
+        }
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetItemsProcessed(state.iterations() * m.size());
+}
+BENCHMARK(to_idx_sequential)->Arg(100);
+
+static void next_idx_sequential(benchmark::State& state)
+{
+    enda::array<double, 3> a(state.range(0), state.range(0), state.range(0));
+    auto const&            m = a.indexmap();
+    long                   s = 0;
+    while (state.KeepRunning())
+    {
+        std::array<long, 3> idx {0, 0, 0};
+        do {
+            s += idx[0] + idx[1] + idx[2];
+        } while (m.next_idx(idx));
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetItemsProcessed(state.iterations() * m.size());
+}
+BENCHMARK(next_idx_sequential)->Arg(100);
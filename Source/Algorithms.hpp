@@ -7,24 +7,256 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
 #include <cmath>
+#include <complex>
+#include <cstdint>
 #include <cstdlib>
 #include <functional>
+#include <limits>
+#include <optional>
 #include <type_traits>
 #include <utility>
 
 #include "Concepts.hpp"
+#include "Declarations.hpp"
+#include "Layout/Collapse.hpp"
 #include "Layout/ForEach.hpp"
+#include "Macros.hpp"
+#include "Map.hpp"
+#include "Mem/AddressSpace.hpp"
+#include "Parallel/Execution.hpp"
 #include "Traits.hpp"
 
 namespace enda
 {
+    /// Summation algorithms available in enda::sum.
+    enum class summation
+    {
+        /// Blocked summation with several independent accumulators (default).
+        standard,
+        /// Pairwise (cascade) summation of contiguous blocks, the rounding error grows as O(log n).
+        pairwise,
+        /// Compensated Kahan-Babuska (Neumaier) summation, the rounding error is independent of n.
+        kahan
+    };
+
+    namespace detail
+    {
+        // Number of independent accumulators used by the reduction kernels (a power of two).
+        template<typename R>
+        constexpr long n_accumulators = static_cast<long>(std::bit_floor(static_cast<size_t>(std::clamp<long>(64 / static_cast<long>(sizeof(R)), 4, 16))));
+
+        // Reduce a 1-dimensional run p[0], p[s], ..., p[(n - 1) * s] using several independent accumulators.
+        template<typename R, typename T, typename Acc, typename Comb>
+        R reduce_run(T* p, long s, long n, R const& id, Acc const& acc, Comb const& comb)
+        {
+            constexpr long   K = n_accumulators<R>;
+            std::array<R, K> r;
+            r.fill(id);
+            long i = 0;
+            if (s == 1)
+            {
+                for (; i + K <= n; i += K)
+                    for (long k = 0; k < K; ++k)
+                        r[k] = acc(r[k], p[i + k]);
+                for (; i < n; ++i)
+                    r[0] = acc(r[0], p[i]);
+            }
+            else
+            {
+                for (; i + K <= n; i += K)
+                    for (long k = 0; k < K; ++k)
+                        r[k] = acc(r[k], p[(i + k) * s]);
+                for (; i < n; ++i)
+                    r[0] = acc(r[0], p[i * s]);
+            }
+
+            // horizontal reduction of the accumulators
+            for (long w = K / 2; w > 0; w /= 2)
+                for (long k = 0; k < w; ++k)
+                    r[k] = comb(r[k], r[k + w]);
+            return r[0];
+        }
+
+        // Reduce a 1-dimensional run by recursively splitting it in halves (pairwise reduction).
+        template<typename R, typename T, typename Acc, typename Comb>
+        R pairwise_run(T* p, long s, long n, R const& id, Acc const& acc, Comb const& comb)
+        {
+            constexpr long block = 256;
+            if (n <= block)
+                return reduce_run(p, s, n, id, acc, comb);
+            const long h = n / 2;
+            return comb(pairwise_run(p, s, h, id, acc, comb), pairwise_run(p + h * s, s, n - h, id, acc, comb));
+        }
+
+        /**
+         * @brief Reduce all elements of an array with an associative operation.
+         *
+         * @details In contrast to enda::fold, the elements are not accumulated strictly from left to right:
+         * - For arrays/views in host memory, the layout is collapsed (see enda::detail::collapse_dims) and the runs are
+         * reduced with several independent accumulators (see enda::detail::reduce_run) which are finally combined.
+         * - For other arrays, the elements are accumulated in memory order (see enda::detail::traversal_order).
+         *
+         * In both cases, large arrays are split into chunks along their slowest dimension which are reduced in parallel
+         * (see enda::parallel::reduce_chunks).
+         *
+         * @tparam Pairwise Use enda::detail::pairwise_run for the runs in memory.
+         * @tparam A enda::Array type.
+         * @tparam R Result type.
+         * @tparam Acc Callable type to accumulate an element: `R acc(R, element)`.
+         * @tparam Comb Callable type to combine two partial results: `R comb(R, R)`.
+         * @param a Array to be reduced.
+         * @param id Identity element of `comb` (it might be used several times).
+         * @param acc Callable object accumulating an element.
+         * @param comb Callable object combining two partial results.
+         * @return Result of the reduction.
+         */
+        template<bool Pairwise = false, Array A, typename R, typename Acc, typename Comb>
+        R reduce(A const& a, R const& id, Acc const& acc, Comb const& comb)
+        {
+            if constexpr (MemoryArray<A> and mem::on_host<A>)
+            {
+                if (a.empty())
+                    return id;
+                auto cl = collapse_dims(a.indexmap().lengths(), a.indexmap().strides(), a.indexmap().stride_order);
+                return parallel::reduce_collapsed_chunks(
+                    cl,
+                    id,
+                    [&](auto const& sub, auto const& off) {
+                        R          r = id;
+                        auto*      p = a.data() + off[0];
+                        const long n = sub.inner_size(), s = sub.inner_stride(0);
+                        for_each_inner_run(sub, [&](auto const& o) {
+                            if constexpr (Pairwise)
+                                r = comb(r, pairwise_run(p + o[0], s, n, id, acc, comb));
+                            else
+                                r = comb(r, reduce_run(p + o[0], s, n, id, acc, comb));
+                        });
+                        return r;
+                    },
+                    comb);
+            }
+            else
+            {
+                // accumulate in memory order within chunks of the slowest dimension
+                static constexpr uint64_t order = traversal_order<A>;
+                static constexpr int      rank  = get_rank<A>;
+                static constexpr int      j     = index_from_stride_order<rank>(order, 0);
+                auto const                shape = a.shape();
+                long                      size  = 1;
+                for (auto l : shape)
+                    size *= l;
+                if (size == 0)
+                    return id;
+
+                auto chunk = [&](long begin, long end) {
+                    R    r   = id;
+                    auto sub = shape;
+                    sub[j]   = end - begin;
+                    for_each_ordered<order>(sub, [&](auto... args) {
+                        auto idx = std::array<long, rank> {args...};
+                        idx[j] += begin;
+                        r = acc(r, std::apply(a, idx));
+                    });
+                    return r;
+                };
+                if (!parallel::use_parallel(size))
+                    return chunk(0, shape[j]);
+                return parallel::reduce_chunks(shape[j], id, chunk, comb);
+            }
+        }
+
+        // Partial sum with a running compensation of the lost low-order bits (the exact sum is approximately s + c).
+        template<typename T>
+        struct kahan_acc
+        {
+            T s {};
+            T c {};
+        };
+
+        // Magnitude used to compare two summands in the Kahan-Babuska algorithm.
+        template<typename T>
+        FORCEINLINE auto kahan_magnitude(T const& x)
+        {
+            if constexpr (is_complex_v<T>)
+                return std::norm(x);
+            else
+                return std::abs(x);
+        }
+
+        // Add a value to a Kahan-Babuska (Neumaier) accumulator.
+        template<typename T, typename X>
+        FORCEINLINE kahan_acc<T> kahan_add(kahan_acc<T> k, X const& x)
+        {
+            const T t = k.s + x;
+            if (kahan_magnitude(k.s) >= kahan_magnitude(T(x)))
+                k.c += (k.s - t) + x;
+            else
+                k.c += (x - t) + k.s;
+            k.s = t;
+            return k;
+        }
+
+        // Combine two Kahan-Babuska (Neumaier) accumulators.
+        template<typename T>
+        FORCEINLINE kahan_acc<T> kahan_combine(kahan_acc<T> k1, kahan_acc<T> const& k2)
+        {
+            k1 = kahan_add(k1, k2.s);
+            k1.c += k2.c;
+            return k1;
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Left fold of all elements of an array.
+     *
+     * @details Computes `f(...f(f(r, a_0), a_1)..., a_{n-1})`, where the elements are visited in memory order. The
+     * elements are accumulated strictly sequentially, so that `f` does not need to be associative. For associative
+     * operations, the reductions below (enda::sum, enda::max_element, ...) are vectorized and run in parallel for large
+     * arrays.
+     *
+     * @tparam A enda::Array type.
+     * @tparam F Callable type.
+     * @tparam R Type of the initial value.
+     * @param f Callable object.
+     * @param a Array to be folded.
+     * @param r Initial value.
+     * @return Result of the fold.
+     */
     template<Array A, typename F, typename R>
     auto fold(F f, A const& a, R r)
     {
         // cast the initial value to the return type of f to avoid narrowing
         decltype(f(r, get_value_t<A> {})) r2 = r;
-        enda::for_each(a.shape(), [&a, &r2, &f](auto&&... args) { r2 = f(r2, a(args...)); });
+        if constexpr (MemoryArray<A> and mem::on_host<A>)
+        {
+            // merge adjacent dimensions and accumulate over the remaining runs in memory order
+            if (a.empty())
+                return r2;
+            auto cl      = detail::collapse_dims(a.indexmap().lengths(), a.indexmap().strides(), a.indexmap().stride_order);
+            auto* p      = a.data();
+            const long n = cl.inner_size(), s = cl.inner_stride(0);
+            detail::for_each_inner_run(cl, [&](auto const& off) {
+                auto* q = p + off[0];
+                if (s == 1)
+                {
+                    for (long i = 0; i < n; ++i)
+                        r2 = f(r2, q[i]);
+                }
+                else
+                {
+                    for (long i = 0; i < n; ++i)
+                        r2 = f(r2, q[i * s]);
+                }
+            });
+            return r2;
+        }
+        // traverse the elements in the memory order of the array (C-order if there is no unique stride order)
+        enda::for_each_ordered<detail::traversal_order<A>>(a.shape(), [&a, &r2, &f](auto&&... args) { r2 = f(r2, a(args...)); });
         return r2;
     }
 
@@ -35,66 +267,611 @@ namespace enda
         return fold(std::move(f), a, get_value_t<A> {});
     }
 
+    namespace detail
+    {
+        // Position of the first element satisfying the predicate in the run p[0], p[s], ..., p[(n - 1) * s] (n if none).
+        template<typename T, typename Pred>
+        long find_in_run(T* p, long s, long n, Pred const& pred)
+        {
+            // test whole blocks without branches (compare-and-mask) and only search the block containing a hit
+            constexpr long B = 32;
+            long           i = 0;
+            for (; i + B <= n; i += B)
+            {
+                // integer mask instead of bool, since the compilers vectorize integer OR reductions more reliably
+                unsigned hit = 0;
+                if (s == 1)
+                {
+                    for (long k = 0; k < B; ++k)
+                        hit |= static_cast<unsigned>(static_cast<bool>(pred(p[i + k])));
+                }
+                else
+                {
+                    for (long k = 0; k < B; ++k)
+                        hit |= static_cast<unsigned>(static_cast<bool>(pred(p[(i + k) * s])));
+                }
+                if (hit != 0)
+                    break;
+            }
+            for (; i < n; ++i)
+                if (pred(p[i * s]))
+                    return i;
+            return n;
+        }
+
+        // Multi-dimensional index of the element at a given position of a traversal in the given order.
+        template<size_t R>
+        std::array<long, R> unravel_position(long pos, std::array<long, R> const& shape, std::array<int, R> const& order)
+        {
+            std::array<long, R> idx {};
+            for (int k = static_cast<int>(R) - 1; k >= 0; --k)
+            {
+                idx[order[k]] = pos % shape[order[k]];
+                pos /= shape[order[k]];
+            }
+            return idx;
+        }
+
+        // Is the type a lazy unary function call on an array/view in host memory?
+        template<typename A>
+        constexpr bool is_unary_host_expr_v = false;
+
+        template<typename F, typename B>
+        constexpr bool is_unary_host_expr_v<expr_call<F, B>> = MemoryArray<std::remove_cvref_t<B>> and mem::on_host<std::remove_cvref_t<B>>;
+
+        /**
+         * @brief Find an element of an array satisfying a predicate and stop the traversal as early as possible.
+         *
+         * @details The elements are visited in memory order: for arrays/views in host memory, the runs of the collapsed
+         * layout are searched with enda::detail::find_in_run, for other arrays the order is given by
+         * enda::detail::traversal_order. Unary lazy expressions like `isnan(a)` search the underlying array directly.
+         *
+         * Large arrays are split into many chunks along their slowest dimension which are handed out to the threads in
+         * increasing order. The position of the first hit found so far is shared between all threads, so that they stop as
+         * soon as the result is known.
+         *
+         * @tparam First If true, find the first such element in memory order, otherwise any such element.
+         * @tparam A enda::Array type.
+         * @tparam Pred Callable type.
+         * @param a Array to be searched.
+         * @param pred Callable object taking an element and returning a `bool`.
+         * @return Multi-dimensional index of the element or an empty optional if there is none.
+         */
+        template<bool First, Array A, typename Pred>
+        std::optional<std::array<long, get_rank<A>>> find_index(A const& a, Pred const& pred)
+        {
+            static constexpr int rank = get_rank<A>;
+            if constexpr (is_unary_host_expr_v<A>)
+            {
+                return find_index<First>(std::get<0>(a.a), [&a, &pred](auto const& x) { return pred(a.f(x)); });
+            }
+            else
+            {
+                auto const shape = a.shape();
+                long       size  = 1;
+                for (auto l : shape)
+                    size *= l;
+                if (size == 0)
+                    return {};
+
+                // position of the first hit found so far (size if there is none)
+                std::atomic<long> found {size};
+                auto              report = [&found](long pos) {
+                    long cur = found.load(std::memory_order_relaxed);
+                    while (pos < cur and !found.compare_exchange_weak(cur, pos, std::memory_order_relaxed)) {}
+                };
+                auto done = [&found, size](long pos) {
+                    const long f = found.load(std::memory_order_relaxed);
+                    return First ? f < pos : f < size;
+                };
+
+                // split the slowest dimension into chunks which are processed in increasing order
+                auto run_chunks = [size](long n_slow, auto const& chunk) {
+                    if (!parallel::use_parallel(size))
+                    {
+                        chunk(0l, n_slow);
+                        return;
+                    }
+                    auto&      pool     = parallel::thread_pool::instance();
+                    const long n_chunks = std::min<long>(n_slow, 8l * pool.size());
+                    pool.run(n_chunks, [&](long c) { chunk(c * n_slow / n_chunks, (c + 1) * n_slow / n_chunks); });
+                };
+
+                std::array<int, rank> order {};
+                if constexpr (MemoryArray<A> and mem::on_host<A>)
+                {
+                    order           = a.indexmap().stride_order;
+                    auto       cl   = collapse_dims(a.indexmap().lengths(), a.indexmap().strides(), order);
+                    const long step = size / cl.lengths[0];
+                    run_chunks(cl.lengths[0], [&](long begin, long end) {
+                        auto [sub, off] = slice_outer(cl, begin, end);
+                        auto*      p    = a.data() + off[0];
+                        const long n = sub.inner_size(), s = sub.inner_stride(0);
+                        long       pos = begin * step;
+                        for_each_inner_run(sub, [&](auto const& o) {
+                            if (done(pos))
+                                return false;
+                            const long i = find_in_run(p + o[0], s, n, pred);
+                            if (i < n)
+                            {
+                                report(pos + i);
+                                return false;
+                            }
+                            pos += n;
+                            return true;
+                        });
+                    });
+                }
+                else
+                {
+                    static constexpr uint64_t enc = traversal_order<A>;
+                    if constexpr (enc == 0)
+                        order = permutations::identity<rank>();
+                    else
+                        order = decode<rank>(enc);
+                    const int  j = order[0], inner = order[rank - 1];
+                    const long step = size / shape[j];
+                    run_chunks(shape[j], [&](long begin, long end) {
+                        for (long pos = begin * step; pos < end * step;)
+                        {
+                            if (done(pos))
+                                return;
+                            auto       idx   = unravel_position(pos, shape, order);
+                            const long first = idx[inner];
+                            const long n     = std::min(shape[inner] - first, end * step - pos);
+                            for (long i = 0; i < n; ++i)
+                            {
+                                idx[inner] = first + i;
+                                if (pred(std::apply(a, idx)))
+                                {
+                                    report(pos + i);
+                                    return;
+                                }
+                            }
+                            pos += n;
+                        }
+                    });
+                }
+
+                const long pos = found.load();
+                if (pos == size)
+                    return {};
+                return unravel_position(pos, shape, order);
+            }
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Does any element of a boolean array evaluate to true?
+     * @details The traversal stops at the first true element, see enda::detail::find_index.
+     */
     template<Array A>
     bool any(A const& a)
     {
         static_assert(std::is_same_v<get_value_t<A>, bool>, "Error in enda::any: Value type of the array must be bool");
-        return fold([](bool r, auto const& x) -> bool { return r or bool(x); }, a, false);
+        return detail::find_index<false>(a, [](bool x) { return x; }).has_value();
     }
 
+    /**
+     * @brief Do all elements of a boolean array evaluate to true?
+     * @details The traversal stops at the first false element, see enda::detail::find_index.
+     */
     template<Array A>
     bool all(A const& a)
     {
         static_assert(std::is_same_v<get_value_t<A>, bool>, "Error in enda::all: Value type of the array must be bool");
-        return fold([](bool r, auto const& x) -> bool { return r and bool(x); }, a, true);
+        return !detail::find_index<false>(a, [](bool x) { return !x; }).has_value();
+    }
+
+    /**
+     * @brief Find the first element of an array (in memory order) which satisfies a predicate.
+     *
+     * @details The traversal stops as soon as the element is found and runs in parallel for large arrays, see
+     * enda::detail::find_index. For C-ordered arrays, memory order is the usual lexicographic order of the indices.
+     *
+     * @tparam A enda::Array type.
+     * @tparam Pred Callable type.
+     * @param a Array to be searched.
+     * @param pred Callable object taking an element and returning a `bool`.
+     * @return Multi-dimensional index of the element or an empty optional if there is none.
+     */
+    template<Array A, typename Pred>
+    std::optional<std::array<long, get_rank<A>>> find_if(A const& a, Pred pred)
+    {
+        return detail::find_index<true>(a, pred);
+    }
+
+    /**
+     * @brief Count the elements of an array which satisfy a predicate.
+     *
+     * @tparam A enda::Array type.
+     * @tparam Pred Callable type.
+     * @param a Array to be searched.
+     * @param pred Callable object taking an element and returning a `bool`.
+     * @return Number of elements satisfying the predicate.
+     */
+    template<Array A, typename Pred>
+    long count_if(A const& a, Pred pred)
+    {
+        return detail::reduce(a, 0l, [&pred](long r, auto const& x) { return r + static_cast<long>(static_cast<bool>(pred(x))); }, std::plus<> {});
     }
 
     template<Array A>
     auto max_element(A const& a)
     {
-        return fold(
-            [](auto const& x, auto const& y) {
-                using std::max;
-                return max(x, y);
-            },
-            a,
-            get_first_element(a));
+        auto f = [](auto const& x, auto const& y) {
+            using std::max;
+            return max(x, y);
+        };
+        using r_t = std::remove_cvref_t<decltype(f(get_first_element(a), get_first_element(a)))>;
+        return detail::reduce(a, r_t(get_first_element(a)), f, f);
     }
 
     template<Array A>
     auto min_element(A const& a)
     {
-        return fold(
-            [](auto const& x, auto const& y) {
-                using std::min;
-                return min(x, y);
-            },
-            a,
-            get_first_element(a));
+        auto f = [](auto const& x, auto const& y) {
+            using std::min;
+            return min(x, y);
+        };
+        using r_t = std::remove_cvref_t<decltype(f(get_first_element(a), get_first_element(a)))>;
+        return detail::reduce(a, r_t(get_first_element(a)), f, f);
+    }
+
+    /**
+     * @brief Multi-dimensional index of the first maximum of an array (in memory order).
+     *
+     * @details The maximum is computed with enda::max_element and then located with enda::find_if. The array must not be
+     * empty. If it contains NaNs, the result is unspecified.
+     *
+     * @tparam A enda::Array type with an arithmetic value type.
+     * @param a Array to be searched.
+     * @return Multi-dimensional index of the maximum.
+     */
+    template<Array A>
+    std::array<long, get_rank<A>> argmax(A const& a) requires(std::is_arithmetic_v<std::remove_cvref_t<get_value_t<A>>>)
+    {
+        EXPECTS(a.size() > 0);
+        const auto m = max_element(a);
+        return *find_if(a, [m](auto const& x) { return !(x < m); });
+    }
+
+    /**
+     * @brief Multi-dimensional index of the first minimum of an array (in memory order).
+     *
+     * @details The minimum is computed with enda::min_element and then located with enda::find_if. The array must not be
+     * empty. If it contains NaNs, the result is unspecified.
+     *
+     * @tparam A enda::Array type with an arithmetic value type.
+     * @param a Array to be searched.
+     * @return Multi-dimensional index of the minimum.
+     */
+    template<Array A>
+    std::array<long, get_rank<A>> argmin(A const& a) requires(std::is_arithmetic_v<std::remove_cvref_t<get_value_t<A>>>)
+    {
+        EXPECTS(a.size() > 0);
+        const auto m = min_element(a);
+        return *find_if(a, [m](auto const& x) { return !(m < x); });
     }
 
     template<ArrayOfRank<2> A>
     double frobenius_norm(A const& a)
     {
-        return std::sqrt(fold(
-            [](double r, auto const& x) -> double {
+        auto acc = [](double r, auto const& x) -> double {
+            if constexpr (is_complex_v<std::remove_cvref_t<decltype(x)>>)
+            {
+                return r + std::norm(x);
+            }
+            else
+            {
                 auto ab = std::abs(x);
                 return r + ab * ab;
-            },
-            a,
-            double(0)));
+            }
+        };
+        return std::sqrt(detail::reduce(a, double(0), acc, std::plus<> {}));
     }
 
+    /**
+     * @brief Sum of all elements of an array.
+     *
+     * @details The default summation uses several independent accumulators and runs in parallel for large arrays, see
+     * enda::detail::reduce. Pairwise summation (only for arrays/views in memory, other arrays use the standard summation)
+     * and Kahan-Babuska summation (only for floating point and complex value types) reduce the rounding error.
+     *
+     * @tparam A enda::Array type.
+     * @param a Array to be summed.
+     * @param method enda::summation algorithm.
+     * @return Sum of all elements. Its type is `decltype(x + x)` for an element `x`, i.e. the same as for
+     * `enda::fold(std::plus<>{}, a)`: small integer types like `short` or `char` are promoted to `int`.
+     */
     template<Array A>
-    auto sum(A const& a) requires(enda::is_scalar_v<get_value_t<A>>)
+    auto sum(A const& a, summation method = summation::standard) requires(enda::is_scalar_v<get_value_t<A>>)
     {
-        return fold(std::plus<> {}, a);
+        using value_t = std::remove_cvref_t<get_value_t<A>>;
+        using r_t     = decltype(value_t {} + value_t {});
+        if constexpr (std::is_floating_point_v<r_t> or is_complex_v<r_t>)
+        {
+            if (method == summation::kahan)
+            {
+                auto add  = [](auto const& k, auto const& x) { return detail::kahan_add(k, x); };
+                auto comb = [](auto const& k1, auto const& k2) { return detail::kahan_combine(k1, k2); };
+                auto k    = detail::reduce(a, detail::kahan_acc<r_t> {}, add, comb);
+                return r_t(k.s + k.c);
+            }
+        }
+        if (method == summation::pairwise)
+            return detail::reduce<true>(a, r_t {}, std::plus<> {}, std::plus<> {});
+        return detail::reduce(a, r_t {}, std::plus<> {}, std::plus<> {});
     }
 
     template<Array A>
     auto product(A const& a) requires(enda::is_scalar_v<get_value_t<A>>)
     {
-        return fold(std::multiplies<> {}, a, get_value_t<A> {1});
+        using value_t = std::remove_cvref_t<get_value_t<A>>;
+        using r_t     = decltype(value_t {} * value_t {});
+        return detail::reduce(a, r_t {1}, std::multiplies<> {}, std::multiplies<> {});
+    }
+
+    namespace detail
+    {
+        // Check that the reduced axes are in range and distinct and that at least one dimension is kept.
+        template<int Rank, int... Axes>
+        constexpr bool valid_reduction_axes()
+        {
+            constexpr std::array<int, sizeof...(Axes)> axes {Axes...};
+            for (size_t i = 0; i < axes.size(); ++i)
+            {
+                if (axes[i] < 0 or axes[i] >= Rank)
+                    return false;
+                for (size_t j = 0; j < i; ++j)
+                    if (axes[i] == axes[j])
+                        return false;
+            }
+            return sizeof...(Axes) > 0 and sizeof...(Axes) < Rank;
+        }
+
+        // Dimensions which are kept by a reduction over the given axes (in increasing order).
+        template<int Rank, int... Axes>
+        constexpr std::array<int, Rank - sizeof...(Axes)> kept_axes()
+        {
+            std::array<int, Rank - sizeof...(Axes)> res {};
+            int                                     k = 0;
+            for (int i = 0; i < Rank; ++i)
+                if (((i != Axes) and ...))
+                    res[k++] = i;
+            return res;
+        }
+
+        // Accumulate the run p[0], p[s], ... element-wise into the run r[0], r[rs], ... (vertical reduction).
+        template<typename R, typename T, typename Acc>
+        void accumulate_run(R* RESTRICT r, long rs, T* RESTRICT p, long s, long n, Acc const& acc)
+        {
+            if (rs == 1 and s == 1)
+            {
+                for (long i = 0; i < n; ++i)
+                    r[i] = acc(r[i], p[i]);
+            }
+            else
+            {
+                for (long i = 0; i < n; ++i)
+                    r[i * rs] = acc(r[i * rs], p[i * s]);
+            }
+        }
+
+        /**
+         * @brief Reduce an array over a subset of its dimensions.
+         *
+         * @details The result is a C-ordered enda::array of rank `Rank - sizeof...(Axes)` whose elements are initialized
+         * with `id`. For arrays/views in host memory, the result and the array are traversed together in the memory order
+         * of the array and the adjacent dimensions are collapsed (see enda::detail::collapse_dims). The innermost loop is
+         * then either
+         * - a reduction of a run of the array to a single result element, if the fastest dimension is reduced
+         * (horizontal, see enda::detail::reduce_run), or
+         * - an element-wise accumulation of a run of the array into a run of the result, if the fastest dimension is kept
+         * (vertical, see enda::detail::accumulate_run).
+         *
+         * Large arrays are split into chunks along the slowest kept dimension, which are processed in parallel. Every
+         * result element is therefore computed by a single thread. Other arrays are accumulated in memory order (see
+         * enda::detail::traversal_order).
+         *
+         * @tparam Assoc If true, `comb` is associative and runs may be reduced with several independent accumulators.
+         * Otherwise, every result element is a left fold of the reduced elements in memory order.
+         * @tparam Axes Dimensions to be reduced.
+         * @tparam A enda::Array type.
+         * @tparam R Result type.
+         * @tparam Acc Callable type to accumulate an element: `R acc(R, element)`.
+         * @tparam Comb Callable type to combine two partial results: `R comb(R, R)`.
+         * @param a Array to be reduced.
+         * @param id Initial value of each result element (identity element of `comb` if `Assoc` is true).
+         * @param acc Callable object accumulating an element.
+         * @param comb Callable object combining two partial results.
+         * @return enda::array containing the reduced elements.
+         */
+        template<bool Assoc, int... Axes, Array A, typename R, typename Acc, typename Comb>
+        auto reduce_axes(A const& a, R const& id, Acc const& acc, Comb const& comb)
+        {
+            static constexpr int rank = get_rank<A>;
+            static_assert(valid_reduction_axes<rank, Axes...>(), "Error in enda::detail::reduce_axes: Invalid axes");
+            static constexpr int  new_rank = rank - static_cast<int>(sizeof...(Axes));
+            static constexpr auto kept     = kept_axes<rank, Axes...>();
+
+            // construct the result and initialize it
+            auto const                  shape = a.shape();
+            std::array<long, new_rank> new_shape {};
+            for (int k = 0; k < new_rank; ++k)
+                new_shape[k] = shape[kept[k]];
+            auto res = array<R, new_rank>(new_shape);
+            std::fill(res.data(), res.data() + res.size(), id);
+            if (a.size() == 0 or res.size() == 0)
+                return res;
+
+            // strides of the result w.r.t. the dimensions of the array (0 for the reduced ones)
+            std::array<long, rank> res_strides {};
+            for (int k = 0; k < new_rank; ++k)
+                res_strides[kept[k]] = res.indexmap().strides()[k];
+            R* pr = res.data();
+
+            if constexpr (MemoryArray<A> and mem::on_host<A>)
+            {
+                auto cl     = collapse_dims(shape, std::array<std::array<long, rank>, 2> {res_strides, a.indexmap().strides()}, a.indexmap().stride_order);
+                auto kernel = [&](auto const& sub, long off_r, long off_a) {
+                    const long n = sub.inner_size(), rs = sub.inner_stride(0), s = sub.inner_stride(1);
+                    for_each_inner_run(sub, [&](auto const& o) {
+                        R*    r = pr + off_r + o[0];
+                        auto* p = a.data() + off_a + o[1];
+                        if (rs == 0)
+                        {
+                            if constexpr (Assoc)
+                                *r = comb(*r, reduce_run(p, s, n, id, acc, comb));
+                            else
+                                for (long i = 0; i < n; ++i)
+                                    *r = acc(*r, p[i * s]);
+                        }
+                        else
+                        {
+                            accumulate_run(r, rs, p, s, n, acc);
+                        }
+                    });
+                };
+
+                // split along the slowest kept dimension (if all kept extents are 1, the result has a single element)
+                int k = 0;
+                while (k < cl.rank and cl.strides[0][k] == 0)
+                    ++k;
+                if (k == cl.rank or !parallel::use_parallel(a.size()))
+                {
+                    kernel(cl, 0, 0);
+                    return res;
+                }
+                parallel::for_chunks(cl.lengths[k], [&](long begin, long end) {
+                    auto sub       = cl;
+                    sub.lengths[k] = end - begin;
+                    kernel(sub, begin * cl.strides[0][k], begin * cl.strides[1][k]);
+                });
+            }
+            else
+            {
+                for_each_ordered<traversal_order<A>>(shape, [&](auto... args) {
+                    auto idx = std::array<long, rank> {args...};
+                    long off = 0;
+                    for (int k = 0; k < rank; ++k)
+                        off += idx[k] * res_strides[k];
+                    pr[off] = acc(pr[off], a(args...));
+                });
+            }
+            return res;
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Left fold of an array over a subset of its dimensions.
+     *
+     * @details For every index of the kept dimensions, the elements of the reduced dimensions `Axes...` are folded with
+     * `f` starting from `r` (see enda::fold), e.g. `fold_axes<1>(f, a, r)(i, k) = f(...f(r, a(i, 0, k))..., a(i, n - 1,
+     * k))` for a rank 3 array whose dimension 1 is traversed in increasing order. The elements are visited in memory
+     * order, see enda::detail::reduce_axes.
+     *
+     * @tparam Axes Dimensions to be reduced (at least one dimension must be kept).
+     * @tparam A enda::Array type.
+     * @tparam F Callable type.
+     * @tparam R Type of the initial value.
+     * @param f Callable object.
+     * @param a Array to be folded.
+     * @param r Initial value.
+     * @return enda::array of rank `get_rank<A> - sizeof...(Axes)` containing the results of the folds.
+     */
+    template<int... Axes, Array A, typename F, typename R>
+    auto fold_axes(F f, A const& a, R r)
+    {
+        using r_t = decltype(f(r, get_value_t<A> {}));
+        return detail::reduce_axes<false, Axes...>(a, r_t(r), f, f);
+    }
+
+    /**
+     * @brief Sum of an array over a subset of its dimensions.
+     *
+     * @details E.g. `sum<0, 2>(a)(j) = sum_{i, k} a(i, j, k)` for a rank 3 array. The kernel is chosen according to the
+     * memory layout and runs in parallel for large arrays, see enda::detail::reduce_axes.
+     *
+     * @tparam Axes Dimensions to be summed over (at least one dimension must be kept).
+     * @tparam A enda::Array type.
+     * @param a Array to be summed.
+     * @return enda::array of rank `get_rank<A> - sizeof...(Axes)` containing the sums (with the same value type as
+     * enda::sum of the whole array).
+     */
+    template<int... Axes, Array A>
+    auto sum(A const& a) requires(sizeof...(Axes) > 0 and enda::is_scalar_v<get_value_t<A>>)
+    {
+        using value_t = std::remove_cvref_t<get_value_t<A>>;
+        using r_t     = decltype(value_t {} + value_t {});
+        return detail::reduce_axes<true, Axes...>(a, r_t {}, std::plus<> {}, std::plus<> {});
+    }
+
+    /**
+     * @brief Maximum of an array over a subset of its dimensions.
+     *
+     * @tparam Axes Dimensions to be reduced (at least one dimension must be kept).
+     * @tparam A enda::Array type with an arithmetic value type.
+     * @param a Array to be reduced.
+     * @return enda::array of rank `get_rank<A> - sizeof...(Axes)` containing the maxima.
+     */
+    template<int... Axes, Array A>
+    auto max_element(A const& a) requires(sizeof...(Axes) > 0 and std::is_arithmetic_v<std::remove_cvref_t<get_value_t<A>>>)
+    {
+        using value_t = std::remove_cvref_t<get_value_t<A>>;
+        using lim_t   = std::numeric_limits<value_t>;
+        auto f        = [](value_t x, value_t y) { return std::max(x, y); };
+        return detail::reduce_axes<true, Axes...>(a, (lim_t::has_infinity ? value_t(-lim_t::infinity()) : lim_t::lowest()), f, f);
+    }
+
+    /**
+     * @brief Minimum of an array over a subset of its dimensions.
+     *
+     * @tparam Axes Dimensions to be reduced (at least one dimension must be kept).
+     * @tparam A enda::Array type with an arithmetic value type.
+     * @param a Array to be reduced.
+     * @return enda::array of rank `get_rank<A> - sizeof...(Axes)` containing the minima.
+     */
+    template<int... Axes, Array A>
+    auto min_element(A const& a) requires(sizeof...(Axes) > 0 and std::is_arithmetic_v<std::remove_cvref_t<get_value_t<A>>>)
+    {
+        using value_t = std::remove_cvref_t<get_value_t<A>>;
+        using lim_t   = std::numeric_limits<value_t>;
+        auto f        = [](value_t x, value_t y) { return std::min(x, y); };
+        return detail::reduce_axes<true, Axes...>(a, (lim_t::has_infinity ? lim_t::infinity() : lim_t::max()), f, f);
+    }
+
+    /**
+     * @brief Arithmetic mean of an array, either of all its elements or over a subset of its dimensions.
+     *
+     * @details Integer arrays are averaged in double precision.
+     *
+     * @tparam Axes Dimensions to be averaged over (none: average of all elements).
+     * @tparam A enda::Array type.
+     * @param a Array to be averaged.
+     * @return Mean of all elements or enda::array of rank `get_rank<A> - sizeof...(Axes)` containing the means.
+     */
+    template<int... Axes, Array A>
+    auto mean(A const& a) requires(enda::is_scalar_v<get_value_t<A>>)
+    {
+        using value_t = std::remove_cvref_t<get_value_t<A>>;
+        using r_t     = std::conditional_t<std::is_integral_v<value_t>, double, decltype(value_t {} + value_t {})>;
+        using real_t  = decltype(std::abs(r_t {}));
+        if constexpr (sizeof...(Axes) == 0)
+        {
+            return detail::reduce(a, r_t {}, std::plus<> {}, std::plus<> {}) / static_cast<real_t>(a.size());
+        }
+        else
+        {
+            auto const shape = a.shape();
+            const long n     = (shape[Axes] * ...);
+            auto       res   = detail::reduce_axes<true, Axes...>(a, r_t {}, std::plus<> {}, std::plus<> {});
+            for (auto& x : res)
+                x /= static_cast<real_t>(n);
+            return res;
+        }
     }
 
 } // namespace enda
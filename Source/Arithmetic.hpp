@@ -6,12 +6,19 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
 #include "Concepts.hpp"
 #include "Declarations.hpp"
+#include "Linalg/Factorizations.hpp"
+#include "Linalg/Gemm.hpp"
 #include "Macros.hpp"
 #include "StdUtil/Complex.hpp"
 #include "Traits.hpp"
@@ -213,6 +220,428 @@ namespace enda
         }
     };
 
+    namespace detail
+    {
+        // Storage of the evaluated value of a lazy matrix product.
+        template<typename T>
+        struct product_cache
+        {
+            std::once_flag flag;
+            std::atomic<bool> ready {false};
+            matrix<T> value;
+        };
+
+        // Is the type a lazy matrix product?
+        template<typename A>
+        inline constexpr bool is_matmul_v = false;
+
+        template<Array L, Array R>
+        inline constexpr bool is_matmul_v<expr_matmul<L, R>> = true;
+
+        // Operand of a product: nested lazy products are replaced by their values.
+        template<typename A>
+        decltype(auto) product_value(A const& a)
+        {
+            if constexpr (is_matmul_v<A>)
+                return a.value();
+            else
+                return (a);
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Lazy matrix-matrix product.
+     *
+     * @details It is returned by enda::operator* for two matrices, unless both have small static extents (see
+     * enda::linalg::matmul). If an expression containing the product is assigned to a matrix/view in host memory, scalar
+     * factors, the accumulation into the destination and an elementwise epilogue given by enda::map are fused into a
+     * single call of enda::linalg::gemm (see enda::detail::assign_products). For example,
+     *
+     * @code{.cpp}
+     * c = 2.0 * a * b + 0.5 * c;      // gemm(2.0, a, b, 0.5, c)
+     * c = enda::map(f)(a * b - d);    // c = d, then gemm(1.0, a, b, -1.0, c, f)
+     * @endcode
+     *
+     * do not create any temporary matrix. In all other cases, the product is evaluated by enda::linalg::matmul the first
+     * time one of its elements is accessed and the result is shared by all copies of the expression.
+     *
+     * @tparam L enda::Array type of the left operand.
+     * @tparam R enda::Array type of the right operand.
+     */
+    template<Array L, Array R>
+    struct expr_matmul
+    {
+        // Value type of the product.
+        using value_t = decltype(std::declval<std::remove_const_t<get_value_t<L>>>() * std::declval<std::remove_const_t<get_value_t<R>>>());
+
+        // enda::Array left operand.
+        L l;
+
+        // enda::Array right operand.
+        R r;
+
+        // Evaluated product (shared by all copies).
+        std::shared_ptr<detail::product_cache<value_t>> cache = std::make_shared<detail::product_cache<value_t>>();
+
+        // Evaluate the product (only once) and get the result.
+        [[nodiscard]] matrix<value_t> const& value() const
+        {
+            std::call_once(cache->flag, [this]() {
+                cache->value = linalg::matmul(detail::product_value(l), detail::product_value(r));
+                cache->ready.store(true, std::memory_order_release);
+            });
+            return cache->value;
+        }
+
+        // Has the product already been evaluated?
+        [[nodiscard]] bool evaluated() const { return cache->ready.load(std::memory_order_acquire); }
+
+        template<typename... Args>
+        decltype(auto) operator()(Args const&... args) const
+        {
+            return value()(args...);
+        }
+
+        [[nodiscard]] std::array<long, 2> shape() const { return {l.shape()[0], r.shape()[1]}; }
+
+        [[nodiscard]] long size() const { return l.shape()[0] * r.shape()[1]; }
+    };
+
+    namespace detail
+    {
+        // Decomposition of an expression into a scalar factor and a base expression: s * X, X * s and -X (recursively).
+        template<typename E>
+        struct scaled
+        {
+            using base_t = E;
+
+            template<typename T>
+            static constexpr bool factor_converts_to = true;
+
+            static E const& base(E const& e) { return e; }
+
+            template<typename T>
+            static T factor(E const&)
+            {
+                return T {1};
+            }
+        };
+
+        template<Array A>
+        struct scaled<expr_unary<'-', A>>
+        {
+            using inner  = scaled<std::decay_t<A>>;
+            using base_t = typename inner::base_t;
+
+            template<typename T>
+            static constexpr bool factor_converts_to = inner::template factor_converts_to<T>;
+
+            static auto const& base(expr_unary<'-', A> const& e) { return inner::base(e.a); }
+
+            template<typename T>
+            static T factor(expr_unary<'-', A> const& e)
+            {
+                return -inner::template factor<T>(e.a);
+            }
+        };
+
+        template<typename S, typename A>
+            requires(is_scalar_v<S> and not is_scalar_v<A>)
+        struct scaled<expr<'*', S, A>>
+        {
+            using inner  = scaled<std::decay_t<A>>;
+            using base_t = typename inner::base_t;
+
+            template<typename T>
+            static constexpr bool factor_converts_to = std::is_convertible_v<S, T> and inner::template factor_converts_to<T>;
+
+            static auto const& base(expr<'*', S, A> const& e) { return inner::base(e.r); }
+
+            template<typename T>
+            static T factor(expr<'*', S, A> const& e)
+            {
+                return static_cast<T>(e.l) * inner::template factor<T>(e.r);
+            }
+        };
+
+        template<typename A, typename S>
+            requires(is_scalar_v<S> and not is_scalar_v<A>)
+        struct scaled<expr<'*', A, S>>
+        {
+            using inner  = scaled<std::decay_t<A>>;
+            using base_t = typename inner::base_t;
+
+            template<typename T>
+            static constexpr bool factor_converts_to = std::is_convertible_v<S, T> and inner::template factor_converts_to<T>;
+
+            static auto const& base(expr<'*', A, S> const& e) { return inner::base(e.l); }
+
+            template<typename T>
+            static T factor(expr<'*', A, S> const& e)
+            {
+                return inner::template factor<T>(e.l) * static_cast<T>(e.r);
+            }
+        };
+
+        // Is the expression a scaled lazy matrix product s * P with value type T?
+        template<typename E, typename T>
+        inline constexpr bool is_product_term_v = []() {
+            using P = typename scaled<E>::base_t;
+            if constexpr (is_matmul_v<P>)
+                return std::is_same_v<typename P::value_t, T> and scaled<E>::template factor_converts_to<T>;
+            else
+                return false;
+        }();
+
+        // Is the expression a fusable update alpha * P + beta * X, i.e. s * P, s * P +/- X or X +/- s * P?
+        template<typename E, typename T>
+        inline constexpr bool is_product_update_v = is_product_term_v<E, T>;
+
+        template<char OP, typename L, typename R, typename T>
+            requires(OP == '+' or OP == '-')
+        inline constexpr bool is_product_update_v<expr<OP, L, R>, T> = []() {
+            using L_t = std::decay_t<L>;
+            using R_t = std::decay_t<R>;
+            if constexpr (is_scalar_v<L_t> or is_scalar_v<R_t>)
+                return false;
+            else
+                return is_product_term_v<L_t, T> or is_product_term_v<R_t, T>;
+        }();
+
+        // Is the expression f(U) for a fusable update U and an elementwise callable f mapping T to T?
+        template<typename E, typename T>
+        inline constexpr bool is_product_epilogue_v = false;
+
+        template<typename F, Array A, typename T>
+        inline constexpr bool is_product_epilogue_v<expr_call<F, A>, T> = []() {
+            if constexpr (std::is_invocable_v<F const&, T const&>)
+                return is_product_update_v<std::decay_t<A>, T> and std::is_convertible_v<std::invoke_result_t<F const&, T const&>, T>;
+            else
+                return false;
+        }();
+
+        // Strip the scalar factors off an operand of a fused product (if they can be converted to T).
+        template<typename T, typename A>
+        auto const& strip_factors(A const& a)
+        {
+            if constexpr (scaled<A>::template factor_converts_to<T>)
+                return scaled<A>::base(a);
+            else
+                return a;
+        }
+
+        // Scalar factor of an operand of a fused product (see enda::detail::strip_factors).
+        template<typename T, typename A>
+        T stripped_factor(A const& a)
+        {
+            if constexpr (scaled<A>::template factor_converts_to<T>)
+                return scaled<A>::template factor<T>(a);
+            else
+                return T {1};
+        }
+
+        // Operand of a fused product: matrices/views in host memory (or their lazy conjugations) and values of nested
+        // products are used directly, anything else is evaluated into a temporary matrix.
+        template<typename T, typename A>
+        decltype(auto) fused_operand(A const& a)
+        {
+            if constexpr (is_matmul_v<A>)
+            {
+                if constexpr (std::is_same_v<typename A::value_t, T>)
+                    return a.value();
+                else
+                    return matrix<T>(a.value());
+            }
+            else if constexpr (linalg::detail::is_operand_v<A, T, 2>)
+                return (a);
+            else
+                return matrix<T>(a);
+        }
+
+        // Address range [first, last) spanned by a matrix/view in host memory or by its lazy conjugation.
+        template<typename A>
+        std::pair<void const*, void const*> memory_span(A const& a)
+        {
+            if constexpr (linalg::detail::is_conj_expr_v<A>)
+            {
+                return memory_span(std::get<0>(a.a));
+            }
+            else
+            {
+                auto const* p = a.data();
+                if (a.empty())
+                    return {p, p};
+                long lo = 0, hi = 0;
+                for (int i = 0; i < get_rank<A>; ++i)
+                {
+                    const long d = (a.shape()[i] - 1) * a.indexmap().strides()[i];
+                    (d < 0 ? lo : hi) += d;
+                }
+                return {p + lo, p + hi + 1};
+            }
+        }
+
+        // Might the destination overlap with an operand of a fused product?
+        template<typename D, typename A>
+        bool may_overlap(D const& lhs, A const& a)
+        {
+            auto const [b0, e0] = memory_span(lhs);
+            auto const [b1, e1] = memory_span(a);
+            return std::less<> {}(b0, e1) and std::less<> {}(b1, e0);
+        }
+
+        // lhs = f(alpha * P + beta * X) with a single GEMM (X = void means beta = 0). Returns false if the product has
+        // already been evaluated or if the destination overlaps with one of its operands.
+        template<typename X, typename D, typename P, typename F>
+        bool fused_gemm(D& lhs, P const& p, get_value_t<D> alpha, X const* x, get_value_t<D> beta, F const& f)
+        {
+            using T = get_value_t<D>;
+            if (p.evaluated())
+                return false;
+
+            // pull the scalar factors out of the operands and check for aliasing before writing to the destination
+            decltype(auto) a = fused_operand<T>(strip_factors<T>(p.l));
+            decltype(auto) b = fused_operand<T>(strip_factors<T>(p.r));
+            if (may_overlap(lhs, a) or may_overlap(lhs, b))
+                return false;
+            alpha *= stripped_factor<T>(p.l) * stripped_factor<T>(p.r);
+
+            // copy X into the destination unless it is the destination itself
+            if constexpr (std::is_void_v<X>)
+            {
+                beta = T {0};
+            }
+            else
+            {
+                auto const& xb = strip_factors<T>(*x);
+                beta *= stripped_factor<T>(*x);
+                bool is_lhs = false;
+                if constexpr (MemoryArray<std::decay_t<decltype(xb)>>)
+                    is_lhs = (static_cast<void const*>(xb.data()) == static_cast<void const*>(lhs.data()) and
+                              xb.indexmap().strides() == lhs.indexmap().strides());
+                if (not is_lhs)
+                    lhs = xb;
+            }
+            linalg::gemm(alpha, a, b, beta, lhs, f);
+            return true;
+        }
+
+        // lhs = f(s * P) for a scaled product.
+        template<typename D, typename E, typename F>
+        bool fused_update(D& lhs, E const& u, F const& f)
+        {
+            using T = get_value_t<D>;
+            return fused_gemm<void>(lhs, scaled<E>::base(u), scaled<E>::template factor<T>(u), nullptr, T {0}, f);
+        }
+
+        // lhs = f(X +/- s * P) or lhs = f(s * P +/- X).
+        template<typename D, char OP, typename L, typename R, typename F>
+            requires(OP == '+' or OP == '-')
+        bool fused_update(D& lhs, expr<OP, L, R> const& u, F const& f)
+        {
+            using T          = get_value_t<D>;
+            using L_t        = std::decay_t<L>;
+            using R_t        = std::decay_t<R>;
+            const T sign     = (OP == '-' ? T {-1} : T {1});
+            if constexpr (is_product_term_v<R_t, T>)
+                return fused_gemm<L_t>(lhs, scaled<R_t>::base(u.r), sign * scaled<R_t>::template factor<T>(u.r), &u.l, T {1}, f);
+            else
+                return fused_gemm<R_t>(lhs, scaled<L_t>::base(u.l), scaled<L_t>::template factor<T>(u.l), &u.r, sign, f);
+        }
+
+        // Specialization of enda::detail::products_in for enda::expr_matmul types.
+        template<Array L, Array R>
+        struct products_in<expr_matmul<L, R>>
+        {
+            static constexpr bool any = true;
+
+            static void evaluate(expr_matmul<L, R> const& p) { (void)p.value(); }
+        };
+
+        // Specialization of enda::detail::products_in for enda::expr_unary types.
+        template<char OP, Array A>
+        struct products_in<expr_unary<OP, A>>
+        {
+            using A_t                 = std::decay_t<A>;
+            static constexpr bool any = products_in<A_t>::any;
+
+            static void evaluate(expr_unary<OP, A> const& e) { products_in<A_t>::evaluate(e.a); }
+        };
+
+        // Specialization of enda::detail::products_in for enda::expr types.
+        template<char OP, typename L, typename R>
+        struct products_in<expr<OP, L, R>>
+        {
+            using L_t                 = std::decay_t<L>;
+            using R_t                 = std::decay_t<R>;
+            static constexpr bool any = products_in<L_t>::any or products_in<R_t>::any;
+
+            static void evaluate(expr<OP, L, R> const& e)
+            {
+                products_in<L_t>::evaluate(e.l);
+                products_in<R_t>::evaluate(e.r);
+            }
+        };
+
+        // Specialization of enda::detail::products_in for enda::expr_call types.
+        template<typename F, Array... As>
+        struct products_in<expr_call<F, As...>>
+        {
+            static constexpr bool any = (products_in<std::decay_t<As>>::any or ...);
+
+            static void evaluate(expr_call<F, As...> const& e)
+            {
+                std::apply([](auto const&... a) { (products_in<std::decay_t<decltype(a)>>::evaluate(a), ...); }, e.a);
+            }
+        };
+
+        /**
+         * @brief Assign an expression containing lazy matrix products to a matrix/view.
+         *
+         * @details If the destination is a matrix/view in host memory and the expression has one of the forms
+         *
+         * - `s * P`, `s * P + X`, `X + s * P`, `s * P - X` or `X - s * P` or
+         * - `f(U)` with an enda::map call expression `f` and `U` of one of the above forms,
+         *
+         * where `P` is an enda::expr_matmul, `s` stands for (products of) scalar factors and negations and the value type of
+         * `P` is the one of the destination, it is evaluated by a single enda::linalg::gemm call. Scalar factors of the
+         * operands of `P` are pulled out, `X` is copied into the destination first (unless it is the destination itself,
+         * possibly scaled) and `f` is applied in the write-back of the GEMM kernel.
+         *
+         * Otherwise (or if the destination overlaps with the operands of `P`), all lazy products in the expression are
+         * evaluated and the caller falls back to the elementwise assignment.
+         *
+         * @tparam D Type of the destination.
+         * @tparam E Type of the expression.
+         * @param lhs Destination.
+         * @param rhs Expression.
+         * @return True if the expression has been assigned, false otherwise.
+         */
+        template<typename D, typename E>
+        bool assign_products(D& lhs, E const& rhs)
+        {
+            if constexpr (MemoryArrayOfRank<D, 2> and mem::on_host<D>)
+            {
+                using T = get_value_t<D>;
+                if constexpr (is_product_update_v<E, T>)
+                {
+                    if (fused_update(lhs, rhs, linalg::detail::no_epilogue {}))
+                        return true;
+                }
+                else if constexpr (is_product_epilogue_v<E, T>)
+                {
+                    auto const& f = rhs.f;
+                    if (fused_update(lhs, std::get<0>(rhs.a), [&f](T const& x) -> T { return f(x); }))
+                        return true;
+                }
+            }
+            products_in<E>::evaluate(rhs);
+            return false;
+        }
+
+    } // namespace detail
+
     template<Array A>
     expr_unary<'-', A> operator-(A&& a)
     {
@@ -277,10 +706,25 @@ namespace enda
             return expr<'*', L, R> {std::forward<L>(l), std::forward<R>(r)};
         }
 
-        // two matrices: M * M
+        // matrix * matrix or matrix * vector: M * M or M * V
         if constexpr (l_algebra == 'M')
         {
-            static_assert(l_algebra != 'M', "Not supported in enda::operator*: M * M or M * V.");
+            static_assert(r_algebra != 'A', "Error in enda::operator*: Can not multiply a matrix by an array");
+            if constexpr (r_algebra == 'M')
+            {
+                if constexpr (linalg::detail::has_fixed_layout_v<L> and linalg::detail::has_fixed_layout_v<R>)
+                {
+                    // small static extents: fully unrolled kernel
+                    return linalg::matmul(std::forward<L>(l), std::forward<R>(r));
+                }
+                else
+                {
+                    EXPECTS(l.shape()[1] == r.shape()[0]);
+                    return expr_matmul<L, R> {std::forward<L>(l), std::forward<R>(r)};
+                }
+            }
+            else
+                return linalg::matvecmul(std::forward<L>(l), std::forward<R>(r));
         }
     }
 
@@ -21,15 +21,19 @@
 #include "BasicFunctions.hpp"
 #include "Concepts.hpp"
 #include "Exceptions.hpp"
+#include "FancyIndexing.hpp"
 #include "Iterators.hpp"
 #include "Layout/ForEach.hpp"
 #include "Layout/Permutation.hpp"
 #include "Layout/Range.hpp"
+#include "Layout/StridedCopy.hpp"
+#include "Layout/Tiling.hpp"
 #include "LayoutTransforms.hpp"
 #include "Macros.hpp"
 #include "Mem/AddressSpace.hpp"
 #include "Mem/Memcpy.hpp"
 #include "Mem/Policies.hpp"
+#include "Parallel/Execution.hpp"
 #include "StdUtil/Array.hpp"
 #include "Traits.hpp"
 
@@ -101,7 +105,11 @@ namespace enda
         static constexpr int rank = Rank;
 
         // Compile-time check.
-        static_assert(has_contiguous(layout_t::layout_prop), "Error in enda::basic_array: Memory layout has to be contiguous");
+        static_assert(has_contiguous(layout_t::layout_prop) or is_blocked_idx_map_v<layout_t>, "Error in enda::basic_array: Memory layout has to be contiguous");
+
+        // Compile-time check (the padding of blocked layouts is never constructed).
+        static_assert(not is_blocked_idx_map_v<layout_t> or std::is_trivially_copyable_v<ValueType>,
+                      "Error in enda::basic_array: Blocked memory layouts require trivially copyable value types");
 
     private:
         // Type of the array itself.
@@ -127,7 +135,7 @@ namespace enda
 
         // Construct an array with a given shape and initialize the memory with zeros.
         template<std::integral Int = long>
-        basic_array(std::array<Int, Rank> const& shape, mem::init_zero_t) : lay {shape}, sto {lay.size(), mem::init_zero}
+        basic_array(std::array<Int, Rank> const& shape, mem::init_zero_t) : lay {shape}, sto {detail::storage_size(lay), mem::init_zero}
         {}
 
     public:
@@ -179,7 +187,7 @@ namespace enda
         {
             // setting the layout and storage in the constructor body improves error messages for wrong # of args
             lay = layout_t {std::array {long(is)...}}; // NOLINT (for better error messages)
-            sto = storage_t {lay.size()};              // NOLINT (for better error messages)
+            sto = storage_t {detail::storage_size(lay)}; // NOLINT (for better error messages)
         }
 
         /**
@@ -192,7 +200,7 @@ namespace enda
          */
         template<std::integral Int, typename RHS>
         explicit basic_array(Int sz, RHS const& val) requires((Rank == 1 and is_scalar_for_v<RHS, basic_array>)) :
-            lay(layout_t {std::array {long(sz)}}), sto {lay.size()}
+            lay(layout_t {std::array {long(sz)}}), sto {detail::storage_size(lay)}
         {
             assign_from_scalar(val);
         }
@@ -206,7 +214,7 @@ namespace enda
          * @param shape Shape of the array.
          */
         template<std::integral Int = long>
-        explicit basic_array(std::array<Int, Rank> const& shape) requires(std::is_default_constructible_v<ValueType>) : lay(shape), sto(lay.size())
+        explicit basic_array(std::array<Int, Rank> const& shape) requires(std::is_default_constructible_v<ValueType>) : lay(shape), sto(detail::storage_size(lay))
         {}
 
         /**
@@ -216,7 +224,7 @@ namespace enda
          *
          * @param layout Memory layout.
          */
-        explicit basic_array(layout_t const& layout) requires(std::is_default_constructible_v<ValueType>) : lay {layout}, sto {lay.size()} {}
+        explicit basic_array(layout_t const& layout) requires(std::is_default_constructible_v<ValueType>) : lay {layout}, sto {detail::storage_size(lay)} {}
 
         /**
          * @brief Construct an array with the given memory layout and with an existing memory handle/storage.
@@ -235,7 +243,7 @@ namespace enda
          * @param a enda::ArrayOfRank object.
          */
         template<ArrayOfRank<Rank> A>
-        requires(HasValueTypeConstructibleFrom<A, value_type>) basic_array(A const& a) : lay(a.shape()), sto {lay.size(), mem::do_not_initialize}
+        requires(HasValueTypeConstructibleFrom<A, value_type>) basic_array(A const& a) : lay(a.shape()), sto {detail::storage_size(lay), mem::do_not_initialize}
         {
             static_assert(std::is_constructible_v<value_type, get_value_t<A>>, "Error in enda::basic_array: Incompatible value types in constructor");
             if constexpr (std::is_trivial_v<ValueType> or is_complex_v<ValueType>)
@@ -284,7 +292,7 @@ namespace enda
          * @param l Initializer list.
          */
         basic_array(std::initializer_list<ValueType> const& l) requires(Rank == 1) :
-            lay(std::array<long, 1> {long(l.size())}), sto {lay.size(), mem::do_not_initialize}
+            lay(std::array<long, 1> {long(l.size())}), sto {detail::storage_size(lay), mem::do_not_initialize}
         {
             long i = 0;
             for (auto const& x : l)
@@ -298,7 +306,7 @@ namespace enda
          * @param l2 Initializer list.
          */
         basic_array(std::initializer_list<std::initializer_list<ValueType>> const& l2) requires(Rank == 2) :
-            lay(shape_from_init_list(l2)), sto {lay.size(), mem::do_not_initialize}
+            lay(shape_from_init_list(l2)), sto {detail::storage_size(lay), mem::do_not_initialize}
         {
             long i = 0, j = 0;
             for (auto const& l1 : l2)
@@ -317,7 +325,7 @@ namespace enda
          * @param l3 Initializer list.
          */
         basic_array(std::initializer_list<std::initializer_list<std::initializer_list<ValueType>>> const& l3) requires(Rank == 3) :
-            lay(shape_from_init_list(l3)), sto {lay.size(), mem::do_not_initialize}
+            lay(shape_from_init_list(l3)), sto {detail::storage_size(lay), mem::do_not_initialize}
         {
             long i = 0, j = 0, k = 0;
             for (auto const& l2 : l3)
@@ -481,6 +489,12 @@ namespace enda
         template<ArrayOfRank<Rank> RHS>
         basic_array& operator=(RHS const& rhs)
         {
+            // lazy matrix products might read the storage which is freed by the resize
+            if constexpr (detail::products_in<RHS>::any)
+            {
+                if (rhs.shape() != shape())
+                    detail::products_in<RHS>::evaluate(rhs);
+            }
             resize(rhs.shape());
             assign_from_ndarray(rhs);
             return *this;
@@ -497,7 +511,7 @@ namespace enda
          * @param rhs Right hand side of the assignment operation.
          */
         template<typename RHS>
-        basic_array& operator=(RHS const& rhs) noexcept requires(is_scalar_for_v<RHS, basic_array>)
+        basic_array& operator=(RHS const& rhs) requires(is_scalar_for_v<RHS, basic_array>)
         {
             assign_from_scalar(rhs);
             return *this;
@@ -550,8 +564,8 @@ namespace enda
         void resize(std::array<long, Rank> const& shape)
         {
             lay = layout_t(shape);
-            if (sto.is_null() or (sto.size() != lay.size()))
-                sto = storage_t {lay.size()};
+            if (sto.is_null() or (sto.size() != detail::storage_size(lay)))
+                sto = storage_t {detail::storage_size(lay)};
         }
 
 // include common functionality of arrays and views
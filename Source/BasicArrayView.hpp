@@ -18,16 +18,20 @@
 #include "Concepts.hpp"
 #include "Declarations.hpp"
 #include "Exceptions.hpp"
+#include "FancyIndexing.hpp"
 #include "Iterators.hpp"
 #include "Itertools/Itertools.hpp"
 #include "Layout/ForEach.hpp"
 #include "Layout/IdxMap.hpp"
 #include "Layout/Permutation.hpp"
 #include "Layout/Range.hpp"
+#include "Layout/StridedCopy.hpp"
+#include "Layout/Tiling.hpp"
 #include "Macros.hpp"
 #include "Mem/AddressSpace.hpp"
 #include "Mem/Memcpy.hpp"
 #include "Mem/Policies.hpp"
+#include "Parallel/Execution.hpp"
 #include "Traits.hpp"
 
 #ifdef ENDA_ENFORCE_BOUNDCHECK
@@ -280,7 +284,7 @@ namespace enda
          * @param rhs Right hand side of the assignment operation.
          */
         template<typename RHS>
-        basic_array_view& operator=(RHS const& rhs) noexcept requires(is_scalar_for_v<RHS, basic_array_view>)
+        basic_array_view& operator=(RHS const& rhs) requires(is_scalar_for_v<RHS, basic_array_view>)
         {
             static_assert(!is_const, "Cannot assign to an enda::basic_array_view with const value_type");
             assign_from_scalar(rhs);
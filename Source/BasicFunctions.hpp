@@ -17,8 +17,10 @@
 #include "Declarations.hpp"
 #include "Exceptions.hpp"
 #include "Itertools/Itertools.hpp"
+#include "Layout/Collapse.hpp"
 #include "Layout/ForEach.hpp"
 #include "Mem/AddressSpace.hpp"
+#include "Parallel/Execution.hpp"
 #include "Traits.hpp"
 
 namespace enda
@@ -257,31 +259,25 @@ namespace enda
         EXPECTS(!a.empty());
         using opt_t = std::optional<std::tuple<int, int, int>>;
 
-        auto const& shape   = a.indexmap().lengths();
-        auto const& strides = a.indexmap().strides();
-        auto const& order   = a.indexmap().stride_order;
+        // merge adjacent dimensions in memory order: a block layout has at most one dimension with a non-unit stride
+        auto cl = detail::collapse_dims(a.indexmap().lengths(), a.indexmap().strides(), a.indexmap().stride_order);
+        auto const& len = cl.lengths;
+        auto const& str = cl.strides[0];
 
-        int data_size  = shape[order[0]] * strides[order[0]];
-        int block_size = data_size;
-        int block_str  = data_size;
-        int n_blocks   = 1;
-
-        for (auto n : range(A::rank))
+        if (cl.rank == 1)
+        {
+            // a single contiguous block or blocks of size one
+            if (str[0] == 1)
+                return opt_t {std::make_tuple(1, static_cast<int>(len[0]), static_cast<int>(len[0]))};
+            return opt_t {std::make_tuple(static_cast<int>(len[0]), 1, static_cast<int>(str[0]))};
+        }
+        if (cl.rank == 2 and str[1] == 1)
         {
-            auto inner_size = (n == A::rank - 1) ? 1 : strides[order[n + 1]] * shape[order[n + 1]];
-            if (strides[order[n]] != inner_size)
-            {
-                if (block_size < data_size) // second strided dimension
-                    return opt_t {};
-                // found a strided dimension with (assumed) contiguous inner blocks
-                n_blocks   = a.size() / inner_size;
-                block_size = inner_size;
-                block_str  = strides[order[n]];
-            }
+            // strided dimension with contiguous inner blocks
+            ASSERT(len[0] * len[1] == a.size());
+            return opt_t {std::make_tuple(static_cast<int>(len[0]), static_cast<int>(len[1]), static_cast<int>(str[0]))};
         }
-        ASSERT(n_blocks * block_size == a.size());
-        ASSERT(n_blocks * block_str == shape[order[0]] * strides[order[0]]);
-        return opt_t {std::make_tuple(n_blocks, block_size, block_str)};
+        return opt_t {};
     }
 
     template<size_t Axis = 0, Array A0, Array... As>
@@ -319,4 +315,49 @@ namespace enda
         return new_array;
     };
 
+    /**
+     * @brief Assign an array, expression or scalar to an array/view with a given execution policy.
+     *
+     * @details Equivalent to `lhs = rhs`, except that the assignment kernel uses the given policy instead of deciding
+     * automatically (based on the size and enda::parallel::get_threshold()) whether to run in parallel.
+     *
+     * @tparam P enda::execution::ExecutionPolicy type.
+     * @tparam LHS Type of the left hand side (enda::basic_array or enda::basic_array_view).
+     * @tparam RHS Type of the right hand side.
+     * @param policy Execution policy (e.g. enda::execution::seq or enda::execution::par).
+     * @param lhs Left hand side array/view.
+     * @param rhs Right hand side.
+     */
+    template<execution::ExecutionPolicy P, typename LHS, typename RHS>
+        requires(is_regular_or_view_v<LHS>)
+    void assign(P const& policy, LHS&& lhs, RHS const& rhs)
+    {
+        parallel::policy_guard guard(policy);
+        lhs = rhs;
+    }
+
+    /**
+     * @brief Set all elements of an array/view to a given value with a given execution policy.
+     *
+     * @details In contrast to the assignment of a scalar to a matrix, all elements are set (not only the diagonal).
+     *
+     * @tparam P enda::execution::ExecutionPolicy type.
+     * @param policy Execution policy (e.g. enda::execution::seq or enda::execution::par).
+     * @param a Array view to be filled.
+     * @param x Value to be assigned.
+     */
+    template<execution::ExecutionPolicy P, typename T, int R, typename LP, char A, typename AP, typename OP, typename S>
+    void fill(P const& policy, basic_array_view<T, R, LP, A, AP, OP> a, S const& x)
+    {
+        parallel::policy_guard guard(policy);
+        basic_array_view<T, R, LP, 'A', AP, OP> {a} = x;
+    }
+
+    // Overload of enda::fill for enda::basic_array objects.
+    template<execution::ExecutionPolicy P, typename T, int R, typename LP, char A, typename CP, typename S>
+    void fill(P const& policy, basic_array<T, R, LP, A, CP>& a, S const& x)
+    {
+        fill(policy, a.as_array_view(), x);
+    }
+
 } // namespace enda
@@ -48,6 +48,14 @@ namespace enda
     template<char OP, ArrayOrScalar L, ArrayOrScalar R>
     struct expr;
 
+    template<Array L, Array R>
+    struct expr_matmul;
+
+    template<typename F, Array... As>
+    struct expr_call;
+
+    struct conj_f;
+
     auto     _ = range::all;
     ellipsis ___;
 
@@ -241,4 +249,35 @@ namespace enda
     template<char OP, typename L, typename R>
     inline constexpr layout_info_t get_layout_info<expr<OP, L, R>> = expr<OP, L, R>::compute_layout_info();
 
+    // Specialization of enda::get_algebra for enda::expr_matmul types.
+    template<Array L, Array R>
+    inline constexpr char get_algebra<expr_matmul<L, R>> = 'M';
+
+    namespace detail
+    {
+        // Lazy matrix products (enda::expr_matmul) contained in an expression (specialized in Arithmetic.hpp).
+        template<typename A>
+        struct products_in
+        {
+            // Does the expression contain a lazy matrix product?
+            static constexpr bool any = false;
+
+            // Evaluate all lazy matrix products in the expression.
+            static void evaluate(A const&) {}
+        };
+
+        // Assign an expression containing lazy matrix products to a matrix/view (defined in Arithmetic.hpp).
+        template<typename D, typename E>
+        bool assign_products(D& lhs, E const& rhs);
+
+        // Is the expression the elementwise complex conjugate of a single array/view (e.g. enda::dagger of a complex matrix)?
+        template<typename A>
+        inline constexpr bool is_conj_call_v = false;
+
+        // Specialization of enda::detail::is_conj_call_v for enda::conj expressions.
+        template<typename A>
+        inline constexpr bool is_conj_call_v<expr_call<conj_f, A>> = true;
+
+    } // namespace detail
+
 } // namespace enda
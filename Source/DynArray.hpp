@@ -0,0 +1,710 @@
+/**
+ * @file DynArray.hpp
+ *
+ * @brief Provides arrays and views whose rank is only known at runtime.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstdlib>
+#include <numeric>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "Algorithms.hpp"
+#include "BasicArray.hpp"
+#include "BasicArrayView.hpp"
+#include "Concepts.hpp"
+#include "Declarations.hpp"
+#include "Layout/Collapse.hpp"
+#include "Layout/StridedCopy.hpp"
+#include "Macros.hpp"
+#include "Mem/AddressSpace.hpp"
+#include "Mem/Policies.hpp"
+#include "Parallel/Execution.hpp"
+#include "StdUtil/SmallVector.hpp"
+#include "Traits.hpp"
+
+namespace enda
+{
+    /**
+     * @brief Type used for the shape and the strides of arrays/views with a runtime rank.
+     * @details Ranks up to 8 are stored inline, i.e. without any heap allocation.
+     */
+    using dyn_shape_t = stdutil::small_vector<long, 8>;
+
+    namespace detail
+    {
+        // Rank of the static kernels which are used for arrays/views with a runtime rank.
+        inline constexpr int dyn_kernel_rank = 4;
+
+        /**
+         * @brief Merge adjacent dimensions of strided layouts with a runtime rank and pass them to the static kernels.
+         *
+         * @details The dimensions are sorted w.r.t. the memory order of the first layout and merged as in
+         * enda::detail::collapse_dims. The innermost (at most enda::detail::dyn_kernel_rank) collapsed dimensions form an
+         * enda::detail::collapsed_layout which is passed to the callable together with the offsets (one per layout) of its
+         * first element. If there are more collapsed dimensions, the callable is called for every index of the remaining
+         * outer dimensions. A contiguous layout therefore results in a single call with a rank 1 collapsed layout.
+         *
+         * The lengths should not contain zeros (empty layouts have to be handled by the caller).
+         *
+         * @tparam N Number of layouts.
+         * @tparam F Callable type.
+         * @param lengths Common shape of the layouts.
+         * @param strides Strides of the layouts.
+         * @param f Callable object taking an enda::detail::collapsed_layout and a `std::array<long, N>` of offsets.
+         */
+        template<size_t N, typename F>
+        void for_each_collapsed_block(std::span<long const> lengths, std::array<std::span<long const>, N> const& strides, F&& f)
+        { // NOLINT (we do not want to forward here)
+            constexpr int K = dyn_kernel_rank;
+            const int     r = static_cast<int>(lengths.size());
+
+            // memory order of the first layout
+            stdutil::small_vector<int, 8> order(r);
+            std::iota(order.begin(), order.end(), 0);
+            std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return std::abs(strides[0][a]) > std::abs(strides[0][b]); });
+
+            // merge adjacent dimensions (see enda::detail::collapse_dims)
+            dyn_shape_t                 len;
+            std::array<dyn_shape_t, N>  str;
+            for (int j : order)
+            {
+                if (lengths[j] == 1)
+                    continue;
+                bool merge = not len.empty();
+                for (size_t n = 0; n < N and merge; ++n)
+                    merge = (str[n].back() == strides[n][j] * lengths[j]);
+                if (merge)
+                {
+                    len.back() *= lengths[j];
+                    for (size_t n = 0; n < N; ++n)
+                        str[n].back() = strides[n][j];
+                }
+                else
+                {
+                    len.push_back(lengths[j]);
+                    for (size_t n = 0; n < N; ++n)
+                        str[n].push_back(strides[n][j]);
+                }
+            }
+            if (len.empty())
+            {
+                len.push_back(1);
+                for (size_t n = 0; n < N; ++n)
+                    str[n].push_back(1);
+            }
+
+            // the innermost dimensions are handled by the static kernels
+            const int              rank    = static_cast<int>(len.size());
+            const int              n_outer = std::max(0, rank - K);
+            collapsed_layout<N, K> cl;
+            cl.rank = rank - n_outer;
+            for (int k = 0; k < cl.rank; ++k)
+            {
+                cl.lengths[k] = len[n_outer + k];
+                for (size_t n = 0; n < N; ++n)
+                    cl.strides[n][k] = str[n][n_outer + k];
+            }
+
+            // odometer over the outer dimensions (the offsets are updated incrementally)
+            std::array<long, N> off {};
+            dyn_shape_t         idx(n_outer);
+            while (true)
+            {
+                f(cl, off);
+                int k = n_outer - 1;
+                for (; k >= 0; --k)
+                {
+                    if (++idx[k] < len[k])
+                    {
+                        for (size_t n = 0; n < N; ++n)
+                            off[n] += str[n][k];
+                        break;
+                    }
+                    for (size_t n = 0; n < N; ++n)
+                        off[n] -= (len[k] - 1) * str[n][k];
+                    idx[k] = 0;
+                }
+                if (k < 0)
+                    break;
+            }
+        }
+
+    } // namespace detail
+
+    template<typename T>
+    class dyn_array;
+
+    /**
+     * @brief View of strided data in host memory whose rank is only known at runtime.
+     *
+     * @details The shape and the strides are stored in enda::stdutil::small_vector objects, i.e. views up to rank 8 do not
+     * allocate. A view never owns its data. As for enda::basic_array_view, copy construction is shallow while assignment
+     * copies the elements (use enda::dyn_array_view::rebind to rebind a view).
+     *
+     * Whole-array operations (assignment, enda::sum, ...) collapse the layout (see
+     * enda::detail::for_each_collapsed_block) and run the same kernels as the arrays/views with a static rank, i.e.
+     * contiguous data is processed as a single flat run, split into chunks for the thread pool if it is large enough. For
+     * everything else, the view can be converted without copying to a view with a static rank (see
+     * enda::dyn_array_view::as_static) and back (see enda::dyn_array_view::dyn_array_view(A &&)).
+     *
+     * @tparam T Value type (can be const).
+     */
+    template<typename T>
+    class dyn_array_view
+    {
+        // Pointer to the first element.
+        T* ptr = nullptr;
+
+        // Extents of all dimensions.
+        dyn_shape_t len {0};
+
+        // Strides of all dimensions.
+        dyn_shape_t str {1};
+
+        // Compute C-order strides from the shape.
+        static dyn_shape_t contiguous_strides(dyn_shape_t const& shape)
+        {
+            dyn_shape_t s(shape.size());
+            long        x = 1;
+            for (int k = static_cast<int>(shape.size()) - 1; k >= 0; --k)
+            {
+                s[k] = x;
+                x *= shape[k];
+            }
+            return s;
+        }
+
+    public:
+        /// Value type of the elements.
+        using value_type = T;
+
+        /// Default constructor creates an empty 1-dimensional view.
+        dyn_array_view() = default;
+
+        /**
+         * @brief Construct a view from a pointer to contiguous data in C-order and a shape.
+         *
+         * @param p Pointer to the data.
+         * @param shape Shape of the view.
+         */
+        dyn_array_view(T* p, dyn_shape_t shape) : ptr(p), len(std::move(shape)), str(contiguous_strides(len))
+        {
+            EXPECTS(std::all_of(len.begin(), len.end(), [](long l) { return l >= 0; }));
+        }
+
+        /**
+         * @brief Construct a view from a pointer, a shape and strides.
+         *
+         * @param p Pointer to the data.
+         * @param shape Shape of the view.
+         * @param strides Strides of the view (same size as `shape`).
+         */
+        dyn_array_view(T* p, dyn_shape_t shape, dyn_shape_t strides) : ptr(p), len(std::move(shape)), str(std::move(strides))
+        {
+            EXPECTS(len.size() == str.size());
+            EXPECTS(std::all_of(len.begin(), len.end(), [](long l) { return l >= 0; }));
+        }
+
+        /**
+         * @brief Construct a view of an enda::MemoryArray with a static rank in host memory (no copy).
+         *
+         * @tparam A enda::MemoryArray type.
+         * @param a Array/view.
+         */
+        template<MemoryArray A>
+        requires(mem::on_host<A> and std::is_same_v<std::remove_const_t<T>, get_value_t<A>> and
+                 (std::is_const_v<T> or (!std::is_const_v<std::remove_reference_t<A>> and !std::is_const_v<typename std::decay_t<A>::value_type>)))
+            dyn_array_view(A&& a) // NOLINT (implicit conversion is intended)
+            : ptr(a.data()), len(a.shape()), str(a.indexmap().strides())
+        {}
+
+        /**
+         * @brief Construct a const view from a non-const view.
+         * @param v Non-const view.
+         */
+        dyn_array_view(dyn_array_view<std::remove_const_t<T>> const& v) requires(std::is_const_v<T>) // NOLINT (implicit conversion is intended)
+            : ptr(v.data()), len(v.shape()), str(v.strides())
+        {}
+
+        /// Default copy constructor (shallow copy).
+        dyn_array_view(dyn_array_view const&) = default;
+
+        /// Default move constructor.
+        dyn_array_view(dyn_array_view&&) = default;
+
+        /**
+         * @brief Copy assignment operator copies the elements (the shapes have to agree).
+         * @param rhs Right hand side view.
+         * @return Reference to this view.
+         */
+        dyn_array_view& operator=(dyn_array_view const& rhs)
+        {
+            assign(rhs);
+            return *this;
+        }
+
+        /**
+         * @brief Assignment operator copies the elements of another view (the shapes have to agree).
+         *
+         * @tparam U Value type of the right hand side.
+         * @param rhs Right hand side view.
+         * @return Reference to this view.
+         */
+        template<typename U>
+        dyn_array_view& operator=(dyn_array_view<U> const& rhs)
+        {
+            assign(rhs);
+            return *this;
+        }
+
+        /**
+         * @brief Assignment operator sets all elements to a scalar.
+         *
+         * @tparam S enda::Scalar type.
+         * @param x Scalar value.
+         * @return Reference to this view.
+         */
+        template<Scalar S>
+        dyn_array_view& operator=(S const& x)
+        {
+            fill(x);
+            return *this;
+        }
+
+        /**
+         * @brief Rebind the view to another view (no copy of the elements).
+         * @param v Other view.
+         */
+        void rebind(dyn_array_view const& v) noexcept
+        {
+            ptr = v.ptr;
+            len = v.len;
+            str = v.str;
+        }
+
+        /// Get the rank of the view.
+        [[nodiscard]] int rank() const noexcept { return static_cast<int>(len.size()); }
+
+        /// Get the shape of the view.
+        [[nodiscard]] dyn_shape_t const& shape() const noexcept { return len; }
+
+        /// Get the strides of the view.
+        [[nodiscard]] dyn_shape_t const& strides() const noexcept { return str; }
+
+        /// Get the extent of the i-th dimension.
+        [[nodiscard]] long extent(int i) const noexcept { return len[i]; }
+
+        /// Get the total number of elements.
+        [[nodiscard]] long size() const noexcept { return std::accumulate(len.begin(), len.end(), 1L, std::multiplies<> {}); }
+
+        /// Is the view empty?
+        [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+        /// Get a pointer to the first element.
+        [[nodiscard]] T* data() const noexcept { return ptr; }
+
+        /**
+         * @brief Are the elements contiguous in memory (in any order of the dimensions)?
+         * @return True if the elements occupy `size()` consecutive memory locations starting at `data()`.
+         */
+        [[nodiscard]] bool is_contiguous() const
+        {
+            if (empty())
+                return true;
+            stdutil::small_vector<int, 8> order(len.size());
+            std::iota(order.begin(), order.end(), 0);
+            std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return std::abs(str[a]) > std::abs(str[b]); });
+            long s = 1;
+            for (int k = rank() - 1; k >= 0; --k)
+            {
+                int const u = order[k];
+                if (len[u] > 1 and str[u] != s)
+                    return false;
+                s *= len[u];
+            }
+            return true;
+        }
+
+        /**
+         * @brief Access an element.
+         *
+         * @tparam Ints Integer types.
+         * @param is Multi-dimensional index (one integer per dimension).
+         * @return Reference to the element.
+         */
+        template<std::integral... Ints>
+        T& operator()(Ints... is) const noexcept
+        {
+            EXPECTS(sizeof...(Ints) == len.size());
+            long off = 0, k = 0;
+            ((off += static_cast<long>(is) * str[k++]), ...);
+            return ptr[off];
+        }
+
+        /**
+         * @brief Access an element.
+         * @param idx Multi-dimensional index.
+         * @return Reference to the element.
+         */
+        T& operator()(std::span<long const> idx) const noexcept
+        {
+            EXPECTS(idx.size() == len.size());
+            long off = 0;
+            for (size_t k = 0; k < idx.size(); ++k)
+                off += idx[k] * str[k];
+            return ptr[off];
+        }
+
+        /**
+         * @brief Get a view with a static rank of the same data (no copy).
+         *
+         * @tparam R Rank of the view (has to be equal to the runtime rank).
+         * @tparam LayoutPolicy Layout policy of the view (its stride order has to be compatible with the strides).
+         * @return enda::array_view of rank `R`.
+         */
+        template<int R, typename LayoutPolicy = C_stride_layout>
+        [[nodiscard]] array_view<T, R, LayoutPolicy> as_static() const
+        {
+            EXPECTS_WITH_MESSAGE(rank() == R, "Error in enda::dyn_array_view::as_static: Rank mismatch");
+            std::array<long, R> l, s;
+            std::copy(len.begin(), len.end(), l.begin());
+            std::copy(str.begin(), str.end(), s.begin());
+            return array_view<T, R, LayoutPolicy> {typename LayoutPolicy::template mapping<R> {l, s}, ptr};
+        }
+
+        /**
+         * @brief Get a 1-dimensional contiguous view of all elements in memory order (no copy).
+         * @details The view has to be contiguous (see enda::dyn_array_view::is_contiguous).
+         * @return enda::array_view of rank 1.
+         */
+        [[nodiscard]] array_view<T, 1, C_layout> flatten() const
+        {
+            EXPECTS_WITH_MESSAGE(is_contiguous(), "Error in enda::dyn_array_view::flatten: View is not contiguous");
+            return array_view<T, 1, C_layout> {std::array<long, 1> {size()}, ptr};
+        }
+
+        /**
+         * @brief Set all elements to a scalar.
+         *
+         * @tparam S enda::Scalar type.
+         * @param x Scalar value.
+         */
+        template<Scalar S>
+        void fill(S const& x) const
+        {
+            static_assert(!std::is_const_v<T>, "Error in enda::dyn_array_view::fill: Cannot assign to a const view");
+            if (empty())
+                return;
+            detail::for_each_collapsed_block<1>(len, {std::span<long const>(str)}, [p = ptr, &x](auto const& cl, auto const& off) {
+                parallel::for_collapsed_chunks(cl, [&](auto const& sub, auto const& o) {
+                    const long n = sub.inner_size(), s = sub.inner_stride(0);
+                    detail::for_each_inner_run(sub, [&](auto const& o2) { detail::fill_run(p + off[0] + o[0] + o2[0], s, n, x); });
+                });
+            });
+        }
+
+        /**
+         * @brief Copy the elements of another view with the same shape.
+         *
+         * @details The layouts are collapsed jointly in the memory order of this view and copied with
+         * enda::detail::strided_copy. An overlapping right hand side (e.g. a transposed view of this view) is copied into
+         * a temporary first.
+         *
+         * @tparam U Value type of the right hand side.
+         * @param rhs Right hand side view.
+         */
+        template<typename U>
+        void assign(dyn_array_view<U> const& rhs) const
+        {
+            static_assert(!std::is_const_v<T>, "Error in enda::dyn_array_view::assign: Cannot assign to a const view");
+            EXPECTS_WITH_MESSAGE(len == rhs.shape(), "Error in enda::dyn_array_view::assign: Shape mismatch");
+            if (empty())
+                return;
+            if ((static_cast<void const*>(ptr) != static_cast<void const*>(rhs.data()) or str != rhs.strides()) and
+                detail::strided_overlap(ptr, str, rhs.data(), rhs.strides(), len))
+            {
+                assign(dyn_array<std::remove_const_t<U>>(rhs).as_view());
+                return;
+            }
+            detail::for_each_collapsed_block<2>(len, {std::span<long const>(str), std::span<long const>(rhs.strides())},
+                                                [dst = ptr, src = rhs.data()](auto const& cl, auto const& off) {
+                                                    parallel::for_collapsed_chunks(cl, [&](auto const& sub, auto const& o) {
+                                                        detail::strided_copy(dst + off[0] + o[0], src + off[1] + o[1], sub);
+                                                    });
+                                                });
+        }
+    };
+
+    // Class template argument deduction guide.
+    template<MemoryArray A>
+    dyn_array_view(A&& a)
+        -> dyn_array_view<std::conditional_t<std::is_const_v<std::remove_reference_t<A>>, const typename std::decay_t<A>::value_type, typename std::decay_t<A>::value_type>>;
+
+    /**
+     * @brief Array in host memory whose rank is only known at runtime.
+     *
+     * @details The data is stored contiguously in C-order in an enda::mem::handle_heap. All the element access and whole
+     * array operations are those of enda::dyn_array_view (see enda::dyn_array::as_view). Arrays with a static rank can be
+     * copied into a enda::dyn_array and vice versa (see enda::dyn_array::as_static).
+     *
+     * @tparam T Value type.
+     */
+    template<typename T>
+    class dyn_array
+    {
+        static_assert(!std::is_const_v<T>, "Error in enda::dyn_array: Value type cannot be const");
+
+        // Memory handle.
+        typename heap<>::template handle<T> sto;
+
+        // View of the data.
+        dyn_array_view<T> v;
+
+    public:
+        /// Value type of the elements.
+        using value_type = T;
+
+        /// Default constructor creates an empty 1-dimensional array.
+        dyn_array() = default;
+
+        /**
+         * @brief Construct an array with a given shape (the elements are not initialized for trivial types).
+         * @param shape Shape of the array.
+         */
+        explicit dyn_array(dyn_shape_t const& shape) :
+            sto(std::accumulate(shape.begin(), shape.end(), 1L, std::multiplies<> {})), v(sto.data(), shape)
+        {}
+
+        /**
+         * @brief Construct an array with a given shape and set all elements to a given value.
+         *
+         * @param shape Shape of the array.
+         * @param x Value of the elements.
+         */
+        dyn_array(dyn_shape_t const& shape, T const& x) : dyn_array(shape) { v.fill(x); }
+
+        /**
+         * @brief Construct an array from any enda::Array with a static rank (copies the elements).
+         *
+         * @tparam A enda::Array type.
+         * @param a Array/view/expression.
+         */
+        template<Array A>
+        requires(std::is_constructible_v<T, get_value_t<A>>) explicit dyn_array(A const& a) : dyn_array(dyn_shape_t(a.shape()))
+        {
+            as_static<get_rank<A>>() = a;
+        }
+
+        /**
+         * @brief Construct an array from a view with a runtime rank (copies the elements).
+         *
+         * @tparam U Value type of the view.
+         * @param a View.
+         */
+        template<typename U>
+        explicit dyn_array(dyn_array_view<U> const& a) : dyn_array(a.shape())
+        {
+            v.assign(a);
+        }
+
+        /// Copy constructor (deep copy).
+        dyn_array(dyn_array const& a) : sto(a.sto), v(sto.data(), a.shape()) {}
+
+        /// Move constructor.
+        dyn_array(dyn_array&& a) noexcept : sto(std::move(a.sto)), v(std::move(a.v)) { a.v.rebind({}); }
+
+        /// Copy assignment operator (resizes the array if needed).
+        dyn_array& operator=(dyn_array const& a)
+        {
+            if (this != &a)
+                *this = a.as_view();
+            return *this;
+        }
+
+        /// Move assignment operator.
+        dyn_array& operator=(dyn_array&& a) noexcept
+        {
+            sto = std::move(a.sto);
+            v.rebind(a.v);
+            a.v.rebind({});
+            return *this;
+        }
+
+        /**
+         * @brief Assignment operator copies the elements of a view with a runtime rank (resizes the array if needed).
+         *
+         * @tparam U Value type of the view.
+         * @param a View.
+         * @return Reference to this array.
+         */
+        template<typename U>
+        dyn_array& operator=(dyn_array_view<U> const& a)
+        {
+            if (a.shape() != shape())
+            {
+                // the right hand side might be a view of this array
+                dyn_array tmp(a);
+                return *this = std::move(tmp);
+            }
+            v.assign(a);
+            return *this;
+        }
+
+        /**
+         * @brief Assignment operator sets all elements to a scalar.
+         *
+         * @tparam S enda::Scalar type.
+         * @param x Scalar value.
+         * @return Reference to this array.
+         */
+        template<Scalar S>
+        dyn_array& operator=(S const& x)
+        {
+            v.fill(x);
+            return *this;
+        }
+
+        /**
+         * @brief Resize the array (the elements are not preserved).
+         * @param shape New shape.
+         */
+        void resize(dyn_shape_t const& shape)
+        {
+            if (shape == v.shape())
+                return;
+            *this = dyn_array(shape);
+        }
+
+        /// Get a view of the array.
+        [[nodiscard]] dyn_array_view<T> as_view() noexcept { return v; }
+
+        /// Get a const view of the array.
+        [[nodiscard]] dyn_array_view<T const> as_view() const noexcept { return v; }
+
+        /// Implicit conversion to a view.
+        operator dyn_array_view<T>() noexcept { return v; } // NOLINT (implicit conversion is intended)
+
+        /// Implicit conversion to a const view.
+        operator dyn_array_view<T const>() const noexcept { return v; } // NOLINT (implicit conversion is intended)
+
+        /// Get the rank of the array.
+        [[nodiscard]] int rank() const noexcept { return v.rank(); }
+
+        /// Get the shape of the array.
+        [[nodiscard]] dyn_shape_t const& shape() const noexcept { return v.shape(); }
+
+        /// Get the strides of the array.
+        [[nodiscard]] dyn_shape_t const& strides() const noexcept { return v.strides(); }
+
+        /// Get the extent of the i-th dimension.
+        [[nodiscard]] long extent(int i) const noexcept { return v.extent(i); }
+
+        /// Get the total number of elements.
+        [[nodiscard]] long size() const noexcept { return v.size(); }
+
+        /// Is the array empty?
+        [[nodiscard]] bool empty() const noexcept { return v.empty(); }
+
+        /// Get a pointer to the first element.
+        [[nodiscard]] T* data() noexcept { return v.data(); }
+
+        /// Get a pointer to the first element (const version).
+        [[nodiscard]] T const* data() const noexcept { return v.data(); }
+
+        /// Access an element (see enda::dyn_array_view::operator()).
+        template<std::integral... Ints>
+        T& operator()(Ints... is) noexcept
+        {
+            return v(is...);
+        }
+
+        /// Access an element (const version).
+        template<std::integral... Ints>
+        T const& operator()(Ints... is) const noexcept
+        {
+            return v(is...);
+        }
+
+        /// Access an element (see enda::dyn_array_view::operator()).
+        T& operator()(std::span<long const> idx) noexcept { return v(idx); }
+
+        /// Access an element (const version).
+        T const& operator()(std::span<long const> idx) const noexcept { return v(idx); }
+
+        /// Get a view with a static rank of the data (see enda::dyn_array_view::as_static).
+        template<int R>
+        [[nodiscard]] array_view<T, R, C_layout> as_static() noexcept
+        {
+            return v.template as_static<R, C_layout>();
+        }
+
+        /// Get a const view with a static rank of the data (see enda::dyn_array_view::as_static).
+        template<int R>
+        [[nodiscard]] array_const_view<T, R, C_layout> as_static() const noexcept
+        {
+            return as_view().template as_static<R, C_layout>();
+        }
+
+        /// Get a 1-dimensional view of all elements (see enda::dyn_array_view::flatten).
+        [[nodiscard]] array_view<T, 1, C_layout> flatten() noexcept { return v.flatten(); }
+
+        /// Get a 1-dimensional const view of all elements (see enda::dyn_array_view::flatten).
+        [[nodiscard]] array_const_view<T, 1, C_layout> flatten() const noexcept { return as_view().flatten(); }
+    };
+
+    /**
+     * @brief Sum all elements of a view with a runtime rank.
+     *
+     * @details The layout is collapsed (see enda::detail::for_each_collapsed_block) and the runs are reduced with the
+     * kernels of enda::sum (see enda::detail::reduce_run), in parallel chunks for large views.
+     *
+     * @tparam T Value type of the view.
+     * @param a View.
+     * @return Sum of all elements.
+     */
+    template<typename T>
+    auto sum(dyn_array_view<T> const& a)
+    {
+        using R = std::remove_const_t<T>;
+        R res   = R {};
+        if (a.empty())
+            return res;
+        auto acc  = [](R const& x, R const& y) { return x + y; };
+        auto comb = acc;
+        detail::for_each_collapsed_block<1>(a.shape(), {std::span<long const>(a.strides())}, [&](auto const& cl, auto const& off) {
+            res = comb(res, parallel::reduce_collapsed_chunks(
+                                cl,
+                                R {},
+                                [&](auto const& sub, auto const& o) {
+                                    R          r = R {};
+                                    auto*      p = a.data() + off[0] + o[0];
+                                    const long n = sub.inner_size(), s = sub.inner_stride(0);
+                                    detail::for_each_inner_run(sub, [&](auto const& o2) { r = comb(r, detail::reduce_run(p + o2[0], s, n, R {}, acc, comb)); });
+                                    return r;
+                                },
+                                comb));
+        });
+        return res;
+    }
+
+    /**
+     * @brief Sum all elements of an array with a runtime rank (see enda::sum(dyn_array_view<T> const &)).
+     *
+     * @tparam T Value type of the array.
+     * @param a Array.
+     * @return Sum of all elements.
+     */
+    template<typename T>
+    auto sum(dyn_array<T> const& a)
+    {
+        return sum(a.as_view());
+    }
+
+} // namespace enda
@@ -31,16 +31,21 @@
 #include "Concepts.hpp"
 #include "Declarations.hpp"
 #include "Device.hpp"
+#include "DynArray.hpp"
 #include "Exceptions.hpp"
+#include "FancyIndexing.hpp"
 #include "GroupIndices.hpp"
 #include "Iterators.hpp"
 #include "Layout.hpp"
 #include "LayoutTransforms.hpp"
+#include "Linalg.hpp"
 #include "Macros.hpp"
 #include "Map.hpp"
 #include "MappedFunctions.hpp"
 #include "MatrixFunctions.hpp"
 #include "Mem.hpp"
+#include "Parallel.hpp"
 #include "Print.hpp"
+#include "Sparse.hpp"
 #include "StdUtil.hpp"
 #include "Traits.hpp"
@@ -0,0 +1,476 @@
+/**
+ * @file FancyIndexing.hpp
+ *
+ * @brief Provides gather/scatter operations on arrays/views with integer index arrays and boolean masks.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Concepts.hpp"
+#include "Layout/ForEach.hpp"
+#include "Layout/StridedCopy.hpp"
+#include "Macros.hpp"
+#include "Parallel/Execution.hpp"
+#include "Traits.hpp"
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+    #include <immintrin.h>
+#endif
+
+namespace enda
+{
+    template<typename T>
+    class gather_view;
+
+    // Specialization of enda::get_algebra for enda::gather_view.
+    template<typename T>
+    inline constexpr char get_algebra<gather_view<T>> = 'A';
+
+    namespace detail
+    {
+        // Is the type a 1-dimensional enda::Array of (non-boolean) integers?
+        template<typename I>
+        constexpr bool _is_index_array()
+        {
+            if constexpr (Array<I>)
+                return get_rank<I> == 1 and std::is_integral_v<get_value_t<I>> and !std::is_same_v<get_value_t<I>, bool>;
+            else
+                return false;
+        }
+
+        // Is the type an enda::Array of booleans with a given rank?
+        template<typename M, int R>
+        constexpr bool _is_mask()
+        {
+            if constexpr (Array<M>)
+                return get_rank<M> == R and std::is_same_v<get_value_t<M>, bool>;
+            else
+                return false;
+        }
+
+        // Can the arguments of a call operator on an array/view of rank R be used for gathering? This is the case for a
+        // single integer index array (only for R == 1) or a single boolean mask of rank R.
+        template<int R, typename... Ts>
+        inline constexpr bool is_fancy_index_v = false;
+
+        // Specialization of enda::detail::is_fancy_index_v for a single argument.
+        template<int R, typename T>
+        inline constexpr bool is_fancy_index_v<R, T> = (R == 1 and _is_index_array<T>()) or _is_mask<T, R>();
+
+        // Is the type an enda::gather_view?
+        template<typename A>
+        inline constexpr bool is_gather_view_v = false;
+
+        // Specialization of enda::detail::is_gather_view_v for enda::gather_view.
+        template<typename T>
+        inline constexpr bool is_gather_view_v<gather_view<T>> = true;
+
+        // Can the elements be moved with the 64-bit gather/scatter instructions? The data is only moved, so any trivially
+        // copyable 8 byte type can be reinterpreted as double.
+        template<typename TD, typename TS>
+        inline constexpr bool is_gather_simd_v =
+            std::is_same_v<TD, std::remove_const_t<TS>> and std::is_trivially_copyable_v<TD> and sizeof(TD) == 8 and sizeof(long) == 8;
+
+        // Gather a block of elements: dst[i * ds] = src[off[i]] for i < n. The destination must not overlap with the
+        // source (see gather_view::gather_to).
+        template<typename TD, typename TS>
+        FORCEINLINE void gather_block(TD* RESTRICT dst, long ds, TS const* RESTRICT src, long const* off, long n)
+        {
+            long i = 0;
+#if defined(__AVX512F__) || defined(__AVX2__)
+            if constexpr (is_gather_simd_v<TD, TS>)
+            {
+                if (ds == 1)
+                {
+                    auto* d       = reinterpret_cast<double*>(dst);    // NOLINT (only the bits are moved)
+                    auto const* s = reinterpret_cast<double const*>(src); // NOLINT (only the bits are moved)
+    #if defined(__AVX512F__)
+                    for (; i + 8 <= n; i += 8)
+                        _mm512_storeu_pd(d + i, _mm512_i64gather_pd(_mm512_loadu_si512(off + i), s, 8));
+    #else
+                    for (; i + 4 <= n; i += 4)
+                        _mm256_storeu_pd(d + i, _mm256_i64gather_pd(s, _mm256_loadu_si256(reinterpret_cast<__m256i const*>(off + i)), 8));
+    #endif
+                }
+            }
+#endif
+            if (ds == 1)
+            {
+                for (; i < n; ++i)
+                    dst[i] = src[off[i]];
+            }
+            else
+            {
+                for (; i < n; ++i)
+                    dst[i * ds] = src[off[i]];
+            }
+        }
+
+        // Scatter a block of elements: dst[off[i]] = src[i * ss] for i < n (AVX2 has no scatter instruction). The source
+        // must not overlap with the destination (see gather_view::assign).
+        template<typename TD, typename TS>
+        FORCEINLINE void scatter_block(TD* RESTRICT dst, long const* off, TS const* RESTRICT src, long ss, long n)
+        {
+            long i = 0;
+#if defined(__AVX512F__)
+            if constexpr (is_gather_simd_v<TD, TS>)
+            {
+                // duplicate offsets within one vector are written in order, i.e. the last one wins like in the scalar loop
+                if (ss == 1)
+                {
+                    auto* d       = reinterpret_cast<double*>(dst);    // NOLINT (only the bits are moved)
+                    auto const* s = reinterpret_cast<double const*>(src); // NOLINT (only the bits are moved)
+                    for (; i + 8 <= n; i += 8)
+                        _mm512_i64scatter_pd(d, _mm512_loadu_si512(off + i), _mm512_loadu_pd(s + i), 8);
+                }
+            }
+#endif
+            if (ss == 1)
+            {
+                for (; i < n; ++i)
+                    dst[off[i]] = src[i];
+            }
+            else
+            {
+                for (; i < n; ++i)
+                    dst[off[i]] = src[i * ss];
+            }
+        }
+
+        // Minimum number of consecutive offsets which are copied with a single memcpy instead of gathered/scattered.
+        inline constexpr long gather_min_run = 8;
+
+        // Run of consecutive offsets, i.e. off[begin + t] == off[begin] + t for t < length.
+        struct offset_run
+        {
+            long begin;
+            long length;
+        };
+
+        // Find all runs of at least enda::detail::gather_min_run consecutive offsets (in increasing order).
+        inline std::vector<offset_run> find_offset_runs(std::span<long const> off)
+        {
+            std::vector<offset_run> runs;
+            long const n = static_cast<long>(off.size());
+            long i       = 0;
+            while (i < n)
+            {
+                long k = 1;
+                while (i + k < n and off[i + k] == off[i] + k)
+                    ++k;
+                if (k >= gather_min_run)
+                    runs.push_back({i, k});
+                i += k;
+            }
+            return runs;
+        }
+
+        // Split the elements [b, e) into the (clipped) runs and the elements in between: calls `run(i, k)` for a run of
+        // length k starting at i and `block(i, k)` for k other elements.
+        template<typename FR, typename FB>
+        FORCEINLINE void for_each_run_or_block(std::span<offset_run const> runs, long b, long e, FR&& run, FB&& block)
+        { // NOLINT (we do not want to forward here)
+            auto it = std::partition_point(runs.begin(), runs.end(), [b](auto const& r) { return r.begin + r.length <= b; });
+            long p  = b; // begin of the pending elements which are not part of a run
+            for (; it != runs.end() and it->begin < e; ++it)
+            {
+                long const rb = std::max(it->begin, b);
+                long const re = std::min(it->begin + it->length, e);
+                block(p, rb - p);
+                run(rb, re - rb);
+                p = re;
+            }
+            block(p, e - p);
+        }
+
+        /**
+         * @brief Gather elements from memory with precomputed offsets.
+         *
+         * @details Computes `dst[i * ds] = src[off[i]]` for `b <= i < e`. The given runs of consecutive offsets (see
+         * enda::detail::find_offset_runs) are copied with enda::detail::copy_run (i.e. a memcpy for contiguous
+         * destinations), the rest is gathered with SIMD instructions if possible.
+         */
+        template<typename TD, typename TS>
+        void gather(TD* dst, long ds, TS const* src, long const* off, std::span<offset_run const> runs, long b, long e)
+        {
+            for_each_run_or_block(
+                runs, b, e, [&](long i, long k) { copy_run(dst + i * ds, ds, src + off[i], 1, k); },
+                [&](long i, long k) { gather_block(dst + i * ds, ds, src, off + i, k); });
+        }
+
+        /**
+         * @brief Scatter elements to memory with precomputed offsets.
+         *
+         * @details Computes `dst[off[i]] = src[i * ss]` for `b <= i < e` in order (for duplicate offsets, the last element
+         * wins). Runs of consecutive offsets are handled as in enda::detail::gather.
+         */
+        template<typename TD, typename TS>
+        void scatter(TD* dst, long const* off, TS const* src, long ss, std::span<offset_run const> runs, long b, long e)
+        {
+            for_each_run_or_block(
+                runs, b, e, [&](long i, long k) { copy_run(dst + off[i], 1, src + i * ss, ss, k); },
+                [&](long i, long k) { scatter_block(dst, off + i, src + i * ss, ss, k); });
+        }
+
+        // Memory offsets of the elements selected by an enda::gather_view and the runs of consecutive offsets among them.
+        struct gather_index
+        {
+            std::vector<long> offsets;
+            std::vector<offset_run> runs;
+            long min_offset = 0;
+            long max_offset = -1;
+
+            explicit gather_index(std::vector<long> off) : offsets(std::move(off)), runs(find_offset_runs(offsets))
+            {
+                if (!offsets.empty())
+                {
+                    auto const [lo, hi] = std::ranges::minmax_element(offsets);
+                    min_offset          = *lo;
+                    max_offset          = *hi;
+                }
+            }
+        };
+
+        // Do the n elements at p with stride s and the address range [b, e) overlap?
+        template<typename U>
+        bool strided_overlaps(U const* p, long s, long n, void const* b, void const* e)
+        {
+            if (n == 0)
+                return false;
+            long const d = (n - 1) * s;
+            U const* lo  = p + std::min(d, 0l);
+            U const* hi  = p + std::max(d, 0l) + 1;
+            return std::less<> {}(static_cast<void const*>(lo), e) and std::less<> {}(b, static_cast<void const*>(hi));
+        }
+
+        // Compute the memory offsets of the elements selected by an integer index array in a 1-dimensional array/view.
+        template<typename A, typename I>
+        std::vector<long> gather_offsets(A const& a, I const& idx)
+        {
+            long const n                    = idx.size();
+            [[maybe_unused]] long const len = a.shape()[0];
+            std::vector<long> off(n);
+            for (long i = 0; i < n; ++i)
+            {
+                long const j = idx(i);
+                EXPECTS_WITH_MESSAGE(j >= 0 and j < len, "Error in enda::gather_view: Index out of bounds");
+                off[i] = a.indexmap()(j);
+            }
+            return off;
+        }
+
+        // Compute the memory offsets of the elements selected by a boolean mask (in C-order).
+        template<typename A, typename M>
+        std::vector<long> mask_offsets(A const& a, M const& mask)
+        {
+            EXPECTS_WITH_MESSAGE(a.shape() == mask.shape(), "Error in enda::gather_view: Mask and array have different shapes");
+            std::vector<long> off;
+            enda::for_each(a.shape(), [&](auto... is) {
+                if (mask(is...))
+                    off.push_back(a.indexmap()(is...));
+            });
+            return off;
+        }
+
+    } // namespace detail
+
+    /**
+     * @addtogroup av_utils
+     * @{
+     */
+
+    /**
+     * @brief Lazy 1-dimensional view of the elements of an array/view selected by an index array or a boolean mask.
+     *
+     * @details It is returned by the call operator of an enda::basic_array or enda::basic_array_view of
+     * - rank 1 when called with a 1-dimensional integer enda::Array `idx`: the i-th element is `a(idx(i))`,
+     * - rank R when called with a boolean enda::Array `mask` of the same shape: the elements `a(is...)` for which
+     *   `mask(is...)` is true, in C-order.
+     *
+     * The memory offsets of the selected elements and the runs of consecutive offsets among them are computed once on
+     * construction. The view fulfils the enda::Array
+     * concept, i.e. it can be used in expressions and assigned to arrays/views, which gathers the elements (runs of
+     * consecutive offsets are copied with memcpy, the rest uses SIMD gather instructions if available):
+     *
+     * @code{.cpp}
+     * auto a = enda::array<double, 1>{10, 20, 30, 40};
+     * auto b = enda::array<double, 1>(a(enda::array<long, 1>{3, 0}));  // b = {40, 10}
+     * a(a_mask) = 0;                                                    // scatter a scalar
+     * a(enda::array<long, 1>{1, 2}) = enda::array<double, 1>{-1, -2}; // scatter an array
+     * @endcode
+     *
+     * Assigning to a gather view scatters the elements in order, i.e. for duplicate indices the last element wins.
+     *
+     * @tparam T Value type of the underlying array/view (const for read-only access).
+     */
+    template<typename T>
+    class gather_view
+    {
+        // Pointer to the data of the underlying array/view.
+        T* ptr = nullptr;
+
+        // Memory offsets of the selected elements (shared between copies).
+        std::shared_ptr<detail::gather_index const> idx;
+
+    public:
+        /// Value type of the selected elements.
+        using value_type = std::remove_const_t<T>;
+
+        /**
+         * @brief Construct a gather view from a data pointer and the memory offsets of the selected elements.
+         *
+         * @param p Pointer to the data of the underlying array/view.
+         * @param offsets Memory offsets of the selected elements w.r.t. `p`.
+         */
+        gather_view(T* p, std::vector<long> offsets) : ptr(p), idx(std::make_shared<detail::gather_index const>(std::move(offsets))) {}
+
+        /// Default copy constructor makes a shallow copy.
+        gather_view(gather_view const&) = default;
+
+        /// Default move constructor makes a shallow copy.
+        gather_view(gather_view&&) = default;
+
+        /**
+         * @brief Copy assignment operator scatters the elements of another gather view.
+         * @param rhs Right hand side of the assignment.
+         */
+        gather_view& operator=(gather_view const& rhs)
+        {
+            assign(rhs);
+            return *this;
+        }
+
+        /**
+         * @brief Assignment operator scatters the elements of an enda::Array.
+         *
+         * @tparam A enda::ArrayOfRank<1> type.
+         * @param rhs Right hand side of the assignment.
+         */
+        template<ArrayOfRank<1> A>
+        gather_view& operator=(A const& rhs)
+        {
+            assign(rhs);
+            return *this;
+        }
+
+        /**
+         * @brief Assignment operator assigns a scalar to all selected elements.
+         *
+         * @tparam S Scalar type.
+         * @param x Right hand side of the assignment.
+         */
+        template<typename S>
+            requires(is_scalar_for_v<S, gather_view>)
+        gather_view& operator=(S const& x)
+        {
+            static_assert(!std::is_const_v<T>, "Error in enda::gather_view: Cannot assign to a const view");
+            long const* off = idx->offsets.data();
+            detail::for_each_run_or_block(
+                idx->runs, 0, size(), [&](long i, long k) { detail::fill_run(ptr + off[i], 1, k, x); },
+                [&](long i, long k) {
+                    for (long j = i; j < i + k; ++j)
+                        ptr[off[j]] = x;
+                });
+            return *this;
+        }
+
+        /// Get the shape of the view, i.e. the number of selected elements.
+        [[nodiscard]] std::array<long, 1> shape() const noexcept { return {size()}; }
+
+        /// Get the number of selected elements.
+        [[nodiscard]] long size() const noexcept { return static_cast<long>(idx->offsets.size()); }
+
+        /// Get the memory offsets of the selected elements.
+        [[nodiscard]] std::span<long const> offsets() const noexcept { return idx->offsets; }
+
+        /// Get the data pointer of the underlying array/view.
+        [[nodiscard]] T* data() const noexcept { return ptr; }
+
+        /**
+         * @brief Access the i-th selected element.
+         *
+         * @param i Index of the element.
+         * @return Reference to the element.
+         */
+        [[nodiscard]] T& operator()(long i) const noexcept { return ptr[idx->offsets[i]]; }
+
+        /// Same as gather_view::operator()(long).
+        [[nodiscard]] T& operator[](long i) const noexcept { return ptr[idx->offsets[i]]; }
+
+        /**
+         * @brief Gather the selected elements into strided memory.
+         *
+         * @details Large gathers are split into chunks which run in parallel (see enda::parallel::use_parallel). If the
+         * destination overlaps with the selected elements (e.g. `a = a(p)`), the elements are gathered into a temporary
+         * buffer first.
+         *
+         * @tparam U Value type of the destination.
+         * @param dst Pointer to the destination.
+         * @param ds Stride of the destination.
+         */
+        template<typename U>
+        void gather_to(U* dst, long ds) const
+        {
+            long const n = size();
+            if (overlaps(dst, ds, n))
+            {
+                auto tmp = std::make_unique<value_type[]>(n);
+                detail::gather(tmp.get(), 1, ptr, idx->offsets.data(), idx->runs, 0, n);
+                detail::copy_run(dst, ds, tmp.get(), 1, n);
+                return;
+            }
+            if (parallel::use_parallel(n))
+                parallel::for_chunks(n, [&](long b, long e) { detail::gather(dst, ds, ptr, idx->offsets.data(), idx->runs, b, e); });
+            else
+                detail::gather(dst, ds, ptr, idx->offsets.data(), idx->runs, 0, n);
+        }
+
+    private:
+        // Do the n elements at p with stride s overlap with the memory spanned by the selected elements?
+        template<typename U>
+        [[nodiscard]] bool overlaps(U const* p, long s, long n) const
+        {
+            if (idx->offsets.empty())
+                return false;
+            return detail::strided_overlaps(p, s, n, ptr + idx->min_offset, ptr + idx->max_offset + 1);
+        }
+
+        // Scatter the elements of a 1-dimensional array.
+        template<typename A>
+        void assign(A const& rhs)
+        {
+            static_assert(!std::is_const_v<T>, "Error in enda::gather_view: Cannot assign to a const view");
+            EXPECTS_WITH_MESSAGE(rhs.size() == size(), "Error in enda::gather_view: Size mismatch in assignment");
+            if constexpr (MemoryArray<A> and requires { rhs.indexmap().strides(); })
+            {
+                if constexpr (std::is_same_v<std::remove_const_t<std::remove_pointer_t<decltype(rhs.data())>>, value_type>)
+                {
+                    // scatter directly from memory unless the source overlaps with the selected elements (e.g. a(p) = a)
+                    if (!overlaps(rhs.data(), rhs.indexmap().strides()[0], size()))
+                    {
+                        detail::scatter(ptr, idx->offsets.data(), rhs.data(), rhs.indexmap().strides()[0], idx->runs, 0, size());
+                        return;
+                    }
+                }
+            }
+            // evaluate the right hand side first since it might depend on the selected elements
+            auto tmp = std::make_unique<value_type[]>(size());
+            for (long i = 0; i < size(); ++i)
+                tmp[i] = rhs(i);
+            detail::scatter(ptr, idx->offsets.data(), tmp.get(), 1, idx->runs, 0, size());
+        }
+    };
+
+    /** @} */
+
+} // namespace enda
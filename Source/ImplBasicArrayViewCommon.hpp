@@ -83,6 +83,14 @@ FORCEINLINE static decltype(auto) call(Self&& self, Ts const&... idxs) noexcept(
         // if no arguments are given, a full view is returned
         return basic_array_view<r_v_t, Rank, LayoutPolicy, Algebra, AccessorPolicy, OwningPolicy> {self.lay, self.sto};
     }
+    else if constexpr (detail::is_fancy_index_v<Rank, Ts...>)
+    {
+        // gather the elements selected by an integer index array or a boolean mask (see enda::gather_view)
+        if constexpr (Rank == 1 and (detail::_is_index_array<Ts>() and ...))
+            return gather_view<r_v_t> {self.sto.data(), detail::gather_offsets(self, idxs...)};
+        else
+            return gather_view<r_v_t> {self.sto.data(), detail::mask_offsets(self, idxs...)};
+    }
     else
     {
         // otherwise we check the arguments and either access a single element or make a slice
@@ -107,6 +115,10 @@ FORCEINLINE static decltype(auto) call(Self&& self, Ts const&... idxs) noexcept(
                 return ValueType {self.sto[offset]};
             }
         }
+        else if constexpr (is_blocked_idx_map_v<layout_t>)
+        {
+            static_assert(always_false<layout_t>, "Error in array/view: Arrays/views with a blocked layout cannot be sliced");
+        }
         else
         {
             // access a slice of the view/array
@@ -125,7 +137,8 @@ public:
 template<typename... Ts>
 FORCEINLINE decltype(auto) operator()(Ts const&... idxs) const& noexcept(has_no_boundcheck)
 {
-    static_assert((rank == -1) or (sizeof...(Ts) == rank) or (sizeof...(Ts) == 0) or (ellipsis_is_present<Ts...> and (sizeof...(Ts) <= rank + 1)),
+    static_assert((rank == -1) or (sizeof...(Ts) == rank) or (sizeof...(Ts) == 0) or (ellipsis_is_present<Ts...> and (sizeof...(Ts) <= rank + 1)) or
+                      detail::is_fancy_index_v<Rank, Ts...>,
                   "Error in array/view: Incorrect number of parameters in call operator");
     return call<Algebra, false>(*this, idxs...);
 }
@@ -133,7 +146,8 @@ FORCEINLINE decltype(auto) operator()(Ts const&... idxs) const& noexcept(has_no_
 template<typename... Ts>
 FORCEINLINE decltype(auto) operator()(Ts const&... idxs) & noexcept(has_no_boundcheck)
 {
-    static_assert((rank == -1) or (sizeof...(Ts) == rank) or (sizeof...(Ts) == 0) or (ellipsis_is_present<Ts...> and (sizeof...(Ts) <= rank + 1)),
+    static_assert((rank == -1) or (sizeof...(Ts) == rank) or (sizeof...(Ts) == 0) or (ellipsis_is_present<Ts...> and (sizeof...(Ts) <= rank + 1)) or
+                      detail::is_fancy_index_v<Rank, Ts...>,
                   "Error in array/view: Incorrect number of parameters in call operator");
     return call<Algebra, false>(*this, idxs...);
 }
@@ -141,7 +155,8 @@ FORCEINLINE decltype(auto) operator()(Ts const&... idxs) & noexcept(has_no_bound
 template<typename... Ts>
 FORCEINLINE decltype(auto) operator()(Ts const&... idxs) && noexcept(has_no_boundcheck)
 {
-    static_assert((rank == -1) or (sizeof...(Ts) == rank) or (sizeof...(Ts) == 0) or (ellipsis_is_present<Ts...> and (sizeof...(Ts) <= rank + 1)),
+    static_assert((rank == -1) or (sizeof...(Ts) == rank) or (sizeof...(Ts) == 0) or (ellipsis_is_present<Ts...> and (sizeof...(Ts) <= rank + 1)) or
+                      detail::is_fancy_index_v<Rank, Ts...>,
                   "Error in array/view: Incorrect number of parameters in call operator");
     return call<Algebra, true>(*this, idxs...);
 }
@@ -169,15 +184,24 @@ decltype(auto) operator[](T const& x) && noexcept(has_no_boundcheck)
 
 static constexpr int iterator_rank = (has_strided_1d(layout_t::layout_prop) ? 1 : Rank);
 
-using const_iterator = array_iterator<iterator_rank, ValueType const, typename AccessorPolicy::template accessor<ValueType>::pointer>;
+using const_iterator = std::conditional_t<is_blocked_idx_map_v<layout_t>,
+                                          blocked_array_iterator<layout_t, ValueType const, typename AccessorPolicy::template accessor<ValueType>::pointer>,
+                                          array_iterator<iterator_rank, ValueType const, typename AccessorPolicy::template accessor<ValueType>::pointer>>;
 
-using iterator = array_iterator<iterator_rank, ValueType, typename AccessorPolicy::template accessor<ValueType>::pointer>;
+using iterator = std::conditional_t<is_blocked_idx_map_v<layout_t>,
+                                    blocked_array_iterator<layout_t, ValueType, typename AccessorPolicy::template accessor<ValueType>::pointer>,
+                                    array_iterator<iterator_rank, ValueType, typename AccessorPolicy::template accessor<ValueType>::pointer>>;
 
 private:
 template<typename Iterator>
 [[nodiscard]] auto make_iterator(bool at_end) const noexcept
 {
-    if constexpr (iterator_rank == Rank)
+    if constexpr (is_blocked_idx_map_v<layout_t>)
+    {
+        // blocked layout (the iterator uses the index map)
+        return Iterator {indexmap(), sto.data(), at_end};
+    }
+    else if constexpr (iterator_rank == Rank)
     {
         // multi-dimensional iterator
         if constexpr (layout_t::is_stride_order_C())
@@ -250,6 +274,16 @@ auto& operator=(R const& rhs) noexcept requires(Rank == 1 and not MemoryArray<R>
 }
 
 private:
+// Does the memory of an array/view in host memory overlap with the memory of this array/view? The exact same elements in
+// the same layout (e.g. a = a) can be copied elementwise and do not count as overlapping.
+template<typename A>
+bool overlaps_with(A const& a) const
+{
+    if (static_cast<void const*>(a.data()) == static_cast<void const*>(data()) and a.indexmap().strides() == indexmap().strides())
+        return false;
+    return detail::strided_overlap(data(), indexmap().strides(), a.data(), a.indexmap().strides(), shape());
+}
+
 template<typename RHS>
 void assign_from_ndarray(RHS const& rhs)
 {
@@ -261,6 +295,62 @@ void assign_from_ndarray(RHS const& rhs)
     // compile-time check if assignment is possible
     static_assert(std::is_assignable_v<value_type&, get_value_t<RHS>>, "Error in assign_from_ndarray: Incompatible value types");
 
+    // fuse lazy matrix products into the assignment if possible (see enda::expr_matmul)
+    if constexpr (detail::products_in<RHS>::any)
+    {
+        if (detail::assign_products(*this, rhs))
+            return;
+    }
+
+    // gather the elements selected by an index array or a mask directly into memory (gather_view::gather_to uses a
+    // temporary buffer if the destination overlaps with the selected elements, e.g. for b = b(p))
+    if constexpr (detail::is_gather_view_v<RHS> and requires { indexmap().strides(); })
+    {
+        rhs.gather_to(data(), indexmap().strides()[0]);
+        return;
+    }
+
+    // blocked layouts: copy the memory if both layouts are the same, otherwise traverse the elements block by block
+    if constexpr (is_blocked_idx_map_v<layout_t> or detail::has_blocked_layout<RHS>::value)
+    {
+        if constexpr (requires { requires std::is_same_v<std::remove_cvref_t<decltype(rhs.indexmap())>, layout_t>; } and have_same_value_type_v<self_t, RHS>)
+        {
+            if (rhs.indexmap() == indexmap())
+            {
+                std::copy(rhs.data(), rhs.data() + detail::storage_size(indexmap()), data());
+                return;
+            }
+        }
+        std::array<long, Rank> tile {};
+        if constexpr (is_blocked_idx_map_v<layout_t>)
+            tile = detail::block_traversal_tile(indexmap());
+        else
+            tile = detail::block_traversal_tile(rhs.indexmap());
+        enda::for_each_tile(shape(), tile, [this, &rhs](auto... is) { (*this)(is...) = rhs(is...); });
+        return;
+    }
+
+    // conjugated arrays/views on host (e.g. enda::dagger of a complex matrix): cache-blocked conjugating copy
+    if constexpr (detail::is_conj_call_v<RHS>)
+    {
+        using src_t = std::remove_cvref_t<decltype(std::get<0>(rhs.a))>;
+        if constexpr (MemoryArray<self_t> and MemoryArray<src_t> and mem::on_host<self_t, src_t>)
+        {
+            auto const& src = std::get<0>(rhs.a);
+            if (src.empty())
+                return;
+            if (overlaps_with(src))
+            {
+                // the copy kernels require disjoint operands (e.g. for a = dagger(a)): evaluate into a temporary first
+                assign_from_ndarray(enda::array<std::remove_cvref_t<get_value_t<RHS>>, Rank>(rhs));
+                return;
+            }
+            auto cl = detail::collapse_copy_layout(indexmap().strides(), src.indexmap().strides(), shape());
+            parallel::for_collapsed_chunks(cl, [this, &src](auto const& sub, auto const& off) { detail::strided_copy<true>(data() + off[0], src.data() + off[1], sub); });
+            return;
+        }
+    }
+
     // are both operands enda::MemoryArray types?
     static constexpr bool both_in_memory = MemoryArray<self_t> and MemoryArray<RHS>;
 
@@ -276,9 +366,17 @@ void assign_from_ndarray(RHS const& rhs)
         static constexpr bool both_1d_strided = has_layout_strided_1d<self_t> and has_layout_strided_1d<RHS>;
         if constexpr (mem::on_host<self_t, RHS> and both_1d_strided)
         {
-            // vectorizable copy on host
-            for (long i = 0; i < size(); ++i)
-                (*this)(_linear_index_t {i}) = rhs(_linear_index_t {i});
+            // vectorizable copy on host (split into chunks of linear indices for large arrays)
+            auto copy_range = [this, &rhs](long begin, long end) {
+                for (long i = begin; i < end; ++i)
+                    (*this)(_linear_index_t {i}) = rhs(_linear_index_t {i});
+            };
+            if constexpr (layout_t::ce_size() != 0)
+                copy_range(0, layout_t::ce_size()); // static size: fully unrolled (e.g. enda::stack_array)
+            else if (parallel::use_parallel(size()))
+                parallel::for_chunks(size(), copy_range);
+            else
+                copy_range(0, size());
             return;
         }
         else if constexpr (!mem::on_host<self_t, RHS> and have_same_value_type_v<self_t, RHS>)
@@ -320,45 +418,101 @@ void assign_from_ndarray(RHS const& rhs)
             }
         }
     }
+    // general strided layouts on host: collapse adjacent dimensions and copy in the memory order of the destination
+    // (cache-blocked and transposing if the stride orders differ)
+    if constexpr (both_in_memory and mem::on_host<self_t, RHS>)
+    {
+        if (rhs.empty())
+            return;
+        if (overlaps_with(rhs))
+        {
+            // the copy kernels require disjoint operands (e.g. for a = transpose(a)): copy into a temporary first (see also
+            // enda::transpose_inplace)
+            assign_from_ndarray(enda::array<std::remove_cvref_t<get_value_t<RHS>>, Rank>(rhs));
+            return;
+        }
+        auto cl = detail::collapse_copy_layout(indexmap().strides(), rhs.indexmap().strides(), shape());
+        parallel::for_collapsed_chunks(cl, [this, &rhs](auto const& sub, auto const& off) { detail::strided_copy(data() + off[0], rhs.data() + off[1], sub); });
+        return;
+    }
     // otherwise fallback to elementwise assignment
     if constexpr (mem::on_device<self_t> || mem::on_device<RHS>)
     {
         ENDA_RUNTIME_ERROR << "Error in assign_from_ndarray: Fallback to elementwise assignment not implemented for arrays/views on the GPU";
     }
-    enda::for_each(shape(), [this, &rhs](auto const&... args) { (*this)(args...) = rhs(args...); });
+    // traverse the elements in the memory order of the destination (split along the slowest dimension for large arrays)
+    if constexpr (mem::on_host<self_t, RHS> and layout_t::ce_size() == 0)
+    {
+        if (parallel::use_parallel(size()))
+        {
+            static constexpr int j = layout_t::stride_order[0];
+            parallel::for_chunks(shape()[j], [this, &rhs](long begin, long end) {
+                auto sub = shape();
+                sub[j]   = end - begin;
+                enda::for_each_static<0, layout_t::stride_order_encoded>(sub, [this, &rhs, begin](auto... args) {
+                    auto idx = std::array<long, Rank> {args...};
+                    idx[j] += begin;
+                    std::apply([this, &rhs](auto... is) { (*this)(is...) = rhs(is...); }, idx);
+                });
+            });
+            return;
+        }
+    }
+    enda::for_each_static<layout_t::static_extents_encoded, layout_t::stride_order_encoded>(
+        shape(), [this, &rhs](auto const&... args) { (*this)(args...) = rhs(args...); });
 }
 
 template<typename Scalar>
-void fill_with_scalar(Scalar const& scalar) noexcept
+void fill_with_scalar(Scalar const& scalar)
 {
     // we make a special implementation if the array is strided in 1d or contiguous
     if constexpr (has_layout_strided_1d<self_t>)
     {
-        const long L             = size();
-        auto* __restrict const p = data(); // no alias possible here!
-        if constexpr (has_contiguous_layout<self_t>)
-        {
-            for (long i = 0; i < L; ++i)
-                p[i] = scalar;
-        }
+        const long L = (layout_t::ce_size() != 0 ? layout_t::ce_size() : size());
+        auto fill_range = [p = data(), stri = indexmap().min_stride(), &scalar](long begin, long end) {
+            auto* __restrict const q = p; // no alias possible here!
+            if constexpr (has_contiguous_layout<self_t>)
+            {
+                for (long i = begin; i < end; ++i)
+                    q[i] = scalar;
+            }
+            else
+            {
+                for (long i = begin * stri; i < end * stri; i += stri)
+                    q[i] = scalar;
+            }
+        };
+        if (mem::on_host<self_t> and layout_t::ce_size() == 0 and parallel::use_parallel(L))
+            parallel::for_chunks(L, fill_range);
         else
-        {
-            const long stri  = indexmap().min_stride();
-            const long Lstri = L * stri;
-            for (long i = 0; i < Lstri; i += stri)
-                p[i] = scalar;
-        }
+            fill_range(0, L);
+    }
+    else if constexpr (is_blocked_idx_map_v<layout_t>)
+    {
+        // blocked layouts: fill the whole memory (including the padding)
+        std::fill(data(), data() + detail::storage_size(indexmap()), scalar);
+    }
+    else if constexpr (mem::on_host<self_t>)
+    {
+        // no compile-time memory layout guarantees: merge adjacent dimensions and fill the remaining runs
+        if (empty())
+            return;
+        auto cl = detail::collapse_dims(indexmap().lengths(), indexmap().strides(), layout_t::stride_order);
+        parallel::for_collapsed_chunks(cl, [p = data(), &scalar](auto const& sub, auto const& off) {
+            const long n = sub.inner_size(), s = sub.inner_stride(0);
+            detail::for_each_inner_run(sub, [&](auto const& o) { detail::fill_run(p + off[0] + o[0], s, n, scalar); });
+        });
     }
     else
     {
-        // no compile-time memory layout guarantees
-        for (auto& x : *this)
-            x = scalar;
+        // use nested loops in the memory order of the array
+        enda::for_each_static<layout_t::static_extents_encoded, layout_t::stride_order_encoded>(
+            shape(), [this, &scalar](auto const&... args) { (*this)(args...) = scalar; });
     }
 }
 
 template<typename Scalar>
-void assign_from_scalar(Scalar const& scalar) noexcept
+void assign_from_scalar(Scalar const& scalar)
 {
     static_assert(!is_const, "Error in assign_from_ndarray: Cannot assign to a const view");
     if constexpr (Algebra != 'M')
@@ -6,97 +6,24 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <iterator>
+#include <tuple>
+#include <type_traits>
 
-#include "StdUtil/Array.hpp"
 
 namespace enda
 {
     namespace detail
     {
 
-        // N-dimensional rectangular grid iterator in C traversal order.
+        // Rectangular grid iterator (only the 1-dimensional case is needed, see enda::array_iterator).
         template<int Rank>
-        class grid_iterator
-        {
-            // Stride or number of elements to skip when increasing the iterator in the current dimension.
-            long stri = 0;
-
-            // Position of the iterator in the current dimension.
-            long pos = 0;
-
-            // Position times the stride in the current dimension.
-            long offset = 0;
-
-            // Iterator to the beginning of the Rank - 1 dimensional grid (excluding the current dimension).
-            grid_iterator<Rank - 1> it_begin;
-
-            // Iterator to the end of the Rank - 1 dimensional grid (excluding the current dimension).
-            grid_iterator<Rank - 1> it_end;
-
-            // Iterator to the Rank - 1 dimensional grid (excluding the current dimension).
-            grid_iterator<Rank - 1> it;
-
-        public:
-            using iterator_category = std::forward_iterator_tag;
-            using value_type        = long;
-            using difference_type   = std::ptrdiff_t;
-            using pointer           = long*;
-            using reference         = long&;
-
-            // Default constructor.
-            grid_iterator() = default;
-
-            // Construct an iterator from the shape of the grid, the stride of the grid and a flag indicating if the iterator
-            // is at the end.
-            grid_iterator(long const* lengths, long const* strides, bool at_end) :
-                stri(strides[0]), pos(at_end ? lengths[0] : 0), offset(pos * stri), it_begin(lengths + 1, strides + 1, false),
-                it_end(lengths + 1, strides + 1, true), it(it_begin)
-            {}
-
-            // Get the position/multi-dimensional index of the iterator.
-            [[nodiscard]] std::array<long, Rank> indices() { return stdutil::front_append(it.indices(), pos); }
-
-            // Dereference operator returns the sum of the offsets of every dimension = its linear index.
-            [[nodiscard]] long operator*() const { return offset + *it; }
-
-            // Member access operator returns the sum of the offsets of every dimension = its linear index.
-            [[nodiscard]] long operator->() const { return operator*(); }
-
-            // True if the positions of the iterators are equal in every dimension, false otherwise.
-            [[nodiscard]] bool operator==(grid_iterator const& rhs) const { return ((rhs.pos == pos) and (rhs.it == it)); }
+        class grid_iterator;
 
-            // True if the positions of the iterators are not equal in every dimension, false otherwise.
-            [[nodiscard]] bool operator!=(grid_iterator const& rhs) const { return not operator==(rhs); }
-
-            // Prefix increment operator.
-            grid_iterator& operator++()
-            {
-                // increment the iterator of the subgrid
-                ++it;
-
-                // if the iterator of the subgrid is at the end, reset it and increment the current position and offset
-                if (it == it_end)
-                { // FIXME [[unlikely]]
-                    ++pos;
-                    offset += stri;
-                    it = it_begin;
-                }
-                return *this;
-            }
-
-            // Postfix increment operator.
-            grid_iterator operator++(int)
-            {
-                auto c = *this;
-                ++(*this);
-                return c;
-            }
-        };
-
-        // Specialization of enda::grid_iterator for 1-dimensional grids.
+        // 1-dimensional grid iterator.
         template<>
         class grid_iterator<1>
         {
@@ -124,7 +51,7 @@ namespace enda
             grid_iterator(long const* lengths, long const* strides, bool at_end) : stri(strides[0]), pos(at_end ? lengths[0] : 0), offset(pos * stri) {}
 
             // Get the position/index of the iterator.
-            [[nodiscard]] std::array<long, 1> indices() { return {pos}; }
+            [[nodiscard]] std::array<long, 1> indices() const { return {pos}; }
 
             // Dereference operator returns the offset = its linear index.
             [[nodiscard]] long operator*() const { return offset; }
@@ -183,11 +110,16 @@ namespace enda
      * @brief Iterator for enda::basic_array and enda::basic_array_view types.
      *
      * @details It is a <a href="https://en.cppreference.com/w/cpp/named_req/RandomAccessIterator">LegacyRandomAccessIterator</a>
-     * for 1-dimensional and a <a href="https://en.cppreference.com/w/cpp/named_req/ForwardIterator">LegacyForwardIterator</a>
-     * for multi-dimensional arrays/views.
+     * (and a `std::random_access_iterator`), so that e.g. `std::sort` or `std::nth_element` can be used on
+     * multi-dimensional arrays/views.
+     *
+     * The iterator stores its linear position in the traversal together with the corresponding multi-dimensional index
+     * and memory offset. Incrementing it only touches the innermost dimension unless a carry is needed. Jumps by `n`
+     * elements stay within the innermost dimension if possible and otherwise recompute the index from the position
+     * with the precomputed sizes of the subgrids, i.e. with `Rank` divisions, independent of `n`.
      *
-     * Given the shape, strides and a pointer to the start of the data, the iterator uses an `enda::detail::grid_iterator`
-     * to traverse the element in the array/view.
+     * The traversal consists of segments, i.e. runs along the innermost dimension with a constant stride (see
+     * enda::for_each_segment), which can be processed with raw pointers instead of the iterator.
      *
      * @note The memory layout is always assumed to be C-style. For other layouts, one has to permute the given shape and
      * the strides according to the stride order.
@@ -204,20 +136,50 @@ namespace enda
         T* data = nullptr;
 
         // Shape of the array.
-        std::array<long, Rank> len;
+        std::array<long, Rank> len {};
 
         // Strides of the array.
-        std::array<long, Rank> stri;
+        std::array<long, Rank> stri {};
 
-        // Grid iterator.
-        detail::grid_iterator<Rank> iter;
+        // Number of elements in the subgrid spanned by the dimensions faster than a given dimension.
+        std::array<long, Rank> sub_size {};
+
+        // Multi-dimensional index of the current element.
+        std::array<long, Rank> idx {};
+
+        // Linear position of the current element in the traversal.
+        long pos = 0;
+
+        // Memory offset of the current element.
+        long offset = 0;
+
+        // Move the iterator to a given linear position.
+        void set_position(long p) noexcept
+        {
+            pos    = p;
+            offset = 0;
+            if (p == len[0] * sub_size[0])
+            {
+                // the end is one past the last element in the slowest dimension
+                idx.fill(0);
+                idx[0] = len[0];
+                offset = len[0] * stri[0];
+                return;
+            }
+            for (int k = 0; k < Rank; ++k)
+            {
+                idx[k] = p / sub_size[k];
+                p -= idx[k] * sub_size[k];
+                offset += idx[k] * stri[k];
+            }
+        }
 
     public:
         // Iterator category.
-        using iterator_category = std::forward_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
 
         // Value type.
-        using value_type = T;
+        using value_type = std::remove_const_t<T>;
 
         // Difference type.
         using difference_type = std::ptrdiff_t;
@@ -241,31 +203,121 @@ namespace enda
          * @param at_end Flag indicating if the iterator is at the end.
          */
         array_iterator(std::array<long, Rank> const& lengths, std::array<long, Rank> const& strides, T* start, bool at_end) :
-            data(start), len(lengths), stri(strides), iter(len.data(), stri.data(), at_end)
-        {}
+            data(start), len(lengths), stri(strides)
+        {
+            sub_size[Rank - 1] = 1;
+            for (int k = Rank - 2; k >= 0; --k)
+                sub_size[k] = sub_size[k + 1] * len[k + 1];
+            set_position(at_end ? len[0] * sub_size[0] : 0);
+        }
 
-        [[nodiscard]] auto indices() { return iter.indices(); }
+        [[nodiscard]] auto indices() const { return idx; }
 
-        [[nodiscard]] value_type& operator*() const { return ((Pointer)data)[*iter]; }
+        [[nodiscard]] T& operator*() const { return ((Pointer)data)[offset]; }
 
-        [[nodiscard]] value_type& operator->() const { return operator*(); }
+        [[nodiscard]] T* operator->() const { return &operator*(); }
 
         array_iterator& operator++()
         {
-            ++iter;
+            ++pos;
+            offset += stri[Rank - 1];
+            if (++idx[Rank - 1] == len[Rank - 1])
+            {
+                // carry over to the slower dimensions
+                for (int k = Rank - 1; k > 0 and idx[k] == len[k]; --k)
+                {
+                    offset += stri[k - 1] - len[k] * stri[k];
+                    idx[k] = 0;
+                    ++idx[k - 1];
+                }
+            }
             return *this;
         }
 
         array_iterator operator++(int)
         {
             auto c = *this;
-            ++iter;
+            ++(*this);
             return c;
         }
 
-        [[nodiscard]] bool operator==(array_iterator const& rhs) const { return (rhs.iter == iter); }
+        array_iterator& operator--()
+        {
+            --pos;
+            int k = Rank - 1;
+            for (; k > 0 and idx[k] == 0; --k)
+            {
+                // borrow from the slower dimensions
+                idx[k] = len[k] - 1;
+                offset += idx[k] * stri[k];
+            }
+            --idx[k];
+            offset -= stri[k];
+            return *this;
+        }
 
-        [[nodiscard]] bool operator!=(array_iterator const& rhs) const { return (!operator==(rhs)); }
+        array_iterator operator--(int)
+        {
+            auto c = *this;
+            --(*this);
+            return c;
+        }
+
+        array_iterator& operator+=(std::ptrdiff_t n)
+        {
+            const long i = idx[Rank - 1] + n;
+            if (i >= 0 and i < len[Rank - 1])
+            {
+                // stay within the innermost dimension
+                idx[Rank - 1] = i;
+                pos += n;
+                offset += n * stri[Rank - 1];
+            }
+            else if (n > 0 and i == len[Rank - 1])
+            {
+                // jump to the end of the current segment
+                *this += (n - 1);
+                ++(*this);
+            }
+            else
+            {
+                set_position(pos + n);
+            }
+            return *this;
+        }
+
+        array_iterator& operator-=(std::ptrdiff_t n) { return *this += (-n); }
+
+        [[nodiscard]] friend array_iterator operator+(std::ptrdiff_t n, array_iterator it) { return it += n; }
+
+        [[nodiscard]] friend array_iterator operator+(array_iterator it, std::ptrdiff_t n) { return it += n; }
+
+        [[nodiscard]] friend array_iterator operator-(array_iterator it, std::ptrdiff_t n) { return it -= n; }
+
+        [[nodiscard]] friend std::ptrdiff_t operator-(array_iterator const& lhs, array_iterator const& rhs) { return lhs.pos - rhs.pos; }
+
+        [[nodiscard]] T& operator[](std::ptrdiff_t n) const { return *(*this + n); }
+
+        [[nodiscard]] bool operator==(array_iterator const& rhs) const { return (rhs.pos == pos); }
+
+        [[nodiscard]] bool operator!=(array_iterator const& rhs) const { return (rhs.pos != pos); }
+
+        [[nodiscard]] friend bool operator<(array_iterator const& lhs, array_iterator const& rhs) { return lhs.pos < rhs.pos; }
+
+        [[nodiscard]] friend bool operator>(array_iterator const& lhs, array_iterator const& rhs) { return lhs.pos > rhs.pos; }
+
+        [[nodiscard]] friend bool operator<=(array_iterator const& lhs, array_iterator const& rhs) { return lhs.pos <= rhs.pos; }
+
+        [[nodiscard]] friend bool operator>=(array_iterator const& lhs, array_iterator const& rhs) { return lhs.pos >= rhs.pos; }
+
+        // Pointer to the current element (first element of the remaining segment).
+        [[nodiscard]] T* local() const { return &operator*(); }
+
+        // Number of elements from the current one to the end of its segment.
+        [[nodiscard]] long segment_size() const { return len[Rank - 1] - idx[Rank - 1]; }
+
+        // Memory stride between the elements of a segment.
+        [[nodiscard]] long segment_stride() const { return stri[Rank - 1]; }
     };
 
     /**
@@ -297,7 +349,7 @@ namespace enda
         using iterator_category = std::random_access_iterator_tag;
 
         // Value type.
-        using value_type = T;
+        using value_type = std::remove_const_t<T>;
 
         // Difference type.
         using difference_type = std::ptrdiff_t;
@@ -324,11 +376,11 @@ namespace enda
             data(start), len(lengths), stri(strides), iter(len.data(), stri.data(), at_end)
         {}
 
-        [[nodiscard]] auto indices() { return iter.indices(); }
+        [[nodiscard]] auto indices() const { return iter.indices(); }
 
         [[nodiscard]] T& operator*() const { return ((Pointer)data)[*iter]; }
 
-        T& operator->() const { return operator*(); }
+        [[nodiscard]] T* operator->() const { return &operator*(); }
 
         array_iterator& operator++()
         {
@@ -380,7 +432,7 @@ namespace enda
 
         [[nodiscard]] friend std::ptrdiff_t operator-(array_iterator const& lhs, array_iterator const& rhs) { return lhs.iter - rhs.iter; }
 
-        [[nodiscard]] T& operator[](std::ptrdiff_t n) { return ((Pointer)data)[*(iter + n)]; }
+        [[nodiscard]] T& operator[](std::ptrdiff_t n) const { return ((Pointer)data)[*(iter + n)]; }
 
         [[nodiscard]] friend bool operator<(array_iterator const& lhs, array_iterator const& rhs) { return lhs.iter < rhs.iter; }
 
@@ -389,5 +441,220 @@ namespace enda
         [[nodiscard]] friend bool operator<=(array_iterator const& lhs, array_iterator const& rhs) { return not(lhs.iter > rhs.iter); }
 
         [[nodiscard]] friend bool operator>=(array_iterator const& lhs, array_iterator const& rhs) { return not(lhs.iter < rhs.iter); }
+
+        // Pointer to the current element (first element of the remaining segment).
+        [[nodiscard]] T* local() const { return &operator*(); }
+
+        // Number of elements from the current one to the end of the segment (the whole array/view).
+        [[nodiscard]] long segment_size() const { return len[0] - iter.indices()[0]; }
+
+        // Memory stride between the elements of the segment.
+        [[nodiscard]] long segment_stride() const { return stri[0]; }
+    };
+
+    /**
+     * @brief Iterator for enda::basic_array and enda::basic_array_view types with a blocked memory layout (see e.g.
+     * enda::morton_idx_map).
+     *
+     * @details It traverses the elements in C-order of their indices and computes the memory offset of each element with
+     * the index map. Like enda::array_iterator, it is a
+     * <a href="https://en.cppreference.com/w/cpp/named_req/RandomAccessIterator">LegacyRandomAccessIterator</a>.
+     *
+     * @tparam Map Type of the index map.
+     * @tparam T Type of the elements in the array (can be const).
+     * @tparam Pointer Type of the pointer used to access the elements in the array (might be restricted depending on the
+     * accessor).
+     */
+    template<typename Map, typename T, typename Pointer>
+    class blocked_array_iterator
+    {
+        static constexpr int Rank = Map::rank();
+
+        // Pointer to the data (to the first memory location).
+        T* data = nullptr;
+
+        // Index map of the array.
+        Map map;
+
+        // Number of elements in the subgrid spanned by the dimensions faster than a given dimension.
+        std::array<long, Rank> sub_size {};
+
+        // Multi-dimensional index of the current element.
+        std::array<long, Rank> idx {};
+
+        // Linear position of the current element in the traversal.
+        long pos = 0;
+
+        // Move the iterator to a given linear position.
+        void set_position(long p) noexcept
+        {
+            pos = p;
+            if (p == map.lengths()[0] * sub_size[0])
+            {
+                // the end is one past the last element in the slowest dimension
+                idx.fill(0);
+                idx[0] = map.lengths()[0];
+                return;
+            }
+            for (int k = 0; k < Rank; ++k)
+            {
+                idx[k] = p / sub_size[k];
+                p -= idx[k] * sub_size[k];
+            }
+        }
+
+    public:
+        // Iterator category.
+        using iterator_category = std::random_access_iterator_tag;
+
+        // Value type.
+        using value_type = std::remove_const_t<T>;
+
+        // Difference type.
+        using difference_type = std::ptrdiff_t;
+
+        // Pointer type.
+        using pointer = T*;
+
+        // Reference type.
+        using reference = T&;
+
+        // Default constructor leaves the iterator in an uninitialized state.
+        blocked_array_iterator() = default;
+
+        /**
+         * @brief Construct an iterator from the index map of an array/view, a pointer to its data and a flag indicating if
+         * the iterator is at the end.
+         *
+         * @param map Index map of the array/view.
+         * @param start Pointer to the data.
+         * @param at_end Flag indicating if the iterator is at the end.
+         */
+        blocked_array_iterator(Map const& map, T* start, bool at_end) : data(start), map(map)
+        {
+            sub_size[Rank - 1] = 1;
+            for (int k = Rank - 2; k >= 0; --k)
+                sub_size[k] = sub_size[k + 1] * map.lengths()[k + 1];
+            set_position(at_end ? map.lengths()[0] * sub_size[0] : 0);
+        }
+
+        [[nodiscard]] auto indices() const { return idx; }
+
+        [[nodiscard]] T& operator*() const
+        {
+            return ((Pointer)data)[std::apply([this](auto... is) { return map(is...); }, idx)];
+        }
+
+        [[nodiscard]] T* operator->() const { return &operator*(); }
+
+        blocked_array_iterator& operator++()
+        {
+            ++pos;
+            if (++idx[Rank - 1] == map.lengths()[Rank - 1])
+            {
+                // carry over to the slower dimensions
+                for (int k = Rank - 1; k > 0 and idx[k] == map.lengths()[k]; --k)
+                {
+                    idx[k] = 0;
+                    ++idx[k - 1];
+                }
+            }
+            return *this;
+        }
+
+        blocked_array_iterator operator++(int)
+        {
+            auto c = *this;
+            ++(*this);
+            return c;
+        }
+
+        blocked_array_iterator& operator--()
+        {
+            set_position(pos - 1);
+            return *this;
+        }
+
+        blocked_array_iterator operator--(int)
+        {
+            auto c = *this;
+            --(*this);
+            return c;
+        }
+
+        blocked_array_iterator& operator+=(std::ptrdiff_t n)
+        {
+            set_position(pos + n);
+            return *this;
+        }
+
+        blocked_array_iterator& operator-=(std::ptrdiff_t n) { return *this += (-n); }
+
+        [[nodiscard]] friend blocked_array_iterator operator+(std::ptrdiff_t n, blocked_array_iterator it) { return it += n; }
+
+        [[nodiscard]] friend blocked_array_iterator operator+(blocked_array_iterator it, std::ptrdiff_t n) { return it += n; }
+
+        [[nodiscard]] friend blocked_array_iterator operator-(blocked_array_iterator it, std::ptrdiff_t n) { return it -= n; }
+
+        [[nodiscard]] friend std::ptrdiff_t operator-(blocked_array_iterator const& lhs, blocked_array_iterator const& rhs) { return lhs.pos - rhs.pos; }
+
+        [[nodiscard]] T& operator[](std::ptrdiff_t n) const { return *(*this + n); }
+
+        [[nodiscard]] bool operator==(blocked_array_iterator const& rhs) const { return (rhs.pos == pos); }
+
+        [[nodiscard]] bool operator!=(blocked_array_iterator const& rhs) const { return (rhs.pos != pos); }
+
+        [[nodiscard]] friend bool operator<(blocked_array_iterator const& lhs, blocked_array_iterator const& rhs) { return lhs.pos < rhs.pos; }
+
+        [[nodiscard]] friend bool operator>(blocked_array_iterator const& lhs, blocked_array_iterator const& rhs) { return lhs.pos > rhs.pos; }
+
+        [[nodiscard]] friend bool operator<=(blocked_array_iterator const& lhs, blocked_array_iterator const& rhs) { return lhs.pos <= rhs.pos; }
+
+        [[nodiscard]] friend bool operator>=(blocked_array_iterator const& lhs, blocked_array_iterator const& rhs) { return lhs.pos >= rhs.pos; }
     };
+
+    /**
+     * @brief Process the elements in a range of enda::array_iterator objects segment by segment.
+     *
+     * @details The range is split into runs along the innermost dimension of the traversal (the whole range for
+     * 1-dimensional iterators, which includes contiguous multi-dimensional arrays/views). For every run, the callable is
+     * called as `f(p, n, s)` with a raw pointer `p` to its first element, the number of elements `n` and the memory stride
+     * `s` between them, i.e. the run consists of `p[0], p[s], ..., p[(n - 1) * s]`. If `s == 1`, `[p, p + n)` is a
+     * contiguous pointer range that can be passed directly to `std::` algorithms or vectorized kernels.
+     *
+     * @tparam Rank Rank of the iterators.
+     * @tparam T Value type of the iterators.
+     * @tparam Pointer Pointer type of the iterators.
+     * @tparam F Callable type.
+     * @param first Iterator to the first element.
+     * @param last Iterator past the last element.
+     * @param f Callable object.
+     */
+    template<int Rank, typename T, typename Pointer, typename F>
+    void for_each_segment(array_iterator<Rank, T, Pointer> first, array_iterator<Rank, T, Pointer> const& last, F&& f)
+    {
+        while (first < last)
+        {
+            const long n = std::min(first.segment_size(), static_cast<long>(last - first));
+            f(first.local(), n, first.segment_stride());
+            first += n;
+        }
+    }
+
+    /**
+     * @brief Process the elements of an array/view segment by segment in the order of its iterators.
+     *
+     * @details See enda::for_each_segment for iterator ranges.
+     *
+     * @tparam A Type of the array/view.
+     * @tparam F Callable type.
+     * @param a Array/view.
+     * @param f Callable object.
+     */
+    template<typename A, typename F>
+    void for_each_segment(A&& a, F&& f)
+        requires(requires { a.begin().segment_size(); })
+    {
+        for_each_segment(a.begin(), a.end(), f);
+    }
 } // namespace enda
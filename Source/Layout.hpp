@@ -6,7 +6,10 @@
 
 #pragma once
 
+#include "Layout/BlockedIdxMap.hpp"
 #include "Layout/BoundCheckWorker.hpp"
+#include "Layout/Collapse.hpp"
+#include "Layout/FastDivisor.hpp"
 #include "Layout/ForEach.hpp"
 #include "Layout/IdxMap.hpp"
 #include "Layout/Padding.hpp"
@@ -15,3 +18,5 @@
 #include "Layout/Range.hpp"
 #include "Layout/RectStr.hpp"
 #include "Layout/SliceStatic.hpp"
+#include "Layout/StridedCopy.hpp"
+#include "Layout/Tiling.hpp"
@@ -0,0 +1,511 @@
+/**
+ * @file BlockedIdxMap.hpp
+ *
+ * @brief Provides blocked (non-strided) index maps: Morton/Z-order and block-tiled layouts.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "Layout/BoundCheckWorker.hpp"
+#include "Layout/Permutation.hpp"
+#include "Layout/Range.hpp"
+#include "Macros.hpp"
+#include "Traits.hpp"
+
+namespace enda
+{
+    namespace detail
+    {
+        // Insert R - 1 zero bits between two consecutive bits of x (bits which do not fit into 64 bits are dropped).
+        template<int R>
+        constexpr uint64_t morton_spread(uint64_t x) noexcept
+        {
+            if constexpr (R == 1)
+            {
+                return x;
+            }
+            else if constexpr (R == 2)
+            {
+                x &= 0x00000000ffffffffull;
+                x = (x | (x << 16)) & 0x0000ffff0000ffffull;
+                x = (x | (x << 8)) & 0x00ff00ff00ff00ffull;
+                x = (x | (x << 4)) & 0x0f0f0f0f0f0f0f0full;
+                x = (x | (x << 2)) & 0x3333333333333333ull;
+                return (x | (x << 1)) & 0x5555555555555555ull;
+            }
+            else if constexpr (R == 3)
+            {
+                x &= 0x00000000001fffffull;
+                x = (x | (x << 32)) & 0x001f00000000ffffull;
+                x = (x | (x << 16)) & 0x001f0000ff0000ffull;
+                x = (x | (x << 8)) & 0x100f00f00f00f00full;
+                x = (x | (x << 4)) & 0x10c30c30c30c30c3ull;
+                return (x | (x << 2)) & 0x1249249249249249ull;
+            }
+            else
+            {
+                uint64_t r = 0;
+                for (int b = 0; b * R < 64; ++b)
+                    r |= ((x >> b) & 1) << (b * R);
+                return r;
+            }
+        }
+
+        // Inverse of morton_spread: collect every R-th bit of x.
+        template<int R>
+        constexpr uint64_t morton_compact(uint64_t x) noexcept
+        {
+            uint64_t r = 0;
+            for (int b = 0; b * R < 64; ++b)
+                r |= ((x >> (b * R)) & 1) << b;
+            return r;
+        }
+
+        // C-ordered grid of equally sized blocks covering a given shape.
+        template<int Rank>
+        struct block_grid
+        {
+            // Number of blocks in each dimension.
+            std::array<long, Rank> n_blocks {};
+
+            // Strides of the grid (in units of blocks).
+            std::array<long, Rank> str {};
+
+            // Construct the grid for a given shape and block edge.
+            block_grid(std::array<long, Rank> const& len, long edge)
+            {
+                long s = 1;
+                for (int k = Rank - 1; k >= 0; --k)
+                {
+                    n_blocks[k] = (len[k] + edge - 1) / edge;
+                    str[k]      = s;
+                    s *= n_blocks[k];
+                }
+            }
+
+            block_grid() = default;
+
+            // Total number of blocks.
+            [[nodiscard]] long size() const noexcept { return Rank == 0 ? 1 : n_blocks[0] * str[0]; }
+
+            bool operator==(block_grid const&) const = default;
+        };
+
+    } // namespace detail
+
+    /**
+     * @brief Layout that maps multi-dimensional indices to their position on a Morton (Z-order) curve.
+     *
+     * @details The index space is covered by a C-ordered grid of hypercubes with an edge of \f$ 2^m \f$, where \f$ 2^m \f$
+     * is the largest power of two not exceeding the smallest extent, capped so that a hypercube holds at most
+     * \f$ 2^{12} \f$ elements (see max_block_bits), i.e. it fits into the L1 cache. Within a hypercube, the elements are stored in
+     * Z-order, i.e. the linear index is obtained by interleaving the bits of the local indices (the first dimension
+     * provides the most significant bit). Neighbouring elements in any dimension are therefore close in memory, which
+     * benefits neighbourhood lookups (stencils) and transposes.
+     *
+     * The extents are padded to multiples of \f$ 2^m \f$, i.e. by less than one hypercube edge per dimension. The memory
+     * required by an array with this layout (see storage_size()) is therefore larger than its size, but not at all if
+     * all extents are multiples of \f$ 2^m \f$ (e.g. powers of two).
+     *
+     * A Morton layout is not strided. Arrays/views with this layout can only be accessed element-wise, they cannot be
+     * sliced and generic algorithms treat them like lazy expressions.
+     *
+     * @tparam Rank Number of dimensions.
+     */
+    template<int Rank>
+    class morton_idx_map
+    {
+        static_assert(Rank > 0 and Rank < 16, "Error in enda::morton_idx_map: Rank must be in [1, 16)");
+
+        // Extents of all dimensions (the shape of the map).
+        std::array<long, Rank> len {};
+
+        // Number of bits of the local index in each dimension (the edge of a block is 2^m).
+        int m = 0;
+
+        // Grid of blocks.
+        detail::block_grid<Rank> grid;
+
+        // Linear index of a multi-dimensional index.
+        template<typename... Ints>
+        FORCEINLINE long offset(Ints... is) const noexcept
+        {
+            static_assert(sizeof...(Ints) == Rank, "Error in enda::morton_idx_map: Incorrect number of arguments");
+            return [&]<size_t... Is>(std::index_sequence<Is...>) {
+                long const     block = (((is >> m) * grid.str[Is]) + ... + 0);
+                uint64_t const mask  = (uint64_t(1) << m) - 1;
+                uint64_t const local = ((detail::morton_spread<Rank>(uint64_t(is) & mask) << (Rank - 1 - Is)) | ... | 0);
+                return (block << (m * Rank)) + static_cast<long>(local);
+            }(std::make_index_sequence<Rank> {});
+        }
+
+    public:
+        /// Maximum number of bits of the linear index within a hypercube (a hypercube holds at most 2^12 elements).
+        static constexpr int max_block_bits = 12;
+
+        // Encoded static extents (always dynamic).
+        static constexpr uint64_t static_extents_encoded = 0;
+
+        // Decoded stride order (the blocks are stored in C-order).
+        static constexpr std::array<int, Rank> stride_order = permutations::identity<Rank>();
+
+        // Encoded stride order.
+        static constexpr uint64_t stride_order_encoded = encode(stride_order);
+
+        // Compile-time memory layout properties (none, since the layout is not strided).
+        static constexpr layout_prop_e layout_prop = layout_prop_e::none;
+
+        // Compile-time information about the layout (stride order and layout properties).
+        static constexpr layout_info_t layout_info = layout_info_t {stride_order_encoded, layout_prop};
+
+        // Alias template to check if type `T` can be used to access a single element.
+        template<typename T>
+        static constexpr int argument_is_allowed_for_call = std::is_constructible_v<long, T>;
+
+        // Alias template to check if type `T` can be used to either access a single element or a slice of elements.
+        template<typename T>
+        static constexpr int argument_is_allowed_for_call_or_slice = std::is_constructible_v<long, T>;
+
+        /// Default constructor (empty shape).
+        morton_idx_map() = default;
+
+        /**
+         * @brief Construct a Morton layout from a given shape.
+         *
+         * @tparam Int Integer type.
+         * @param shape Shape of the map.
+         */
+        template<std::integral Int = long>
+        explicit morton_idx_map(std::array<Int, Rank> const& shape)
+        {
+            long min_len = 0;
+            for (int k = 0; k < Rank; ++k)
+            {
+                len[k]  = shape[k];
+                min_len = (k == 0 ? len[k] : std::min(min_len, len[k]));
+            }
+            m = (min_len > 0 ? std::bit_width(static_cast<uint64_t>(min_len)) - 1 : 0);
+            m = std::min(m, max_block_bits / Rank);
+            grid = detail::block_grid<Rank>(len, 1l << m);
+        }
+
+        /// Get the rank of the map.
+        static constexpr int rank() noexcept { return Rank; }
+
+        /// Get the size known at compile-time (always zero).
+        static constexpr long ce_size() noexcept { return 0; }
+
+        /// Morton layouts are not strided.
+        static constexpr bool is_stride_order_C() { return false; }
+
+        /// Morton layouts are not strided.
+        static constexpr bool is_stride_order_Fortran() { return false; }
+
+        /// Get the total number of elements.
+        [[nodiscard]] long size() const noexcept
+        {
+            long s = 1;
+            for (auto l : len)
+                s *= l;
+            return s;
+        }
+
+        /// Get the number of memory locations spanned by the map (including the padding).
+        [[nodiscard]] long storage_size() const noexcept { return size() == 0 ? 0 : grid.size() << (m * Rank); }
+
+        /// Get the extents of all dimensions.
+        [[nodiscard]] std::array<long, Rank> const& lengths() const noexcept { return len; }
+
+        /// Get the shape of the blocks which are stored contiguously in Z-order.
+        [[nodiscard]] std::array<long, Rank> block_shape() const noexcept
+        {
+            std::array<long, Rank> res;
+            res.fill(1l << m);
+            return res;
+        }
+
+        /**
+         * @brief Get the linear index of a multi-dimensional index.
+         *
+         * @tparam Args Types of the arguments (convertible to `long`).
+         * @param args Multi-dimensional index.
+         * @return Linear/Flat index.
+         */
+#ifdef ENDA_ENFORCE_BOUNDCHECK
+        template<typename... Args>
+        FORCEINLINE long operator()(Args const&... args) const noexcept(false)
+        {
+            assert_in_bounds(rank(), len.data(), args...);
+            return offset(long(args)...);
+        }
+#else
+        template<typename... Args>
+        FORCEINLINE long operator()(Args const&... args) const noexcept(true)
+        {
+            return offset(long(args)...);
+        }
+#endif
+
+        /**
+         * @brief Calculate the multi-dimensional index from a given linear index.
+         * @param lin Linear index of an element (not of a padding location).
+         * @return Multi-dimensional index.
+         */
+        [[nodiscard]] std::array<long, Rank> to_idx(long lin) const noexcept
+        {
+            std::array<long, Rank> res;
+            long                   block = lin >> (m * Rank);
+            uint64_t const         local = static_cast<uint64_t>(lin) & ((uint64_t(1) << (m * Rank)) - 1);
+            for (int k = 0; k < Rank; ++k)
+            {
+                long const b = block / grid.str[k];
+                block -= b * grid.str[k];
+                res[k] = (b << m) + static_cast<long>(detail::morton_compact<Rank>(local >> (Rank - 1 - k)));
+            }
+            return res;
+        }
+
+        /// Equal-to operator.
+        bool operator==(morton_idx_map const& rhs) const = default;
+    };
+
+    /**
+     * @brief Layout that stores the elements in fixed-size hypercubic blocks.
+     *
+     * @details The index space is covered by a C-ordered grid of blocks with an edge of `Block` elements. Each block is
+     * stored contiguously in C-order. A kernel working block by block (e.g. with enda::for_each_tile) therefore touches
+     * a contiguous chunk of memory of `Block^Rank` elements, independent of the shape of the array.
+     *
+     * The extents are padded to multiples of `Block`, i.e. the memory required by an array with this layout
+     * (see storage_size()) can be larger than its size.
+     *
+     * A tiled layout is not strided. Arrays/views with this layout can only be accessed element-wise, they cannot be
+     * sliced and generic algorithms treat them like lazy expressions.
+     *
+     * @tparam Rank Number of dimensions.
+     * @tparam Block Edge of the blocks (number of elements).
+     */
+    template<int Rank, long Block>
+    class tiled_idx_map
+    {
+        static_assert(Rank > 0 and Rank < 16, "Error in enda::tiled_idx_map: Rank must be in [1, 16)");
+        static_assert(Block > 0, "Error in enda::tiled_idx_map: Block must be positive");
+
+        // Extents of all dimensions (the shape of the map).
+        std::array<long, Rank> len {};
+
+        // Grid of blocks.
+        detail::block_grid<Rank> grid;
+
+        // Strides within a block (C-order).
+        static constexpr std::array<long, Rank> local_str = []() {
+            std::array<long, Rank> s {};
+            long                   x = 1;
+            for (int k = Rank - 1; k >= 0; --k)
+            {
+                s[k] = x;
+                x *= Block;
+            }
+            return s;
+        }();
+
+        // Number of elements in a block.
+        static constexpr long block_size = local_str[0] * Block;
+
+        // Linear index of a multi-dimensional index.
+        template<typename... Ints>
+        FORCEINLINE long offset(Ints... is) const noexcept
+        {
+            static_assert(sizeof...(Ints) == Rank, "Error in enda::tiled_idx_map: Incorrect number of arguments");
+            return [&]<size_t... Is>(std::index_sequence<Is...>) {
+                long const block = (((is / Block) * grid.str[Is]) + ... + 0);
+                long const local = (((is % Block) * local_str[Is]) + ... + 0);
+                return block * block_size + local;
+            }(std::make_index_sequence<Rank> {});
+        }
+
+    public:
+        // Encoded static extents (always dynamic).
+        static constexpr uint64_t static_extents_encoded = 0;
+
+        // Decoded stride order (the blocks and the elements within a block are stored in C-order).
+        static constexpr std::array<int, Rank> stride_order = permutations::identity<Rank>();
+
+        // Encoded stride order.
+        static constexpr uint64_t stride_order_encoded = encode(stride_order);
+
+        // Compile-time memory layout properties (none, since the layout is not strided).
+        static constexpr layout_prop_e layout_prop = layout_prop_e::none;
+
+        // Compile-time information about the layout (stride order and layout properties).
+        static constexpr layout_info_t layout_info = layout_info_t {stride_order_encoded, layout_prop};
+
+        // Alias template to check if type `T` can be used to access a single element.
+        template<typename T>
+        static constexpr int argument_is_allowed_for_call = std::is_constructible_v<long, T>;
+
+        // Alias template to check if type `T` can be used to either access a single element or a slice of elements.
+        template<typename T>
+        static constexpr int argument_is_allowed_for_call_or_slice = std::is_constructible_v<long, T>;
+
+        /// Default constructor (empty shape).
+        tiled_idx_map() = default;
+
+        /**
+         * @brief Construct a tiled layout from a given shape.
+         *
+         * @tparam Int Integer type.
+         * @param shape Shape of the map.
+         */
+        template<std::integral Int = long>
+        explicit tiled_idx_map(std::array<Int, Rank> const& shape)
+        {
+            for (int k = 0; k < Rank; ++k)
+                len[k] = shape[k];
+            grid = detail::block_grid<Rank>(len, Block);
+        }
+
+        /// Get the rank of the map.
+        static constexpr int rank() noexcept { return Rank; }
+
+        /// Get the size known at compile-time (always zero).
+        static constexpr long ce_size() noexcept { return 0; }
+
+        /// Tiled layouts are not strided.
+        static constexpr bool is_stride_order_C() { return false; }
+
+        /// Tiled layouts are not strided.
+        static constexpr bool is_stride_order_Fortran() { return false; }
+
+        /// Get the total number of elements.
+        [[nodiscard]] long size() const noexcept
+        {
+            long s = 1;
+            for (auto l : len)
+                s *= l;
+            return s;
+        }
+
+        /// Get the number of memory locations spanned by the map (including the padding).
+        [[nodiscard]] long storage_size() const noexcept { return size() == 0 ? 0 : grid.size() * block_size; }
+
+        /// Get the extents of all dimensions.
+        [[nodiscard]] std::array<long, Rank> const& lengths() const noexcept { return len; }
+
+        /// Get the shape of the blocks which are stored contiguously in C-order.
+        [[nodiscard]] static constexpr std::array<long, Rank> block_shape() noexcept
+        {
+            std::array<long, Rank> res;
+            res.fill(Block);
+            return res;
+        }
+
+        /**
+         * @brief Get the linear index of a multi-dimensional index.
+         *
+         * @tparam Args Types of the arguments (convertible to `long`).
+         * @param args Multi-dimensional index.
+         * @return Linear/Flat index.
+         */
+#ifdef ENDA_ENFORCE_BOUNDCHECK
+        template<typename... Args>
+        FORCEINLINE long operator()(Args const&... args) const noexcept(false)
+        {
+            assert_in_bounds(rank(), len.data(), args...);
+            return offset(long(args)...);
+        }
+#else
+        template<typename... Args>
+        FORCEINLINE long operator()(Args const&... args) const noexcept(true)
+        {
+            return offset(long(args)...);
+        }
+#endif
+
+        /**
+         * @brief Calculate the multi-dimensional index from a given linear index.
+         * @param lin Linear index of an element (not of a padding location).
+         * @return Multi-dimensional index.
+         */
+        [[nodiscard]] std::array<long, Rank> to_idx(long lin) const noexcept
+        {
+            std::array<long, Rank> res;
+            long                   block = lin / block_size;
+            long                   local = lin % block_size;
+            for (int k = 0; k < Rank; ++k)
+            {
+                long const b = block / grid.str[k];
+                long const l = local / local_str[k];
+                block -= b * grid.str[k];
+                local -= l * local_str[k];
+                res[k] = b * Block + l;
+            }
+            return res;
+        }
+
+        /// Equal-to operator.
+        bool operator==(tiled_idx_map const& rhs) const = default;
+    };
+
+    /**
+     * @brief Constexpr variable that is true if the given type is a blocked index map, i.e. an enda::morton_idx_map or
+     * an enda::tiled_idx_map.
+     *
+     * @tparam L Type to check.
+     */
+    template<typename L>
+    inline constexpr bool is_blocked_idx_map_v = false;
+
+    // Specialization of enda::is_blocked_idx_map_v for enda::morton_idx_map.
+    template<int Rank>
+    inline constexpr bool is_blocked_idx_map_v<morton_idx_map<Rank>> = true;
+
+    // Specialization of enda::is_blocked_idx_map_v for enda::tiled_idx_map.
+    template<int Rank, long Block>
+    inline constexpr bool is_blocked_idx_map_v<tiled_idx_map<Rank, Block>> = true;
+
+    namespace detail
+    {
+        // Is the type an array/view with a blocked index map?
+        template<typename A>
+        struct has_blocked_layout : std::false_type
+        {};
+
+        // Specialization for types with an index map.
+        template<typename A>
+        requires(requires(A const& a) { a.indexmap(); }) struct has_blocked_layout<A>
+            : std::bool_constant<is_blocked_idx_map_v<std::remove_cvref_t<decltype(std::declval<A const&>().indexmap())>>>
+        {};
+
+        // Number of elements the memory handle of an array with a given layout has to hold.
+        template<typename L>
+        long storage_size(L const& lay) noexcept
+        {
+            if constexpr (is_blocked_idx_map_v<L>)
+                return lay.storage_size();
+            else
+                return lay.size();
+        }
+
+        // Tile shape used to traverse an array/view with a blocked index map (the blocks, but at most 32 elements in each
+        // dimension).
+        template<typename L>
+        auto block_traversal_tile(L const& lay) noexcept
+        {
+            auto tile = lay.block_shape();
+            for (auto& t : tile)
+                t = std::min(t, 32l);
+            return tile;
+        }
+
+    } // namespace detail
+
+} // namespace enda
@@ -0,0 +1,181 @@
+/**
+ * @file Collapse.hpp
+ *
+ * @brief Provides functions to merge adjacent dimensions of strided layouts into a layout of minimal rank.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace enda::detail
+{
+    /**
+     * @brief Shape and strides of one or more strided layouts after merging adjacent dimensions.
+     *
+     * @details Only the first `rank` entries of `lengths` and `strides[n]` are meaningful. The dimensions are ordered from
+     * the slowest to the fastest varying one (w.r.t. the traversal order that was used to collapse the layouts).
+     *
+     * @tparam N Number of layouts (operands) sharing the same shape.
+     * @tparam R Rank of the original layouts.
+     */
+    template<size_t N, size_t R>
+    struct collapsed_layout
+    {
+        /// Rank of the collapsed layouts (between 1 and R).
+        int rank = 0;
+
+        /// Extents of the collapsed dimensions.
+        std::array<long, R> lengths {};
+
+        /// Strides of the collapsed dimensions for each layout.
+        std::array<std::array<long, R>, N> strides {};
+
+        /// Number of elements in the innermost dimension.
+        [[nodiscard]] long inner_size() const noexcept { return lengths[rank - 1]; }
+
+        /// Stride of the innermost dimension of the n-th layout.
+        [[nodiscard]] long inner_stride(size_t n) const noexcept { return strides[n][rank - 1]; }
+    };
+
+    /**
+     * @brief Merge adjacent dimensions of strided layouts with the same shape.
+     *
+     * @details The dimensions are visited in the given order (slowest to fastest). Dimensions of extent one are dropped and
+     * two neighbouring dimensions `i` (slower) and `j` (faster) are merged if `str[i] == str[j] * len[j]` holds for all
+     * layouts, i.e. if they can be traversed by a single loop. E.g. a contiguous view `a(range::all, range(0, n),
+     * range::all)` of a C-ordered rank 3 array collapses to rank 2 and a contiguous array always collapses to rank 1.
+     *
+     * The result has at least rank 1. The lengths should not contain zeros (empty layouts have to be handled by the
+     * caller).
+     *
+     * @tparam N Number of layouts.
+     * @tparam R Rank of the layouts.
+     * @param lengths Common shape of the layouts.
+     * @param strides Strides of the layouts.
+     * @param order Traversal order (permutation of the dimensions from the slowest to the fastest one).
+     * @return enda::detail::collapsed_layout object.
+     */
+    template<size_t N, size_t R>
+    collapsed_layout<N, R> collapse_dims(std::array<long, R> const& lengths, std::array<std::array<long, R>, N> const& strides, std::array<int, R> const& order)
+    {
+        collapsed_layout<N, R> res;
+        for (int k = 0; k < static_cast<int>(R); ++k)
+        {
+            const int j = order[k];
+            if (lengths[j] == 1)
+                continue;
+
+            // can the current dimension be merged into the last (slower) one?
+            bool merge = (res.rank > 0);
+            for (size_t n = 0; n < N and merge; ++n)
+                merge = (res.strides[n][res.rank - 1] == strides[n][j] * lengths[j]);
+
+            if (merge)
+            {
+                res.lengths[res.rank - 1] *= lengths[j];
+                for (size_t n = 0; n < N; ++n)
+                    res.strides[n][res.rank - 1] = strides[n][j];
+            }
+            else
+            {
+                res.lengths[res.rank] = lengths[j];
+                for (size_t n = 0; n < N; ++n)
+                    res.strides[n][res.rank] = strides[n][j];
+                ++res.rank;
+            }
+        }
+
+        // a single element
+        if (res.rank == 0)
+        {
+            res.rank       = 1;
+            res.lengths[0] = 1;
+            for (size_t n = 0; n < N; ++n)
+                res.strides[n][0] = 1;
+        }
+        return res;
+    }
+
+    // Overload of enda::detail::collapse_dims for a single layout.
+    template<size_t R>
+    collapsed_layout<1, R> collapse_dims(std::array<long, R> const& lengths, std::array<long, R> const& strides, std::array<int, R> const& order)
+    {
+        return collapse_dims(lengths, std::array<std::array<long, R>, 1> {strides}, order);
+    }
+
+    // Restrict the slowest dimension of a collapsed layout to [begin, end) and get the offsets of the first element.
+    template<size_t N, size_t R>
+    std::pair<collapsed_layout<N, R>, std::array<long, N>> slice_outer(collapsed_layout<N, R> cl, long begin, long end)
+    {
+        std::array<long, N> off {};
+        for (size_t n = 0; n < N; ++n)
+            off[n] = begin * cl.strides[n][0];
+        cl.lengths[0] = end - begin;
+        return {cl, off};
+    }
+
+    /**
+     * @brief Loop over the outer dimensions of a collapsed layout.
+     *
+     * @details For every index of the collapsed dimensions except the innermost one, the callable is called with the
+     * memory offsets (one per layout) of the first element of the corresponding innermost run. The innermost loop is left to
+     * the callable (see enda::detail::collapsed_layout::inner_size and enda::detail::collapsed_layout::inner_stride).
+     * If the callable returns a `bool`, the loop stops as soon as it returns false.
+     *
+     * @tparam N Number of layouts.
+     * @tparam R Rank of the layouts.
+     * @tparam F Callable type.
+     * @param cl enda::detail::collapsed_layout object.
+     * @param f Callable object taking a `std::array<long, N>` of offsets (and optionally returning a `bool`).
+     */
+    template<size_t N, size_t R, typename F>
+    void for_each_inner_run(collapsed_layout<N, R> const& cl, F&& f)
+    { // NOLINT (we do not want to forward here)
+        // call f and check if the loop should continue
+        auto call = [&f](auto const& off) {
+            if constexpr (std::is_same_v<decltype(f(off)), bool>)
+                return f(off);
+            else
+            {
+                f(off);
+                return true;
+            }
+        };
+
+        std::array<long, N> off {};
+        const int           n_outer = cl.rank - 1;
+        if (n_outer == 0)
+        {
+            call(off);
+            return;
+        }
+
+        // odometer over the outer dimensions (the offsets are updated incrementally)
+        std::array<long, R> idx {};
+        while (true)
+        {
+            if (!call(off))
+                break;
+            int k = n_outer - 1;
+            for (; k >= 0; --k)
+            {
+                if (++idx[k] < cl.lengths[k])
+                {
+                    for (size_t n = 0; n < N; ++n)
+                        off[n] += cl.strides[n][k];
+                    break;
+                }
+                for (size_t n = 0; n < N; ++n)
+                    off[n] -= (cl.lengths[k] - 1) * cl.strides[n][k];
+                idx[k] = 0;
+            }
+            if (k < 0)
+                break;
+        }
+    }
+
+} // namespace enda::detail
@@ -0,0 +1,114 @@
+/**
+ * @file FastDivisor.hpp
+ *
+ * @brief Provides division of non-negative integers by a runtime invariant divisor without hardware division.
+ */
+
+#pragma once
+
+#include <bit>
+#include <cstdint>
+
+#include "Macros.hpp"
+
+#if !defined(__SIZEOF_INT128__) && defined(_MSC_VER) && defined(_M_X64)
+    #include <intrin.h>
+#endif
+
+namespace enda::detail
+{
+    /**
+     * @brief Divisor with a precomputed reciprocal multiplier.
+     *
+     * @details For a divisor \f$ d \geq 1 \f$ with \f$ l = \lceil \log_2 d \rceil \f$, the magic number
+     * \f$ m = \lceil 2^{63 + l} / d \rceil < 2^{64} \f$ satisfies \f$ \lfloor n / d \rfloor = \lfloor n m / 2^{63 + l}
+     * \rfloor \f$ for all \f$ 0 \leq n < 2^{63} \f$ (Granlund and Montgomery, 1994). The quotient is therefore obtained
+     * with one 64-bit high multiplication and one shift, which is considerably faster than a hardware division when the
+     * same divisor is used many times (e.g. when converting linear indices into multi-dimensional ones).
+     *
+     * Only non-negative dividends (e.g. linear indices) are supported.
+     */
+    class fast_divisor
+    {
+        // Divisor.
+        long d = 1;
+
+        // Reciprocal multiplier.
+        uint64_t magic = uint64_t {1} << 63;
+
+        // Shift applied to the high part of the product.
+        int shift = 0;
+
+        // High 64 bits of the product of two 64-bit unsigned integers.
+        [[nodiscard]] static uint64_t mulhi(uint64_t a, uint64_t b) noexcept
+        {
+#if defined(__SIZEOF_INT128__)
+            return static_cast<uint64_t>((static_cast<unsigned __int128>(a) * b) >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+            return __umulh(a, b);
+#else
+            uint64_t a_lo = a & 0xFFFFFFFF, a_hi = a >> 32, b_lo = b & 0xFFFFFFFF, b_hi = b >> 32;
+            uint64_t mid = (a_lo * b_lo >> 32) + (a_hi * b_lo & 0xFFFFFFFF) + a_lo * b_hi;
+            return a_hi * b_hi + (a_hi * b_lo >> 32) + (mid >> 32);
+#endif
+        }
+
+    public:
+        // Default constructor divides by one.
+        fast_divisor() = default;
+
+        /**
+         * @brief Construct the divisor and its reciprocal multiplier.
+         * @param divisor Divisor (has to be positive).
+         */
+        explicit fast_divisor(long divisor) noexcept : d(divisor)
+        {
+            EXPECTS(divisor > 0);
+            auto const ud = static_cast<uint64_t>(divisor);
+            shift         = static_cast<int>(std::bit_width(ud - 1));
+
+            // magic = ceil(2^(63 + shift) / d)
+#if defined(__SIZEOF_INT128__)
+            auto const num = static_cast<unsigned __int128>(1) << (63 + shift);
+            magic          = static_cast<uint64_t>((num + ud - 1) / ud);
+#elif defined(_MSC_VER) && defined(_M_X64)
+            uint64_t rem = 0;
+            magic        = _udiv128(shift == 0 ? 0 : uint64_t {1} << (shift - 1), shift == 0 ? uint64_t {1} << 63 : 0, ud, &rem);
+            magic += (rem != 0);
+#else
+            // long division of 2^(63 + shift) by d, one bit at a time
+            uint64_t q = 0, r = 0;
+            for (int b = 126; b >= 0; --b)
+            {
+                bool const carry = (r >> 63) != 0;
+                r                = (r << 1) | (b == 63 + shift ? 1 : 0);
+                q <<= 1;
+                if (carry or r >= ud)
+                {
+                    r -= ud;
+                    q |= 1;
+                }
+            }
+            magic = q + (r != 0);
+#endif
+        }
+
+        /// Get the divisor.
+        [[nodiscard]] long divisor() const noexcept { return d; }
+
+        /**
+         * @brief Compute the quotient of a non-negative integer and the divisor.
+         *
+         * @param n Dividend (has to be non-negative).
+         * @return \f$ \lfloor n / d \rfloor \f$.
+         */
+        [[nodiscard]] long divide(long n) const noexcept { return static_cast<long>(mulhi(static_cast<uint64_t>(n) << 1, magic) >> shift); }
+
+        // Division of a non-negative integer by a enda::detail::fast_divisor.
+        [[nodiscard]] friend long operator/(long n, fast_divisor const& fd) noexcept { return fd.divide(n); }
+
+        // Remainder of a non-negative integer divided by a enda::detail::fast_divisor.
+        [[nodiscard]] friend long operator%(long n, fast_divisor const& fd) noexcept { return n - fd.divide(n) * fd.d; }
+    };
+
+} // namespace enda::detail
@@ -13,6 +13,7 @@
 
 #include "Layout/Permutation.hpp"
 #include "StdUtil/Array.hpp"
+#include "Traits.hpp"
 
 namespace enda
 {
@@ -74,6 +75,54 @@ namespace enda
             }
         }
 
+        // Apply a callable object recursively to all possible index values of a given shape in a runtime order.
+        template<int I, typename F, size_t R, std::integral Int = long>
+        FORCEINLINE void for_each_ordered_impl(std::array<Int, R> const& shape, std::array<int, R> const& order, std::array<long, R>& idxs, F& f)
+        {
+            if constexpr (I == R)
+            {
+                // end of recursion
+                std::apply(f, idxs);
+            }
+            else
+            {
+                // get the dimension over which to iterate and its extent
+                const int  j    = order[I];
+                const long imax = shape[j];
+
+                // loop over all indices of the current dimension
+                for (long i = 0; i < imax; ++i)
+                {
+                    idxs[j] = i;
+                    for_each_ordered_impl<I + 1>(shape, order, idxs, f);
+                }
+                idxs[j] = 0;
+            }
+        }
+
+        // Check at compile time if an encoded stride order is a valid permutation of rank R.
+        template<int R>
+        constexpr bool is_valid_stride_order(uint64_t stride_order)
+        {
+            if (stride_order == 0)
+                return true;
+            if (R < 16 and (stride_order >> (4 * R)) != 0)
+                return false;
+            return permutations::is_valid(decode<R>(stride_order));
+        }
+
+        /**
+         * @brief Encoded stride order in which the elements of an enda::Array type should be traversed.
+         *
+         * @details For memory arrays and for expressions whose operands all share the same stride order, this is the stride
+         * order of the type, i.e. the innermost loop runs over the dimension with the smallest stride. For all other types
+         * (e.g. expressions mixing different stride orders), it falls back to C-order.
+         *
+         * @tparam A enda::Array type.
+         */
+        template<typename A>
+        constexpr uint64_t traversal_order = (is_valid_stride_order<get_rank<A>>(get_layout_info<A>.stride_order) ? get_layout_info<A>.stride_order : 0);
+
     } // namespace detail
 
     /**
@@ -122,4 +171,47 @@ namespace enda
         detail::for_each_static_impl<0, 0, 0>(shape, idxs, f);
     }
 
+    /**
+     * @brief Loop over all possible index values of a given shape in the order given by a compile-time stride order.
+     *
+     * @details The slowest varying dimension is the first element of the decoded `StrideOrder` and the fastest varying
+     * dimension is the last one, i.e. passing the stride order of an array/view traverses its elements in the order in
+     * which they are stored in memory (see enda::detail::traversal_order). A zero stride order corresponds to C-order.
+     *
+     * @tparam StrideOrder Encoded stride order.
+     * @tparam F Callable type.
+     * @tparam R Number of dimensions.
+     * @tparam Int Integer type used in the shape array.
+     *
+     * @param shape Shape to loop over (index bounds).
+     * @param f Callable object.
+     */
+    template<uint64_t StrideOrder, typename F, auto R, std::integral Int = long>
+    FORCEINLINE void for_each_ordered(std::array<Int, R> const& shape, F&& f)
+    { // NOLINT (we do not want to forward here)
+        auto idxs = enda::stdutil::make_initialized_array<R>(0l);
+        detail::for_each_static_impl<0, 0, StrideOrder>(shape, idxs, f);
+    }
+
+    /**
+     * @brief Loop over all possible index values of a given shape in the order given by a runtime stride order.
+     *
+     * @details `order[0]` is the slowest and `order[R - 1]` the fastest varying dimension.
+     *
+     * @tparam F Callable type.
+     * @tparam R Number of dimensions.
+     * @tparam Int Integer type used in the shape array.
+     *
+     * @param shape Shape to loop over (index bounds).
+     * @param order Permutation specifying the traversal order.
+     * @param f Callable object.
+     */
+    template<typename F, auto R, std::integral Int = long>
+    FORCEINLINE void for_each_ordered(std::array<Int, R> const& shape, std::array<int, R> const& order, F&& f)
+    { // NOLINT (we do not want to forward here)
+        EXPECTS(permutations::is_valid(order));
+        auto idxs = enda::stdutil::make_initialized_array<R>(0l);
+        detail::for_each_ordered_impl<0>(shape, order, idxs, f);
+    }
+
 } // namespace enda
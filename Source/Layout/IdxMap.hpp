@@ -13,11 +13,13 @@
 #include <cstdlib>
 #include <functional>
 #include <numeric>
+#include <span>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "Layout/FastDivisor.hpp"
 #include "Layout/Permutation.hpp"
 #include "Layout/Range.hpp"
 #include "Layout/SliceStatic.hpp"
@@ -42,6 +44,40 @@ namespace enda
     template<int Rank>
     constexpr uint64_t C_stride_order = enda::encode(enda::permutations::identity<Rank>());
 
+    namespace detail
+    {
+        // Placeholder for the strides of an enda::idx_map whose strides are all known at compile-time.
+        template<int Rank>
+        struct static_strides
+        {
+            static_strides() = default;
+            constexpr static_strides(std::array<long, Rank> const&) noexcept {}
+        };
+
+        // Strides of a contiguous layout which are known at compile-time, i.e. the strides of the dimensions for which all
+        // faster varying dimensions have a static extent (zero for the other dimensions).
+        template<int Rank>
+        constexpr std::array<long, Rank> contiguous_static_strides(std::array<int, Rank> const& static_extents, std::array<int, Rank> const& stride_order)
+        {
+            std::array<long, Rank> res {};
+            long s = 1;
+            for (int v = Rank - 1; v >= 0; --v)
+            {
+                int const u = stride_order[v];
+                res[u]      = s;
+                if (static_extents[u] == 0)
+                {
+                    for (int w = v - 1; w >= 0; --w)
+                        res[stride_order[w]] = 0;
+                    break;
+                }
+                s *= static_extents[u];
+            }
+            return res;
+        }
+
+    } // namespace detail
+
     /**
      * @brief Layout that specifies how to map multi-dimensional indices to a linear/flat index.
      *
@@ -86,9 +122,6 @@ namespace enda
         // Extents of all dimensions (the shape of the map).
         std::array<long, Rank> len;
 
-        // Strides of all dimensions.
-        std::array<long, Rank> str;
-
     public:
         // Encoded static extents.
         static constexpr uint64_t static_extents_encoded = StaticExtents;
@@ -126,6 +159,41 @@ namespace enda
             return r;
         }();
 
+    public:
+        // Strides known at compile-time (zero if the stride of a dimension is only known at runtime). They are only known
+        // for contiguous layouts, in the dimensions for which all faster varying dimensions have a static extent.
+        static constexpr std::array<long, Rank> ce_strides =
+            (has_contiguous(LayoutProp) ? detail::contiguous_static_strides<Rank>(static_extents, stride_order) : std::array<long, Rank> {});
+
+        // Are all strides known at compile-time? If so, they are not stored in the map.
+        static constexpr bool has_static_strides = (n_dynamic_extents == 0) and has_contiguous(LayoutProp);
+
+    private:
+        // Strides of all dimensions (an empty placeholder if all of them are known at compile-time).
+        [[no_unique_address]] std::conditional_t<has_static_strides, detail::static_strides<Rank>, std::array<long, Rank>> str;
+
+        // Get the stride of the I-th dimension (a compile-time constant if possible).
+        template<auto I>
+        [[nodiscard]] FORCEINLINE long stride() const noexcept
+        {
+            if constexpr (ce_strides[I] != 0)
+                return ce_strides[I];
+            else
+                return std::get<I>(str);
+        }
+
+        // Check that the given strides agree with the ones known at compile-time (dimensions of length 1 are ignored).
+        void assert_strides_match_ce_strides(std::array<long, Rank> const& s) const
+        {
+            for (int u = 0; u < Rank; ++u)
+            {
+                if (len[u] > 1 and ce_strides[u] != 0)
+                {
+                    EXPECTS_WITH_MESSAGE(s[u] == ce_strides[u], "Error in enda::idx_map: Strides do not match the static extents");
+                }
+            }
+        }
+
     public:
         /**
          * @brief Get the rank of the map.
@@ -165,13 +233,19 @@ namespace enda
          * @brief Get the strides of all dimensions.
          * @return `std::array<long, Rank>` containing the stride of each dimension.
          */
-        [[nodiscard]] std::array<long, Rank> const& strides() const noexcept { return str; }
+        [[nodiscard]] std::array<long, Rank> const& strides() const noexcept
+        {
+            if constexpr (has_static_strides)
+                return ce_strides;
+            else
+                return str;
+        }
 
         /**
          * @brief Get the value of the smallest stride.
          * @return Stride of the fastest varying dimension.
          */
-        [[nodiscard]] long min_stride() const noexcept { return str[stride_order[Rank - 1]]; }
+        [[nodiscard]] long min_stride() const noexcept { return stride<stride_order[Rank - 1]>(); }
 
         /**
          * @brief Is the data contiguous in memory?
@@ -186,7 +260,7 @@ namespace enda
             auto s = size();
             if (s == 0)
                 return true;
-            auto const str_x_len = str * len;
+            auto const str_x_len = strides() * len;
             return (*std::max_element(str_x_len.cbegin(), str_x_len.cend()) == s);
         }
 
@@ -204,7 +278,7 @@ namespace enda
             auto s = size();
             if (s == 0)
                 return true;
-            auto const str_x_len = str * len;
+            auto const str_x_len = strides() * len;
             return (*std::max_element(str_x_len.cbegin(), str_x_len.cend()) == s * min_stride());
         }
 
@@ -257,20 +331,23 @@ namespace enda
          * @details See idx_map::is_stride_order_valid(Int *lenptr, Int *strptr)).
          * @return True if the shape and strides are compatible with the stride order.
          */
-        [[nodiscard]] bool is_stride_order_valid() const { return is_stride_order_valid(len.data(), str.data()); }
+        [[nodiscard]] bool is_stride_order_valid() const { return is_stride_order_valid(len.data(), strides().data()); }
 
     private:
         // Compute contiguous strides from the shape.
         void compute_strides_contiguous()
         {
-            long s = 1;
-            for (int v = rank() - 1; v >= 0; --v)
+            if constexpr (not has_static_strides)
             {
-                int u  = stride_order[v];
-                str[u] = s;
-                s *= len[u];
+                long s = 1;
+                for (int v = rank() - 1; v >= 0; --v)
+                {
+                    int u  = stride_order[v];
+                    str[u] = s;
+                    s *= len[u];
+                }
+                ENSURES(s == size());
             }
-            ENSURES(s == size());
         }
 
         // Check that the static extents and the shape are compatible.
@@ -352,6 +429,9 @@ namespace enda
                     EXPECTS_WITH_MESSAGE(idxm.is_strided_1d(), "Error in enda::idx_map: Constructing a strided_1d from a non-strided_1d layout");
                 }
             }
+
+            // check that the strides agree with the ones known at compile-time
+            assert_strides_match_ce_strides(idxm.strides());
         }
 
         /**
@@ -382,6 +462,9 @@ namespace enda
 
             // check that the static extents and the shape are compatible
             assert_static_extents_and_len_are_compatible();
+
+            // check that the strides agree with the ones known at compile-time
+            assert_strides_match_ce_strides(idxm.strides());
         }
 
         /**
@@ -399,6 +482,7 @@ namespace enda
                 if (not is_stride_order_valid())
                     throw std::runtime_error("Error in enda::idx_map: Incompatible strides, shape and stride order");
             }
+            assert_strides_match_ce_strides(strides);
         }
 
         /**
@@ -486,7 +570,7 @@ namespace enda
             else
             {
                 // otherwise multiply the argument by the stride of the current dimension
-                return arg * std::get<I>(str);
+                return arg * stride<I>();
             }
         }
 
@@ -511,7 +595,7 @@ namespace enda
                 else
                 {
                     // arbitrary layouts
-                    return ((args * std::get<Is>(str)) + ...);
+                    return ((args * stride<Is>()) + ...);
                 }
             }
             else
@@ -584,21 +668,84 @@ namespace enda
             residues[0] = lin_idx;
             for (auto i : range(1, Rank))
             {
-                residues[i] = residues[i - 1] % str[stride_order[i - 1]];
+                residues[i] = residues[i - 1] % strides()[stride_order[i - 1]];
             }
 
             // convert residues to indices, ordered from slowest to fastest
             std::array<long, Rank> idx;
-            idx[Rank - 1] = residues[Rank - 1] / str[stride_order[Rank - 1]];
+            idx[Rank - 1] = residues[Rank - 1] / strides()[stride_order[Rank - 1]];
             for (auto i : range(Rank - 2, -1, -1))
             {
-                idx[i] = (residues[i] - residues[i + 1]) / str[stride_order[i]];
+                idx[i] = (residues[i] - residues[i + 1]) / strides()[stride_order[i]];
             }
 
             // reorder indices according to stride order
             return permutations::apply_inverse(stride_order, idx);
         }
 
+        /**
+         * @brief Calculate the multi-dimensional indices for a batch of linear indices.
+         *
+         * @details Gives the same result as calling enda::idx_map::to_idx for each linear index. The reciprocals of the
+         * strides (see enda::detail::fast_divisor) are computed once per call, so that no hardware division is needed
+         * for the individual indices. The linear indices are processed in blocks, one dimension at a time, which keeps the
+         * inner loops free of dependencies between consecutive indices.
+         *
+         * @param lin_idx Linear/Flat indices (have to be non-negative).
+         * @param idx Multi-dimensional indices (same size as `lin_idx`).
+         */
+        void to_idx(std::span<long const> lin_idx, std::span<std::array<long, Rank>> idx) const
+        {
+            EXPECTS(lin_idx.size() == idx.size());
+            if (lin_idx.empty()) return;
+
+            // reciprocals of the strides, ordered from slowest to fastest
+            std::array<detail::fast_divisor, Rank> fd;
+            for (int i = 0; i < Rank; ++i)
+                fd[i] = detail::fast_divisor {strides()[stride_order[i]]};
+
+            constexpr long block = 256;
+            std::array<long, block> residues;
+            for (long first = 0; first < long(lin_idx.size()); first += block)
+            {
+                long const n = std::min(block, long(lin_idx.size()) - first);
+                for (long j = 0; j < n; ++j)
+                    residues[j] = lin_idx[first + j];
+                for (int i = 0; i < Rank; ++i)
+                {
+                    int const  k = stride_order[i];
+                    long const s = strides()[k];
+                    for (long j = 0; j < n; ++j)
+                    {
+                        long const q      = fd[i].divide(residues[j]);
+                        idx[first + j][k] = q;
+                        residues[j] -= q * s;
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Advance a multi-dimensional index to the next element in memory order.
+         *
+         * @details The fastest varying dimension (w.r.t. the stride order) is incremented and overflows are carried to the
+         * slower dimensions. For contiguous maps, this is equivalent to `idx = to_idx(operator()(idx) + 1)` but does not
+         * require any division.
+         *
+         * @param idx Multi-dimensional index to be advanced.
+         * @return False if the last element has been passed (`idx` is reset to zeros), true otherwise.
+         */
+        bool next_idx(std::array<long, Rank>& idx) const noexcept
+        {
+            for (int i = Rank - 1; i >= 0; --i)
+            {
+                int const k = stride_order[i];
+                if (++idx[k] < len[k]) return true;
+                idx[k] = 0;
+            }
+            return false;
+        }
+
         /**
          * @brief Get a new enda::idx_map by taking a slice of the current one.
          *
@@ -629,7 +776,7 @@ namespace enda
         template<int R, uint64_t SE, uint64_t SO, layout_prop_e LP>
         bool operator==(idx_map<R, SE, SO, LP> const& rhs) const
         {
-            return (Rank == R and len == rhs.lengths() and str == rhs.strides());
+            return (Rank == R and len == rhs.lengths() and strides() == rhs.strides());
         }
 
         /**
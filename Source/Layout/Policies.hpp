@@ -9,6 +9,7 @@
 #include <cstdint>
 #include <type_traits>
 
+#include "Layout/BlockedIdxMap.hpp"
 #include "Layout/IdxMap.hpp"
 #include "Traits.hpp"
 
@@ -85,6 +86,42 @@ namespace enda
         using contiguous_t = F_layout;
     };
 
+    /**
+     * @brief Layout policy storing the elements along a Morton (Z-order) curve.
+     * @details See enda::morton_idx_map. Arrays/views with this layout cannot be sliced.
+     */
+    struct morton_layout
+    {
+        // Multi-dimensional to flat index mapping.
+        template<int Rank>
+        using mapping = morton_idx_map<Rank>;
+
+        // The same layout policy, but with no guarantee of contiguity.
+        using with_lowest_guarantee_t = morton_layout;
+
+        // The same layout policy, but with guarantee of contiguity.
+        using contiguous_t = morton_layout;
+    };
+
+    /**
+     * @brief Layout policy storing the elements in hypercubic blocks with block-local C-order.
+     * @details See enda::tiled_idx_map. Arrays/views with this layout cannot be sliced.
+     * @tparam Block Edge of the blocks (number of elements).
+     */
+    template<long Block>
+    struct tiled_layout
+    {
+        // Multi-dimensional to flat index mapping.
+        template<int Rank>
+        using mapping = tiled_idx_map<Rank, Block>;
+
+        // The same layout policy, but with no guarantee of contiguity.
+        using with_lowest_guarantee_t = tiled_layout;
+
+        // The same layout policy, but with guarantee of contiguity.
+        using contiguous_t = tiled_layout;
+    };
+
     /**
      * @brief Generic layout policy with arbitrary order.
      *
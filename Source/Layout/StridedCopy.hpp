@@ -0,0 +1,491 @@
+/**
+ * @file StridedCopy.hpp
+ *
+ * @brief Provides cache-blocked copy kernels between strided memory layouts with different stride orders.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Layout/Collapse.hpp"
+#include "Layout/Padding.hpp"
+#include "Macros.hpp"
+
+#if defined(__AVX__) || defined(__SSE2__)
+    #include <immintrin.h>
+#endif
+
+namespace enda::detail
+{
+    /**
+     * @brief Get the edge length of the square tiles used by the transposing copy kernels.
+     *
+     * @details The tile is chosen such that one source and one destination tile together occupy at most half of the L1
+     * data cache. The result is a power of two between 8 and 64 and is computed only once per element size.
+     *
+     * @tparam T Value type of the elements.
+     * @return Edge length of a tile (in elements).
+     */
+    template<typename T>
+    long transpose_tile_size() noexcept
+    {
+        static const long tile = []() {
+            long l1_size = 32 * 1024;
+            try
+            {
+                l1_size = get_L1_data_cache_info().size;
+            }
+            catch (std::exception const&)
+            {}
+            long b = 64;
+            while (b > 8 and 2 * b * b * static_cast<long>(sizeof(T)) > l1_size / 2)
+                b /= 2;
+            return b;
+        }();
+        return tile;
+    }
+
+    // Complex conjugate of an element if Conj is true (no-op for real types).
+    template<bool Conj, typename T>
+    FORCEINLINE T conj_value(T const& x)
+    {
+        return x;
+    }
+
+    // Complex conjugate of a complex element if Conj is true.
+    template<bool Conj, typename T>
+    FORCEINLINE std::complex<T> conj_value(std::complex<T> const& x)
+    {
+        if constexpr (Conj)
+            return std::conj(x);
+        else
+            return x;
+    }
+
+    /**
+     * @brief Check if the memory spanned by two strided layouts of the same shape overlaps.
+     *
+     * @details Compares the address ranges `[first, last]` of the elements of both layouts, i.e. it might report an
+     * overlap for interleaved layouts which do not share any element.
+     *
+     * @tparam TD Value type of the destination.
+     * @tparam TS Value type of the source.
+     * @tparam SD Strides type of the destination (e.g. `std::array<long, R>`).
+     * @tparam SS Strides type of the source.
+     * @tparam L Shape type.
+     * @param dst Pointer to the destination data.
+     * @param dst_str Strides of the destination.
+     * @param src Pointer to the source data.
+     * @param src_str Strides of the source.
+     * @param len Shape of both operands.
+     * @return True if the address ranges overlap (false if the shape contains a zero).
+     */
+    template<typename TD, typename TS, typename SD, typename SS, typename L>
+    bool strided_overlap(TD const* dst, SD const& dst_str, TS const* src, SS const& src_str, L const& len)
+    {
+        long dlo = 0, dhi = 0, slo = 0, shi = 0;
+        for (size_t k = 0; k < std::size(len); ++k)
+        {
+            if (len[k] == 0)
+                return false;
+            const long dd = (len[k] - 1) * dst_str[k], ds = (len[k] - 1) * src_str[k];
+            (dd < 0 ? dlo : dhi) += dd;
+            (ds < 0 ? slo : shi) += ds;
+        }
+        void const* const db = dst + dlo;
+        void const* const de = dst + dhi + 1;
+        void const* const sb = src + slo;
+        void const* const se = src + shi + 1;
+        return std::less<> {}(db, se) and std::less<> {}(sb, de);
+    }
+
+    // Copy a 4x4 block of doubles and transpose it in registers: dst[i * dld + j] = src[j * sld + i].
+    template<bool Conj = false>
+    FORCEINLINE void transpose_micro_kernel(double* RESTRICT dst, long dld, double const* RESTRICT src, long sld)
+    {
+#if defined(__AVX__)
+        __m256d r0 = _mm256_loadu_pd(src);
+        __m256d r1 = _mm256_loadu_pd(src + sld);
+        __m256d r2 = _mm256_loadu_pd(src + 2 * sld);
+        __m256d r3 = _mm256_loadu_pd(src + 3 * sld);
+        __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+        __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+        __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+        __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+        _mm256_storeu_pd(dst, _mm256_permute2f128_pd(t0, t2, 0x20));
+        _mm256_storeu_pd(dst + dld, _mm256_permute2f128_pd(t1, t3, 0x20));
+        _mm256_storeu_pd(dst + 2 * dld, _mm256_permute2f128_pd(t0, t2, 0x31));
+        _mm256_storeu_pd(dst + 3 * dld, _mm256_permute2f128_pd(t1, t3, 0x31));
+#elif defined(__SSE2__)
+        // four 2x2 transposes
+        for (int bi = 0; bi < 4; bi += 2)
+            for (int bj = 0; bj < 4; bj += 2)
+            {
+                __m128d r0 = _mm_loadu_pd(src + bj * sld + bi);
+                __m128d r1 = _mm_loadu_pd(src + (bj + 1) * sld + bi);
+                _mm_storeu_pd(dst + bi * dld + bj, _mm_unpacklo_pd(r0, r1));
+                _mm_storeu_pd(dst + (bi + 1) * dld + bj, _mm_unpackhi_pd(r0, r1));
+            }
+#else
+        for (int i = 0; i < 4; ++i)
+            for (int j = 0; j < 4; ++j)
+                dst[i * dld + j] = src[j * sld + i];
+#endif
+    }
+
+    // Copy a 2x2 block of complex doubles and transpose (and conjugate) it in registers: dst[i * dld + j] = src[j * sld + i].
+    template<bool Conj = false>
+    FORCEINLINE void transpose_micro_kernel(std::complex<double>* RESTRICT dst, long dld, std::complex<double> const* RESTRICT src, long sld)
+    {
+#if defined(__AVX__)
+        auto*   d  = reinterpret_cast<double*>(dst);
+        auto*   s  = reinterpret_cast<double const*>(src);
+        __m256d r0 = _mm256_loadu_pd(s);
+        __m256d r1 = _mm256_loadu_pd(s + 2 * sld);
+        if constexpr (Conj)
+        {
+            // flip the sign bits of the imaginary parts
+            const __m256d mask = _mm256_set_pd(-0.0, 0.0, -0.0, 0.0);
+            r0                 = _mm256_xor_pd(r0, mask);
+            r1                 = _mm256_xor_pd(r1, mask);
+        }
+        _mm256_storeu_pd(d, _mm256_permute2f128_pd(r0, r1, 0x20));
+        _mm256_storeu_pd(d + 2 * dld, _mm256_permute2f128_pd(r0, r1, 0x31));
+#else
+        dst[0]       = conj_value<Conj>(src[0]);
+        dst[1]       = conj_value<Conj>(src[sld]);
+        dst[dld]     = conj_value<Conj>(src[1]);
+        dst[dld + 1] = conj_value<Conj>(src[sld + 1]);
+#endif
+    }
+
+    // Size of the blocks handled by the register micro-kernel (0 if there is none for the given types).
+    template<typename TD, typename TS>
+    constexpr long micro_kernel_size = (std::is_same_v<TD, double> and std::is_same_v<std::remove_const_t<TS>, double> ?
+                                            4 :
+                                            (std::is_same_v<TD, std::complex<double>> and std::is_same_v<std::remove_const_t<TS>, std::complex<double>> ? 2 : 0));
+
+    /**
+     * @brief Copy a single tile of a 2-dimensional transposing copy.
+     *
+     * @details Performs `dst[i * d0 + j] = src[i + j * s1]` (conjugated if `Conj` is true) for `i < n0` and `j < n1`,
+     * i.e. the destination is contiguous along `j` and the source is contiguous along `i`. If the value types allow it,
+     * the tile is processed with an in-register transpose micro-kernel. The tiles must not overlap.
+     */
+    template<bool Conj = false, typename TD, typename TS>
+    FORCEINLINE void transpose_tile(TD* RESTRICT dst, long d0, TS const* RESTRICT src, long s1, long n0, long n1)
+    {
+        constexpr long mk = micro_kernel_size<TD, TS>;
+        long           i  = 0;
+        if constexpr (mk > 0)
+        {
+            for (; i + mk <= n0; i += mk)
+            {
+                long j = 0;
+                for (; j + mk <= n1; j += mk)
+                    transpose_micro_kernel<Conj>(dst + i * d0 + j, d0, src + i + j * s1, s1);
+                for (; j < n1; ++j)
+                    for (long ii = i; ii < i + mk; ++ii)
+                        dst[ii * d0 + j] = conj_value<Conj>(src[ii + j * s1]);
+            }
+        }
+        for (; i < n0; ++i)
+            for (long j = 0; j < n1; ++j)
+                dst[i * d0 + j] = conj_value<Conj>(src[i + j * s1]);
+    }
+
+    /**
+     * @brief Cache-blocked 2-dimensional copy between two strided layouts.
+     *
+     * @details Performs `dst[i * d0 + j * d1] = src[i * s0 + j * s1]` (conjugated if `Conj` is true) for `i < n0` and
+     * `j < n1`. The index space is
+     * traversed in square tiles (see enda::detail::transpose_tile_size) so that neither operand is streamed through
+     * with a large stride. If the destination is contiguous along `j` and the source along `i`, the tiles are handled
+     * by enda::detail::transpose_tile. The operands must not overlap (see enda::detail::strided_overlap).
+     *
+     * @tparam Conj Should the elements be complex conjugated?
+     * @tparam TD Value type of the destination.
+     * @tparam TS Value type of the source.
+     * @param dst Pointer to the destination data.
+     * @param d0 Destination stride of the first dimension.
+     * @param d1 Destination stride of the second dimension.
+     * @param src Pointer to the source data.
+     * @param s0 Source stride of the first dimension.
+     * @param s1 Source stride of the second dimension.
+     * @param n0 Extent of the first dimension.
+     * @param n1 Extent of the second dimension.
+     */
+    template<bool Conj = false, typename TD, typename TS>
+    void transpose_copy_2d(TD* dst, long d0, long d1, TS const* src, long s0, long s1, long n0, long n1)
+    {
+        const long b = transpose_tile_size<TD>();
+        for (long ib = 0; ib < n0; ib += b)
+        {
+            const long ni = std::min(b, n0 - ib);
+            for (long jb = 0; jb < n1; jb += b)
+            {
+                const long nj = std::min(b, n1 - jb);
+                auto* dt      = dst + ib * d0 + jb * d1;
+                auto* st      = src + ib * s0 + jb * s1;
+                if (d1 == 1 and s0 == 1)
+                {
+                    transpose_tile<Conj>(dt, d0, st, s1, ni, nj);
+                }
+                else
+                {
+                    for (long i = 0; i < ni; ++i)
+                        for (long j = 0; j < nj; ++j)
+                            dt[i * d0 + j * d1] = conj_value<Conj>(st[i * s0 + j * s1]);
+                }
+            }
+        }
+    }
+
+    // Copy a 1-dimensional run of elements: dst[i * ds] = src[i * ss] (conjugated if Conj is true) for i < n.
+    template<bool Conj = false, typename TD, typename TS>
+    FORCEINLINE void copy_run(TD* dst, long ds, TS const* src, long ss, long n)
+    {
+        if (ds == 1 and ss == 1)
+        {
+            if constexpr (!Conj and std::is_same_v<TD, std::remove_const_t<TS>> and std::is_trivially_copyable_v<TD>)
+            {
+                // memmove since the operands might overlap
+                std::memmove(dst, src, n * sizeof(TD));
+            }
+            else
+            {
+                for (long i = 0; i < n; ++i)
+                    dst[i] = conj_value<Conj>(src[i]);
+            }
+        }
+        else
+        {
+            for (long i = 0; i < n; ++i)
+                dst[i * ds] = conj_value<Conj>(src[i * ss]);
+        }
+    }
+
+    // Fill a 1-dimensional run of elements: dst[i * ds] = x for i < n.
+    template<typename T, typename X>
+    FORCEINLINE void fill_run(T* RESTRICT dst, long ds, long n, X const& x)
+    {
+        if (ds == 1)
+        {
+            for (long i = 0; i < n; ++i)
+                dst[i] = x;
+        }
+        else
+        {
+            for (long i = 0; i < n; ++i)
+                dst[i * ds] = x;
+        }
+    }
+
+    /**
+     * @brief Collapse the layouts of the destination and the source of a strided copy.
+     *
+     * @details The dimensions are sorted w.r.t. the memory order of the destination and adjacent dimensions which are
+     * jointly contiguous in both operands are merged (see enda::detail::collapse_dims).
+     *
+     * @tparam R Number of dimensions.
+     * @param dst_str Strides of the destination.
+     * @param src_str Strides of the source.
+     * @param len Shape of both operands (must not contain zeros).
+     * @return enda::detail::collapsed_layout for the destination (0) and the source (1).
+     */
+    template<size_t R>
+    collapsed_layout<2, R> collapse_copy_layout(std::array<long, R> const& dst_str, std::array<long, R> const& src_str, std::array<long, R> const& len)
+    {
+        std::array<int, R> order;
+        for (int k = 0; k < static_cast<int>(R); ++k)
+            order[k] = k;
+        std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return std::abs(dst_str[a]) > std::abs(dst_str[b]); });
+        return collapse_dims<2>(len, std::array {dst_str, src_str}, order);
+    }
+
+    /**
+     * @brief Copy between two collapsed strided layouts.
+     *
+     * @details If the fastest dimension of the destination is also the fastest dimension of the source, the innermost loop
+     * is a simple (possibly contiguous) run. Otherwise, the two fastest dimensions form a 2-dimensional transposing copy
+     * (see enda::detail::transpose_copy_2d) which is repeated for every index of the remaining dimensions.
+     *
+     * The destination and the source must not overlap (see enda::detail::strided_overlap). Callers copy an overlapping
+     * source into a temporary first (e.g. for `a = transpose(a)`, see also enda::transpose_inplace).
+     *
+     * @tparam Conj Should the elements be complex conjugated?
+     * @tparam TD Value type of the destination.
+     * @tparam TS Value type of the source.
+     * @tparam R Rank of the original layouts.
+     * @param dst Pointer to the destination data.
+     * @param src Pointer to the source data.
+     * @param cl Collapsed layout (see enda::detail::collapse_copy_layout).
+     */
+    template<bool Conj = false, typename TD, typename TS, size_t R>
+    void strided_copy(TD* dst, TS const* src, collapsed_layout<2, R> const& cl)
+    {
+        // fastest dimension of the destination and of the source
+        const int inner_d = cl.rank - 1;
+        int       inner_s = inner_d;
+        for (int k = 0; k < cl.rank; ++k)
+            if (std::abs(cl.strides[1][k]) < std::abs(cl.strides[1][inner_s]))
+                inner_s = k;
+
+        if (inner_s == inner_d)
+        {
+            const long n = cl.inner_size(), ds = cl.inner_stride(0), ss = cl.inner_stride(1);
+            for_each_inner_run(cl, [&](auto const& off) { copy_run<Conj>(dst + off[0], ds, src + off[1], ss, n); });
+            return;
+        }
+
+        // remove the fastest source dimension from the outer loops and copy 2-dimensional tiles
+        const long ni = cl.lengths[inner_s], nj = cl.lengths[inner_d];
+        const long d0 = cl.strides[0][inner_s], d1 = cl.strides[0][inner_d];
+        const long s0 = cl.strides[1][inner_s], s1 = cl.strides[1][inner_d];
+        collapsed_layout<2, R> outer;
+        for (int k = 0; k < cl.rank; ++k)
+        {
+            if (k == inner_s)
+                continue;
+            outer.lengths[outer.rank] = cl.lengths[k];
+            for (size_t n = 0; n < 2; ++n)
+                outer.strides[n][outer.rank] = cl.strides[n][k];
+            ++outer.rank;
+        }
+        for_each_inner_run(outer, [&](auto const& off) { transpose_copy_2d<Conj>(dst + off[0], d0, d1, src + off[1], s0, s1, ni, nj); });
+    }
+
+    /**
+     * @brief Copy between two strided N-dimensional layouts with the same shape.
+     *
+     * @details The dimensions are traversed in the memory order of the destination (see
+     * enda::detail::collapse_copy_layout and enda::detail::strided_copy).
+     *
+     * @tparam Conj Should the elements be complex conjugated?
+     * @tparam TD Value type of the destination.
+     * @tparam TS Value type of the source.
+     * @tparam R Number of dimensions.
+     * @param dst Pointer to the destination data.
+     * @param dst_str Strides of the destination.
+     * @param src Pointer to the source data.
+     * @param src_str Strides of the source.
+     * @param len Shape of both operands.
+     */
+    template<bool Conj = false, typename TD, typename TS, size_t R>
+    void strided_copy(TD* dst, std::array<long, R> const& dst_str, TS const* src, std::array<long, R> const& src_str, std::array<long, R> const& len)
+    {
+        if (std::any_of(len.cbegin(), len.cend(), [](long l) { return l == 0; }))
+            return;
+        strided_copy<Conj>(dst, src, collapse_copy_layout(dst_str, src_str, len));
+    }
+
+    /**
+     * @brief Transpose (and conjugate) a band of tile rows of a square matrix in place.
+     *
+     * @details The matrix `a[i * ld + j]` of size `n x n` is split into square tiles (see
+     * enda::detail::transpose_tile_size). For every tile `(I, J)` with `ib_begin <= I < ib_end` and `J >= I`, the tile is
+     * swapped with the transposed tile `(J, I)`: the tile `(I, J)` is transposed into a buffer, the tile `(J, I)` is
+     * transposed into the tile `(I, J)` and the buffer is copied back, all with the in-register micro-kernels of
+     * enda::detail::transpose_tile. Diagonal tiles are transposed by swapping elements. Disjoint bands can be processed
+     * concurrently.
+     *
+     * @tparam Conj Should the elements be complex conjugated?
+     * @tparam T Value type.
+     * @param a Pointer to the matrix data.
+     * @param ld Stride of the first dimension (the second dimension has to be contiguous).
+     * @param n Size of the matrix.
+     * @param ib_begin First tile row.
+     * @param ib_end One past the last tile row.
+     */
+    template<bool Conj = false, typename T>
+    void transpose_inplace_tiles(T* a, long ld, long n, long ib_begin, long ib_end)
+    {
+        const long b   = transpose_tile_size<T>();
+        auto       buf = std::vector<T>(b * b);
+        for (long ib = ib_begin; ib < ib_end; ++ib)
+        {
+            const long i0 = ib * b, ni = std::min(b, n - i0);
+            auto*      d  = a + i0 * ld + i0;
+            for (long i = 0; i < ni; ++i)
+            {
+                d[i * ld + i] = conj_value<Conj>(d[i * ld + i]);
+                for (long j = i + 1; j < ni; ++j)
+                {
+                    auto const t  = d[i * ld + j];
+                    d[i * ld + j] = conj_value<Conj>(d[j * ld + i]);
+                    d[j * ld + i] = conj_value<Conj>(t);
+                }
+            }
+            for (long j0 = i0 + b; j0 < n; j0 += b)
+            {
+                const long nj = std::min(b, n - j0);
+                auto*      x  = a + i0 * ld + j0;
+                auto*      y  = a + j0 * ld + i0;
+                transpose_tile<Conj>(buf.data(), ni, x, ld, nj, ni);
+                transpose_tile<Conj>(x, ld, y, ld, ni, nj);
+                for (long i = 0; i < nj; ++i)
+                    for (long j = 0; j < ni; ++j)
+                        y[i * ld + j] = buf[i * ni + j];
+            }
+        }
+    }
+
+    /**
+     * @brief Transpose (and conjugate) a contiguous rectangular matrix in place by following the cycles of the permutation.
+     *
+     * @details The `m x n` matrix stored contiguously in row-major order is replaced by its `n x m` transpose in row-major
+     * order. The element at position `p = i * n + j` moves to `j * m + i`. Every cycle of this permutation is followed
+     * once, which needs one bit per element to mark the visited positions instead of a full copy of the matrix. The
+     * memory access pattern is essentially random, so this is much slower than an out-of-place copy and should only be
+     * used if memory is scarce.
+     *
+     * @tparam Conj Should the elements be complex conjugated?
+     * @tparam T Value type.
+     * @param a Pointer to the matrix data.
+     * @param m Number of rows.
+     * @param n Number of columns.
+     */
+    template<bool Conj = false, typename T>
+    void transpose_inplace_cycles(T* a, long m, long n)
+    {
+        const long size = m * n;
+        if (size <= 1)
+            return;
+        auto visited = std::vector<uint64_t>((size + 63) / 64, 0);
+        auto mark    = [&visited](long p) { visited[p / 64] |= uint64_t {1} << (p % 64); };
+        auto is_set  = [&visited](long p) { return (visited[p / 64] >> (p % 64)) & 1; };
+        for (long start = 0; start < size; ++start)
+        {
+            if (is_set(start))
+                continue;
+            // move the elements along the cycle starting at start
+            auto val = a[start];
+            long p   = start;
+            while (true)
+            {
+                mark(p);
+                const long q = (p % n) * m + p / n;
+                if (q == start)
+                    break;
+                auto const t = a[q];
+                a[q]         = conj_value<Conj>(val);
+                val          = t;
+                p            = q;
+            }
+            a[start] = conj_value<Conj>(val);
+        }
+    }
+
+} // namespace enda::detail
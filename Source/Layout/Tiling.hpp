@@ -0,0 +1,383 @@
+/**
+ * @file Tiling.hpp
+ *
+ * @brief Provides cache-tiled traversals of multi-dimensional index spaces and arrays/views.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "Layout/ForEach.hpp"
+#include "Layout/Padding.hpp"
+#include "Layout/Range.hpp"
+#include "Macros.hpp"
+
+namespace enda
+{
+    /// Order in which the tiles of a tiled traversal are visited.
+    enum class tile_order
+    {
+        /// Lexicographic order of the tile indices w.r.t. the traversal order (the last/fastest tile index varies fastest).
+        lexicographic,
+
+        /// Z-order (Morton order), which keeps neighbouring tiles close in time and improves reuse in higher cache levels.
+        morton
+    };
+
+    namespace detail
+    {
+        // Size and line size (in bytes) of the L1 data cache, queried once (falls back to 32 KiB and 64 bytes).
+        inline std::array<long, 2> l1_data_cache_size_and_line() noexcept
+        {
+            static std::array<long, 2> const res = []() -> std::array<long, 2> {
+                try
+                {
+                    auto const ci = get_L1_data_cache_info();
+                    if (ci.size > 0 and ci.lineSize > 0)
+                        return {long(ci.size), long(ci.lineSize)};
+                }
+                catch (std::exception const&)
+                {}
+                return {32 * 1024, 64};
+            }();
+            return res;
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Get a tile shape whose footprint fits into the L1 data cache.
+     *
+     * @details The tile holds about as many elements as fit into the L1 data cache (see enda::get_L1_data_cache_info).
+     * Its extent along the fastest dimension (the last one for C-order) is an eighth of that budget, rounded up to full
+     * cache lines, so that the innermost loops stay long enough for vectorization and hardware prefetching and the rows
+     * of a tile do not all map to the same cache sets. The remaining budget is distributed evenly over the other
+     * dimensions. The tile shape is clipped to the given shape.
+     *
+     * @tparam R Number of dimensions.
+     * @tparam Int Integer type used in the shape array.
+     * @param shape Shape of the index space.
+     * @param value_size Size of an element in bytes.
+     * @param fastest Fastest varying dimension.
+     * @return Tile shape.
+     */
+    template<size_t R, std::integral Int = long>
+    std::array<long, R> default_tile_shape(std::array<Int, R> const& shape, long value_size = sizeof(double), int fastest = R - 1)
+    {
+        auto const [l1_size, l1_line] = detail::l1_data_cache_size_and_line();
+        long const budget             = std::max(1l, l1_size / std::max(1l, value_size));
+        long const line               = std::max(1l, l1_line / std::max(1l, value_size));
+
+        // fastest dimension: long runs of full cache lines
+        std::array<long, R> tile {};
+        long const          inner = (std::max(budget / 8, line) + line - 1) / line * line;
+        tile[fastest]             = std::max(1l, std::min<long>(shape[fastest], inner));
+
+        // other dimensions: share the remaining budget evenly
+        if constexpr (R > 1)
+        {
+            auto const other = std::max(1l, static_cast<long>(std::pow(double(budget / tile[fastest]), 1.0 / (R - 1))));
+            for (int k = 0; k < int(R); ++k)
+                if (k != fastest)
+                    tile[k] = std::max(1l, std::min<long>(shape[k], other));
+        }
+        return tile;
+    }
+
+    namespace detail
+    {
+        // Loop over all indices of the box [lo, hi) in the order given by a compile-time stride order (the innermost loop
+        // variable is passed directly to keep it in a register).
+        template<int I, uint64_t StrideOrder, typename F, size_t R>
+        FORCEINLINE void for_each_in_box(std::array<long, R> const& lo, std::array<long, R> const& hi, std::array<long, R>& idxs, F& f)
+        {
+            static constexpr int J = index_from_stride_order<R>(StrideOrder, I);
+            if constexpr (I == R - 1)
+            {
+                [&]<size_t... Is>(std::index_sequence<Is...>) {
+                    for (long i = lo[J]; i < hi[J]; ++i)
+                        f((Is == J ? i : idxs[Is])...);
+                }(std::make_index_sequence<R> {});
+            }
+            else
+            {
+                for (long i = lo[J]; i < hi[J]; ++i)
+                {
+                    idxs[J] = i;
+                    for_each_in_box<I + 1, StrideOrder>(lo, hi, idxs, f);
+                }
+            }
+        }
+
+        // Visit the tile indices in [lo, hi) of a tile grid in Z-order by recursively halving all dimensions with more
+        // than one tile. The children are visited with the fastest dimension (w.r.t. the stride order) varying fastest.
+        template<uint64_t StrideOrder, typename G, size_t R>
+        void for_each_tile_index_morton(std::array<long, R> const& lo, std::array<long, R> const& hi, G& g)
+        {
+            std::array<long, R> mid {};
+            int                 n_split = 0;
+            for (size_t k = 0; k < R; ++k)
+            {
+                mid[k] = lo[k] + (hi[k] - lo[k] + 1) / 2;
+                n_split += (hi[k] - lo[k] > 1 ? 1 : 0);
+            }
+            if (n_split == 0)
+            {
+                g(lo);
+                return;
+            }
+
+            // child c: bit b of c selects the upper half of the b-th split dimension, counted from the fastest one
+            for (long c = 0; c < (1l << n_split); ++c)
+            {
+                std::array<long, R> clo = lo, chi = hi;
+                int                 b   = 0;
+                bool                ok  = true;
+                for (int i = int(R) - 1; i >= 0; --i)
+                {
+                    int const J = index_from_stride_order<R>(StrideOrder, i);
+                    if (hi[J] - lo[J] <= 1)
+                        continue;
+                    if ((c >> b) & 1)
+                        clo[J] = mid[J];
+                    else
+                        chi[J] = mid[J];
+                    ok = ok and clo[J] < chi[J];
+                    ++b;
+                }
+                if (ok)
+                    for_each_tile_index_morton<StrideOrder>(clo, chi, g);
+            }
+        }
+
+        // Visit all tile indices of a grid with n_tiles tiles per dimension in the given order.
+        template<uint64_t StrideOrder, typename G, size_t R>
+        void for_each_tile_index(std::array<long, R> const& n_tiles, tile_order order, G&& g)
+        { // NOLINT (we do not want to forward here)
+            if (std::any_of(n_tiles.begin(), n_tiles.end(), [](long n) { return n <= 0; }))
+                return;
+            if (order == tile_order::morton)
+                for_each_tile_index_morton<StrideOrder>(std::array<long, R> {}, n_tiles, g);
+            else
+                for_each_ordered<StrideOrder>(n_tiles, [&g](auto... t) { g(std::array<long, R> {t...}); });
+        }
+
+        // Number of tiles per dimension.
+        template<size_t R, std::integral Int>
+        std::array<long, R> number_of_tiles(std::array<Int, R> const& shape, std::array<long, R> const& tile_shape)
+        {
+            std::array<long, R> n {};
+            for (size_t k = 0; k < R; ++k)
+            {
+                EXPECTS(tile_shape[k] > 0);
+                n[k] = (long(shape[k]) + tile_shape[k] - 1) / tile_shape[k];
+            }
+            return n;
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Loop tile by tile over all possible index values of a given shape and apply a function to them.
+     *
+     * @details The index space is partitioned into boxes of the given tile shape (the tiles at the upper boundaries may
+     * be smaller). The tiles are visited in the given enda::tile_order and the indices within a tile in the order given by
+     * the encoded `StrideOrder` (C-order by default). Compared to enda::for_each, a kernel accessing neighbouring
+     * elements (e.g. a stencil) finds most of them in cache, since the working set of a tile is small.
+     *
+     * @tparam StrideOrder Encoded stride order.
+     * @tparam F Callable type.
+     * @tparam R Number of dimensions.
+     * @tparam Int Integer type used in the shape array.
+     * @param shape Shape to loop over (index bounds).
+     * @param tile_shape Shape of the tiles.
+     * @param f Callable object, must be callable as `f(long, ..., long)` with `R` arguments.
+     * @param order Order in which the tiles are visited.
+     */
+    template<uint64_t StrideOrder = 0, typename F, auto R, std::integral Int = long>
+    void for_each_tile(std::array<Int, R> const& shape, std::array<long, R> const& tile_shape, F&& f, tile_order order = tile_order::lexicographic)
+    { // NOLINT (we do not want to forward here)
+        detail::for_each_tile_index<StrideOrder>(detail::number_of_tiles(shape, tile_shape), order, [&](std::array<long, R> const& t) {
+            std::array<long, R> lo {}, hi {}, idxs {};
+            for (size_t k = 0; k < R; ++k)
+            {
+                lo[k] = t[k] * tile_shape[k];
+                hi[k] = std::min<long>(lo[k] + tile_shape[k], shape[k]);
+            }
+            detail::for_each_in_box<0, StrideOrder>(lo, hi, idxs, f);
+        });
+    }
+
+    /**
+     * @brief Loop tile by tile over all possible index values of a given shape using enda::default_tile_shape (for
+     * elements of type `double`).
+     *
+     * @tparam StrideOrder Encoded stride order.
+     * @tparam F Callable type.
+     * @tparam R Number of dimensions.
+     * @tparam Int Integer type used in the shape array.
+     * @param shape Shape to loop over (index bounds).
+     * @param f Callable object, must be callable as `f(long, ..., long)` with `R` arguments.
+     * @param order Order in which the tiles are visited.
+     */
+    template<uint64_t StrideOrder = 0, typename F, auto R, std::integral Int = long>
+    void for_each_tile(std::array<Int, R> const& shape, F&& f, tile_order order = tile_order::lexicographic)
+    {
+        constexpr int fastest = detail::index_from_stride_order<R>(StrideOrder, R - 1);
+        for_each_tile<StrideOrder>(shape, default_tile_shape(shape, sizeof(double), fastest), std::forward<F>(f), order);
+    }
+
+    /**
+     * @brief Range of the tiles of an array/view.
+     *
+     * @details Dereferencing its iterators gives the sub-view `v(range(lo_0, hi_0), ..., range(lo_{R-1}, hi_{R-1}))` of
+     * the corresponding tile. See enda::tiles.
+     *
+     * @tparam V View type (result of `a()` for an array/view `a`).
+     */
+    template<typename V>
+    class tile_range
+    {
+        static constexpr int R = V::rank;
+
+        // View of the whole array.
+        V v;
+
+        // Shape of the tiles.
+        std::array<long, R> tile_shape;
+
+        // Lower corners of the tiles in the order of the traversal.
+        std::vector<std::array<long, R>> origins;
+
+    public:
+        /**
+         * @brief Construct the range of tiles of a view.
+         *
+         * @param v View of the whole array.
+         * @param tile_shape Shape of the tiles.
+         * @param order Order in which the tiles are visited.
+         */
+        tile_range(V v, std::array<long, R> const& tile_shape, tile_order order) : v(std::move(v)), tile_shape(tile_shape)
+        {
+            auto const& shape = this->v.shape();
+            detail::for_each_tile_index<V::layout_t::stride_order_encoded>(detail::number_of_tiles(shape, tile_shape), order,
+                                                                           [this](std::array<long, R> const& t) {
+                                                                               std::array<long, R> lo {};
+                                                                               for (int k = 0; k < R; ++k)
+                                                                                   lo[k] = t[k] * this->tile_shape[k];
+                                                                               origins.push_back(lo);
+                                                                           });
+        }
+
+        /// Get the number of tiles.
+        [[nodiscard]] long size() const noexcept { return static_cast<long>(origins.size()); }
+
+        /**
+         * @brief Get the index ranges of the n-th tile.
+         * @param n Position of the tile in the traversal.
+         * @return std::array of enda::range objects.
+         */
+        [[nodiscard]] std::array<range, R> ranges(long n) const
+        {
+            auto const& lo = origins[n];
+            return [&]<size_t... Is>(std::index_sequence<Is...>) {
+                return std::array<range, R> {range(lo[Is], std::min(lo[Is] + tile_shape[Is], long(v.shape()[Is])))...};
+            }(std::make_index_sequence<R> {});
+        }
+
+        /// Get the sub-view of the n-th tile.
+        [[nodiscard]] auto operator[](long n) const
+        {
+            return std::apply([this](auto const&... r) { return v(r...); }, ranges(n));
+        }
+
+        /// Iterator over the tiles.
+        class iterator
+        {
+            tile_range const* tr = nullptr;
+            long              n  = 0;
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = decltype(std::declval<tile_range const&>()[0]);
+            using difference_type   = std::ptrdiff_t;
+
+            iterator() = default;
+            iterator(tile_range const* tr, long n) : tr(tr), n(n) {}
+
+            [[nodiscard]] value_type operator*() const { return (*tr)[n]; }
+
+            iterator& operator++()
+            {
+                ++n;
+                return *this;
+            }
+
+            iterator operator++(int)
+            {
+                auto c = *this;
+                ++n;
+                return c;
+            }
+
+            [[nodiscard]] bool operator==(iterator const& rhs) const { return n == rhs.n; }
+        };
+
+        /// Iterator to the first tile.
+        [[nodiscard]] iterator begin() const { return {this, 0}; }
+
+        /// Iterator past the last tile.
+        [[nodiscard]] iterator end() const { return {this, size()}; }
+    };
+
+    /**
+     * @brief Get the tiles of an array/view as a range of sub-views.
+     *
+     * @details The array/view is partitioned into tiles of the given shape (the tiles at the upper boundaries may be
+     * smaller), which are visited in the given enda::tile_order (w.r.t. the stride order of the array/view). Each element
+     * of the range is a view obtained by slicing the array/view with enda::range objects.
+     *
+     * @code{.cpp}
+     * for (auto t : enda::tiles(a, {64, 64}))
+     *     t = 0;
+     * @endcode
+     *
+     * @tparam A Array/view type.
+     * @param a Array/view.
+     * @param tile_shape Shape of the tiles.
+     * @param order Order in which the tiles are visited.
+     * @return enda::tile_range of the tiles.
+     */
+    template<typename A>
+    auto tiles(A&& a, std::array<long, std::remove_cvref_t<A>::rank> const& tile_shape, tile_order order = tile_order::lexicographic)
+    {
+        return tile_range<decltype(a())>(a(), tile_shape, order);
+    }
+
+    /**
+     * @brief Get the tiles of an array/view as a range of sub-views using enda::default_tile_shape.
+     *
+     * @tparam A Array/view type.
+     * @param a Array/view.
+     * @param order Order in which the tiles are visited.
+     * @return enda::tile_range of the tiles.
+     */
+    template<typename A>
+    auto tiles(A&& a, tile_order order = tile_order::lexicographic)
+    {
+        using A_t             = std::remove_cvref_t<A>;
+        constexpr int fastest = A_t::layout_t::stride_order[A_t::rank - 1];
+        return tiles(std::forward<A>(a), default_tile_shape(a.shape(), sizeof(typename A_t::value_type), fastest), order);
+    }
+
+} // namespace enda
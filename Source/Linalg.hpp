@@ -0,0 +1,13 @@
+/**
+ * @file Linalg.hpp
+ *
+ * @brief Includes all relevant headers for the linear algebra functionality.
+ */
+
+#pragma once
+
+#include "Linalg/AnalyticFunctions.hpp"
+#include "Linalg/Batched.hpp"
+#include "Linalg/Factorizations.hpp"
+#include "Linalg/Gemm.hpp"
+#include "Linalg/Spectral.hpp"
@@ -0,0 +1,647 @@
+/**
+ * @file AnalyticFunctions.hpp
+ *
+ * @brief Provides the exponential, the principal square root and the principal logarithm of matrices.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <numbers>
+#include <type_traits>
+#include <vector>
+
+#include "BasicArray.hpp"
+#include "Concepts.hpp"
+#include "Declarations.hpp"
+#include "Exceptions.hpp"
+#include "Linalg/Batched.hpp"
+#include "Linalg/Factorizations.hpp"
+#include "Linalg/Gemm.hpp"
+#include "Linalg/Spectral.hpp"
+#include "Macros.hpp"
+#include "Traits.hpp"
+
+namespace enda::linalg
+{
+    namespace detail
+    {
+        // Matrix functions provided by this file.
+        enum class analytic_function
+        {
+            exp,
+            sqrt,
+            log
+        };
+
+        // Maximum number of iterations of the Denman-Beavers square root iteration.
+        inline constexpr int sqrtm_max_iterations = 100;
+
+        // Maximum number of square roots taken by the inverse scaling and squaring algorithm of the logarithm.
+        inline constexpr int logm_max_square_roots = 64;
+
+        // Degree of the Pade approximant of log(1 + x) used by the logarithm (evaluated by Gauss-Legendre quadrature).
+        inline constexpr int logm_pade_degree = 8;
+
+        // The logarithm uses the Pade approximant once the distance to the identity is at most this (1-norm).
+        inline constexpr double logm_pade_radius = 0.25;
+
+        // Column-major n x n matrix in a buffer.
+        template<typename T>
+        strided_matrix<T> column_major(std::vector<T>& buf, long n)
+        {
+            buf.resize(n * n);
+            return {buf.data(), 1, n};
+        }
+
+        // B = A for n x n matrices.
+        template<typename T>
+        void copy_square(long n, strided_matrix<T> a, strided_matrix<T> b)
+        {
+            for (long j = 0; j < n; ++j)
+                for (long i = 0; i < n; ++i)
+                    b(i, j) = a(i, j);
+        }
+
+        // A = s * I.
+        template<typename T>
+        void set_identity(long n, strided_matrix<T> a, T s = T {1})
+        {
+            for (long j = 0; j < n; ++j)
+                for (long i = 0; i < n; ++i)
+                    a(i, j) = (i == j ? s : T {0});
+        }
+
+        // C = A * B for n x n matrices (B is read conjugate transposed if adjoint is true).
+        template<typename T>
+        void square_product(long n, strided_matrix<T> a, strided_matrix<T> b, strided_matrix<T> c, bool adjoint = false)
+        {
+            auto const opb = (adjoint ? strided_operand<T> {b.p, b.cs, b.rs, true} : b.operand());
+            gemm_strided<T>(n, n, n, T {1}, a.operand(), opb, T {0}, c.p, c.rs, c.cs);
+        }
+
+        // 1-norm (maximum absolute column sum) of A - s * I.
+        template<typename T>
+        real_t<T> norm1_shifted(long n, strided_matrix<T> a, T s = T {0})
+        {
+            real_t<T> r = 0;
+            for (long j = 0; j < n; ++j)
+            {
+                real_t<T> c = 0;
+                for (long i = 0; i < n; ++i)
+                    c += std::abs(i == j ? a(i, j) - s : a(i, j));
+                r = std::max(r, c);
+            }
+            return r;
+        }
+
+        // Solve A * X = B in place (A is overwritten by its LU factorization). Returns the logarithm of |det(A)| or
+        // -infinity if A is singular.
+        template<typename T>
+        real_t<T> solve_square(long n, strided_matrix<T> a, strided_matrix<T> b)
+        {
+            auto ipiv = std::vector<long>(n);
+            if (getrf(n, n, a, ipiv.data()) != 0)
+                return -std::numeric_limits<real_t<T>>::infinity();
+            getrs(n, n, a, ipiv.data(), b);
+            real_t<T> logdet = 0;
+            for (long i = 0; i < n; ++i)
+                logdet += std::log(std::abs(a(i, i)));
+            return logdet;
+        }
+
+        // Returns 1 if the matrix is Hermitian, i if it is skew-Hermitian (complex matrices only) and 0 otherwise.
+        template<typename T>
+        T normal_kind(long n, strided_matrix<T> a)
+        {
+            bool herm = true, skew = is_complex_v<T>;
+            for (long j = 0; j < n and (herm or skew); ++j)
+                for (long i = j; i < n; ++i)
+                {
+                    const T x = a(i, j), y = conj_if(a(j, i), true);
+                    herm      = herm and x == y;
+                    skew      = skew and x == -y;
+                }
+            if (herm)
+                return T {1};
+            if constexpr (is_complex_v<T>)
+                if (skew)
+                    return T {0, 1};
+            return T {0};
+        }
+
+        // Scalar version of a matrix function (throws if a real matrix has no real result).
+        template<analytic_function F, typename T>
+        T scalar_function(T const& x)
+        {
+            if constexpr (F == analytic_function::exp)
+            {
+                return std::exp(x);
+            }
+            else
+            {
+                if constexpr (!is_complex_v<T>)
+                    if (x < 0)
+                        ENDA_RUNTIME_ERROR << "Error in enda::" << (F == analytic_function::sqrt ? "sqrtm" : "logm")
+                                           << ": Real matrix with negative eigenvalues (use a complex matrix)";
+                if constexpr (F == analytic_function::sqrt)
+                    return std::sqrt(x);
+                else
+                {
+                    if (x == T {0})
+                        ENDA_RUNTIME_ERROR << "Error in enda::logm: Matrix is singular";
+                    return std::log(x);
+                }
+            }
+        }
+
+        // f(A) = V * diag(f(c * w)) * V^H for A = c * K, with c = 1 or i and the eigendecomposition K = V * diag(w) * V^H
+        // of the Hermitian matrix K. For exp and sqrt, eigenvalues below the rounding level are set to zero (which avoids
+        // spurious negative eigenvalues of semidefinite matrices). For log, they are kept as they are since log is not
+        // continuous at zero: only an exact zero or a negative eigenvalue of a real matrix is an error.
+        template<analytic_function F, typename T>
+        void funm_normal(long n, strided_matrix<T> a, T c)
+        {
+            using R   = real_t<T>;
+            auto vbuf = std::vector<T>();
+            auto wbuf = std::vector<T>();
+            auto v    = column_major(vbuf, n);
+            auto wv   = column_major(wbuf, n);
+            for (long j = 0; j < n; ++j)
+                for (long i = j; i < n; ++i)
+                    v(i, j) = a(i, j) / c;
+            auto w = std::vector<R>(n);
+            heevd(n, v, w.data(), true);
+
+            const R wmax        = std::max(std::abs(w.front()), std::abs(w.back()));
+            const R tol         = static_cast<R>(n) * std::numeric_limits<R>::epsilon() * wmax;
+            bool    real_values = (c == T {1});
+            for (long j = 0; j < n; ++j)
+            {
+                // real eigenvalues are not multiplied by c to keep the sign of a zero imaginary part
+                const R x  = (F != analytic_function::log and std::abs(w[j]) <= tol ? R {0} : w[j]);
+                const T fw = scalar_function<F>(c == T {1} ? T(x) : c * x);
+                real_values = real_values and std::imag(fw) == 0;
+                for (long i = 0; i < n; ++i)
+                    wv(i, j) = v(i, j) * fw;
+            }
+            square_product(n, wv, v, a, true);
+
+            // real f(w) give a Hermitian result
+            if (real_values)
+                hermitian_from_lower(n, a);
+        }
+
+        // Pade degrees and the corresponding bounds of the 1-norm up to which they are accurate in double and single
+        // precision (Higham, SIAM J. Matrix Anal. Appl. 26, 2005).
+        inline constexpr int expm_degrees[]         = {3, 5, 7, 9, 13};
+        inline constexpr double expm_theta_double[] = {1.495585217958292e-2, 2.539398330063230e-1, 9.504178996162932e-1, 2.097847961257068e0, 5.371920351148152e0};
+        inline constexpr double expm_theta_single[] = {4.258730016922831e-1, 1.880152677804762e0, 3.925724783138660e0};
+
+        // Coefficients of the numerators of the [m/m] Pade approximants of exp(x).
+        inline constexpr double expm_pade3[]  = {120., 60., 12., 1.};
+        inline constexpr double expm_pade5[]  = {30240., 15120., 3360., 420., 30., 1.};
+        inline constexpr double expm_pade7[]  = {17297280., 8648640., 1995840., 277200., 25200., 1512., 56., 1.};
+        inline constexpr double expm_pade9[]  = {17643225600., 8821612800., 2075673600., 302702400., 30270240., 2162160., 110880., 3960., 90., 1.};
+        inline constexpr double expm_pade13[] = {64764752532480000., 32382376266240000., 7771770303897600., 1187353796428800., 129060195264000.,
+                                                 10559470521600.,    670442572800.,      33522128640.,     1323241920.,      40840800.,
+                                                 960960.,            16380.,             182.,             1.};
+
+        // Coefficients of the numerator of the [m/m] Pade approximant of exp(x).
+        constexpr double const* expm_pade_coefficients(int m)
+        {
+            switch (m)
+            {
+                case 3: return expm_pade3;
+                case 5: return expm_pade5;
+                case 7: return expm_pade7;
+                case 9: return expm_pade9;
+                default: return expm_pade13;
+            }
+        }
+
+        /**
+         * @brief Matrix exponential by scaling and squaring with Pade approximants in place.
+         *
+         * @details The degree `m` of the diagonal Pade approximant `r_m(x) = q_m(x)^{-1} p_m(x)` is the smallest one for
+         * which the 1-norm of `A` is below the bound `theta_m`. If there is none, `A` is scaled by `2^{-s}` so that the
+         * highest degree can be used and the result is squared `s` times. The even and odd parts of `p_m` are evaluated
+         * with the least number of matrix products (Paterson-Stockmeyer like for `m = 13`), all of which run on the
+         * blocked GEMM, followed by a single LU solve.
+         *
+         * @tparam T Value type.
+         * @param n Size of the matrix.
+         * @param a Matrix, overwritten by its exponential.
+         */
+        template<typename T>
+        void expm_pade(long n, strided_matrix<T> a)
+        {
+            using R                 = real_t<T>;
+            constexpr bool single   = std::is_same_v<R, float>;
+            constexpr int n_degrees = (single ? 3 : 5);
+            auto const& theta       = (single ? expm_theta_single : expm_theta_double);
+
+            const R nrm = norm1_shifted(n, a);
+            if (!std::isfinite(nrm))
+                ENDA_RUNTIME_ERROR << "Error in enda::expm: Matrix contains non-finite elements";
+            int d = 0;
+            while (d < n_degrees - 1 and nrm > static_cast<R>(theta[d]))
+                ++d;
+            const int m = expm_degrees[d];
+            int       s = 0;
+            if (nrm > static_cast<R>(theta[d]))
+                s = static_cast<int>(std::ceil(std::log2(nrm / static_cast<R>(theta[d]))));
+            double const* b = expm_pade_coefficients(m);
+
+            // scaled matrix and its even powers
+            std::vector<T> bufs[8];
+            auto x = column_major(bufs[0], n), x2 = column_major(bufs[1], n), x4 = column_major(bufs[2], n), x6 = column_major(bufs[3], n);
+            auto u = column_major(bufs[4], n), v = column_major(bufs[5], n), t = column_major(bufs[6], n), q = column_major(bufs[7], n);
+            const T scale = static_cast<T>(std::ldexp(R {1}, -s));
+            for (long j = 0; j < n; ++j)
+                for (long i = 0; i < n; ++i)
+                    x(i, j) = scale * a(i, j);
+            square_product(n, x, x, x2);
+            if (m >= 5)
+                square_product(n, x2, x2, x4);
+            if (m >= 7)
+                square_product(n, x4, x2, x6);
+
+            auto coef = [b](int k) { return static_cast<T>(b[k]); };
+            if (m <= 9)
+            {
+                // t = sum_k b_{2k+1} X^{2k}, v = sum_k b_{2k} X^{2k} (with X^8 = X^4 * X^4 for m = 9)
+                std::vector<T> x8buf;
+                auto           x8 = (m == 9 ? column_major(x8buf, n) : x);
+                if (m == 9)
+                    square_product(n, x4, x4, x8);
+                strided_matrix<T> const powers[] = {x2, x4, x6, x8};
+                set_identity(n, t, coef(1));
+                set_identity(n, v, coef(0));
+                for (int k = 1; 2 * k < m; ++k)
+                    for (long j = 0; j < n; ++j)
+                        for (long i = 0; i < n; ++i)
+                        {
+                            t(i, j) += coef(2 * k + 1) * powers[k - 1](i, j);
+                            v(i, j) += coef(2 * k) * powers[k - 1](i, j);
+                        }
+            }
+            else
+            {
+                // t = X6 * (b13 X6 + b11 X4 + b9 X2) + b7 X6 + b5 X4 + b3 X2 + b1 I and similarly for v with the even
+                // coefficients
+                for (long j = 0; j < n; ++j)
+                    for (long i = 0; i < n; ++i)
+                    {
+                        u(i, j) = coef(13) * x6(i, j) + coef(11) * x4(i, j) + coef(9) * x2(i, j);
+                        q(i, j) = coef(12) * x6(i, j) + coef(10) * x4(i, j) + coef(8) * x2(i, j);
+                    }
+                square_product(n, x6, u, t);
+                square_product(n, x6, q, v);
+                for (long j = 0; j < n; ++j)
+                    for (long i = 0; i < n; ++i)
+                    {
+                        const T id = (i == j ? T {1} : T {0});
+                        t(i, j) += coef(7) * x6(i, j) + coef(5) * x4(i, j) + coef(3) * x2(i, j) + coef(1) * id;
+                        v(i, j) += coef(6) * x6(i, j) + coef(4) * x4(i, j) + coef(2) * x2(i, j) + coef(0) * id;
+                    }
+            }
+
+            // u = X * t, r_m(X) = (v - u)^{-1} (v + u)
+            square_product(n, x, t, u);
+            for (long j = 0; j < n; ++j)
+                for (long i = 0; i < n; ++i)
+                {
+                    q(i, j) = v(i, j) - u(i, j);
+                    t(i, j) = v(i, j) + u(i, j);
+                }
+            if (!std::isfinite(solve_square(n, q, t)))
+                ENDA_RUNTIME_ERROR << "Error in enda::expm: Pade denominator is singular";
+
+            // undo the scaling by repeated squaring
+            for (int k = 0; k < s; ++k)
+            {
+                square_product(n, t, t, q);
+                std::swap(t, q);
+            }
+            copy_square(n, t, a);
+        }
+
+        /**
+         * @brief Principal square root by the scaled product form of the Denman-Beavers iteration in place.
+         *
+         * @details The iteration `Y_{k+1} = mu_k Y_k (I + mu_k^{-2} M_k^{-1}) / 2` and
+         * `M_{k+1} = (I + (mu_k^2 M_k + mu_k^{-2} M_k^{-1}) / 2) / 2` with `Y_0 = M_0 = A` converges quadratically to
+         * `Y = A^{1/2}` and `M = I` (Higham, Functions of Matrices, 2008, Sec. 6.3). The determinant scaling
+         * `mu_k = |det(M_k)|^{-1/(2n)}` reduces the number of iterations and is switched off close to convergence. Each
+         * iteration costs one LU based inversion and one GEMM.
+         *
+         * @tparam T Value type.
+         * @param n Size of the matrix.
+         * @param a Matrix, overwritten by its square root.
+         * @return False if the iteration did not converge (e.g. for eigenvalues on the closed negative real axis).
+         */
+        template<typename T>
+        bool sqrtm_db(long n, strided_matrix<T> a)
+        {
+            using R = real_t<T>;
+            std::vector<T> bufs[5];
+            auto y = column_major(bufs[0], n), m = column_major(bufs[1], n), minv = column_major(bufs[2], n);
+            auto lu = column_major(bufs[3], n), t = column_major(bufs[4], n);
+            copy_square(n, a, y);
+            copy_square(n, a, m);
+
+            const R tol     = static_cast<R>(n) * std::numeric_limits<R>::epsilon();
+            bool    scaling = true;
+            R       err_old = std::numeric_limits<R>::infinity();
+            for (int it = 0; it < sqrtm_max_iterations; ++it)
+            {
+                copy_square(n, m, lu);
+                set_identity(n, minv);
+                const R logdet = solve_square(n, lu, minv);
+                if (!std::isfinite(logdet))
+                    return false;
+                const R mu  = (scaling ? std::exp(-logdet / static_cast<R>(2 * n)) : R {1});
+                const R mu2 = mu * mu;
+
+                // Y = mu / 2 * Y * (I + mu^{-2} M^{-1}), M = (I + (mu^2 M + mu^{-2} M^{-1}) / 2) / 2
+                for (long j = 0; j < n; ++j)
+                    for (long i = 0; i < n; ++i)
+                    {
+                        const T id = (i == j ? T {1} : T {0});
+                        lu(i, j)   = static_cast<T>(mu / 2) * (id + minv(i, j) / mu2);
+                        m(i, j)    = (id + (mu2 * m(i, j) + minv(i, j) / mu2) / T {2}) / T {2};
+                    }
+                square_product(n, y, lu, t);
+                std::swap(y, t);
+
+                const R err = norm1_shifted(n, m, T {1});
+                if (!std::isfinite(err))
+                    return false;
+                if (err <= tol or (err_old < R {1e-3} and err >= err_old / 2))
+                {
+                    copy_square(n, y, a);
+                    return true;
+                }
+                scaling = scaling and err > R {1e-2};
+                err_old = err;
+            }
+            return false;
+        }
+
+        // Nodes and weights of the m-point Gauss-Legendre quadrature on [0, 1].
+        template<typename R>
+        void gauss_legendre(int m, R* x, R* w)
+        {
+            for (int i = 0; i < m; ++i)
+            {
+                // Newton iteration for the i-th root of the Legendre polynomial P_m on [-1, 1]
+                double z = std::cos(std::numbers::pi * (i + 0.75) / (m + 0.5)), dp = 0;
+                for (int it = 0; it < 100; ++it)
+                {
+                    double p0 = 1, p1 = z;
+                    for (int k = 2; k <= m; ++k)
+                    {
+                        const double p2 = ((2 * k - 1) * z * p1 - (k - 1) * p0) / k;
+                        p0              = p1;
+                        p1              = p2;
+                    }
+                    dp             = m * (z * p1 - p0) / (z * z - 1);
+                    const double dz = p1 / dp;
+                    z -= dz;
+                    if (std::abs(dz) < 1e-16)
+                        break;
+                }
+                x[i] = static_cast<R>((1 - z) / 2);
+                w[i] = static_cast<R>(1 / ((1 - z * z) * dp * dp));
+            }
+        }
+
+        /**
+         * @brief Principal logarithm by inverse scaling and squaring in place.
+         *
+         * @details Square roots (see enda::linalg::detail::sqrtm_db) are taken until `X = A^{1/2^k}` is close to the
+         * identity. Then `log(X) = log(I + (X - I))` is approximated by the diagonal Pade approximant of `log(1 + x)`,
+         * evaluated in its partial fraction form `sum_j w_j (X - I) (I + t_j (X - I))^{-1}` with the Gauss-Legendre nodes
+         * `t_j` and weights `w_j` on [0, 1], and the result is multiplied by `2^k` (Higham, SIAM J. Matrix Anal. Appl.
+         * 22, 2001).
+         *
+         * @tparam T Value type.
+         * @param n Size of the matrix.
+         * @param a Matrix, overwritten by its logarithm.
+         * @return False if one of the square roots could not be computed.
+         */
+        template<typename T>
+        bool logm_iss(long n, strided_matrix<T> a)
+        {
+            using R = real_t<T>;
+            std::vector<T> bufs[4];
+            auto x = column_major(bufs[0], n), b = column_major(bufs[1], n), y = column_major(bufs[2], n), r = column_major(bufs[3], n);
+            copy_square(n, a, x);
+
+            int k = 0;
+            while (norm1_shifted(n, x, T {1}) > static_cast<R>(logm_pade_radius))
+            {
+                if (k == logm_max_square_roots or !sqrtm_db(n, x))
+                    return false;
+                ++k;
+            }
+            for (long i = 0; i < n; ++i)
+                x(i, i) -= T {1};
+
+            R nodes[logm_pade_degree], weights[logm_pade_degree];
+            gauss_legendre(logm_pade_degree, nodes, weights);
+            set_identity(n, r, T {0});
+            for (int q = 0; q < logm_pade_degree; ++q)
+            {
+                for (long j = 0; j < n; ++j)
+                    for (long i = 0; i < n; ++i)
+                    {
+                        b(i, j) = (i == j ? T {1} : T {0}) + nodes[q] * x(i, j);
+                        y(i, j) = x(i, j);
+                    }
+                if (!std::isfinite(solve_square(n, b, y)))
+                    return false;
+                for (long j = 0; j < n; ++j)
+                    for (long i = 0; i < n; ++i)
+                        r(i, j) += weights[q] * y(i, j);
+            }
+
+            const T scale = static_cast<T>(std::ldexp(R {1}, k));
+            for (long j = 0; j < n; ++j)
+                for (long i = 0; i < n; ++i)
+                    a(i, j) = scale * r(i, j);
+            return true;
+        }
+
+        // Overwrite a square matrix by a function of it: (skew-)Hermitian matrices via their eigendecomposition, other
+        // matrices by the general algorithms above.
+        template<analytic_function F, typename T>
+        void analytic_function_into(long n, strided_matrix<T> a)
+        {
+            if (n == 0)
+                return;
+            if (const T c = normal_kind(n, a); c != T {0})
+            {
+                funm_normal<F>(n, a, c);
+                return;
+            }
+            if constexpr (F == analytic_function::exp)
+            {
+                expm_pade(n, a);
+            }
+            else if constexpr (F == analytic_function::sqrt)
+            {
+                if (!sqrtm_db(n, a))
+                    ENDA_RUNTIME_ERROR << "Error in enda::sqrtm: Iteration did not converge (the matrix might be singular or have eigenvalues on "
+                                          "the negative real axis)";
+            }
+            else
+            {
+                if (!logm_iss(n, a))
+                    ENDA_RUNTIME_ERROR << "Error in enda::logm: Square roots could not be computed (the matrix might be singular or have "
+                                          "eigenvalues on the negative real axis)";
+            }
+        }
+
+        // Apply a matrix function to a single matrix.
+        template<analytic_function F, typename A>
+        auto analytic_function_matrix(A const& a)
+        {
+            using T      = std::remove_const_t<get_value_t<A>>;
+            const long n = a.shape()[0];
+            EXPECTS(a.shape()[1] == n);
+            auto r = matrix<T, F_layout>(a);
+            analytic_function_into<F>(n, make_strided_matrix(r));
+            return matrix<T>(r);
+        }
+
+        // Apply a matrix function to each matrix of a stack (distributed over the threads if the stack is large enough).
+        template<analytic_function F, typename A>
+        auto analytic_function_stack(A const& a)
+        {
+            using T          = std::remove_const_t<get_value_t<A>>;
+            const long batch = a.shape()[0], n = a.shape()[1];
+            EXPECTS(a.shape()[2] == n);
+            auto r  = array<T, 3>(a);
+            auto sr = make_strided_stack(r);
+            for_batch_chunks(batch, batch * n * n * n, [&](long b0, long b1) {
+                for (long q = b0; q < b1; ++q)
+                    analytic_function_into<F>(n, sr[q]);
+            });
+            return r;
+        }
+
+    } // namespace detail
+
+} // namespace enda::linalg
+
+namespace enda
+{
+    /**
+     * @brief Matrix exponential.
+     *
+     * @details Hermitian and skew-Hermitian matrices (e.g. `-i * H * dt` for a Hermitian `H`) are detected and
+     * exponentiated through their eigendecomposition (see enda::linalg::eigh), which gives (anti-)Hermitian and unitary
+     * results to working precision. Other matrices are handled by scaling and squaring with Pade approximants (see
+     * enda::linalg::detail::expm_pade). Unlike enda::exp, which is not defined for matrices, this is the exponential
+     * series `sum_k a^k / k!`.
+     *
+     * @tparam A enda::Matrix type with a floating point or complex value type.
+     * @param a Square matrix.
+     * @return enda::matrix containing `exp(a)`.
+     */
+    template<Matrix A>
+    auto expm(A const& a)
+        requires(linalg::detail::is_spectral_type_v<A>)
+    {
+        return linalg::detail::analytic_function_matrix<linalg::detail::analytic_function::exp>(a);
+    }
+
+    /**
+     * @brief Principal matrix square root.
+     *
+     * @details (Skew-)Hermitian matrices are handled through their eigendecomposition (see enda::expm), other matrices
+     * by the scaled Denman-Beavers iteration (see enda::linalg::detail::sqrtm_db). The principal square root exists if
+     * `a` has no eigenvalues on the closed negative real axis. A real matrix whose square root is not real (e.g. a
+     * symmetric matrix with negative eigenvalues) throws an exception and has to be passed as a complex matrix.
+     *
+     * @tparam A enda::Matrix type with a floating point or complex value type.
+     * @param a Square matrix.
+     * @return enda::matrix `x` with `x * x = a` whose eigenvalues have nonnegative real parts.
+     */
+    template<Matrix A>
+    auto sqrtm(A const& a)
+        requires(linalg::detail::is_spectral_type_v<A>)
+    {
+        return linalg::detail::analytic_function_matrix<linalg::detail::analytic_function::sqrt>(a);
+    }
+
+    /**
+     * @brief Principal matrix logarithm.
+     *
+     * @details (Skew-)Hermitian matrices are handled through their eigendecomposition (see enda::expm), other matrices
+     * by inverse scaling and squaring (see enda::linalg::detail::logm_iss). The principal logarithm exists if `a` has no
+     * eigenvalues on the closed negative real axis. Real matrices whose logarithm is not real throw an exception (see
+     * enda::sqrtm).
+     *
+     * @tparam A enda::Matrix type with a floating point or complex value type.
+     * @param a Square matrix.
+     * @return enda::matrix `x` with `expm(x) = a` whose eigenvalues have imaginary parts in (-pi, pi).
+     */
+    template<Matrix A>
+    auto logm(A const& a)
+        requires(linalg::detail::is_spectral_type_v<A>)
+    {
+        return linalg::detail::analytic_function_matrix<linalg::detail::analytic_function::log>(a);
+    }
+
+    /**
+     * @brief Matrix exponentials of a stack of matrices `a(k, _, _)` (see enda::expm).
+     *
+     * @details The matrices are processed independently and the stack is distributed over the threads if it is large
+     * enough.
+     *
+     * @tparam A enda::ArrayOfRank<3> type with a floating point or complex value type.
+     * @param a Stack of square matrices.
+     * @return enda::array of rank 3 containing `exp(a(k, _, _))`.
+     */
+    template<ArrayOfRank<3> A>
+    auto expm(A const& a)
+        requires(linalg::detail::is_spectral_type_v<A>)
+    {
+        return linalg::detail::analytic_function_stack<linalg::detail::analytic_function::exp>(a);
+    }
+
+    /**
+     * @brief Principal square roots of a stack of matrices `a(k, _, _)` (see enda::sqrtm and enda::expm).
+     *
+     * @tparam A enda::ArrayOfRank<3> type with a floating point or complex value type.
+     * @param a Stack of square matrices.
+     * @return enda::array of rank 3 containing the square roots of `a(k, _, _)`.
+     */
+    template<ArrayOfRank<3> A>
+    auto sqrtm(A const& a)
+        requires(linalg::detail::is_spectral_type_v<A>)
+    {
+        return linalg::detail::analytic_function_stack<linalg::detail::analytic_function::sqrt>(a);
+    }
+
+    /**
+     * @brief Principal logarithms of a stack of matrices `a(k, _, _)` (see enda::logm and enda::expm).
+     *
+     * @tparam A enda::ArrayOfRank<3> type with a floating point or complex value type.
+     * @param a Stack of square matrices.
+     * @return enda::array of rank 3 containing the logarithms of `a(k, _, _)`.
+     */
+    template<ArrayOfRank<3> A>
+    auto logm(A const& a)
+        requires(linalg::detail::is_spectral_type_v<A>)
+    {
+        return linalg::detail::analytic_function_stack<linalg::detail::analytic_function::log>(a);
+    }
+
+} // namespace enda
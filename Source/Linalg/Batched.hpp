@@ -0,0 +1,609 @@
+/**
+ * @file Batched.hpp
+ *
+ * @brief Provides matrix products, LU factorizations, inverses and determinants of stacks of matrices.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <type_traits>
+#include <vector>
+
+#include "BasicArray.hpp"
+#include "Concepts.hpp"
+#include "Declarations.hpp"
+#include "Exceptions.hpp"
+#include "Layout/Policies.hpp"
+#include "Linalg/Factorizations.hpp"
+#include "Linalg/Gemm.hpp"
+#include "Macros.hpp"
+#include "Mem/AddressSpace.hpp"
+#include "Parallel/Execution.hpp"
+#include "Traits.hpp"
+
+namespace enda::linalg
+{
+    /**
+     * @brief Layout policy for a stack of matrices `a(k, i, j)` in which the batch index `k` varies fastest in memory.
+     *
+     * @details The elements `(i, j)` of consecutive matrices are contiguous, so that the batched kernels operate on whole
+     * SIMD registers of matrices at once. It is meant for stacks of small matrices: for larger ones, the elements of a
+     * single matrix are too far apart in memory.
+     */
+    using batch_interleaved_layout = contiguous_layout_with_stride_order<encode(std::array {1, 2, 0})>;
+
+    /**
+     * @brief Layout policy for a stack of `N x M` matrices `a(k, i, j)` with static matrix extents in C order.
+     * @details The batched kernels are fully unrolled for such stacks.
+     */
+    template<int N, int M = N>
+    using static_matrix_stack_layout = basic_layout<static_extents(0, N, M), C_stride_order<3>, layout_prop_e::contiguous>;
+
+    namespace detail
+    {
+        // Number of matrices processed together by the interleaved kernels.
+        inline constexpr long batch_block_size = 64;
+
+        /**
+         * @brief Stack of matrices in host memory with arbitrary strides.
+         * @details The element `(i, j)` of the matrix `k` is `p[k * bs + i * rs + j * cs]`.
+         */
+        template<typename T>
+        struct strided_stack
+        {
+            T*   p  = nullptr;
+            long bs = 0;
+            long rs = 0;
+            long cs = 0;
+
+            // Access an element.
+            [[nodiscard]] FORCEINLINE T& operator()(long k, long i, long j) const noexcept { return p[k * bs + i * rs + j * cs]; }
+
+            // Matrix k of the stack.
+            [[nodiscard]] strided_matrix<T> operator[](long k) const noexcept { return {p + k * bs, rs, cs}; }
+
+            // Read-only operand of a product (see enda::linalg::detail::gemm_strided) for the matrix k.
+            [[nodiscard]] strided_operand<std::remove_const_t<T>> operand(long k) const noexcept { return {p + k * bs, rs, cs, false}; }
+
+            // Is the batch index the fastest one in memory (see enda::linalg::batch_interleaved_layout)?
+            [[nodiscard]] bool interleaved() const noexcept { return bs == 1; }
+
+            // Are the matrices contiguous in C order with the given number of columns?
+            [[nodiscard]] bool row_major_contiguous(long ncols) const noexcept { return cs == 1 and rs == ncols; }
+        };
+
+        // Get the strided stack of a rank 3 array/view.
+        template<typename A>
+        auto make_strided_stack(A&& a)
+        {
+            using T      = std::remove_reference_t<decltype(*a.data())>;
+            auto const s = a.indexmap().strides();
+            return strided_stack<T> {a.data(), s[0], s[1], s[2]};
+        }
+
+        // Static extents of the matrices in a stack of matrices (0 if dynamic).
+        template<typename A>
+        constexpr std::array<int, 2> static_matrix_extents = []() {
+            constexpr auto e = std::remove_cvref_t<A>::layout_t::static_extents;
+            return std::array<int, 2> {e[1], e[2]};
+        }();
+
+        // Run a kernel on chunks of a stack of matrices (in parallel if the amount of work is large enough).
+        template<typename F>
+        void for_batch_chunks(long batch, long work, F&& f)
+        { // NOLINT (we do not want to forward here)
+            if (parallel::use_parallel(work))
+                parallel::for_chunks(batch, f);
+            else
+                f(0l, batch);
+        }
+
+        // C = alpha * A * B + beta * C for the matrices [b0, b1) of interleaved stacks (vectorized across the batch). The
+        // rows of C are accumulated in a buffer so that the rows of A and B are traversed in memory order.
+        template<typename T>
+        void gemm_interleaved(long b0, long b1, long m, long n, long k, T alpha, strided_stack<T const> a, strided_stack<T const> b, T beta, strided_stack<T> c)
+        {
+            constexpr long BB  = batch_block_size;
+            auto           acc = std::vector<T>(n * BB);
+            for (long q0 = b0; q0 < b1; q0 += BB)
+            {
+                const long nq = std::min(BB, b1 - q0);
+                for (long i = 0; i < m; ++i)
+                {
+                    std::fill(acc.begin(), acc.end(), T {0});
+                    for (long p = 0; p < k; ++p)
+                    {
+                        T const* RESTRICT ap = &a(q0, i, p);
+                        for (long l = 0; l < n; ++l)
+                        {
+                            T* RESTRICT       cl = acc.data() + l * BB;
+                            T const* RESTRICT bp = &b(q0, p, l);
+                            for (long q = 0; q < nq; ++q)
+                                cl[q] += mul(ap[q], bp[q]);
+                        }
+                    }
+                    for (long l = 0; l < n; ++l)
+                    {
+                        T* RESTRICT       cp = &c(q0, i, l);
+                        T const* RESTRICT cl = acc.data() + l * BB;
+                        if (beta == T {0})
+                            for (long q = 0; q < nq; ++q)
+                                cp[q] = mul(alpha, cl[q]);
+                        else
+                            for (long q = 0; q < nq; ++q)
+                                cp[q] = mul(alpha, cl[q]) + mul(beta, cp[q]);
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief LU factorizations with partial pivoting of the matrices `[q0, q0 + nq)` (`nq <= batch_block_size`) of an
+         * interleaved stack of n x n matrices.
+         *
+         * @details The pivot search, the scaling and the rank-1 updates are vectorized across the matrices. Only the row
+         * interchanges are done matrix by matrix. The pivot of row `i` of the matrix `q0 + q` is stored in
+         * `ipiv[q * ipq + i * ipi]` and the info code (see enda::linalg::getrf) in `info[q]`.
+         */
+        template<typename T, typename I>
+        void getrf_interleaved(long q0, long nq, long n, strided_stack<T> a, I* ipiv, long ipq, long ipi, int* info)
+        {
+            constexpr long BB = batch_block_size;
+            real_t<T>      amax[BB];
+            long           piv[BB];
+            T              rcp[BB];
+            std::fill(info, info + nq, 0);
+            for (long j = 0; j < n; ++j)
+            {
+                // pivot search
+                T const* d = &a(q0, j, j);
+                for (long q = 0; q < nq; ++q)
+                {
+                    amax[q] = abs1(d[q]);
+                    piv[q]  = j;
+                }
+                for (long i = j + 1; i < n; ++i)
+                {
+                    T const* RESTRICT col = &a(q0, i, j);
+                    for (long q = 0; q < nq; ++q)
+                    {
+                        const auto v = abs1(col[q]);
+                        piv[q]       = (v > amax[q] ? i : piv[q]);
+                        amax[q]      = (v > amax[q] ? v : amax[q]);
+                    }
+                }
+
+                // row interchanges
+                for (long q = 0; q < nq; ++q)
+                {
+                    ipiv[q * ipq + j * ipi] = static_cast<I>(piv[q]);
+                    if (piv[q] != j)
+                        for (long c = 0; c < n; ++c)
+                            std::swap(a(q0 + q, j, c), a(q0 + q, piv[q], c));
+                }
+
+                // scaling of the column below the pivot
+                for (long q = 0; q < nq; ++q)
+                {
+                    rcp[q] = (d[q] == T {0} ? T {0} : T {1} / d[q]);
+                    if (d[q] == T {0} and info[q] == 0)
+                        info[q] = static_cast<int>(j + 1);
+                }
+                for (long i = j + 1; i < n; ++i)
+                {
+                    T* RESTRICT l = &a(q0, i, j);
+                    for (long q = 0; q < nq; ++q)
+                        l[q] = mul(l[q], rcp[q]);
+                }
+
+                // rank-1 update of the trailing submatrices
+                for (long i = j + 1; i < n; ++i)
+                    for (long c = j + 1; c < n; ++c)
+                    {
+                        T* RESTRICT       x = &a(q0, i, c);
+                        T const* RESTRICT l = &a(q0, i, j);
+                        T const* RESTRICT u = &a(q0, j, c);
+                        for (long q = 0; q < nq; ++q)
+                            x[q] -= mul(l[q], u[q]);
+                    }
+            }
+        }
+
+        // Invert the matrices [q0, q0 + nq) of an interleaved stack of n x n matrices in place (vectorized across the
+        // batch). Returns false if one of them is singular.
+        template<typename T>
+        bool inverse_interleaved(long q0, long nq, long n, strided_stack<T> a, std::vector<T>& xbuf, std::vector<long>& pbuf)
+        {
+            constexpr long BB = batch_block_size;
+            int            info[BB];
+            pbuf.resize(n * BB);
+            getrf_interleaved(q0, nq, n, a, pbuf.data(), 1, BB, info);
+            if (std::any_of(info, info + nq, [](int i) { return i != 0; }))
+                return false;
+
+            // X = P * I, then forward and backward substitution (X(i, c) of matrix q is xbuf[(i * n + c) * BB + q])
+            xbuf.assign(n * n * BB, T {0});
+            auto x = [&](long i, long c) { return xbuf.data() + (i * n + c) * BB; };
+            for (long q = 0; q < nq; ++q)
+            {
+                for (long i = 0; i < n; ++i)
+                    x(i, i)[q] = T {1};
+                for (long i = 0; i < n; ++i)
+                    if (const long p = pbuf[i * BB + q]; p != i)
+                        for (long c = 0; c < n; ++c)
+                            std::swap(x(i, c)[q], x(p, c)[q]);
+            }
+            for (long i = 0; i < n; ++i)
+                for (long r = i + 1; r < n; ++r)
+                {
+                    T const* RESTRICT l = &a(q0, r, i);
+                    for (long c = 0; c < n; ++c)
+                    {
+                        T* RESTRICT       xr = x(r, c);
+                        T const* RESTRICT xi = x(i, c);
+                        for (long q = 0; q < nq; ++q)
+                            xr[q] -= mul(l[q], xi[q]);
+                    }
+                }
+            T rcp[BB];
+            for (long i = n - 1; i >= 0; --i)
+            {
+                T const* d = &a(q0, i, i);
+                for (long q = 0; q < nq; ++q)
+                    rcp[q] = T {1} / d[q];
+                for (long c = 0; c < n; ++c)
+                {
+                    T* RESTRICT xi = x(i, c);
+                    for (long q = 0; q < nq; ++q)
+                        xi[q] = mul(xi[q], rcp[q]);
+                }
+                for (long r = 0; r < i; ++r)
+                {
+                    T const* RESTRICT u = &a(q0, r, i);
+                    for (long c = 0; c < n; ++c)
+                    {
+                        T* RESTRICT       xr = x(r, c);
+                        T const* RESTRICT xi = x(i, c);
+                        for (long q = 0; q < nq; ++q)
+                            xr[q] -= mul(u[q], xi[q]);
+                    }
+                }
+            }
+            for (long i = 0; i < n; ++i)
+                for (long c = 0; c < n; ++c)
+                {
+                    T* RESTRICT       y  = &a(q0, i, c);
+                    T const* RESTRICT xi = x(i, c);
+                    for (long q = 0; q < nq; ++q)
+                        y[q] = xi[q];
+                }
+            return true;
+        }
+
+        // Layout policy of the result of a batched product.
+        template<typename A, typename B>
+        constexpr auto batched_result_layout()
+        {
+            using A_t = std::remove_cvref_t<A>;
+            using B_t = std::remove_cvref_t<B>;
+            if constexpr (MemoryArray<A_t> and MemoryArray<B_t>)
+            {
+                constexpr auto ea = static_matrix_extents<A_t>, eb = static_matrix_extents<B_t>;
+                if constexpr (A_t::layout_t::stride_order == std::array {1, 2, 0})
+                    return batch_interleaved_layout {};
+                else if constexpr (ea[0] != 0 and eb[1] != 0)
+                    return static_matrix_stack_layout<ea[0], eb[1]> {};
+                else
+                    return C_layout {};
+            }
+            else
+            {
+                return C_layout {};
+            }
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Batched matrix-matrix product `c(k, _, _) = alpha * a(k, _, _) * b(k, _, _) + beta * c(k, _, _)`.
+     *
+     * @details The matrices are processed directly through the strides of the stacks and the stack is distributed over the
+     * threads if it is large enough. Depending on the layouts, one of the following kernels is used:
+     * - stacks with the batch index varying fastest (see enda::linalg::batch_interleaved_layout): a kernel vectorized
+     *   across the matrices (for small matrices),
+     * - stacks with static matrix extents in C order (see enda::linalg::static_matrix_stack_layout): a fully unrolled
+     *   kernel,
+     * - otherwise: the unblocked kernel for small matrices or enda::linalg::gemm for larger ones.
+     *
+     * @tparam A enda::MemoryArrayOfRank<3> type.
+     * @tparam B enda::MemoryArrayOfRank<3> type.
+     * @tparam C enda::MemoryArrayOfRank<3> type.
+     * @param alpha Scalar factor of the products.
+     * @param a Stack of left operands.
+     * @param b Stack of right operands.
+     * @param beta Scalar factor of `c`.
+     * @param c Stack of results.
+     */
+    template<MemoryArrayOfRank<3> A, MemoryArrayOfRank<3> B, MemoryArrayOfRank<3> C>
+    void gemm(get_value_t<C> alpha, A const& a, B const& b, get_value_t<C> beta, C&& c)
+        requires(mem::on_host<A, B, C> and have_same_value_type_v<A, B, C>)
+    {
+        using T          = get_value_t<C>;
+        const long batch = c.shape()[0], m = c.shape()[1], n = c.shape()[2], k = a.shape()[2];
+        EXPECTS(a.shape()[0] == batch and b.shape()[0] == batch and a.shape()[1] == m and b.shape()[1] == k and b.shape()[2] == n);
+        auto const sa   = detail::make_strided_stack(a);
+        auto const sb   = detail::make_strided_stack(b);
+        auto const sc   = detail::make_strided_stack(c);
+        const long work = batch * m * n * k;
+
+        if (batch > 1 and m * n * k <= detail::small_gemm_size and sa.interleaved() and sb.interleaved() and sc.interleaved())
+        {
+            detail::for_batch_chunks(batch, work, [&](long b0, long b1) { detail::gemm_interleaved<T>(b0, b1, m, n, k, alpha, sa, sb, beta, sc); });
+            return;
+        }
+
+        constexpr auto ea = detail::static_matrix_extents<A>, eb = detail::static_matrix_extents<B>;
+        if constexpr (ea[0] != 0 and ea[1] != 0 and eb[1] != 0)
+        {
+            constexpr long M = ea[0], K = ea[1], N = eb[1];
+            if (sa.row_major_contiguous(K) and sb.row_major_contiguous(N) and sc.row_major_contiguous(N))
+            {
+                detail::for_batch_chunks(batch, work, [&](long b0, long b1) {
+                    for (long q = b0; q < b1; ++q)
+                        detail::gemm_fixed<M, N, K>(alpha, sa.p + q * sa.bs, sb.p + q * sb.bs, beta, sc.p + q * sc.bs);
+                });
+                return;
+            }
+        }
+
+        detail::for_batch_chunks(batch, work, [&](long b0, long b1) {
+            for (long q = b0; q < b1; ++q)
+            {
+                auto cq = sc[q];
+                if (m * n * k <= detail::small_gemm_size)
+                    detail::gemm_small(m, n, k, alpha, sa.operand(q), sb.operand(q), beta, cq.p, cq.rs, cq.cs);
+                else
+                    detail::gemm_strided(m, n, k, alpha, sa.operand(q), sb.operand(q), beta, cq.p, cq.rs, cq.cs);
+            }
+        });
+    }
+
+    /**
+     * @brief Batched matrix-matrix product of two stacks of matrices.
+     *
+     * @details Operands which are not arrays/views in host memory or whose value type differs from the one of the
+     * result are first evaluated into temporaries. The result is interleaved if `a` is (see
+     * enda::linalg::batch_interleaved_layout) and has static matrix extents if both operands have them.
+     *
+     * @tparam A enda::ArrayOfRank<3> type.
+     * @tparam B enda::ArrayOfRank<3> type.
+     * @param a Stack of left operands `a(k, _, _)`.
+     * @param b Stack of right operands `b(k, _, _)`.
+     * @return enda::array of rank 3 containing the products.
+     */
+    template<ArrayOfRank<3> A, ArrayOfRank<3> B>
+    auto matmul(A const& a, B const& b)
+    {
+        using T = decltype(std::declval<get_value_t<A>>() * std::declval<get_value_t<B>>());
+        if constexpr (!MemoryArray<A> or !mem::on_host<A> or !std::is_same_v<get_value_t<A>, T>)
+        {
+            return matmul(array<T, 3>(a), b);
+        }
+        else if constexpr (!MemoryArray<B> or !mem::on_host<B> or !std::is_same_v<get_value_t<B>, T>)
+        {
+            return matmul(a, array<T, 3>(b));
+        }
+        else
+        {
+            EXPECTS(a.shape()[0] == b.shape()[0] and a.shape()[2] == b.shape()[1]);
+            using layout_t = decltype(detail::batched_result_layout<A, B>());
+            auto c         = array<T, 3, layout_t>(a.shape()[0], a.shape()[1], b.shape()[2]);
+            gemm(T {1}, a, b, T {0}, c);
+            return c;
+        }
+    }
+
+    /**
+     * @brief LU factorizations of a stack of matrices in place.
+     *
+     * @details Each matrix `a(k, _, _)` is factorized as in enda::linalg::getrf with the pivot indices `ipiv(k, _)`.
+     * The matrices are processed directly through their strides (no view is created per matrix) and the stack is
+     * distributed over the threads if it is large enough. Square matrices of interleaved stacks (see
+     * enda::linalg::batch_interleaved_layout) are factorized by a kernel vectorized across the batch and stacks with
+     * static matrix extents (see enda::linalg::static_matrix_stack_layout) by a fully unrolled kernel.
+     *
+     * @tparam A enda::MemoryArrayOfRank<3> type.
+     * @tparam IPIV enda::MemoryArrayOfRank<2> type with integral values.
+     * @param a Stack of matrices.
+     * @param ipiv Pivot indices.
+     * @return enda::vector with the info code (see enda::linalg::getrf) of each matrix.
+     */
+    template<MemoryArrayOfRank<3> A, MemoryArrayOfRank<2> IPIV>
+    auto getrf(A&& a, IPIV&& ipiv)
+        requires(detail::is_factorizable_v<A> and std::integral<get_value_t<IPIV>>)
+    {
+        const long batch = a.shape()[0], m = a.shape()[1], n = a.shape()[2];
+        EXPECTS(ipiv.shape()[0] == batch and ipiv.shape()[1] == std::min(m, n));
+        auto const sa   = detail::make_strided_stack(a);
+        auto const si   = ipiv.indexmap().strides();
+        auto       info = vector<int>(batch);
+        const long work = a.size() * std::min(m, n);
+
+        if (batch > 1 and m == n and sa.interleaved())
+        {
+            detail::for_batch_chunks(batch, work, [&](long b0, long b1) {
+                for (long q0 = b0; q0 < b1; q0 += detail::batch_block_size)
+                {
+                    const long nq = std::min(detail::batch_block_size, b1 - q0);
+                    detail::getrf_interleaved(q0, nq, n, sa, ipiv.data() + q0 * si[0], si[0], si[1], &info(q0));
+                }
+            });
+            return info;
+        }
+
+        constexpr auto e = detail::static_matrix_extents<A>;
+        if constexpr (e[0] != 0 and e[0] == e[1])
+        {
+            constexpr long N = e[0];
+            if (sa.row_major_contiguous(N) and si[1] == 1)
+            {
+                detail::for_batch_chunks(batch, work, [&](long b0, long b1) {
+                    for (long q = b0; q < b1; ++q)
+                        info(q) = detail::getrf_fixed<N>(sa.p + q * sa.bs, ipiv.data() + q * si[0]);
+                });
+                return info;
+            }
+        }
+
+        EXPECTS(si[1] == 1);
+        detail::for_batch_chunks(batch, work, [&](long b0, long b1) {
+            for (long q = b0; q < b1; ++q)
+                info(q) = detail::getrf(m, n, sa[q], ipiv.data() + q * si[0]);
+        });
+        return info;
+    }
+
+} // namespace enda::linalg
+
+namespace enda
+{
+    /**
+     * @brief Compute the determinants of a stack of square matrices `m(k, _, _)`.
+     *
+     * @tparam A enda::ArrayOfRank<3> type.
+     * @param m Stack of square matrices.
+     * @return enda::vector containing the determinants.
+     */
+    template<ArrayOfRank<3> A>
+    auto determinant(A const& m)
+    {
+        using T          = get_value_t<A>;
+        auto       a     = array<T, 3>(m);
+        const long batch = a.shape()[0], n = a.shape()[1];
+        EXPECTS(a.shape()[2] == n);
+        auto ipiv = array<long, 2>(batch, n);
+        auto r    = vector<T>(batch);
+        linalg::getrf(a, ipiv);
+        for (long k = 0; k < batch; ++k)
+            r(k) = linalg::detail::lu_determinant(n, linalg::detail::strided_matrix<T> {&a(k, 0, 0), n, 1}, &ipiv(k, 0));
+        return r;
+    }
+
+    /**
+     * @brief Invert a stack of square matrices `m(k, _, _)` in place.
+     *
+     * @details The matrices are processed directly through their strides and the stack is distributed over the threads
+     * if it is large enough. The kernel is chosen from the layout of the stack as in enda::linalg::getrf.
+     *
+     * @tparam A enda::MemoryArrayOfRank<3> type.
+     * @param m Stack of square matrices, overwritten by their inverses.
+     */
+    template<MemoryArrayOfRank<3> A>
+    void inverse_in_place(A&& m)
+        requires(linalg::detail::is_factorizable_v<A>)
+    {
+        using T          = get_value_t<A>;
+        const long batch = m.shape()[0], n = m.shape()[1];
+        EXPECTS(m.shape()[2] == n);
+        auto const        sa       = linalg::detail::make_strided_stack(m);
+        const long        work     = m.size() * n;
+        std::atomic<bool> singular = false;
+
+        constexpr auto e = linalg::detail::static_matrix_extents<A>;
+        if (batch > 1 and sa.interleaved())
+        {
+            linalg::detail::for_batch_chunks(batch, work, [&](long b0, long b1) {
+                std::vector<T>    x;
+                std::vector<long> p;
+                for (long q0 = b0; q0 < b1; q0 += linalg::detail::batch_block_size)
+                    if (!linalg::detail::inverse_interleaved(q0, std::min(linalg::detail::batch_block_size, b1 - q0), n, sa, x, p))
+                        singular = true;
+            });
+        }
+        else if (e[0] != 0 and e[0] == e[1] and sa.row_major_contiguous(e[0]))
+        {
+            if constexpr (e[0] != 0 and e[0] == e[1])
+            {
+                constexpr long N = e[0];
+                linalg::detail::for_batch_chunks(batch, work, [&](long b0, long b1) {
+                    for (long q = b0; q < b1; ++q)
+                    {
+                        T    lu[N * N];
+                        long ipiv[N];
+                        std::copy(sa.p + q * sa.bs, sa.p + q * sa.bs + N * N, lu);
+                        if (linalg::detail::getrf_fixed<N>(lu, ipiv) != 0)
+                        {
+                            singular = true;
+                            continue;
+                        }
+                        linalg::detail::lu_inverse_fixed<N>(lu, ipiv, sa.p + q * sa.bs);
+                    }
+                });
+            }
+        }
+        else
+        {
+            linalg::detail::for_batch_chunks(batch, work, [&](long b0, long b1) {
+                std::vector<T>    x(n * n);
+                std::vector<long> ipiv(n);
+                for (long q = b0; q < b1; ++q)
+                {
+                    auto lu = sa[q];
+                    if (linalg::detail::getrf(n, n, lu, ipiv.data()) != 0)
+                    {
+                        singular = true;
+                        continue;
+                    }
+                    std::fill(x.begin(), x.end(), T {0});
+                    linalg::detail::strided_matrix<T> xm {x.data(), n, 1};
+                    for (long i = 0; i < n; ++i)
+                        xm(i, i) = T {1};
+                    linalg::detail::getrs(n, n, lu, ipiv.data(), xm);
+                    for (long i = 0; i < n; ++i)
+                        for (long j = 0; j < n; ++j)
+                            lu(i, j) = xm(i, j);
+                }
+            });
+        }
+        if (singular)
+            ENDA_RUNTIME_ERROR << "Error in enda::inverse_in_place: Matrix is singular";
+    }
+
+    /**
+     * @brief Compute the inverses of a stack of square matrices `m(k, _, _)`.
+     *
+     * @details The result has the same layout policy as `m` if it is an array and the same stride order if it is a view
+     * (see enda::inverse_in_place).
+     *
+     * @tparam A enda::ArrayOfRank<3> type.
+     * @param m Stack of square matrices.
+     * @return enda::array of rank 3 containing the inverses.
+     */
+    template<ArrayOfRank<3> A>
+    auto inverse(A const& m)
+    {
+        using T = get_value_t<A>;
+        if constexpr (is_regular_v<A>)
+        {
+            auto a = array<T, 3, typename std::remove_cvref_t<A>::layout_policy_t>(m);
+            inverse_in_place(a);
+            return a;
+        }
+        else if constexpr (MemoryArray<A>)
+        {
+            auto a = array<T, 3, get_contiguous_layout_policy<3, std::remove_cvref_t<A>::layout_t::stride_order_encoded>>(m);
+            inverse_in_place(a);
+            return a;
+        }
+        else
+        {
+            auto a = array<T, 3>(m);
+            inverse_in_place(a);
+            return a;
+        }
+    }
+
+} // namespace enda
@@ -0,0 +1,926 @@
+/**
+ * @file Factorizations.hpp
+ *
+ * @brief Provides blocked LU, Cholesky and QR factorizations, linear solvers, matrix inverses and determinants.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <concepts>
+#include <cstdlib>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "BasicArray.hpp"
+#include "Concepts.hpp"
+#include "Declarations.hpp"
+#include "Exceptions.hpp"
+#include "Linalg/Gemm.hpp"
+#include "Macros.hpp"
+#include "Mem/AddressSpace.hpp"
+#include "Parallel/Execution.hpp"
+#include "Traits.hpp"
+
+namespace enda::linalg
+{
+    namespace detail
+    {
+        // Block size of the blocked factorizations (number of columns of a panel).
+        inline constexpr long lapack_block_size = 64;
+
+        /**
+         * @brief Mutable matrix in host memory with arbitrary strides.
+         * @details The element `(i, j)` is `p[i * rs + j * cs]`.
+         */
+        template<typename T>
+        struct strided_matrix
+        {
+            T*   p  = nullptr;
+            long rs = 0;
+            long cs = 0;
+
+            // Access an element.
+            [[nodiscard]] FORCEINLINE T& operator()(long i, long j) const noexcept { return p[i * rs + j * cs]; }
+
+            // Submatrix starting at the element (i, j).
+            [[nodiscard]] strided_matrix block(long i, long j) const noexcept { return {p + i * rs + j * cs, rs, cs}; }
+
+            // Read-only operand of a product (see enda::linalg::detail::gemm_strided).
+            [[nodiscard]] strided_operand<T> operand(bool conj = false) const noexcept { return {p, rs, cs, conj}; }
+
+            // Are the elements of a row closer in memory than the elements of a column?
+            [[nodiscard]] bool row_major() const noexcept { return std::abs(cs) <= std::abs(rs); }
+        };
+
+        // Get the strided matrix of a matrix/view (or of a vector, seen as a matrix with a single column).
+        template<typename A>
+        auto make_strided_matrix(A&& a)
+        {
+            using T      = std::remove_reference_t<decltype(*a.data())>;
+            auto const s = a.indexmap().strides();
+            if constexpr (get_rank<A> == 1)
+                return strided_matrix<T> {a.data(), s[0], 0};
+            else
+                return strided_matrix<T> {a.data(), s[0], s[1]};
+        }
+
+        // Cheap absolute value used for pivoting (|Re(x)| + |Im(x)| for complex numbers).
+        template<typename T>
+        FORCEINLINE real_t<T> abs1(T const& x)
+        {
+            if constexpr (is_complex_v<T>)
+                return std::abs(x.real()) + std::abs(x.imag());
+            else
+                return std::abs(x);
+        }
+
+        // Swap the rows k and ipiv[k] of the columns [c0, c1) for k in [k0, k1).
+        template<typename T, typename I>
+        void swap_rows(strided_matrix<T> a, long k0, long k1, I const* ipiv, long c0, long c1)
+        {
+            for (long k = k0; k < k1; ++k)
+            {
+                const long p = ipiv[k];
+                if (p != k)
+                    for (long j = c0; j < c1; ++j)
+                        std::swap(a(k, j), a(p, j));
+            }
+        }
+
+        // Rank-1 update of an m x n matrix: A = A - x * y^T (the loop order follows the memory layout of A).
+        template<typename T>
+        void rank1_update(long m, long n, strided_matrix<T> a, T const* x, long incx, T const* y, long incy)
+        {
+            if (a.row_major())
+            {
+                for (long i = 0; i < m; ++i)
+                {
+                    const T xi  = x[i * incx];
+                    T*      row = a.p + i * a.rs;
+                    for (long k = 0; k < n; ++k)
+                        row[k * a.cs] -= mul(xi, y[k * incy]);
+                }
+            }
+            else
+            {
+                for (long k = 0; k < n; ++k)
+                {
+                    const T yk  = y[k * incy];
+                    T*      col = a.p + k * a.cs;
+                    for (long i = 0; i < m; ++i)
+                        col[i * a.rs] -= mul(x[i * incx], yk);
+                }
+            }
+        }
+
+        /**
+         * @brief Unblocked LU factorization with partial pivoting of an m x n matrix: `A = P * L * U`.
+         *
+         * @details The pivot indices are 0-based and relative to the first row of the matrix.
+         *
+         * @return 0 on success or `j + 1` if `U(j, j)` is the first exactly zero pivot.
+         */
+        template<typename T, typename I>
+        int getf2(long m, long n, strided_matrix<T> a, I* ipiv)
+        {
+            int info = 0;
+            for (long j = 0; j < std::min(m, n); ++j)
+            {
+                // find the pivot
+                long      p    = j;
+                real_t<T> amax = abs1(a(j, j));
+                for (long i = j + 1; i < m; ++i)
+                {
+                    const auto v = abs1(a(i, j));
+                    if (v > amax)
+                    {
+                        amax = v;
+                        p    = i;
+                    }
+                }
+                ipiv[j] = static_cast<I>(p);
+
+                if (a(p, j) != T {0})
+                {
+                    if (p != j)
+                        for (long k = 0; k < n; ++k)
+                            std::swap(a(j, k), a(p, k));
+                    const T r = T {1} / a(j, j);
+                    for (long i = j + 1; i < m; ++i)
+                        a(i, j) = mul(a(i, j), r);
+                }
+                else if (info == 0)
+                {
+                    info = static_cast<int>(j + 1);
+                }
+
+                // update the trailing submatrix
+                if (j + 1 < m and j + 1 < n)
+                    rank1_update(m - j - 1, n - j - 1, a.block(j + 1, j + 1), &a(j + 1, j), a.rs, &a(j, j + 1), a.cs);
+            }
+            return info;
+        }
+
+        // Unblocked triangular solve with m x m triangular L/U and m x n right hand side B: B = op(L)^{-1} * B.
+        template<bool Lower, bool Unit, typename T>
+        void trsm_left_unblocked(long m, long n, strided_matrix<T> l, strided_matrix<T> b)
+        {
+            auto solve_cols = [&](long c0, long c1) {
+                if (b.row_major())
+                {
+                    // row operations
+                    auto row_op = [&](long i, long r) {
+                        const T f = l(r, i);
+                        for (long c = c0; c < c1; ++c)
+                            b(r, c) -= mul(f, b(i, c));
+                    };
+                    auto scale_row = [&](long i) {
+                        const T d = T {1} / l(i, i);
+                        for (long c = c0; c < c1; ++c)
+                            b(i, c) = mul(b(i, c), d);
+                    };
+                    if constexpr (Lower)
+                    {
+                        for (long i = 0; i < m; ++i)
+                        {
+                            if constexpr (!Unit)
+                                scale_row(i);
+                            for (long r = i + 1; r < m; ++r)
+                                row_op(i, r);
+                        }
+                    }
+                    else
+                    {
+                        for (long i = m - 1; i >= 0; --i)
+                        {
+                            if constexpr (!Unit)
+                                scale_row(i);
+                            for (long r = 0; r < i; ++r)
+                                row_op(i, r);
+                        }
+                    }
+                }
+                else
+                {
+                    // substitution column by column
+                    for (long c = c0; c < c1; ++c)
+                    {
+                        T* x = &b(0, c);
+                        if constexpr (Lower)
+                        {
+                            for (long i = 0; i < m; ++i)
+                            {
+                                if constexpr (!Unit)
+                                    x[i * b.rs] = mul(x[i * b.rs], T {1} / l(i, i));
+                                const T xi = x[i * b.rs];
+                                for (long r = i + 1; r < m; ++r)
+                                    x[r * b.rs] -= mul(l(r, i), xi);
+                            }
+                        }
+                        else
+                        {
+                            for (long i = m - 1; i >= 0; --i)
+                            {
+                                if constexpr (!Unit)
+                                    x[i * b.rs] = mul(x[i * b.rs], T {1} / l(i, i));
+                                const T xi = x[i * b.rs];
+                                for (long r = 0; r < i; ++r)
+                                    x[r * b.rs] -= mul(l(r, i), xi);
+                            }
+                        }
+                    }
+                }
+            };
+            if (parallel::use_parallel(m * m * n))
+                parallel::for_chunks(n, solve_cols, 16);
+            else
+                solve_cols(0, n);
+        }
+
+        // Blocked triangular solve with m x m triangular L/U and m x n right hand side B: B = op(L)^{-1} * B.
+        template<bool Lower, bool Unit, typename T>
+        void trsm_left(long m, long n, strided_matrix<T> l, strided_matrix<T> b)
+        {
+            constexpr long NB = lapack_block_size;
+            if (m <= NB)
+            {
+                trsm_left_unblocked<Lower, Unit>(m, n, l, b);
+                return;
+            }
+            if constexpr (Lower)
+            {
+                for (long i0 = 0; i0 < m; i0 += NB)
+                {
+                    const long ib = std::min(NB, m - i0);
+                    trsm_left_unblocked<Lower, Unit>(ib, n, l.block(i0, i0), b.block(i0, 0));
+                    if (i0 + ib < m)
+                    {
+                        auto c = b.block(i0 + ib, 0);
+                        gemm_strided<T>(m - i0 - ib, n, ib, T {-1}, l.block(i0 + ib, i0).operand(), b.block(i0, 0).operand(), T {1}, c.p, c.rs, c.cs);
+                    }
+                }
+            }
+            else
+            {
+                for (long i1 = m; i1 > 0; i1 -= NB)
+                {
+                    const long i0 = std::max(0l, i1 - NB);
+                    trsm_left_unblocked<Lower, Unit>(i1 - i0, n, l.block(i0, i0), b.block(i0, 0));
+                    if (i0 > 0)
+                        gemm_strided<T>(i0, n, i1 - i0, T {-1}, l.block(0, i0).operand(), b.block(i0, 0).operand(), T {1}, b.p, b.rs, b.cs);
+                }
+            }
+        }
+
+        /**
+         * @brief Blocked right-looking LU factorization with partial pivoting of an m x n matrix: `A = P * L * U`.
+         *
+         * @details Each panel of enda::linalg::detail::lapack_block_size columns is factorized by
+         * enda::linalg::detail::getf2. The row interchanges are then applied to the rest of the matrix, the block row of
+         * U is computed by a triangular solve and the trailing submatrix is updated by a GEMM.
+         *
+         * @return 0 on success or `j + 1` if `U(j, j)` is the first exactly zero pivot.
+         */
+        template<typename T, typename I>
+        int getrf(long m, long n, strided_matrix<T> a, I* ipiv)
+        {
+            constexpr long NB = lapack_block_size;
+            const long     mn = std::min(m, n);
+            if (mn <= NB)
+                return getf2(m, n, a, ipiv);
+
+            int info = 0;
+            for (long j0 = 0; j0 < mn; j0 += NB)
+            {
+                const long jb    = std::min(NB, mn - j0);
+                const int  iinfo = getf2(m - j0, jb, a.block(j0, j0), ipiv + j0);
+                if (info == 0 and iinfo > 0)
+                    info = static_cast<int>(iinfo + j0);
+                for (long i = j0; i < j0 + jb; ++i)
+                    ipiv[i] += static_cast<I>(j0);
+
+                // apply the interchanges to the columns on the left and on the right of the panel
+                swap_rows(a, j0, j0 + jb, ipiv, 0, j0);
+                swap_rows(a, j0, j0 + jb, ipiv, j0 + jb, n);
+
+                if (j0 + jb < n)
+                {
+                    // block row of U and trailing update
+                    trsm_left<true, true>(jb, n - j0 - jb, a.block(j0, j0), a.block(j0, j0 + jb));
+                    if (j0 + jb < m)
+                    {
+                        auto c = a.block(j0 + jb, j0 + jb);
+                        gemm_strided<T>(m - j0 - jb, n - j0 - jb, jb, T {-1}, a.block(j0 + jb, j0).operand(), a.block(j0, j0 + jb).operand(), T {1}, c.p, c.rs, c.cs);
+                    }
+                }
+            }
+            return info;
+        }
+
+        // Solve A * X = B with the LU factorization of the n x n matrix A (B has nrhs columns).
+        template<typename T, typename I>
+        void getrs(long n, long nrhs, strided_matrix<T> lu, I const* ipiv, strided_matrix<T> b)
+        {
+            swap_rows(b, 0, n, ipiv, 0, nrhs);
+            trsm_left<true, true>(n, nrhs, lu, b);
+            trsm_left<false, false>(n, nrhs, lu, b);
+        }
+
+        // Unblocked Cholesky factorization of the lower triangle of an n x n Hermitian matrix: A = L * L^H.
+        template<typename T>
+        int potf2(long n, strided_matrix<T> a)
+        {
+            for (long j = 0; j < n; ++j)
+            {
+                real_t<T> d = std::real(a(j, j));
+                for (long k = 0; k < j; ++k)
+                    d -= std::norm(a(j, k));
+                if (!(d > 0))
+                    return static_cast<int>(j + 1);
+                const real_t<T> ajj = std::sqrt(d);
+                a(j, j)             = ajj;
+                for (long i = j + 1; i < n; ++i)
+                {
+                    T s = a(i, j);
+                    for (long k = 0; k < j; ++k)
+                        s -= mul(a(i, k), conj_if(a(j, k), true));
+                    a(i, j) = s / ajj;
+                }
+            }
+            return 0;
+        }
+
+        /**
+         * @brief Blocked right-looking Cholesky factorization of the lower triangle of an n x n Hermitian matrix:
+         * `A = L * L^H`.
+         *
+         * @details The diagonal blocks are factorized by enda::linalg::detail::potf2, the blocks below them are computed
+         * by a triangular solve and the trailing lower triangle is updated by GEMMs on its block columns. The strictly
+         * upper triangle is not referenced, but may be modified in the diagonal blocks.
+         *
+         * @return 0 on success or `j + 1` if the leading minor of order `j + 1` is not positive definite.
+         */
+        template<typename T>
+        int potrf(long n, strided_matrix<T> a)
+        {
+            constexpr long NB = lapack_block_size;
+            for (long j0 = 0; j0 < n; j0 += NB)
+            {
+                const long jb = std::min(NB, n - j0);
+                if (const int info = potf2(jb, a.block(j0, j0)); info > 0)
+                    return static_cast<int>(info + j0);
+                const long m2 = n - j0 - jb;
+                if (m2 == 0)
+                    break;
+
+                // A21 = A21 * L11^{-H}
+                auto l11 = a.block(j0, j0);
+                auto a21 = a.block(j0 + jb, j0);
+                auto solve_rows = [&](long r0, long r1) {
+                    for (long i = r0; i < r1; ++i)
+                        for (long j = 0; j < jb; ++j)
+                        {
+                            T s = a21(i, j);
+                            for (long k = 0; k < j; ++k)
+                                s -= mul(a21(i, k), conj_if(l11(j, k), true));
+                            a21(i, j) = s / std::real(l11(j, j));
+                        }
+                };
+                if (parallel::use_parallel(m2 * jb * jb))
+                    parallel::for_chunks(m2, solve_rows, 16);
+                else
+                    solve_rows(0, m2);
+
+                // A22 = A22 - A21 * A21^H (lower block triangle only)
+                for (long jj = 0; jj < m2; jj += NB)
+                {
+                    const long nb = std::min(NB, m2 - jj);
+                    auto       c  = a.block(j0 + jb + jj, j0 + jb + jj);
+                    gemm_strided<T>(m2 - jj, nb, jb, T {-1}, a21.block(jj, 0).operand(), a21.block(jj, 0).operand(true).transposed(), T {1}, c.p, c.rs, c.cs);
+                }
+            }
+            return 0;
+        }
+
+        // Generate an elementary reflector H = I - tau * v * v^H with H^H * (alpha, x) = (beta, 0) (x is overwritten by v).
+        template<typename T>
+        T larfg(long n, T& alpha, T* x, long incx)
+        {
+            using R  = real_t<T>;
+            R xnorm2 = 0;
+            for (long i = 0; i < n; ++i)
+                xnorm2 += std::norm(x[i * incx]);
+            const R ar = std::real(alpha), ai = std::imag(alpha);
+            if (xnorm2 == 0 and ai == 0)
+                return T {0};
+            const R beta = -std::copysign(std::sqrt(ar * ar + ai * ai + xnorm2), ar);
+            T       tau;
+            if constexpr (is_complex_v<T>)
+                tau = T((beta - ar) / beta, -ai / beta);
+            else
+                tau = (beta - ar) / beta;
+            const T scal = T {1} / (alpha - beta);
+            for (long i = 0; i < n; ++i)
+                x[i * incx] = mul(x[i * incx], scal);
+            alpha = beta;
+            return tau;
+        }
+
+        // Apply H = I - tau * v * v^H (v(0) = 1 implied) from the left to an m x n matrix C.
+        template<typename T>
+        void apply_reflector(long m, long n, T tau, T const* v, long incv, strided_matrix<T> c)
+        {
+            if (tau == T {0})
+                return;
+            for (long k = 0; k < n; ++k)
+            {
+                T w = c(0, k);
+                for (long i = 1; i < m; ++i)
+                    w += mul(conj_if(v[i * incv], true), c(i, k));
+                w = mul(tau, w);
+                c(0, k) -= w;
+                for (long i = 1; i < m; ++i)
+                    c(i, k) -= mul(v[i * incv], w);
+            }
+        }
+
+        // Unblocked Householder QR factorization of an m x n matrix.
+        template<typename T>
+        void geqr2(long m, long n, strided_matrix<T> a, T* tau)
+        {
+            for (long j = 0; j < std::min(m, n); ++j)
+            {
+                tau[j] = larfg(m - j - 1, a(j, j), (j + 1 < m ? &a(j + 1, j) : nullptr), a.rs);
+                if (j + 1 < n)
+                {
+                    // apply H^H from the left to the trailing columns
+                    const T ajj = a(j, j);
+                    a(j, j)     = T {1};
+                    apply_reflector(m - j, n - j - 1, conj_if(tau[j], true), &a(j, j), a.rs, a.block(j, j + 1));
+                    a(j, j) = ajj;
+                }
+            }
+        }
+
+        // Upper triangular factor T of the compact WY form H_1 ... H_k = I - V * T * V^H of k reflectors stored in the
+        // unit lower trapezoidal m x k matrix V (w is a workspace of size k).
+        template<typename T>
+        void larft(long m, long k, strided_matrix<T> v, T const* tau, strided_matrix<T> t, T* w)
+        {
+            for (long i = 0; i < k; ++i)
+            {
+                // T(0:i, i) = -tau_i * T(0:i, 0:i) * V(:, 0:i)^H * v_i
+                const T ti = tau[i];
+                t(i, i)    = ti;
+                for (long r = 0; r < i; ++r)
+                {
+                    T s {0};
+                    for (long q = i; q < m; ++q)
+                        s += mul(conj_if(v(q, r), true), v(q, i));
+                    w[r] = mul(-ti, s);
+                }
+                for (long r = 0; r < i; ++r)
+                {
+                    T s {0};
+                    for (long q = r; q < i; ++q)
+                        s += mul(t(r, q), w[q]);
+                    t(r, i) = s;
+                }
+            }
+        }
+
+        // Apply H_1 ... H_k = I - V * T * V^H (or its adjoint) from the left to an m x n matrix C with three GEMMs (work
+        // is a workspace of size 2 * k * n).
+        template<typename T>
+        void larfb(long m, long n, long k, strided_matrix<T> v, strided_matrix<T> t, bool adjoint, strided_matrix<T> c, T* work)
+        {
+            strided_matrix<T> w {work, 1, k};
+            strided_matrix<T> w2 {work + k * n, 1, k};
+            auto const        opt = (adjoint ? t.operand(true).transposed() : t.operand());
+            gemm_strided<T>(k, n, m, T {1}, v.operand(true).transposed(), c.operand(), T {0}, w.p, w.rs, w.cs);
+            gemm_strided<T>(k, n, k, T {1}, opt, w.operand(), T {0}, w2.p, w2.rs, w2.cs);
+            gemm_strided<T>(m, n, k, T {-1}, v.operand(), w2.operand(), T {1}, c.p, c.rs, c.cs);
+        }
+
+        /**
+         * @brief Blocked Householder QR factorization of an m x n matrix: `A = Q * R`.
+         *
+         * @details Each panel is factorized by enda::linalg::detail::geqr2. Its reflectors are accumulated in the compact
+         * WY form `H_1 ... H_k = I - V * T * V^H` and applied to the trailing columns with three GEMMs.
+         */
+        template<typename T>
+        void geqrf(long m, long n, strided_matrix<T> a, T* tau)
+        {
+            constexpr long NB = lapack_block_size;
+            const long     mn = std::min(m, n);
+            if (mn <= NB)
+            {
+                geqr2(m, n, a, tau);
+                return;
+            }
+
+            std::vector<T> work;
+            for (long j0 = 0; j0 < mn; j0 += NB)
+            {
+                const long jb = std::min(NB, mn - j0);
+                const long mv = m - j0, n2 = n - j0 - jb;
+                geqr2(mv, jb, a.block(j0, j0), tau + j0);
+                if (n2 == 0)
+                    continue;
+
+                // V (mv x jb, unit lower trapezoidal) and T (jb x jb, upper triangular), both column-major
+                work.assign(mv * jb + jb * jb + 2 * jb * n2, T {0});
+                strided_matrix<T> v {work.data(), 1, mv};
+                strided_matrix<T> t {v.p + mv * jb, 1, jb};
+                for (long j = 0; j < jb; ++j)
+                {
+                    v(j, j) = T {1};
+                    for (long i = j + 1; i < mv; ++i)
+                        v(i, j) = a(j0 + i, j0 + j);
+                }
+                larft(mv, jb, v, tau + j0, t, t.p + jb * jb);
+
+                // C = (I - V * T * V^H)^H * C with C = A(j0:m, j0+jb:n)
+                larfb(mv, n2, jb, v, t, true, a.block(j0, j0 + jb), t.p + jb * jb);
+            }
+        }
+
+        // Overwrite the first k columns of an m x n matrix (n <= m) containing Householder reflectors with the first n
+        // columns of Q = H_1 * ... * H_k.
+        template<typename T>
+        void orgqr(long m, long n, long k, strided_matrix<T> a, T const* tau)
+        {
+            for (long j = k; j < n; ++j)
+            {
+                for (long i = 0; i < m; ++i)
+                    a(i, j) = T {0};
+                a(j, j) = T {1};
+            }
+            for (long i = k - 1; i >= 0; --i)
+            {
+                if (i + 1 < n)
+                {
+                    a(i, i) = T {1};
+                    apply_reflector(m - i, n - i - 1, tau[i], &a(i, i), a.rs, a.block(i, i + 1));
+                }
+                for (long r = i + 1; r < m; ++r)
+                    a(r, i) = mul(-tau[i], a(r, i));
+                a(i, i) = T {1} - tau[i];
+                for (long r = 0; r < i; ++r)
+                    a(r, i) = T {0};
+            }
+        }
+
+        // Determinant from an LU factorization.
+        template<typename T, typename I>
+        T lu_determinant(long n, strided_matrix<T> lu, I const* ipiv)
+        {
+            T r {1};
+            for (long i = 0; i < n; ++i)
+                r = mul(r, (ipiv[i] != i ? -lu(i, i) : lu(i, i)));
+            return r;
+        }
+
+        // LU factorization with partial pivoting of an N x N matrix contiguous in C order (fully unrolled).
+        template<long N, typename T, typename I>
+        int getrf_fixed(T* RESTRICT a, I* RESTRICT ipiv)
+        {
+            int info = 0;
+            for (long j = 0; j < N; ++j)
+            {
+                long      p    = j;
+                real_t<T> amax = abs1(a[j * N + j]);
+                for (long i = j + 1; i < N; ++i)
+                    if (abs1(a[i * N + j]) > amax)
+                    {
+                        amax = abs1(a[i * N + j]);
+                        p    = i;
+                    }
+                ipiv[j] = static_cast<I>(p);
+                if (a[p * N + j] != T {0})
+                {
+                    if (p != j)
+                        for (long c = 0; c < N; ++c)
+                            std::swap(a[j * N + c], a[p * N + c]);
+                    const T r = T {1} / a[j * N + j];
+                    for (long i = j + 1; i < N; ++i)
+                        a[i * N + j] = mul(a[i * N + j], r);
+                }
+                else if (info == 0)
+                {
+                    info = static_cast<int>(j + 1);
+                }
+                for (long i = j + 1; i < N; ++i)
+                {
+                    const T l = a[i * N + j];
+                    for (long c = j + 1; c < N; ++c)
+                        a[i * N + c] -= mul(l, a[j * N + c]);
+                }
+            }
+            return info;
+        }
+
+        // Inverse X of an N x N matrix from its LU factorization (both contiguous in C order, fully unrolled).
+        template<long N, typename T, typename I>
+        void lu_inverse_fixed(T const* RESTRICT lu, I const* RESTRICT ipiv, T* RESTRICT x)
+        {
+            for (long i = 0; i < N; ++i)
+                for (long c = 0; c < N; ++c)
+                    x[i * N + c] = (i == c ? T {1} : T {0});
+            for (long i = 0; i < N; ++i)
+                if (ipiv[i] != i)
+                    for (long c = 0; c < N; ++c)
+                        std::swap(x[i * N + c], x[ipiv[i] * N + c]);
+            for (long i = 0; i < N; ++i)
+                for (long r = i + 1; r < N; ++r)
+                    for (long c = 0; c < N; ++c)
+                        x[r * N + c] -= mul(lu[r * N + i], x[i * N + c]);
+            for (long i = N - 1; i >= 0; --i)
+            {
+                const T d = T {1} / lu[i * N + i];
+                for (long c = 0; c < N; ++c)
+                    x[i * N + c] = mul(x[i * N + c], d);
+                for (long r = 0; r < i; ++r)
+                    for (long c = 0; c < N; ++c)
+                        x[r * N + c] -= mul(lu[r * N + i], x[i * N + c]);
+            }
+        }
+
+        // Check that an array is a square matrix in host memory (or a stack of them) with a value type known to the
+        // factorizations.
+        template<typename A>
+        constexpr bool is_factorizable_v = MemoryArray<std::remove_cvref_t<A>> and mem::on_host<std::remove_cvref_t<A>> and
+                                           (std::is_floating_point_v<std::remove_const_t<get_value_t<A>>> or is_complex_v<std::remove_const_t<get_value_t<A>>>);
+
+    } // namespace detail
+
+    /**
+     * @brief LU factorization with partial pivoting of a matrix in place: `A = P * L * U`.
+     *
+     * @details On return, the strictly lower part of `a` contains `L` (whose diagonal elements are 1) and its upper part
+     * contains `U`. Row `i` of the matrix has been interchanged with row `ipiv(i)`. Large matrices are factorized by a
+     * blocked algorithm whose updates run on enda::linalg::gemm.
+     *
+     * @note Unlike LAPACK, the pivot indices are 0-based.
+     *
+     * @tparam A enda::MemoryMatrix type.
+     * @tparam IPIV enda::MemoryVector type with integral values.
+     * @param a Matrix to be factorized (m x n).
+     * @param ipiv Pivot indices (size min(m, n)).
+     * @return 0 on success or `j + 1` if `U(j, j)` is exactly zero (the factorization is completed anyway).
+     */
+    template<MemoryMatrix A, MemoryVector IPIV>
+    int getrf(A&& a, IPIV&& ipiv)
+        requires(detail::is_factorizable_v<A> and std::integral<get_value_t<IPIV>>)
+    {
+        const long m = a.shape()[0], n = a.shape()[1];
+        EXPECTS(ipiv.size() == std::min(m, n) and ipiv.indexmap().strides()[0] == 1);
+        return detail::getrf(m, n, detail::make_strided_matrix(a), ipiv.data());
+    }
+
+    /**
+     * @brief Solve the linear system(s) `A * X = B` in place with the LU factorization from enda::linalg::getrf.
+     *
+     * @tparam LU enda::MemoryMatrix type.
+     * @tparam IPIV enda::MemoryVector type with integral values.
+     * @tparam B enda::MemoryArray type of rank 1 or 2.
+     * @param lu LU factorization of the n x n matrix `A`.
+     * @param ipiv Pivot indices of the factorization.
+     * @param b Right hand side(s), overwritten by the solution(s).
+     */
+    template<MemoryMatrix LU, MemoryVector IPIV, MemoryArray B>
+    void getrs(LU const& lu, IPIV const& ipiv, B&& b)
+        requires(get_rank<B> <= 2 and std::is_same_v<get_value_t<B>, std::remove_const_t<get_value_t<LU>>>)
+    {
+        const long n = lu.shape()[0];
+        EXPECTS(lu.shape()[1] == n and ipiv.size() == n and b.shape()[0] == n);
+        using T = get_value_t<B>;
+        auto sl = lu.indexmap().strides();
+        // the factorization is only read
+        detail::getrs(n, (get_rank<B> == 1 ? 1 : b.shape()[get_rank<B> - 1]), detail::strided_matrix<T> {const_cast<T*>(lu.data()), sl[0], sl[1]}, ipiv.data(),
+                      detail::make_strided_matrix(b));
+    }
+
+    /**
+     * @brief Cholesky factorization of a Hermitian positive definite matrix in place: `A = L * L^H`.
+     *
+     * @details Only the lower triangle of `a` is read. On success, `a` contains `L` and its strictly upper triangle is
+     * set to zero. Large matrices are factorized by a blocked algorithm whose updates run on enda::linalg::gemm.
+     *
+     * @tparam A enda::MemoryMatrix type.
+     * @param a Matrix to be factorized.
+     * @return 0 on success or `j + 1` if the leading minor of order `j + 1` is not positive definite.
+     */
+    template<MemoryMatrix A>
+    int potrf(A&& a)
+        requires(detail::is_factorizable_v<A>)
+    {
+        const long n = a.shape()[0];
+        EXPECTS(a.shape()[1] == n);
+        auto       m    = detail::make_strided_matrix(a);
+        const int  info = detail::potrf(n, m);
+        if (info == 0)
+            for (long i = 0; i < n; ++i)
+                for (long j = i + 1; j < n; ++j)
+                    m(i, j) = 0;
+        return info;
+    }
+
+    /**
+     * @brief Householder QR factorization of a matrix in place: `A = Q * R`.
+     *
+     * @details On return, the upper triangle of `a` contains `R` and the part below the diagonal, together with `tau`,
+     * represents `Q = H_0 * ... * H_{k-1}` as a product of elementary reflectors `H_i = I - tau(i) * v_i * v_i^H` (LAPACK
+     * convention). Use enda::linalg::orgqr to form `Q` explicitly.
+     *
+     * @tparam A enda::MemoryMatrix type.
+     * @tparam TAU enda::MemoryVector type.
+     * @param a Matrix to be factorized (m x n).
+     * @param tau Scalar factors of the reflectors (size min(m, n)).
+     */
+    template<MemoryMatrix A, MemoryVector TAU>
+    void geqrf(A&& a, TAU&& tau)
+        requires(detail::is_factorizable_v<A> and std::is_same_v<get_value_t<TAU>, get_value_t<A>>)
+    {
+        const long m = a.shape()[0], n = a.shape()[1];
+        EXPECTS(tau.size() == std::min(m, n) and tau.indexmap().strides()[0] == 1);
+        detail::geqrf(m, n, detail::make_strided_matrix(a), tau.data());
+    }
+
+    /**
+     * @brief Form the matrix `Q` with orthonormal columns from the output of enda::linalg::geqrf in place.
+     *
+     * @tparam A enda::MemoryMatrix type.
+     * @tparam TAU enda::MemoryVector type.
+     * @param a Output of enda::linalg::geqrf (m x n with n <= m), overwritten by the first n columns of `Q`.
+     * @param tau Scalar factors of the reflectors.
+     */
+    template<MemoryMatrix A, MemoryVector TAU>
+    void orgqr(A&& a, TAU const& tau)
+        requires(detail::is_factorizable_v<A> and std::is_same_v<get_value_t<TAU>, get_value_t<A>>)
+    {
+        const long m = a.shape()[0], n = a.shape()[1];
+        EXPECTS(n <= m and tau.size() <= n);
+        detail::orgqr(m, n, tau.size(), detail::make_strided_matrix(a), tau.data());
+    }
+
+    /**
+     * @brief Solve the linear system(s) `A * X = B`.
+     *
+     * @tparam A enda::Matrix type.
+     * @tparam B enda::Array type of rank 1 or 2.
+     * @param a Square matrix.
+     * @param b Right hand side vector or matrix.
+     * @return Solution with the same shape as `b`.
+     */
+    template<Matrix A, Array B>
+    auto solve(A const& a, B const& b)
+        requires(get_rank<B> <= 2)
+    {
+        using T = std::remove_const_t<get_value_t<A>>;
+        EXPECTS(a.shape()[0] == a.shape()[1] and b.shape()[0] == a.shape()[0]);
+        auto lu   = matrix<T, F_layout>(a);
+        auto ipiv = vector<int>(a.shape()[0]);
+        if (getrf(lu, ipiv) != 0)
+            ENDA_RUNTIME_ERROR << "Error in enda::linalg::solve: Matrix is singular";
+        if constexpr (get_rank<B> == 1)
+        {
+            auto x = vector<T>(b);
+            getrs(lu, ipiv, x);
+            return x;
+        }
+        else
+        {
+            auto x = matrix<T, F_layout>(b);
+            getrs(lu, ipiv, x);
+            return matrix<T>(x);
+        }
+    }
+
+} // namespace enda::linalg
+
+namespace enda
+{
+    /**
+     * @brief Compute the determinant of a square matrix in place.
+     *
+     * @details The matrix is overwritten by its LU factorization (see enda::linalg::getrf).
+     *
+     * @tparam M enda::MemoryMatrix type.
+     * @param m Square matrix.
+     * @return Determinant of the matrix (zero if it is singular).
+     */
+    template<MemoryMatrix M>
+    auto determinant_in_place(M&& m)
+        requires(linalg::detail::is_factorizable_v<M>)
+    {
+        const long n = m.shape()[0];
+        EXPECTS(m.shape()[1] == n);
+        if constexpr (linalg::detail::has_fixed_layout_v<M>)
+        {
+            constexpr long N = linalg::detail::static_extents_of<M>[0];
+            long           ipiv[N];
+            linalg::detail::getrf_fixed<N>(m.data(), ipiv);
+            return linalg::detail::lu_determinant(N, linalg::detail::strided_matrix<get_value_t<M>> {m.data(), N, 1}, ipiv);
+        }
+        else
+        {
+            auto ipiv = std::vector<long>(n);
+            auto lu   = linalg::detail::make_strided_matrix(m);
+            linalg::detail::getrf(n, n, lu, ipiv.data());
+            return linalg::detail::lu_determinant(n, lu, ipiv.data());
+        }
+    }
+
+    /**
+     * @brief Compute the determinant of a square matrix.
+     *
+     * @tparam M enda::Matrix type.
+     * @param m Square matrix.
+     * @return Determinant of the matrix (zero if it is singular).
+     */
+    template<Matrix M>
+    auto determinant(M const& m)
+    {
+        using T = std::remove_const_t<get_value_t<M>>;
+        if constexpr (linalg::detail::has_fixed_layout_v<M>)
+        {
+            auto a = stack_matrix<T, linalg::detail::static_extents_of<M>[0], linalg::detail::static_extents_of<M>[1]>(m);
+            return determinant_in_place(a);
+        }
+        else
+        {
+            auto a = matrix<T>(m);
+            return determinant_in_place(a);
+        }
+    }
+
+    /**
+     * @brief Invert a square matrix in place.
+     *
+     * @details The matrix is LU factorized (see enda::linalg::getrf) and the inverse is obtained by solving for the
+     * columns of the identity matrix. Matrices with small static extents and a C order layout (e.g. enda::stack_matrix)
+     * are processed by fully unrolled kernels.
+     *
+     * @tparam M enda::MemoryMatrix type.
+     * @param m Square matrix, overwritten by its inverse.
+     */
+    template<MemoryMatrix M>
+    void inverse_in_place(M&& m)
+        requires(linalg::detail::is_factorizable_v<M>)
+    {
+        using T      = get_value_t<M>;
+        const long n = m.shape()[0];
+        EXPECTS(m.shape()[1] == n);
+        if constexpr (linalg::detail::has_fixed_layout_v<M>)
+        {
+            constexpr long N = linalg::detail::static_extents_of<M>[0];
+            T              lu[N * N];
+            long           ipiv[N];
+            std::copy(m.data(), m.data() + N * N, lu);
+            if (linalg::detail::getrf_fixed<N>(lu, ipiv) != 0)
+                ENDA_RUNTIME_ERROR << "Error in enda::inverse_in_place: Matrix is singular";
+            linalg::detail::lu_inverse_fixed<N>(lu, ipiv, m.data());
+            return;
+        }
+        auto ipiv = std::vector<long>(n);
+        auto lu   = linalg::detail::make_strided_matrix(m);
+        if (linalg::detail::getrf(n, n, lu, ipiv.data()) != 0)
+            ENDA_RUNTIME_ERROR << "Error in enda::inverse_in_place: Matrix is singular";
+        auto x = matrix<T, F_layout>(n, n);
+        x      = T {1};
+        linalg::detail::getrs(n, n, lu, ipiv.data(), linalg::detail::make_strided_matrix(x));
+        m = x;
+    }
+
+    /**
+     * @brief Compute the inverse of a square matrix.
+     *
+     * @tparam M enda::Matrix type.
+     * @param m Square matrix.
+     * @return enda::matrix containing the inverse (enda::stack_matrix if `m` has small static extents, see
+     * enda::inverse_in_place).
+     */
+    template<Matrix M>
+    auto inverse(M const& m)
+    {
+        using T = std::remove_const_t<get_value_t<M>>;
+        if constexpr (linalg::detail::has_fixed_layout_v<M>)
+        {
+            auto a = stack_matrix<T, linalg::detail::static_extents_of<M>[0], linalg::detail::static_extents_of<M>[1]>(m);
+            inverse_in_place(a);
+            return a;
+        }
+        else
+        {
+            auto a = matrix<T>(m);
+            inverse_in_place(a);
+            return a;
+        }
+    }
+
+} // namespace enda
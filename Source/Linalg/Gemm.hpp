@@ -0,0 +1,955 @@
+/**
+ * @file Gemm.hpp
+ *
+ * @brief Provides native (and optionally BLAS backed) matrix-matrix and matrix-vector products.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <climits>
+#include <complex>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "BasicArray.hpp"
+#include "Concepts.hpp"
+#include "Declarations.hpp"
+#include "Macros.hpp"
+#include "Map.hpp"
+#include "MappedFunctions.hpp"
+#include "Mem/AddressSpace.hpp"
+#include "Parallel/Execution.hpp"
+#include "Traits.hpp"
+
+#ifdef ENDA_USE_BLAS
+extern "C"
+{
+    // Fortran BLAS routines (LP64 interface)
+    void sgemm_(char const*, char const*, int const*, int const*, int const*, float const*, float const*, int const*, float const*, int const*, float const*, float*, int const*);
+    void dgemm_(char const*, char const*, int const*, int const*, int const*, double const*, double const*, int const*, double const*, int const*, double const*, double*, int const*);
+    void cgemm_(char const*,
+                char const*,
+                int const*,
+                int const*,
+                int const*,
+                std::complex<float> const*,
+                std::complex<float> const*,
+                int const*,
+                std::complex<float> const*,
+                int const*,
+                std::complex<float> const*,
+                std::complex<float>*,
+                int const*);
+    void zgemm_(char const*,
+                char const*,
+                int const*,
+                int const*,
+                int const*,
+                std::complex<double> const*,
+                std::complex<double> const*,
+                int const*,
+                std::complex<double> const*,
+                int const*,
+                std::complex<double> const*,
+                std::complex<double>*,
+                int const*);
+    void sgemv_(char const*, int const*, int const*, float const*, float const*, int const*, float const*, int const*, float const*, float*, int const*);
+    void dgemv_(char const*, int const*, int const*, double const*, double const*, int const*, double const*, int const*, double const*, double*, int const*);
+    void cgemv_(char const*,
+                int const*,
+                int const*,
+                std::complex<float> const*,
+                std::complex<float> const*,
+                int const*,
+                std::complex<float> const*,
+                int const*,
+                std::complex<float> const*,
+                std::complex<float>*,
+                int const*);
+    void zgemv_(char const*,
+                int const*,
+                int const*,
+                std::complex<double> const*,
+                std::complex<double> const*,
+                int const*,
+                std::complex<double> const*,
+                int const*,
+                std::complex<double> const*,
+                std::complex<double>*,
+                int const*);
+}
+#endif
+
+namespace enda::linalg
+{
+    namespace detail
+    {
+        // Real type underlying a (complex) value type.
+        template<typename T>
+        struct real_type
+        {
+            using type = T;
+        };
+
+        template<typename T>
+        struct real_type<std::complex<T>>
+        {
+            using type = T;
+        };
+
+        template<typename T>
+        using real_t = typename real_type<T>::type;
+
+        // Number of real numbers stored per element in the packed buffers.
+        template<typename T>
+        constexpr long n_reals = (is_complex_v<T> ? 2 : 1);
+
+        // Width of the SIMD registers (in bytes) the kernels are tuned for.
+#if defined(__AVX__)
+        inline constexpr long simd_bytes = 32;
+#else
+        inline constexpr long simd_bytes = 16;
+#endif
+
+        /**
+         * @brief Blocking parameters of the GEMM kernel for a given value type.
+         *
+         * @details The product is computed in the GotoBLAS style: C is updated by MR x NR tiles held in registers
+         * (micro-kernel), which consume a KC x NR panel of B (L1 cache) and an MR x KC panel of A. A MC x KC block of A is
+         * packed into a contiguous buffer that stays in the L2 cache and a KC x NC block of B in the L3 cache.
+         *
+         * @tparam T Value type.
+         */
+        template<typename T>
+        struct gemm_blocking
+        {
+            // number of real lanes in a SIMD register
+            static constexpr long lanes = std::max<long>(1, simd_bytes / static_cast<long>(sizeof(real_t<T>)));
+
+            /// Number of rows of a register tile.
+            static constexpr long MR = (is_complex_v<T> ? lanes : 2 * lanes);
+
+            /// Number of columns of a register tile.
+            static constexpr long NR = (simd_bytes == 32 ? 6 : 4);
+
+            /// Depth of the packed panels.
+            static constexpr long KC = 256;
+
+            /// Number of rows of a packed block of A (about 256 KB).
+            static constexpr long MC = std::max<long>(MR, (256 * 1024 / (KC * static_cast<long>(sizeof(T)))) / MR * MR);
+
+            /// Number of columns of a packed block of B.
+            static constexpr long NC = 2048 / NR * NR;
+        };
+
+        // Products of at most this many multiply-adds (m * n * k) use the unblocked kernel.
+        inline constexpr long small_gemm_size = 16 * 16 * 16;
+
+        // Multiply two scalars (complex numbers without the overhead of the C99 Annex G semantics).
+        template<typename T>
+        FORCEINLINE T mul(T const& x, T const& y)
+        {
+            if constexpr (is_complex_v<T>)
+                return T(x.real() * y.real() - x.imag() * y.imag(), x.real() * y.imag() + x.imag() * y.real());
+            else
+                return x * y;
+        }
+
+        // Largest static extent for which the fully unrolled kernels are used.
+        inline constexpr int max_fixed_extent = 16;
+
+        // Is the type an array/view with static extents (at most enda::linalg::detail::max_fixed_extent) and a
+        // contiguous C order layout known at compile time (e.g. enda::stack_matrix)?
+        template<typename A>
+        constexpr bool has_fixed_layout_v = []() {
+            if constexpr (MemoryArray<std::remove_cvref_t<A>>)
+            {
+                using layout_t = typename std::remove_cvref_t<A>::layout_t;
+                return layout_t::ce_size() != 0 and has_contiguous(layout_t::layout_prop) and layout_t::is_stride_order_C() and
+                       std::ranges::all_of(layout_t::static_extents, [](int e) { return e <= max_fixed_extent; });
+            }
+            else
+            {
+                return false;
+            }
+        }();
+
+        // Static extents of an array/view.
+        template<typename A>
+        constexpr auto static_extents_of = std::remove_cvref_t<A>::layout_t::static_extents;
+
+        // Complex conjugate (identity for real numbers).
+        template<typename T>
+        FORCEINLINE T conj_if(T const& x, bool c)
+        {
+            if constexpr (is_complex_v<T>)
+                return c ? std::conj(x) : x;
+            else
+                return x;
+        }
+
+        /**
+         * @brief Matrix or vector operand of a product in host memory.
+         * @details The element `(i, j)` is `p[i * rs + j * cs]` (vectors only use `rs`) and it is conjugated if `conj`
+         * is true.
+         */
+        template<typename T>
+        struct strided_operand
+        {
+            T const* p = nullptr;
+            long     rs = 0;
+            long     cs = 0;
+            bool     conj = false;
+
+            // Operand of the transposed matrix.
+            [[nodiscard]] strided_operand transposed() const noexcept { return {p, cs, rs, conj}; }
+        };
+
+        // Is the type a lazy conjugation of an array/view in host memory (e.g. the result of enda::dagger)?
+        template<typename A>
+        constexpr bool is_conj_expr_v = false;
+
+        template<typename B>
+        constexpr bool is_conj_expr_v<expr_call<conj_f, B>> = MemoryArray<std::remove_cvref_t<B>> and mem::on_host<std::remove_cvref_t<B>>;
+
+        // Can the array be used directly as an operand of value type T and rank R in a product?
+        template<typename A, typename T, int R>
+        constexpr bool is_operand_v = []() {
+            using A_t = std::remove_cvref_t<A>;
+            if constexpr (get_rank<A_t> != R or !std::is_same_v<std::remove_const_t<get_value_t<A_t>>, T>)
+                return false;
+            else if constexpr (is_conj_expr_v<A_t>)
+                return true;
+            else if constexpr (MemoryArray<A_t>)
+                return mem::on_host<A_t>;
+            else
+                return false;
+        }();
+
+        // Get the strided operand of a matrix/vector in host memory or of its lazy conjugation.
+        template<typename A>
+        auto make_operand(A const& a)
+        {
+            if constexpr (is_conj_expr_v<A>)
+            {
+                auto op = make_operand(std::get<0>(a.a));
+                op.conj = !op.conj;
+                return op;
+            }
+            else
+            {
+                using T      = std::remove_const_t<get_value_t<A>>;
+                auto const s = a.indexmap().strides();
+                if constexpr (get_rank<A> == 2)
+                    return strided_operand<T> {a.data(), s[0], s[1], false};
+                else
+                    return strided_operand<T> {a.data(), s[0], 0, false};
+            }
+        }
+
+        // Packed buffer of the calling thread (reused between calls).
+        template<typename R>
+        R* thread_buffer(size_t size)
+        {
+            thread_local std::vector<R> buf;
+            if (buf.size() < size)
+                buf.resize(size);
+            return buf.data();
+        }
+
+        /**
+         * @brief Pack a block of `op(A)` into panels of `MR` rows.
+         *
+         * @details For each panel and each `p < kc`, the `MR` elements `op(A)(ir + i, p)` are stored contiguously (padded
+         * with zeros at the lower edge). Complex numbers are split into the `MR` real parts followed by the `MR` imaginary
+         * parts, so that the micro-kernel only works with real SIMD registers.
+         */
+        template<long MR, typename T>
+        void pack_panels(long mc, long kc, strided_operand<T> const& a, real_t<T>* RESTRICT buf)
+        {
+            constexpr long W = n_reals<T>;
+            for (long ir = 0; ir < mc; ir += MR)
+            {
+                const long mr = std::min(MR, mc - ir);
+                for (long p = 0; p < kc; ++p, buf += W * MR)
+                {
+                    T const* col = a.p + ir * a.rs + p * a.cs;
+                    if constexpr (is_complex_v<T>)
+                    {
+                        const real_t<T> sgn = (a.conj ? -1 : 1);
+                        for (long i = 0; i < mr; ++i)
+                        {
+                            buf[i]      = col[i * a.rs].real();
+                            buf[MR + i] = sgn * col[i * a.rs].imag();
+                        }
+                        for (long i = mr; i < MR; ++i)
+                            buf[i] = buf[MR + i] = 0;
+                    }
+                    else
+                    {
+                        for (long i = 0; i < mr; ++i)
+                            buf[i] = col[i * a.rs];
+                        for (long i = mr; i < MR; ++i)
+                            buf[i] = 0;
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Compute an `MR x NR` tile `ab = A_panel * B_panel` of packed panels (see enda::linalg::detail::pack_panels).
+         *
+         * @details The tile is stored column by column, i.e. `ab[j * MR + i]`. With GCC and Clang, the accumulators are
+         * SIMD vectors (vector extensions) of the width given by enda::linalg::detail::simd_bytes, which the compiler keeps
+         * in registers for any instruction set. Otherwise, a plain loop nest is used.
+         */
+        template<typename T, long MR, long NR>
+        FORCEINLINE void micro_kernel(long kc, real_t<T> const* RESTRICT a, real_t<T> const* RESTRICT b, T* RESTRICT ab)
+        {
+            using R = real_t<T>;
+#if defined(__GNUC__)
+            constexpr long L = simd_bytes / static_cast<long>(sizeof(R));
+            constexpr long V = MR / L;
+            static_assert(V * L == MR, "Tile height must be a multiple of the SIMD width");
+            typedef R vec __attribute__((vector_size(simd_bytes))); // NOLINT (the attribute is ignored on alias declarations)
+
+            if constexpr (is_complex_v<T>)
+            {
+                vec cr[NR][V] = {};
+                vec ci[NR][V] = {};
+                for (long p = 0; p < kc; ++p, a += 2 * MR, b += 2 * NR)
+                {
+                    vec ar[V], ai[V];
+                    for (long i = 0; i < V; ++i)
+                    {
+                        std::memcpy(&ar[i], a + i * L, simd_bytes);
+                        std::memcpy(&ai[i], a + MR + i * L, simd_bytes);
+                    }
+                    for (long j = 0; j < NR; ++j)
+                    {
+                        const R br = b[j], bi = b[NR + j];
+                        for (long i = 0; i < V; ++i)
+                        {
+                            cr[j][i] += ar[i] * br - ai[i] * bi;
+                            ci[j][i] += ar[i] * bi + ai[i] * br;
+                        }
+                    }
+                }
+                R re[MR], im[MR];
+                for (long j = 0; j < NR; ++j)
+                {
+                    std::memcpy(re, cr[j], sizeof(re));
+                    std::memcpy(im, ci[j], sizeof(im));
+                    for (long i = 0; i < MR; ++i)
+                        ab[j * MR + i] = T(re[i], im[i]);
+                }
+            }
+            else
+            {
+                vec c[NR][V] = {};
+                for (long p = 0; p < kc; ++p, a += MR, b += NR)
+                {
+                    vec av[V];
+                    for (long i = 0; i < V; ++i)
+                        std::memcpy(&av[i], a + i * L, simd_bytes);
+                    for (long j = 0; j < NR; ++j)
+                        for (long i = 0; i < V; ++i)
+                            c[j][i] += av[i] * b[j];
+                }
+                for (long j = 0; j < NR; ++j)
+                    for (long i = 0; i < V; ++i)
+                        std::memcpy(ab + j * MR + i * L, &c[j][i], simd_bytes);
+            }
+#else
+            if constexpr (is_complex_v<T>)
+            {
+                R cr[NR][MR] = {};
+                R ci[NR][MR] = {};
+                for (long p = 0; p < kc; ++p, a += 2 * MR, b += 2 * NR)
+                {
+                    for (long j = 0; j < NR; ++j)
+                    {
+                        const R br = b[j], bi = b[NR + j];
+                        for (long i = 0; i < MR; ++i)
+                        {
+                            cr[j][i] += a[i] * br - a[MR + i] * bi;
+                            ci[j][i] += a[i] * bi + a[MR + i] * br;
+                        }
+                    }
+                }
+                for (long j = 0; j < NR; ++j)
+                    for (long i = 0; i < MR; ++i)
+                        ab[j * MR + i] = T(cr[j][i], ci[j][i]);
+            }
+            else
+            {
+                T c[NR][MR] = {};
+                for (long p = 0; p < kc; ++p, a += MR, b += NR)
+                    for (long j = 0; j < NR; ++j)
+                        for (long i = 0; i < MR; ++i)
+                            c[j][i] += a[i] * b[j];
+                for (long j = 0; j < NR; ++j)
+                    for (long i = 0; i < MR; ++i)
+                        ab[j * MR + i] = c[j][i];
+            }
+#endif
+        }
+
+        // Elementwise function applied to the elements of C when the GEMM kernels write them back (none by default).
+        struct no_epilogue
+        {
+            template<typename T>
+            FORCEINLINE T operator()(T const& x) const
+            {
+                return x;
+            }
+        };
+
+        // Scale a matrix and apply an epilogue: C = f(beta * C) (C is not read if beta == 0).
+        template<typename T, typename F = no_epilogue>
+        void scale_matrix(long m, long n, T beta, T* c, long rsc, long csc, F const& f = {})
+        {
+            for (long j = 0; j < n; ++j)
+                for (long i = 0; i < m; ++i)
+                {
+                    T& x = c[i * rsc + j * csc];
+                    x    = f(beta == T {0} ? T {0} : mul(beta, x));
+                }
+        }
+
+        // C = f(alpha * ab + beta * C) for the upper left mr x nr part of a register tile (C is not read if beta == 0).
+        template<long MR, typename T, typename F>
+        FORCEINLINE void write_back(long mr, long nr, T const* ab, T alpha, T beta, T* c, long rsc, long csc, F const& f)
+        {
+            for (long j = 0; j < nr; ++j)
+                for (long i = 0; i < mr; ++i)
+                {
+                    T& x = c[i * rsc + j * csc];
+                    x    = f(beta == T {0} ? mul(alpha, ab[j * MR + i]) : mul(alpha, ab[j * MR + i]) + mul(beta, x));
+                }
+        }
+
+        // Multiply a packed mc x kc block of A with a packed kc x nc block of B: C = f(alpha * A * B + beta * C).
+        template<typename T, typename F>
+        void macro_kernel(long mc, long nc, long kc, real_t<T> const* ap, real_t<T> const* bp, T alpha, T beta, T* c, long rsc, long csc, F const& f)
+        {
+            using blk   = gemm_blocking<T>;
+            constexpr long MR = blk::MR, NR = blk::NR, W = n_reals<T>;
+            alignas(64) T  ab[MR * NR];
+            for (long jr = 0; jr < nc; jr += NR)
+                for (long ir = 0; ir < mc; ir += MR)
+                {
+                    micro_kernel<T, MR, NR>(kc, ap + ir * kc * W, bp + jr * kc * W, ab);
+                    write_back<MR>(std::min(MR, mc - ir), std::min(NR, nc - jr), ab, alpha, beta, c + ir * rsc + jr * csc, rsc, csc, f);
+                }
+        }
+
+        // C = alpha * A * B + beta * C for M x K and K x N matrices contiguous in C order (fully unrolled).
+        template<long M, long N, long K, typename T>
+        void gemm_fixed(T alpha, T const* RESTRICT a, T const* RESTRICT b, T beta, T* RESTRICT c)
+        {
+            for (long i = 0; i < M; ++i)
+            {
+                T acc[N] = {};
+                for (long p = 0; p < K; ++p)
+                {
+                    const T aip = a[i * K + p];
+                    for (long l = 0; l < N; ++l)
+                        acc[l] += mul(aip, b[p * N + l]);
+                }
+                if (beta == T {0})
+                    for (long l = 0; l < N; ++l)
+                        c[i * N + l] = mul(alpha, acc[l]);
+                else
+                    for (long l = 0; l < N; ++l)
+                        c[i * N + l] = mul(alpha, acc[l]) + mul(beta, c[i * N + l]);
+            }
+        }
+
+        // y = alpha * A * x + beta * y for an M x N matrix contiguous in C order and contiguous vectors (fully unrolled).
+        template<long M, long N, typename T>
+        void gemv_fixed(T alpha, T const* RESTRICT a, T const* RESTRICT x, T beta, T* RESTRICT y)
+        {
+            for (long i = 0; i < M; ++i)
+            {
+                T acc {0};
+                for (long l = 0; l < N; ++l)
+                    acc += mul(a[i * N + l], x[l]);
+                y[i] = (beta == T {0} ? mul(alpha, acc) : mul(alpha, acc) + mul(beta, y[i]));
+            }
+        }
+
+        // Unblocked product for small matrices: C = f(alpha * op(A) * op(B) + beta * C).
+        template<typename T, typename F = no_epilogue>
+        void gemm_small(long m, long n, long k, T alpha, strided_operand<T> const& a, strided_operand<T> const& b, T beta, T* c, long rsc, long csc,
+                        F const& f = {})
+        {
+            for (long j = 0; j < n; ++j)
+                for (long i = 0; i < m; ++i)
+                {
+                    T s {0};
+                    for (long p = 0; p < k; ++p)
+                        s += mul(conj_if(a.p[i * a.rs + p * a.cs], a.conj), conj_if(b.p[p * b.rs + j * b.cs], b.conj));
+                    T& x = c[i * rsc + j * csc];
+                    x    = f(beta == T {0} ? mul(alpha, s) : mul(alpha, s) + mul(beta, x));
+                }
+        }
+
+        /**
+         * @brief Native cache-blocked GEMM: `C = f(alpha * op(A) * op(B) + beta * C)` with arbitrary strides.
+         *
+         * @details See enda::linalg::detail::gemm_blocking for the blocking scheme. For each KC x NC block of B, which is
+         * packed once (in parallel), the MC x KC blocks of A are packed by the threads into their own buffers and multiplied
+         * with (a part of) the packed block of B. The tasks are distributed over the rows of C and, if there are fewer row
+         * blocks than threads, also over its columns, so that no two tasks write to the same element of C. The elementwise
+         * epilogue `f` is applied by the micro-kernel write-back of the last KC block, i.e. while the tile of C is still in
+         * the cache.
+         *
+         * @tparam T Value type.
+         * @tparam F Epilogue type.
+         * @param m Number of rows of C.
+         * @param n Number of columns of C.
+         * @param k Number of columns of op(A).
+         * @param alpha Scalar factor of the product.
+         * @param a Operand A (m x k).
+         * @param b Operand B (k x n).
+         * @param beta Scalar factor of C (C is not read if beta == 0).
+         * @param c Pointer to C.
+         * @param rsc Row stride of C.
+         * @param csc Column stride of C.
+         * @param f Epilogue.
+         */
+        template<typename T, typename F = no_epilogue>
+        void gemm_native(long m, long n, long k, T alpha, strided_operand<T> const& a, strided_operand<T> const& b, T beta, T* c, long rsc, long csc,
+                         F const& f = {})
+        {
+            if (m == 0 or n == 0)
+                return;
+            if (k == 0 or alpha == T {0})
+            {
+                scale_matrix(m, n, beta, c, rsc, csc, f);
+                return;
+            }
+            if (m * n * k <= small_gemm_size)
+            {
+                gemm_small(m, n, k, alpha, a, b, beta, c, rsc, csc, f);
+                return;
+            }
+
+            using R      = real_t<T>;
+            using blk    = gemm_blocking<T>;
+            constexpr long MR = blk::MR, NR = blk::NR, KC = blk::KC, W = n_reals<T>;
+            const bool     par       = parallel::use_parallel(m * n * k);
+            const long     n_threads = (par ? parallel::get_num_threads() : 1);
+
+            // use smaller row blocks if there are not enough of them to keep all threads busy
+            const long mc_max = std::min(blk::MC, std::max(MR, ((m + n_threads - 1) / n_threads + MR - 1) / MR * MR));
+            const long nc_max = std::min(blk::NC, (n + NR - 1) / NR * NR);
+            std::vector<R> bp(std::min(KC, k) * nc_max * W);
+
+            for (long jc = 0; jc < n; jc += blk::NC)
+            {
+                const long nc       = std::min(blk::NC, n - jc);
+                const long n_panels = (nc + NR - 1) / NR;
+                for (long pc = 0; pc < k; pc += KC)
+                {
+                    const long kc       = std::min(KC, k - pc);
+                    const T    beta_eff = (pc == 0 ? beta : T {1});
+
+                    // pack the KC x NC block of B (panels of NR columns)
+                    auto pack_b = [&](long begin, long end) {
+                        auto bt = b.transposed();
+                        bt.p += pc * b.rs + (jc + begin * NR) * b.cs;
+                        pack_panels<NR>(std::min(nc, end * NR) - begin * NR, kc, bt, bp.data() + begin * NR * kc * W);
+                    };
+                    if (par)
+                        parallel::for_chunks(n_panels, pack_b);
+                    else
+                        pack_b(0, n_panels);
+
+                    // tasks: row blocks of C, split into column chunks if there are fewer row blocks than threads
+                    const long n_ic    = (m + mc_max - 1) / mc_max;
+                    const long n_split = std::min(n_panels, std::max(1l, n_threads / n_ic));
+                    auto       task    = [&](long t) {
+                        const long ic = (t / n_split) * mc_max, mc = std::min(mc_max, m - ic);
+                        const long s  = t % n_split;
+                        const long j0 = s * n_panels / n_split * NR, j1 = std::min(nc, (s + 1) * n_panels / n_split * NR);
+                        if (j0 >= j1)
+                            return;
+                        R*   ap = thread_buffer<R>(mc_max * kc * W);
+                        auto at = a;
+                        at.p += ic * a.rs + pc * a.cs;
+                        pack_panels<MR>(mc, kc, at, ap);
+                        T* const cb = c + ic * rsc + (jc + j0) * csc;
+                        if (pc + kc == k)
+                            macro_kernel(mc, j1 - j0, kc, ap, bp.data() + j0 * kc * W, alpha, beta_eff, cb, rsc, csc, f);
+                        else
+                            macro_kernel(mc, j1 - j0, kc, ap, bp.data() + j0 * kc * W, alpha, beta_eff, cb, rsc, csc, no_epilogue {});
+                    };
+                    if (par)
+                        parallel::thread_pool::instance().run(n_ic * n_split, task);
+                    else
+                        for (long t = 0; t < n_ic * n_split; ++t)
+                            task(t);
+                }
+            }
+        }
+
+        /**
+         * @brief Native GEMV: `y = alpha * op(A) * x + beta * y` with arbitrary strides.
+         *
+         * @details If the columns of A are contiguous (or have the smaller stride), the columns scaled by the elements of
+         * x are accumulated into blocks of y (vertical kernel). Otherwise, each element of y is the dot product of a row of
+         * A with x computed with several independent accumulators. Large products are split into chunks of rows of y which
+         * are processed in parallel.
+         */
+        template<typename T>
+        void gemv_native(long m, long n, T alpha, strided_operand<T> const& a, strided_operand<T> const& x, T beta, T* y, long incy)
+        {
+            if (m == 0)
+                return;
+            if (n == 0 or alpha == T {0})
+            {
+                scale_matrix(m, 1, beta, y, incy, 0);
+                return;
+            }
+
+            auto rows = [&](long begin, long end) {
+                if (std::abs(a.rs) <= std::abs(a.cs))
+                {
+                    // accumulate scaled columns of A into blocks of y which stay in the L1 cache
+                    constexpr long RB = 512;
+                    scale_matrix(end - begin, 1, beta, y + begin * incy, incy, 0);
+                    for (long ib = begin; ib < end; ib += RB)
+                    {
+                        const long mb = std::min(RB, end - ib);
+                        T*         yb = y + ib * incy;
+                        for (long j = 0; j < n; ++j)
+                        {
+                            const T  t   = mul(alpha, x.p[j * x.rs]);
+                            T const* col = a.p + ib * a.rs + j * a.cs;
+                            if (a.conj)
+                            {
+                                for (long i = 0; i < mb; ++i)
+                                    yb[i * incy] += mul(t, conj_if(col[i * a.rs], true));
+                            }
+                            else if (a.rs == 1 and incy == 1)
+                            {
+                                for (long i = 0; i < mb; ++i)
+                                    yb[i] += mul(t, col[i]);
+                            }
+                            else
+                            {
+                                for (long i = 0; i < mb; ++i)
+                                    yb[i * incy] += mul(t, col[i * a.rs]);
+                            }
+                        }
+                    }
+                }
+                else
+                {
+                    // dot products of the rows of A with x
+                    constexpr long K = 4;
+                    for (long i = begin; i < end; ++i)
+                    {
+                        T const* row = a.p + i * a.rs;
+                        T        s[K] = {};
+                        long     j    = 0;
+                        for (; j + K <= n; j += K)
+                            for (long l = 0; l < K; ++l)
+                                s[l] += mul(conj_if(row[(j + l) * a.cs], a.conj), x.p[(j + l) * x.rs]);
+                        for (; j < n; ++j)
+                            s[0] += mul(conj_if(row[j * a.cs], a.conj), x.p[j * x.rs]);
+                        const T r = mul(alpha, (s[0] + s[1]) + (s[2] + s[3]));
+                        T&      yi = y[i * incy];
+                        yi         = (beta == T {0} ? r : r + mul(beta, yi));
+                    }
+                }
+            };
+            if (parallel::use_parallel(m * n))
+                parallel::for_chunks(m, rows, 64);
+            else
+                rows(0, m);
+        }
+
+#ifdef ENDA_USE_BLAS
+        // Value types supported by the BLAS routines.
+        template<typename T>
+        constexpr bool is_blas_type_v = std::is_same_v<T, float> or std::is_same_v<T, double> or std::is_same_v<T, std::complex<float>> or
+                                        std::is_same_v<T, std::complex<double>>;
+
+        // Get the BLAS transposition flag and leading dimension of an operand with the given shape (false if impossible).
+        template<typename T>
+        bool blas_layout(strided_operand<T> const& x, long rows, long cols, char& trans, int& ld)
+        {
+            if (x.rs == 1 and !x.conj and x.cs >= std::max(1l, rows) and x.cs <= INT_MAX)
+            {
+                trans = 'N';
+                ld    = static_cast<int>(x.cs);
+                return true;
+            }
+            if (x.cs == 1 and x.rs >= std::max(1l, cols) and x.rs <= INT_MAX)
+            {
+                trans = (x.conj ? 'C' : 'T');
+                ld    = static_cast<int>(x.rs);
+                return true;
+            }
+            return false;
+        }
+
+        // Call the BLAS GEMM if the layouts are compatible: C is column-major or row-major (then C^T = B^T A^T is computed).
+        template<typename T>
+        bool blas_gemm(long m, long n, long k, T alpha, strided_operand<T> a, strided_operand<T> b, T beta, T* c, long rsc, long csc)
+        {
+            if (m > INT_MAX or n > INT_MAX or k > INT_MAX or m == 0 or n == 0 or k == 0)
+                return false;
+            if (!(rsc == 1 and csc >= std::max(1l, m)))
+            {
+                if (!(csc == 1 and rsc >= std::max(1l, n)))
+                    return false;
+                std::swap(m, n);
+                std::swap(rsc, csc);
+                auto at = a.transposed();
+                a       = b.transposed();
+                b       = at;
+            }
+            char ta = 'N', tb = 'N';
+            int  lda = 0, ldb = 0;
+            if (!blas_layout(a, m, k, ta, lda) or !blas_layout(b, k, n, tb, ldb) or csc > INT_MAX)
+                return false;
+            const int mi = static_cast<int>(m), ni = static_cast<int>(n), ki = static_cast<int>(k), ldc = static_cast<int>(csc);
+            if constexpr (std::is_same_v<T, float>)
+                sgemm_(&ta, &tb, &mi, &ni, &ki, &alpha, a.p, &lda, b.p, &ldb, &beta, c, &ldc);
+            else if constexpr (std::is_same_v<T, double>)
+                dgemm_(&ta, &tb, &mi, &ni, &ki, &alpha, a.p, &lda, b.p, &ldb, &beta, c, &ldc);
+            else if constexpr (std::is_same_v<T, std::complex<float>>)
+                cgemm_(&ta, &tb, &mi, &ni, &ki, &alpha, a.p, &lda, b.p, &ldb, &beta, c, &ldc);
+            else
+                zgemm_(&ta, &tb, &mi, &ni, &ki, &alpha, a.p, &lda, b.p, &ldb, &beta, c, &ldc);
+            return true;
+        }
+
+        // Call the BLAS GEMV if the layout of A is compatible and the increments are positive.
+        template<typename T>
+        bool blas_gemv(long m, long n, T alpha, strided_operand<T> const& a, strided_operand<T> const& x, T beta, T* y, long incy)
+        {
+            if (m > INT_MAX or n > INT_MAX or m == 0 or n == 0 or x.rs <= 0 or incy <= 0 or x.rs > INT_MAX or incy > INT_MAX)
+                return false;
+            char trans = 'N';
+            int  lda   = 0;
+            if (!blas_layout(a, m, n, trans, lda))
+                return false;
+            // for a transposed operand, BLAS sees the stored n x m matrix
+            const int mi = static_cast<int>(trans == 'N' ? m : n), ni = static_cast<int>(trans == 'N' ? n : m);
+            const int incx = static_cast<int>(x.rs), incy_i = static_cast<int>(incy);
+            if constexpr (std::is_same_v<T, float>)
+                sgemv_(&trans, &mi, &ni, &alpha, a.p, &lda, x.p, &incx, &beta, y, &incy_i);
+            else if constexpr (std::is_same_v<T, double>)
+                dgemv_(&trans, &mi, &ni, &alpha, a.p, &lda, x.p, &incx, &beta, y, &incy_i);
+            else if constexpr (std::is_same_v<T, std::complex<float>>)
+                cgemv_(&trans, &mi, &ni, &alpha, a.p, &lda, x.p, &incx, &beta, y, &incy_i);
+            else
+                zgemv_(&trans, &mi, &ni, &alpha, a.p, &lda, x.p, &incx, &beta, y, &incy_i);
+            return true;
+        }
+#endif
+
+        // C = f(alpha * op(A) * op(B) + beta * C) with the system BLAS (if enabled and possible, the epilogue is then applied in a
+        // second pass) or the native kernel.
+        template<typename T, typename F = no_epilogue>
+        void gemm_strided(long m, long n, long k, T alpha, strided_operand<T> const& a, strided_operand<T> const& b, T beta, T* c, long rsc, long csc,
+                          F const& f = {})
+        {
+#ifdef ENDA_USE_BLAS
+            if constexpr (is_blas_type_v<T>)
+                if (blas_gemm(m, n, k, alpha, a, b, beta, c, rsc, csc))
+                {
+                    if constexpr (!std::is_same_v<F, no_epilogue>)
+                        scale_matrix(m, n, T {1}, c, rsc, csc, f);
+                    return;
+                }
+#endif
+            gemm_native<T>(m, n, k, alpha, a, b, beta, c, rsc, csc, f);
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Generalized matrix-matrix product `c = f(alpha * a * b + beta * c)`.
+     *
+     * @details The operands are matrices/views in host memory with arbitrary strides or lazy conjugations of them, e.g.
+     * `transpose(m)` or `dagger(m)`. The product is computed by a native cache-blocked kernel that runs in parallel for
+     * large matrices (see enda::linalg::detail::gemm_native). If enda is configured with `ENDA_USE_BLAS`, products of
+     * `float`, `double` and complex matrices with BLAS compatible layouts are computed by the system BLAS. Matrices with
+     * small static extents and C order layouts (e.g. enda::stack_matrix) are multiplied by a fully unrolled kernel. The
+     * matrix `c` must not overlap with `a` or `b` and it is not read if `beta == 0`.
+     *
+     * The optional elementwise epilogue `f` is applied to the elements of the result when the kernel writes them back,
+     * which saves a separate pass over `c`, e.g. `gemm(1.0, a, b, 0.0, c, [](double x) { return std::exp(x); })`.
+     *
+     * @tparam A Type of the first operand.
+     * @tparam B Type of the second operand.
+     * @tparam C enda::MemoryArrayOfRank<2> type.
+     * @tparam F Callable type taking and returning a value of the value type of `c`.
+     * @param alpha Scalar factor of the product.
+     * @param a Left operand.
+     * @param b Right operand.
+     * @param beta Scalar factor of `c`.
+     * @param c Result matrix.
+     * @param f Elementwise epilogue (identity by default).
+     */
+    template<typename A, typename B, MemoryArrayOfRank<2> C, typename F = detail::no_epilogue>
+    void gemm(get_value_t<C> alpha, A const& a, B const& b, get_value_t<C> beta, C&& c, F const& f = {})
+        requires(detail::is_operand_v<A, get_value_t<C>, 2> and detail::is_operand_v<B, get_value_t<C>, 2> and mem::on_host<C>)
+    {
+        using T      = get_value_t<C>;
+        const long m = c.shape()[0], n = c.shape()[1], k = a.shape()[1];
+        EXPECTS(a.shape()[0] == m and b.shape()[0] == k and b.shape()[1] == n);
+        if constexpr (detail::has_fixed_layout_v<A> and detail::has_fixed_layout_v<B> and detail::has_fixed_layout_v<C>)
+        {
+            constexpr auto ea = detail::static_extents_of<A>, eb = detail::static_extents_of<B>;
+            detail::gemm_fixed<ea[0], eb[1], ea[1]>(alpha, a.data(), b.data(), beta, c.data());
+            if constexpr (!std::is_same_v<F, detail::no_epilogue>)
+                for (long i = 0; i < m * n; ++i)
+                    c.data()[i] = f(c.data()[i]);
+            return;
+        }
+        auto const opa = detail::make_operand(a);
+        auto const opb = detail::make_operand(b);
+        auto const s   = c.indexmap().strides();
+        detail::gemm_strided<T>(m, n, k, alpha, opa, opb, beta, c.data(), s[0], s[1], f);
+    }
+
+    /**
+     * @brief Generalized matrix-vector product `y = alpha * a * x + beta * y`.
+     *
+     * @details The matrix `a` is a matrix/view in host memory or a lazy conjugation of one (see enda::linalg::gemm). The
+     * product is computed natively (see enda::linalg::detail::gemv_native) or by the system BLAS if enda is configured
+     * with `ENDA_USE_BLAS`. The vector `y` must not overlap with `a` or `x` and it is not read if `beta == 0`.
+     *
+     * @tparam A Type of the matrix.
+     * @tparam X enda::MemoryArrayOfRank<1> type.
+     * @tparam Y enda::MemoryArrayOfRank<1> type.
+     * @param alpha Scalar factor of the product.
+     * @param a Matrix.
+     * @param x Vector.
+     * @param beta Scalar factor of `y`.
+     * @param y Result vector.
+     */
+    template<typename A, MemoryArrayOfRank<1> X, MemoryArrayOfRank<1> Y>
+    void gemv(get_value_t<Y> alpha, A const& a, X const& x, get_value_t<Y> beta, Y&& y)
+        requires(detail::is_operand_v<A, get_value_t<Y>, 2> and detail::is_operand_v<X, get_value_t<Y>, 1> and mem::on_host<Y>)
+    {
+        using T      = get_value_t<Y>;
+        const long m = y.shape()[0], n = x.shape()[0];
+        EXPECTS(a.shape()[0] == m and a.shape()[1] == n);
+        if constexpr (detail::has_fixed_layout_v<A> and detail::has_fixed_layout_v<X> and detail::has_fixed_layout_v<Y>)
+        {
+            constexpr auto ea = detail::static_extents_of<A>;
+            detail::gemv_fixed<ea[0], ea[1]>(alpha, a.data(), x.data(), beta, y.data());
+            return;
+        }
+        auto const opa  = detail::make_operand(a);
+        auto const opx  = detail::make_operand(x);
+        const long incy = y.indexmap().strides()[0];
+#ifdef ENDA_USE_BLAS
+        if constexpr (detail::is_blas_type_v<T>)
+            if (detail::blas_gemv(m, n, alpha, opa, opx, beta, y.data(), incy))
+                return;
+#endif
+        detail::gemv_native<T>(m, n, alpha, opa, opx, beta, y.data(), incy);
+    }
+
+    /**
+     * @brief Matrix-matrix product.
+     *
+     * @details Operands which are not matrices/views in host memory (or their lazy conjugations) or whose value type
+     * differs from the one of the result are first evaluated into temporary matrices. The product itself is computed by
+     * enda::linalg::gemm. The product of two matrices with small static extents and C order layouts (e.g.
+     * enda::stack_matrix) is an enda::stack_matrix computed by a fully unrolled kernel.
+     *
+     * @tparam A enda::ArrayOfRank<2> type.
+     * @tparam B enda::ArrayOfRank<2> type.
+     * @param a Left operand.
+     * @param b Right operand.
+     * @return enda::matrix containing the product.
+     */
+    template<ArrayOfRank<2> A, ArrayOfRank<2> B>
+    auto matmul(A&& a, B&& b)
+    {
+        using T = decltype(std::declval<std::remove_const_t<get_value_t<A>>>() * std::declval<std::remove_const_t<get_value_t<B>>>());
+        if constexpr (!detail::is_operand_v<A, T, 2>)
+        {
+            return matmul(matrix<T>(a), b);
+        }
+        else if constexpr (!detail::is_operand_v<B, T, 2>)
+        {
+            return matmul(a, matrix<T>(b));
+        }
+        else
+        {
+            EXPECTS(a.shape()[1] == b.shape()[0]);
+            if constexpr (detail::has_fixed_layout_v<A> and detail::has_fixed_layout_v<B>)
+            {
+                auto c = stack_matrix<T, detail::static_extents_of<A>[0], detail::static_extents_of<B>[1]> {};
+                gemm(T {1}, a, b, T {0}, c);
+                return c;
+            }
+            else
+            {
+                auto c = matrix<T>(a.shape()[0], b.shape()[1]);
+                gemm(T {1}, a, b, T {0}, c);
+                return c;
+            }
+        }
+    }
+
+    /**
+     * @brief Matrix-vector product.
+     *
+     * @details Operands are evaluated into temporaries if necessary (see enda::linalg::matmul) and the product is computed
+     * by enda::linalg::gemv.
+     *
+     * @tparam A enda::ArrayOfRank<2> type.
+     * @tparam X enda::ArrayOfRank<1> type.
+     * @param a Matrix.
+     * @param x Vector.
+     * @return enda::vector containing the product.
+     */
+    template<ArrayOfRank<2> A, ArrayOfRank<1> X>
+    auto matvecmul(A&& a, X&& x)
+    {
+        using T = decltype(std::declval<std::remove_const_t<get_value_t<A>>>() * std::declval<std::remove_const_t<get_value_t<X>>>());
+        if constexpr (!detail::is_operand_v<A, T, 2>)
+        {
+            return matvecmul(matrix<T>(a), x);
+        }
+        else if constexpr (!detail::is_operand_v<X, T, 1>)
+        {
+            return matvecmul(a, vector<T>(x));
+        }
+        else
+        {
+            EXPECTS(a.shape()[1] == x.shape()[0]);
+            if constexpr (detail::has_fixed_layout_v<A> and detail::has_fixed_layout_v<X>)
+            {
+                auto y = stack_vector<T, detail::static_extents_of<A>[0]> {};
+                gemv(T {1}, a, x, T {0}, y);
+                return y;
+            }
+            else
+            {
+                auto y = vector<T>(a.shape()[0]);
+                gemv(T {1}, a, x, T {0}, y);
+                return y;
+            }
+        }
+    }
+
+} // namespace enda::linalg
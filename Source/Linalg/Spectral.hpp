@@ -0,0 +1,967 @@
+/**
+ * @file Spectral.hpp
+ *
+ * @brief Provides eigendecompositions of Hermitian matrices and singular value decompositions.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <numeric>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "BasicArray.hpp"
+#include "Concepts.hpp"
+#include "Declarations.hpp"
+#include "Exceptions.hpp"
+#include "Linalg/Batched.hpp"
+#include "Linalg/Factorizations.hpp"
+#include "Linalg/Gemm.hpp"
+#include "Macros.hpp"
+#include "Parallel/Execution.hpp"
+#include "Traits.hpp"
+
+namespace enda::linalg
+{
+    namespace detail
+    {
+        // Number of columns reduced together in the blocked tridiagonal reduction.
+        inline constexpr long hetrd_block_size = 32;
+
+        // Tridiagonal problems of at most this size are solved by the implicit QL algorithm in the divide and conquer.
+        inline constexpr long stedc_base_size = 25;
+
+        // Maximum number of sweeps of the one-sided Jacobi SVD.
+        inline constexpr int jacobi_max_sweeps = 60;
+
+        // Make an n x n matrix Hermitian from its lower triangle.
+        template<typename T>
+        void hermitian_from_lower(long n, strided_matrix<T> a)
+        {
+            for (long j = 0; j < n; ++j)
+            {
+                a(j, j) = std::real(a(j, j));
+                for (long i = 0; i < j; ++i)
+                    a(i, j) = conj_if(a(j, i), true);
+            }
+        }
+
+        /**
+         * @brief Blocked Householder reduction of a Hermitian n x n matrix to a real symmetric tridiagonal matrix:
+         * `Q^H * A * Q = T`.
+         *
+         * @details Both triangles of `A` have to be set. The reflectors of a panel of columns are accumulated together with
+         * the matrix `W` (as in LAPACK's `latrd`) and the trailing matrix is updated by the two GEMMs of `A -= V * W^H + W * V^H`.
+         * On exit, the diagonal of `T` is in `d`, its subdiagonal in `e` and `Q = H(0) ... H(n - 2)` is given by the
+         * reflectors `H(c) = I - tau[c] * v * v^H` with `v` stored in `A(c + 1:n, c)` (including the unit first element).
+         */
+        template<typename T>
+        void hetrd(long n, strided_matrix<T> a, real_t<T>* d, real_t<T>* e, T* tau)
+        {
+            constexpr long NB   = hetrd_block_size;
+            auto           wbuf = std::vector<T>(n * NB);
+            strided_matrix<T> w {wbuf.data(), 1, n};
+            T                 t[NB];
+            for (long j0 = 0; j0 < n; j0 += NB)
+            {
+                const long jb = std::min(NB, n - j0);
+                for (long i = 0; i < jb; ++i)
+                {
+                    const long c = j0 + i;
+                    if (i > 0)
+                    {
+                        // A(c:n, c) -= V(c:n, 0:i) * W(c, 0:i)^H + W(c:n, 0:i) * V(c, 0:i)^H
+                        for (long k = 0; k < i; ++k)
+                            t[k] = conj_if(w(c, k), true);
+                        gemv_native<T>(n - c, i, T {-1}, a.block(c, j0).operand(), {t, 1, 0, false}, T {1}, &a(c, c), a.rs);
+                        for (long k = 0; k < i; ++k)
+                            t[k] = conj_if(a(c, j0 + k), true);
+                        gemv_native<T>(n - c, i, T {-1}, w.block(c, 0).operand(), {t, 1, 0, false}, T {1}, &a(c, c), a.rs);
+                    }
+                    d[c] = std::real(a(c, c));
+                    if (c == n - 1)
+                        break;
+
+                    // reflector annihilating A(c + 2:n, c)
+                    T alpha = a(c + 1, c);
+                    tau[c]  = larfg(n - c - 2, alpha, (c + 2 < n ? &a(c + 2, c) : nullptr), a.rs);
+                    e[c]    = std::real(alpha);
+                    a(c + 1, c) = T {1};
+
+                    // W(c + 1:n, i) = tau * (A - V * W^H - W * V^H) * v
+                    const long               m2 = n - c - 1;
+                    strided_operand<T> const v {&a(c + 1, c), a.rs, 0, false};
+                    T*                       wi = &w(c + 1, i);
+                    gemv_native<T>(m2, m2, T {1}, a.block(c + 1, c + 1).operand(), v, T {0}, wi, 1);
+                    if (i > 0)
+                    {
+                        gemv_native<T>(i, m2, T {1}, w.block(c + 1, 0).operand(true).transposed(), v, T {0}, t, 1);
+                        gemv_native<T>(m2, i, T {-1}, a.block(c + 1, j0).operand(), {t, 1, 0, false}, T {1}, wi, 1);
+                        gemv_native<T>(i, m2, T {1}, a.block(c + 1, j0).operand(true).transposed(), v, T {0}, t, 1);
+                        gemv_native<T>(m2, i, T {-1}, w.block(c + 1, 0).operand(), {t, 1, 0, false}, T {1}, wi, 1);
+                    }
+                    T dot {0};
+                    for (long r = 0; r < m2; ++r)
+                    {
+                        wi[r] = mul(tau[c], wi[r]);
+                        dot += mul(conj_if(wi[r], true), v.p[r * v.rs]);
+                    }
+                    const T al = mul(real_t<T> {-0.5} * tau[c], dot);
+                    for (long r = 0; r < m2; ++r)
+                        wi[r] += mul(al, v.p[r * v.rs]);
+                }
+
+                // A22 -= V * W^H + W * V^H
+                const long m3 = n - j0 - jb;
+                if (m3 > 0)
+                {
+                    auto vb = a.block(j0 + jb, j0);
+                    auto wb = w.block(j0 + jb, 0);
+                    auto c  = a.block(j0 + jb, j0 + jb);
+                    gemm_strided<T>(m3, m3, jb, T {-1}, vb.operand(), wb.operand(true).transposed(), T {1}, c.p, c.rs, c.cs);
+                    gemm_strided<T>(m3, m3, jb, T {-1}, wb.operand(), vb.operand(true).transposed(), T {1}, c.p, c.rs, c.cs);
+                }
+            }
+        }
+
+        // X = Q * X with Q = H(0) ... H(n - 2) from enda::linalg::detail::hetrd (blocks of reflectors applied with GEMMs).
+        template<typename T>
+        void ormtr(long n, strided_matrix<T> a, T const* tau, strided_matrix<T> x)
+        {
+            constexpr long NB = lapack_block_size;
+            const long     nr = n - 1;
+            std::vector<T> work;
+            for (long c1 = nr; c1 > 0; c1 -= NB)
+            {
+                const long c0 = std::max(0l, c1 - NB), kb = c1 - c0, mv = n - c0 - 1;
+                work.assign(mv * kb + kb * kb + 2 * kb * n, T {0});
+                strided_matrix<T> v {work.data(), 1, mv};
+                strided_matrix<T> t {v.p + mv * kb, 1, kb};
+                for (long j = 0; j < kb; ++j)
+                {
+                    v(j, j) = T {1};
+                    for (long i = j + 1; i < mv; ++i)
+                        v(i, j) = a(c0 + 1 + i, c0 + j);
+                }
+                larft(mv, kb, v, tau + c0, t, t.p + kb * kb);
+                larfb(mv, n, kb, v, t, false, x.block(c0 + 1, 0), t.p + kb * kb);
+            }
+        }
+
+        /**
+         * @brief Implicit QL algorithm for a real symmetric tridiagonal n x n matrix.
+         *
+         * @details `d` contains the diagonal and `e[i]` the element `(i, i + 1)`. On exit, `d` contains the (unsorted)
+         * eigenvalues and the rotations have been applied to the columns of the `zrows x n` matrix `z`.
+         */
+        template<typename R>
+        void steql(long n, R* d, R* e, strided_matrix<R> z, long zrows)
+        {
+            constexpr R eps = std::numeric_limits<R>::epsilon();
+            if (n == 0)
+                return;
+            e[n - 1] = 0;
+            for (long l = 0; l < n; ++l)
+            {
+                int  iter = 0;
+                long m    = l;
+                do
+                {
+                    for (m = l; m < n - 1; ++m)
+                        if (std::abs(e[m]) <= eps * (std::abs(d[m]) + std::abs(d[m + 1])))
+                            break;
+                    if (m == l)
+                        break;
+                    if (iter++ == 60)
+                        ENDA_RUNTIME_ERROR << "Error in enda::linalg::detail::steql: No convergence of the implicit QL iteration";
+                    R    g = (d[l + 1] - d[l]) / (2 * e[l]);
+                    R    r = std::hypot(g, R {1});
+                    R    s = 1, c = 1, p = 0;
+                    long i = m - 1;
+                    g      = d[m] - d[l] + e[l] / (g + std::copysign(r, g));
+                    for (; i >= l; --i)
+                    {
+                        const R f = s * e[i], b = c * e[i];
+                        r         = std::hypot(f, g);
+                        e[i + 1]  = r;
+                        if (r == 0)
+                        {
+                            d[i + 1] -= p;
+                            e[m] = 0;
+                            break;
+                        }
+                        s        = f / r;
+                        c        = g / r;
+                        g        = d[i + 1] - p;
+                        r        = (d[i] - g) * s + 2 * c * b;
+                        p        = s * r;
+                        d[i + 1] = g + p;
+                        g        = c * r - b;
+                        for (long k = 0; k < zrows; ++k)
+                        {
+                            const R zk = z(k, i + 1);
+                            z(k, i + 1) = s * z(k, i) + c * zk;
+                            z(k, i)     = c * z(k, i) - s * zk;
+                        }
+                    }
+                    if (r == 0 and i >= l)
+                        continue;
+                    d[l] -= p;
+                    e[l] = g;
+                    e[m] = 0;
+                } while (m != l);
+            }
+        }
+
+        /**
+         * @brief Root of the secular equation `1 + rho * sum_j z_j^2 / (d_j - lambda) = 0` in `(d_i, d_{i+1})` (or in
+         * `(d_{k-1}, d_{k-1} + rho * zsum2)` for `i = k - 1`) with `d` strictly increasing and `rho > 0`.
+         *
+         * @details The root is computed relative to its closest pole `d_o` to keep the differences `d_j - lambda`
+         * accurate. Each step solves a model of the secular function with the two poles around the root (as in LAPACK's
+         * `laed4`) and falls back to bisection if the step leaves the current bracket.
+         *
+         * @return The index `o` of the closest pole and `lambda - d_o`.
+         */
+        template<typename R>
+        std::pair<long, R> laed4(long k, long i, R const* d, R const* z, R rho, R zsum2)
+        {
+            constexpr R eps = std::numeric_limits<R>::epsilon();
+            long        o   = k - 1;
+            R           lo = 0, hi = rho * zsum2;
+            if (i < k - 1)
+            {
+                // the sign at the midpoint decides which pole is closer
+                const R w = d[i + 1] - d[i];
+                R       f = 1;
+                for (long j = 0; j < k; ++j)
+                    f += rho * z[j] * z[j] / ((d[j] - d[i]) - w / 2);
+                if (f >= 0)
+                {
+                    o  = i;
+                    hi = w / 2;
+                }
+                else
+                {
+                    o  = i + 1;
+                    lo = -w / 2;
+                    hi = 0;
+                }
+            }
+
+            R tau = (lo + hi) / 2;
+            for (int iter = 0; iter < 200; ++iter)
+            {
+                R psi = 0, dpsi = 0, phi = 0, dphi = 0;
+                for (long j = 0; j < k; ++j)
+                {
+                    const R t = z[j] / ((d[j] - d[o]) - tau);
+                    if (j <= i)
+                    {
+                        psi += z[j] * t;
+                        dpsi += t * t;
+                    }
+                    else
+                    {
+                        phi += z[j] * t;
+                        dphi += t * t;
+                    }
+                }
+                const R f = 1 + rho * (psi + phi);
+                if (f < 0)
+                    lo = tau;
+                else
+                    hi = tau;
+                if (std::abs(f) <= 8 * eps * (1 + rho * (std::abs(psi) + std::abs(phi))) or hi - lo <= 2 * eps * std::max(std::abs(lo), std::abs(hi)))
+                    break;
+
+                // step to the root of the model c + rho * s / (a - eta) + rho * S / (b - eta)
+                const R a    = (d[i] - d[o]) - tau;
+                const R s    = dpsi * a * a;
+                R       next = lo - 1;
+                if (i < k - 1)
+                {
+                    const R b  = (d[i + 1] - d[o]) - tau;
+                    const R S  = dphi * b * b;
+                    const R c  = 1 + rho * ((psi - s / a) + (phi - S / b));
+                    const R B  = c * (a + b) + rho * (s + S);
+                    const R C0 = f * a * b;
+                    if (c == 0)
+                    {
+                        next = tau + C0 / B;
+                    }
+                    else if (const R disc = B * B - 4 * c * C0; disc >= 0)
+                    {
+                        const R q    = B + std::copysign(std::sqrt(disc), B);
+                        const R eta2 = 2 * C0 / q, eta1 = q / (2 * c);
+                        next         = (tau + eta2 > lo and tau + eta2 < hi) ? tau + eta2 : tau + eta1;
+                    }
+                }
+                else
+                {
+                    const R c = 1 + rho * (psi - s / a);
+                    if (c > 0)
+                        next = tau + a + rho * s / c;
+                }
+                tau = (next > lo and next < hi) ? next : (lo + hi) / 2;
+            }
+            return {o, tau};
+        }
+
+        /**
+         * @brief Merge step of the divide and conquer: eigen-decomposition of `Q * (D + rho * z * z^T) * Q^T`.
+         *
+         * @details The eigenvalues of `D + rho * z * z^T` whose `z` component is negligible or whose pole is (almost)
+         * repeated are deflated (the latter after a Givens rotation). The remaining ones are the roots of the secular
+         * equation (see enda::linalg::detail::laed4) and their eigenvectors are computed from the recomputed `z` of Gu and
+         * Eisenstat, which makes them numerically orthogonal. The eigenvectors of the full matrix are obtained with a GEMM.
+         * On exit, `d` contains the sorted eigenvalues and `q` the eigenvectors.
+         */
+        template<typename R>
+        void laed1(long n, R* d, strided_matrix<R> q, R rho, std::vector<R>& z)
+        {
+            constexpr R eps = std::numeric_limits<R>::epsilon();
+
+            // normalize z and sort the poles
+            const R znorm = std::sqrt(std::inner_product(z.begin(), z.end(), z.begin(), R {0}));
+            rho *= znorm * znorm;
+            for (auto& x : z)
+                x /= znorm;
+            auto perm = std::vector<long>(n);
+            std::iota(perm.begin(), perm.end(), 0l);
+            std::stable_sort(perm.begin(), perm.end(), [d](long x, long y) { return d[x] < d[y]; });
+            auto ds = std::vector<R>(n), zs = std::vector<R>(n);
+            for (long j = 0; j < n; ++j)
+            {
+                ds[j] = d[perm[j]];
+                zs[j] = z[perm[j]];
+            }
+
+            // deflation
+            R dmax = 0, zmax = 0;
+            for (long j = 0; j < n; ++j)
+            {
+                dmax = std::max(dmax, std::abs(ds[j]));
+                zmax = std::max(zmax, std::abs(zs[j]));
+            }
+            const R tol = 8 * eps * std::max(dmax, rho * zmax);
+            auto    nd  = std::vector<long>();
+            long    pj  = -1;
+            for (long j = 0; j < n; ++j)
+            {
+                if (rho * std::abs(zs[j]) <= tol)
+                    continue;
+                if (pj >= 0)
+                {
+                    const R tz = std::hypot(zs[pj], zs[j]);
+                    const R c = zs[j] / tz, s = -zs[pj] / tz;
+                    if (std::abs((ds[j] - ds[pj]) * c * s) <= tol)
+                    {
+                        // rotate the two eigenvectors to zero the z component of the first one and deflate it
+                        for (long r = 0; r < n; ++r)
+                        {
+                            const R qp = q(r, perm[pj]), qj = q(r, perm[j]);
+                            q(r, perm[pj]) = c * qp + s * qj;
+                            q(r, perm[j])  = -s * qp + c * qj;
+                        }
+                        const R dp = ds[pj], dj = ds[j];
+                        ds[pj]     = c * c * dp + s * s * dj;
+                        ds[j]      = s * s * dp + c * c * dj;
+                        zs[pj]     = 0;
+                        zs[j]      = tz;
+                    }
+                    else
+                    {
+                        nd.push_back(pj);
+                    }
+                }
+                pj = j;
+            }
+            if (pj >= 0)
+                nd.push_back(pj);
+            const long k = static_cast<long>(nd.size());
+
+            // secular equation and eigenvectors of D + rho * z * z^T (delta(j, i) = d_j - lambda_i)
+            auto dk = std::vector<R>(k), zk = std::vector<R>(k), lam = std::vector<R>(k), delta = std::vector<R>(k * k);
+            for (long j = 0; j < k; ++j)
+            {
+                dk[j] = ds[nd[j]];
+                zk[j] = zs[nd[j]];
+            }
+            const R zsum2 = std::inner_product(zk.begin(), zk.end(), zk.begin(), R {0});
+            for_batch_chunks(k, k * k * 8, [&](long i0, long i1) {
+                for (long i = i0; i < i1; ++i)
+                {
+                    auto [o, tau] = laed4(k, i, dk.data(), zk.data(), rho, zsum2);
+                    lam[i]        = dk[o] + tau;
+                    for (long j = 0; j < k; ++j)
+                        delta[j + i * k] = (dk[j] - dk[o]) - tau;
+                }
+            });
+            auto u = std::vector<R>(k * k);
+            for_batch_chunks(k, k * k, [&](long j0, long j1) {
+                for (long j = j0; j < j1; ++j)
+                {
+                    // Gu-Eisenstat: zhat_j^2 = prod_i (lambda_i - d_j) / (rho * prod_{i != j} (d_i - d_j))
+                    R p = -delta[j + j * k] / rho;
+                    for (long i = 0; i < k; ++i)
+                        if (i != j)
+                            p *= -delta[j + i * k] / (dk[i] - dk[j]);
+                    zk[j] = std::copysign(std::sqrt(std::abs(p)), zk[j]);
+                }
+            });
+            for_batch_chunks(k, k * k, [&](long i0, long i1) {
+                for (long i = i0; i < i1; ++i)
+                {
+                    R nrm = 0;
+                    for (long j = 0; j < k; ++j)
+                    {
+                        u[j + i * k] = zk[j] / delta[j + i * k];
+                        nrm += u[j + i * k] * u[j + i * k];
+                    }
+                    nrm = 1 / std::sqrt(nrm);
+                    for (long j = 0; j < k; ++j)
+                        u[j + i * k] *= nrm;
+                }
+            });
+
+            // eigenvectors of the merged matrix: Q(:, nd) * U for the non-deflated ones, Q(:, j) for the deflated ones
+            auto qnd = std::vector<R>(n * k), qu = std::vector<R>(n * k);
+            for (long j = 0; j < k; ++j)
+                for (long r = 0; r < n; ++r)
+                    qnd[r + j * n] = q(r, perm[nd[j]]);
+            gemm_strided<R>(n, k, k, R {1}, {qnd.data(), 1, n, false}, {u.data(), 1, k, false}, R {0}, qu.data(), 1, n);
+
+            // sort all eigenpairs
+            auto is_nd = std::vector<long>(n, -1);
+            for (long j = 0; j < k; ++j)
+                is_nd[nd[j]] = j;
+            auto vals = std::vector<std::pair<R, long>>(n);
+            for (long j = 0; j < n; ++j)
+                vals[j] = (is_nd[j] >= 0 ? std::pair {lam[is_nd[j]], -1 - is_nd[j]} : std::pair {ds[j], j});
+            std::stable_sort(vals.begin(), vals.end(), [](auto const& x, auto const& y) { return x.first < y.first; });
+            auto qout = std::vector<R>(n * n);
+            for (long c = 0; c < n; ++c)
+            {
+                const long src = vals[c].second;
+                for (long r = 0; r < n; ++r)
+                    qout[r + c * n] = (src < 0 ? qu[r + (-1 - src) * n] : q(r, perm[src]));
+                d[c] = vals[c].first;
+            }
+            for (long c = 0; c < n; ++c)
+                for (long r = 0; r < n; ++r)
+                    q(r, c) = qout[r + c * n];
+        }
+
+        // Sort the eigenvalues d in ascending order together with the corresponding columns of the n x n matrix q.
+        template<typename R>
+        void sort_eigenpairs(long n, R* d, strided_matrix<R> q)
+        {
+            auto perm = std::vector<long>(n);
+            std::iota(perm.begin(), perm.end(), 0l);
+            std::sort(perm.begin(), perm.end(), [d](long x, long y) { return d[x] < d[y]; });
+            auto ds = std::vector<R>(d, d + n), qs = std::vector<R>(n * n);
+            for (long j = 0; j < n; ++j)
+                for (long i = 0; i < n; ++i)
+                    qs[i + j * n] = q(i, perm[j]);
+            for (long j = 0; j < n; ++j)
+            {
+                d[j] = ds[perm[j]];
+                for (long i = 0; i < n; ++i)
+                    q(i, j) = qs[i + j * n];
+            }
+        }
+
+        /**
+         * @brief Divide and conquer eigen-decomposition of a real symmetric tridiagonal n x n matrix.
+         *
+         * @details The matrix is split into two halves coupled by a rank-one correction. The halves are solved
+         * recursively (in parallel for large matrices) and merged by enda::linalg::detail::laed1. Small problems are
+         * solved by the implicit QL algorithm. On exit, `d` contains the sorted eigenvalues and `q` the eigenvectors.
+         */
+        template<typename R>
+        void stedc(long n, R* d, R* e, strided_matrix<R> q)
+        {
+            if (n <= stedc_base_size)
+            {
+                for (long j = 0; j < n; ++j)
+                    for (long i = 0; i < n; ++i)
+                        q(i, j) = (i == j ? R {1} : R {0});
+                steql(n, d, e, q, n);
+                sort_eigenpairs(n, d, q);
+                return;
+            }
+
+            // T = diag(T1, T2) + rho * v * v^T with v = e_{m-1} + sign(beta) * e_m
+            const long m    = n / 2;
+            const R    beta = e[m - 1];
+            const R    rho  = std::abs(beta);
+            const R    sgn  = (beta < 0 ? R {-1} : R {1});
+            d[m - 1] -= rho;
+            d[m] -= rho;
+            for (long j = 0; j < n; ++j)
+                for (long i = (j < m ? m : 0); i < (j < m ? n : m); ++i)
+                    q(i, j) = 0;
+            auto solve = [&](long h) {
+                if (h == 0)
+                    stedc(m, d, e, q);
+                else
+                    stedc(n - m, d + m, e + m, q.block(m, m));
+            };
+            for_batch_chunks(2, n * n * n, [&](long h0, long h1) {
+                for (long h = h0; h < h1; ++h)
+                    solve(h);
+            });
+            if (rho == 0)
+            {
+                sort_eigenpairs(n, d, q);
+                return;
+            }
+
+            // z = Q^T * v
+            auto z = std::vector<R>(n);
+            for (long j = 0; j < m; ++j)
+                z[j] = q(m - 1, j);
+            for (long j = m; j < n; ++j)
+                z[j] = sgn * q(m, j);
+            laed1(n, d, q, rho, z);
+        }
+
+        /**
+         * @brief Eigen-decomposition of a Hermitian n x n matrix whose lower triangle is given.
+         *
+         * @details The matrix is reduced to tridiagonal form (see enda::linalg::detail::hetrd). The eigenvalues are
+         * computed by the divide and conquer algorithm if the eigenvectors are needed (see
+         * enda::linalg::detail::stedc) and by the implicit QL algorithm otherwise. On exit, `w` contains the eigenvalues in
+         * ascending order and, if `vectors` is true, `A` the corresponding eigenvectors in its columns.
+         */
+        template<typename T>
+        void heevd(long n, strided_matrix<T> a, real_t<T>* w, bool vectors)
+        {
+            using R = real_t<T>;
+            if (n == 0)
+                return;
+            hermitian_from_lower(n, a);
+            auto e   = std::vector<R>(n, R {0});
+            auto tau = std::vector<T>(n, T {0});
+            hetrd(n, a, w, e.data(), tau.data());
+            if (!vectors)
+            {
+                steql(n, w, e.data(), strided_matrix<R> {}, 0);
+                std::sort(w, w + n);
+                return;
+            }
+
+            auto z = std::vector<R>(n * n);
+            stedc(n, w, e.data(), strided_matrix<R> {z.data(), 1, n});
+            auto x = std::vector<T>(z.begin(), z.end());
+            ormtr(n, a, tau.data(), strided_matrix<T> {x.data(), 1, n});
+            for (long j = 0; j < n; ++j)
+                for (long i = 0; i < n; ++i)
+                    a(i, j) = x[i + j * n];
+        }
+
+        /**
+         * @brief One-sided Jacobi SVD of an m x n matrix `G` (m >= n).
+         *
+         * @details Pairs of columns are orthogonalized by plane rotations until all of them are orthogonal to working
+         * precision. The pairs of a sweep are visited in round-robin order, so that the n / 2 disjoint pairs of each step
+         * are processed in parallel for large matrices. On exit, the columns of `G` are `U * S` (in the original order)
+         * and the rotations have been applied to the columns of the n x n matrix `V` if `vectors` is true.
+         */
+        template<typename T>
+        void gesvj(long m, long n, strided_matrix<T> g, strided_matrix<T> v, bool vectors)
+        {
+            using R          = real_t<T>;
+            const R     tol  = std::sqrt(static_cast<R>(m)) * std::numeric_limits<R>::epsilon();
+            const long  nn   = n + (n % 2);
+            auto        pos  = std::vector<long>(nn);
+            std::iota(pos.begin(), pos.end(), 0l);
+
+            // squared column norms, updated by the rotations and recomputed at the beginning of each sweep
+            auto nrm2 = std::vector<R>(n);
+            auto rotate = [&](long p, long q) {
+                // raw column pointers let the compiler keep the strides in registers
+                T* const       gp = &g(0, p);
+                T* const       gq = &g(0, q);
+                const long     rs = g.rs;
+                constexpr long K  = 4;
+                T              acc[K] = {};
+                long           r      = 0;
+                for (; r + K <= m; r += K)
+                    for (long l = 0; l < K; ++l)
+                        acc[l] += mul(conj_if(gp[(r + l) * rs], true), gq[(r + l) * rs]);
+                for (; r < m; ++r)
+                    acc[0] += mul(conj_if(gp[r * rs], true), gq[r * rs]);
+                const T gamma = (acc[0] + acc[1]) + (acc[2] + acc[3]);
+                const R alpha = nrm2[p], beta = nrm2[q];
+                const R ag = std::abs(gamma);
+                if (ag == 0 or ag <= tol * std::sqrt(alpha) * std::sqrt(beta))
+                    return false;
+                const R zeta = (beta - alpha) / (2 * ag);
+                const R t    = std::copysign(R {1}, zeta) / (std::abs(zeta) + std::sqrt(1 + zeta * zeta));
+                const R c    = 1 / std::sqrt(1 + t * t), s = c * t;
+                const T ph   = gamma / ag;
+                const T sp = s * conj_if(ph, true), sq = s * ph;
+                auto    apply = [&](strided_matrix<T> x, long rows) {
+                    T* const   xp = &x(0, p);
+                    T* const   xq = &x(0, q);
+                    const long xs = x.rs;
+                    for (long i = 0; i < rows; ++i)
+                    {
+                        const T yp = xp[i * xs], yq = xq[i * xs];
+                        xp[i * xs] = c * yp - mul(sp, yq);
+                        xq[i * xs] = mul(sq, yp) + c * yq;
+                    }
+                };
+                apply(g, m);
+                if (vectors)
+                    apply(v, n);
+                nrm2[p] = std::max(R {0}, alpha - t * ag);
+                nrm2[q] = beta + t * ag;
+                return true;
+            };
+
+            for (int sweep = 0; sweep < jacobi_max_sweeps; ++sweep)
+            {
+                for (long j = 0; j < n; ++j)
+                {
+                    nrm2[j] = 0;
+                    for (long r = 0; r < m; ++r)
+                        nrm2[j] += std::norm(g(r, j));
+                }
+                std::atomic<bool> rotated = false;
+                for (long step = 0; step + 1 < nn; ++step)
+                {
+                    for_batch_chunks(nn / 2, m * n, [&](long i0, long i1) {
+                        bool any = false;
+                        for (long i = i0; i < i1; ++i)
+                        {
+                            const long p = std::min(pos[i], pos[nn - 1 - i]), q = std::max(pos[i], pos[nn - 1 - i]);
+                            if (q < n and rotate(p, q))
+                                any = true;
+                        }
+                        if (any)
+                            rotated = true;
+                    });
+                    std::rotate(pos.begin() + 1, pos.end() - 1, pos.end());
+                }
+                if (!rotated)
+                    break;
+            }
+        }
+
+        // Normalize the columns of an m x n matrix U * S to get U (sorted by decreasing singular values together with the
+        // columns of V if given) and complete the columns of zero singular values to an orthonormal set.
+        template<typename T>
+        void jacobi_finalize(long m, long n, strided_matrix<T> g, real_t<T>* s, strided_matrix<T> v, bool vectors)
+        {
+            using R   = real_t<T>;
+            auto perm = std::vector<long>(n);
+            auto sv   = std::vector<R>(n);
+            for (long j = 0; j < n; ++j)
+            {
+                R nrm2 = 0;
+                for (long r = 0; r < m; ++r)
+                    nrm2 += std::norm(g(r, j));
+                sv[j] = std::sqrt(nrm2);
+            }
+            std::iota(perm.begin(), perm.end(), 0l);
+            std::stable_sort(perm.begin(), perm.end(), [&](long x, long y) { return sv[x] > sv[y]; });
+            for (long j = 0; j < n; ++j)
+                s[j] = sv[perm[j]];
+            if (!vectors)
+                return;
+
+            auto permute_columns = [&](strided_matrix<T> x, long rows) {
+                auto tmp = std::vector<T>(rows * n);
+                for (long j = 0; j < n; ++j)
+                    for (long r = 0; r < rows; ++r)
+                        tmp[r + j * rows] = x(r, perm[j]);
+                for (long j = 0; j < n; ++j)
+                    for (long r = 0; r < rows; ++r)
+                        x(r, j) = tmp[r + j * rows];
+            };
+            permute_columns(g, m);
+            permute_columns(v, n);
+            for (long j = 0; j < n; ++j)
+            {
+                if (s[j] > 0)
+                {
+                    for (long r = 0; r < m; ++r)
+                        g(r, j) = g(r, j) / s[j];
+                    continue;
+                }
+
+                // orthonormal completion: orthogonalize unit vectors against the previous columns
+                for (long u = 0; u < m; ++u)
+                {
+                    for (long r = 0; r < m; ++r)
+                        g(r, j) = (r == u ? T {1} : T {0});
+                    for (int pass = 0; pass < 2; ++pass)
+                        for (long l = 0; l < j; ++l)
+                        {
+                            T dot {0};
+                            for (long r = 0; r < m; ++r)
+                                dot += mul(conj_if(g(r, l), true), g(r, j));
+                            for (long r = 0; r < m; ++r)
+                                g(r, j) -= mul(dot, g(r, l));
+                        }
+                    R nrm2 = 0;
+                    for (long r = 0; r < m; ++r)
+                        nrm2 += std::norm(g(r, j));
+                    if (nrm2 > R {0.25})
+                    {
+                        for (long r = 0; r < m; ++r)
+                            g(r, j) = g(r, j) / std::sqrt(nrm2);
+                        break;
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Thin SVD `A = U * S * V^H` of an m x n matrix with m >= n.
+         *
+         * @details Tall matrices are first QR factorized (see enda::linalg::detail::geqrf) and the one-sided Jacobi SVD
+         * (see enda::linalg::detail::gesvj) is applied to the triangular factor `R`. On exit, `A` contains `U` (m x n) if
+         * `vectors` is true, `s` the singular values in decreasing order and `V` the right singular vectors.
+         */
+        template<typename T>
+        void gesvd(long m, long n, strided_matrix<T> a, real_t<T>* s, strided_matrix<T> v, bool vectors)
+        {
+            if (n == 0)
+                return;
+            if (vectors)
+                for (long j = 0; j < n; ++j)
+                    for (long i = 0; i < n; ++i)
+                        v(i, j) = (i == j ? T {1} : T {0});
+            if (m == n)
+            {
+                gesvj(m, n, a, v, vectors);
+                jacobi_finalize(m, n, a, s, v, vectors);
+                return;
+            }
+
+            // A = Q * R, then R = U_R * S * V^H and U = Q * U_R
+            auto tau = std::vector<T>(n);
+            geqrf(m, n, a, tau.data());
+            auto              rbuf = std::vector<T>(n * n, T {0});
+            strided_matrix<T> r {rbuf.data(), 1, n};
+            for (long j = 0; j < n; ++j)
+                for (long i = 0; i <= j; ++i)
+                    r(i, j) = a(i, j);
+            gesvj(n, n, r, v, vectors);
+            jacobi_finalize(n, n, r, s, v, vectors);
+            if (!vectors)
+                return;
+            auto              qbuf = std::vector<T>(m * n);
+            strided_matrix<T> q {qbuf.data(), 1, m};
+            for (long j = 0; j < n; ++j)
+                for (long i = 0; i < m; ++i)
+                    q(i, j) = a(i, j);
+            orgqr(m, n, n, q, tau.data());
+            gemm_strided<T>(m, n, n, T {1}, q.operand(), r.operand(), T {0}, a.p, a.rs, a.cs);
+        }
+
+        // Check that the value type of an array is supported by the spectral decompositions.
+        template<typename A>
+        constexpr bool is_spectral_type_v = std::is_floating_point_v<get_value_t<A>> or is_complex_v<get_value_t<A>>;
+
+        // Thin SVD of an m x n matrix into preallocated results (u is m x k, vh is k x n with k = min(m, n)).
+        template<typename T>
+        void svd_into(long m, long n, strided_matrix<T> a, real_t<T>* s, strided_matrix<T> u, strided_matrix<T> vh, bool vectors)
+        {
+            const long k    = std::min(m, n);
+            const bool wide = m < n;
+            const long mm = std::max(m, n), nn = k;
+
+            // work on A (tall) or A^H (wide) in a column-major buffer
+            auto              gbuf = std::vector<T>(mm * nn);
+            auto              vbuf = std::vector<T>(vectors ? nn * nn : 0);
+            strided_matrix<T> g {gbuf.data(), 1, mm};
+            strided_matrix<T> v {vbuf.data(), 1, nn};
+            for (long j = 0; j < nn; ++j)
+                for (long i = 0; i < mm; ++i)
+                    g(i, j) = (wide ? conj_if(a(j, i), true) : a(i, j));
+            gesvd(mm, nn, g, s, v, vectors);
+            if (!vectors)
+                return;
+
+            // A = G * S * V^H (tall) or A = V * S * G^H (wide)
+            for (long j = 0; j < k; ++j)
+            {
+                for (long i = 0; i < m; ++i)
+                    u(i, j) = (wide ? v(i, j) : g(i, j));
+                for (long i = 0; i < n; ++i)
+                    vh(j, i) = conj_if(wide ? g(i, j) : v(i, j), true);
+            }
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Eigenvalues and eigenvectors of a Hermitian matrix.
+     *
+     * @details Only the lower triangle of `a` is referenced. The matrix is reduced to a real symmetric tridiagonal
+     * matrix by blocked Householder transformations whose trailing updates are GEMMs. The tridiagonal problem is solved
+     * by the divide and conquer algorithm (parallel for large matrices) and the eigenvectors are transformed back with
+     * blocked reflectors. `a` can be any matrix (e.g. a strided view or a lazy expression).
+     *
+     * @tparam A enda::Matrix type with a floating point or complex value type.
+     * @param a Hermitian matrix.
+     * @return `std::pair` containing an enda::vector with the eigenvalues in ascending order and an enda::matrix with the
+     * corresponding orthonormal eigenvectors in its columns.
+     */
+    template<Matrix A>
+    auto eigh(A const& a)
+        requires(detail::is_spectral_type_v<A>)
+    {
+        using T      = get_value_t<A>;
+        using R      = detail::real_t<T>;
+        const long n = a.shape()[0];
+        EXPECTS(a.shape()[1] == n);
+        auto v = matrix<T, F_layout>(a);
+        auto w = vector<R>(n);
+        detail::heevd(n, detail::make_strided_matrix(v), w.data(), true);
+        return std::pair {w, matrix<T>(v)};
+    }
+
+    /**
+     * @brief Eigenvalues of a Hermitian matrix.
+     *
+     * @details Only the lower triangle of `a` is referenced. The eigenvalues of the tridiagonal matrix (see
+     * enda::linalg::eigh) are computed by the implicit QL algorithm.
+     *
+     * @tparam A enda::Matrix type with a floating point or complex value type.
+     * @param a Hermitian matrix.
+     * @return enda::vector with the eigenvalues in ascending order.
+     */
+    template<Matrix A>
+    auto eigvalsh(A const& a)
+        requires(detail::is_spectral_type_v<A>)
+    {
+        using T      = get_value_t<A>;
+        using R      = detail::real_t<T>;
+        const long n = a.shape()[0];
+        EXPECTS(a.shape()[1] == n);
+        auto v = matrix<T, F_layout>(a);
+        auto w = vector<R>(n);
+        detail::heevd(n, detail::make_strided_matrix(v), w.data(), false);
+        return w;
+    }
+
+    /**
+     * @brief Thin singular value decomposition `a = u * diag(s) * vh`.
+     *
+     * @details Tall matrices are QR factorized first and the singular values and vectors of the triangular factor are
+     * computed by the one-sided Jacobi method, which is accurate even for small singular values. The rotations of a
+     * Jacobi step are done in parallel for large matrices. Wide matrices are handled through their adjoint.
+     *
+     * @tparam A enda::Matrix type with a floating point or complex value type.
+     * @param a m x n matrix.
+     * @return `std::tuple` containing the m x k enda::matrix `u`, the enda::vector `s` of the k singular values in
+     * decreasing order and the k x n enda::matrix `vh`, with `k = min(m, n)`.
+     */
+    template<Matrix A>
+    auto svd(A const& a)
+        requires(detail::is_spectral_type_v<A>)
+    {
+        using T      = get_value_t<A>;
+        using R      = detail::real_t<T>;
+        const long m = a.shape()[0], n = a.shape()[1], k = std::min(m, n);
+        auto       b  = matrix<T, F_layout>(a);
+        auto       u  = matrix<T>(m, k);
+        auto       vh = matrix<T>(k, n);
+        auto       s  = vector<R>(k);
+        detail::svd_into(m, n, detail::make_strided_matrix(b), s.data(), detail::make_strided_matrix(u), detail::make_strided_matrix(vh), true);
+        return std::tuple {u, s, vh};
+    }
+
+    /**
+     * @brief Singular values of a matrix (see enda::linalg::svd).
+     *
+     * @tparam A enda::Matrix type with a floating point or complex value type.
+     * @param a m x n matrix.
+     * @return enda::vector with the `min(m, n)` singular values in decreasing order.
+     */
+    template<Matrix A>
+    auto svdvals(A const& a)
+        requires(detail::is_spectral_type_v<A>)
+    {
+        using T      = get_value_t<A>;
+        using R      = detail::real_t<T>;
+        const long m = a.shape()[0], n = a.shape()[1];
+        auto       b = matrix<T, F_layout>(a);
+        auto       s = vector<R>(std::min(m, n));
+        detail::svd_into(m, n, detail::make_strided_matrix(b), s.data(), {}, {}, false);
+        return s;
+    }
+
+    /**
+     * @brief Eigenvalues and eigenvectors of a stack of Hermitian matrices `a(k, _, _)`.
+     *
+     * @details The matrices are decomposed independently (see enda::linalg::eigh) and the stack is distributed over the
+     * threads if it is large enough.
+     *
+     * @tparam A enda::ArrayOfRank<3> type with a floating point or complex value type.
+     * @param a Stack of Hermitian matrices.
+     * @return `std::pair` containing an enda::array `w` of rank 2 with the eigenvalues `w(k, _)` and an enda::array `v` of
+     * rank 3 with the eigenvectors in the columns of `v(k, _, _)`.
+     */
+    template<ArrayOfRank<3> A>
+    auto eigh(A const& a)
+        requires(detail::is_spectral_type_v<A>)
+    {
+        using T          = get_value_t<A>;
+        using R          = detail::real_t<T>;
+        const long batch = a.shape()[0], n = a.shape()[1];
+        EXPECTS(a.shape()[2] == n);
+        auto v  = array<T, 3>(a);
+        auto w  = array<R, 2>(batch, n);
+        auto sv = detail::make_strided_stack(v);
+        detail::for_batch_chunks(batch, batch * n * n * n, [&](long b0, long b1) {
+            for (long q = b0; q < b1; ++q)
+                detail::heevd(n, sv[q], &w(q, 0), true);
+        });
+        return std::pair {w, v};
+    }
+
+    /**
+     * @brief Thin singular value decompositions of a stack of matrices `a(k, _, _)`.
+     *
+     * @details The matrices are decomposed independently (see enda::linalg::svd) and the stack is distributed over the
+     * threads if it is large enough.
+     *
+     * @tparam A enda::ArrayOfRank<3> type with a floating point or complex value type.
+     * @param a Stack of m x n matrices.
+     * @return `std::tuple` containing the enda::array objects `u` (rank 3), `s` (rank 2) and `vh` (rank 3) with
+     * `a(k, _, _) = u(k, _, _) * diag(s(k, _)) * vh(k, _, _)`.
+     */
+    template<ArrayOfRank<3> A>
+    auto svd(A const& a)
+        requires(detail::is_spectral_type_v<A>)
+    {
+        using T          = get_value_t<A>;
+        using R          = detail::real_t<T>;
+        const long batch = a.shape()[0], m = a.shape()[1], n = a.shape()[2], k = std::min(m, n);
+        auto       b     = array<T, 3>(a);
+        auto       u     = array<T, 3>(batch, m, k);
+        auto       vh    = array<T, 3>(batch, k, n);
+        auto       s     = array<R, 2>(batch, k);
+        auto       sb = detail::make_strided_stack(b), su = detail::make_strided_stack(u), svh = detail::make_strided_stack(vh);
+        detail::for_batch_chunks(batch, batch * m * n * k, [&](long b0, long b1) {
+            for (long q = b0; q < b1; ++q)
+                detail::svd_into(m, n, sb[q], &s(q, 0), su[q], svh[q], true);
+        });
+        return std::tuple {u, s, vh};
+    }
+
+} // namespace enda::linalg
@@ -7,18 +7,23 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <concepts>
 #include <ranges>
 #include <type_traits>
+#include <utility>
 
 #include "Accessors.hpp"
 #include "Concepts.hpp"
 #include "Declarations.hpp"
+#include "Exceptions.hpp"
 #include "Layout/Policies.hpp"
+#include "Layout/StridedCopy.hpp"
 #include "LayoutTransforms.hpp"
 #include "Macros.hpp"
 #include "MappedFunctions.hpp"
 #include "Mem/Policies.hpp"
+#include "Parallel/Execution.hpp"
 #include "StdUtil/Array.hpp"
 
 namespace enda
@@ -31,14 +36,29 @@ namespace enda
         return r;
     }
 
+    template<Scalar S, int N>
+    auto eye()
+    {
+        auto r = stack_matrix<S, N, N> {};
+        r      = S {1};
+        return r;
+    }
+
     template<ArrayOfRank<2> M>
     auto trace(M const& m)
     {
         static_assert(get_rank<M> == 2, "Error in enda::trace: Array/View must have rank 2");
         EXPECTS(m.shape()[0] == m.shape()[1]);
-        auto r = get_value_t<M> {};
-        auto d = m.shape()[0];
-        for (int i = 0; i < d; ++i)
+        // use the static extent if there is one (fully unrolled loop for stack matrices)
+        static constexpr long d_static = []() {
+            if constexpr (MemoryArray<M>)
+                return M::layout_t::static_extents[0];
+            else
+                return 0;
+        }();
+        auto       r = get_value_t<M> {};
+        const long d = (d_static != 0 ? d_static : m.shape()[0]);
+        for (long i = 0; i < d; ++i)
             r += m(i, i);
         return r;
     }
@@ -52,6 +72,145 @@ namespace enda
             return transpose(m);
     }
 
+    /**
+     * @brief Materialize the transpose of a matrix/view in a new array.
+     *
+     * @details The result has the same stride order and algebra as `a` and contains the elements physically transposed.
+     * The copy is cache-blocked with in-register transposes of small blocks and runs in parallel for large matrices (see
+     * enda::detail::strided_copy).
+     *
+     * @tparam A enda::MemoryArrayOfRank<2> type.
+     * @param a Matrix/view.
+     * @return Regular array with shape `(a.shape()[1], a.shape()[0])` containing `transpose(a)`.
+     */
+    template<MemoryArrayOfRank<2> A>
+    auto transpose_copy(A const& a)
+    {
+        using layout_policy_t = get_contiguous_layout_policy<2, get_layout_info<A>.stride_order>;
+        auto r                = basic_array<get_value_t<A>, 2, layout_policy_t, get_algebra<A>, heap<>>(std::array {a.shape()[1], a.shape()[0]});
+        r                     = transpose(a);
+        return r;
+    }
+
+    /**
+     * @brief Materialize the conjugate transpose of a matrix/view in a new array.
+     *
+     * @details Same as enda::transpose_copy except that complex elements are conjugated on the fly. Note that assigning
+     * enda::dagger of a matrix/view to an existing matrix/view uses the same kernel.
+     *
+     * @tparam A enda::MemoryArrayOfRank<2> type.
+     * @param a Matrix/view.
+     * @return Regular array with shape `(a.shape()[1], a.shape()[0])` containing `dagger(a)`.
+     */
+    template<MemoryArrayOfRank<2> A>
+    auto dagger_copy(A const& a)
+    {
+        using layout_policy_t = get_contiguous_layout_policy<2, get_layout_info<A>.stride_order>;
+        auto r                = basic_array<get_value_t<A>, 2, layout_policy_t, get_algebra<A>, heap<>>(std::array {a.shape()[1], a.shape()[0]});
+        r                     = dagger(a);
+        return r;
+    }
+
+    namespace detail
+    {
+        // Transpose (and conjugate) a matrix/view in place.
+        template<bool Conj, typename M>
+        void transpose_inplace_impl(M&& m)
+        {
+            using M_t = std::remove_cvref_t<M>;
+            static_assert(mem::on_host<M_t>, "Error in enda::transpose_inplace: Only host arrays/views are supported");
+            static_assert(!std::is_const_v<std::remove_reference_t<decltype(*m.data())>>, "Error in enda::transpose_inplace: Cannot modify a const view");
+            auto const [n0, n1] = m.shape();
+            auto const [s0, s1] = m.indexmap().strides();
+            if (n0 * n1 == 0)
+                return;
+
+            // square matrices: swap transposed tiles (bands of tile rows distributed over the threads)
+            if (n0 == n1)
+            {
+                if (s0 != 1 and s1 != 1)
+                {
+                    auto* p = m.data();
+                    for (long i = 0; i < n0; ++i)
+                    {
+                        p[i * (s0 + s1)] = conj_value<Conj>(p[i * (s0 + s1)]);
+                        for (long j = i + 1; j < n0; ++j)
+                        {
+                            auto const t       = p[i * s0 + j * s1];
+                            p[i * s0 + j * s1] = conj_value<Conj>(p[j * s0 + i * s1]);
+                            p[j * s0 + i * s1] = conj_value<Conj>(t);
+                        }
+                    }
+                    return;
+                }
+                // the operation is symmetric in the two dimensions, i.e. only the larger stride matters
+                const long ld = (s1 == 1 ? s0 : s1);
+                const long nb = (n0 + transpose_tile_size<get_value_t<M_t>>() - 1) / transpose_tile_size<get_value_t<M_t>>();
+                auto band     = [&](long begin, long end) {
+                    // pair the tile rows k and nb - 1 - k to balance the triangular amount of work
+                    for (long k = begin; k < end; ++k)
+                    {
+                        transpose_inplace_tiles<Conj>(m.data(), ld, n0, k, k + 1);
+                        if (nb - 1 - k != k)
+                            transpose_inplace_tiles<Conj>(m.data(), ld, n0, nb - 1 - k, nb - k);
+                    }
+                };
+                if (parallel::use_parallel(n0 * n1))
+                    parallel::for_chunks((nb + 1) / 2, band);
+                else
+                    band(0, (nb + 1) / 2);
+                return;
+            }
+
+            // rectangular matrices: follow the cycles of the permutation and swap the extents
+            if constexpr (is_regular_v<M_t> and has_contiguous_layout<M_t> and M_t::layout_t::ce_size() == 0)
+            {
+                const bool c_order = M_t::layout_t::is_stride_order_C();
+                transpose_inplace_cycles<Conj>(m.data(), c_order ? n0 : n1, c_order ? n1 : n0);
+                m = M_t(typename M_t::layout_t {std::array {n1, n0}}, std::move(m).storage());
+            }
+            else
+            {
+                ENDA_RUNTIME_ERROR << "Error in enda::transpose_inplace: Non-square matrices can only be transposed in place if they are contiguous "
+                                      "arrays with dynamic extents (the shape of views cannot change)";
+            }
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Transpose a matrix in place.
+     *
+     * @details Square matrices/views with a unit stride are transposed by swapping pairs of tiles (see
+     * enda::detail::transpose_inplace_tiles) in parallel for large matrices. Other square views are transposed by
+     * swapping elements. Non-square matrices have to be contiguous arrays (e.g. enda::matrix) whose extents are swapped
+     * after their memory has been permuted by following the cycles of the transposition (see
+     * enda::detail::transpose_inplace_cycles). This only needs one extra bit per element but is considerably slower
+     * than enda::transpose_copy.
+     *
+     * @tparam M enda::MemoryArrayOfRank<2> type.
+     * @param m Matrix/view.
+     */
+    template<MemoryArrayOfRank<2> M>
+    void transpose_inplace(M&& m)
+    {
+        detail::transpose_inplace_impl<false>(std::forward<M>(m));
+    }
+
+    /**
+     * @brief Replace a matrix in place by its conjugate transpose.
+     *
+     * @details See enda::transpose_inplace. The elements are conjugated while they are moved.
+     *
+     * @tparam M enda::MemoryArrayOfRank<2> type.
+     * @param m Matrix/view.
+     */
+    template<MemoryArrayOfRank<2> M>
+    void dagger_inplace(M&& m)
+    {
+        detail::transpose_inplace_impl<is_complex_v<get_value_t<M>>>(std::forward<M>(m));
+    }
+
     template<MemoryArrayOfRank<2> M>
     ArrayOfRank<1> auto diagonal(M& m)
     {
@@ -0,0 +1,13 @@
+/**
+ * @file Parallel.hpp
+ *
+ * @brief Includes all relevant headers for the parallel execution of array kernels.
+ */
+
+#pragma once
+
+#include "Parallel/Deque.hpp"
+#include "Parallel/Execution.hpp"
+#include "Parallel/ForEach.hpp"
+#include "Parallel/TaskGroup.hpp"
+#include "Parallel/ThreadPool.hpp"
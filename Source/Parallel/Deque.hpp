@@ -0,0 +1,127 @@
+/**
+ * @file Deque.hpp
+ *
+ * @brief Provides the lock-free work-stealing deque used by the enda::parallel::thread_pool.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace enda::parallel::detail
+{
+    /**
+     * @brief Chase-Lev work-stealing deque of pointers.
+     *
+     * @details The owner thread pushes and pops at the bottom (LIFO), all other threads steal from the top (FIFO). The
+     * implementation follows Chase and Lev (SPAA 2005) and the C11 formulation of Lê et al. (PPoPP 2013), with
+     * sequentially consistent accesses to `top` and `bottom` instead of standalone fences. The ring buffer grows
+     * when it is full. Old buffers are kept alive until the deque is destroyed, since a thief might still read from them.
+     *
+     * @tparam T Type of the pointed-to elements.
+     */
+    template<typename T>
+    class ws_deque
+    {
+        // Ring buffer with a power of two capacity.
+        struct ring
+        {
+            explicit ring(long capacity) : mask(capacity - 1), buf(std::make_unique<std::atomic<T*>[]>(capacity)) {}
+            [[nodiscard]] long capacity() const noexcept { return mask + 1; }
+            [[nodiscard]] T* get(long i) const noexcept { return buf[i & mask].load(std::memory_order_relaxed); }
+            void put(long i, T* x) noexcept { buf[i & mask].store(x, std::memory_order_relaxed); }
+
+            long                                 mask;
+            std::unique_ptr<std::atomic<T*>[]> buf;
+        };
+
+        alignas(64) std::atomic<long> top {0};
+        alignas(64) std::atomic<long> bottom {0};
+        alignas(64) std::atomic<ring*> array {nullptr};
+
+        // All buffers ever used (only accessed by the owner).
+        std::vector<std::unique_ptr<ring>> rings;
+
+        // Replace the current buffer by one with twice the capacity containing the elements in [t, b).
+        ring* grow(ring* a, long t, long b)
+        {
+            auto r = std::make_unique<ring>(2 * a->capacity());
+            for (long i = t; i < b; ++i)
+                r->put(i, a->get(i));
+            a = r.get();
+            rings.push_back(std::move(r));
+            array.store(a, std::memory_order_release);
+            return a;
+        }
+
+    public:
+        /**
+         * @brief Construct an empty deque.
+         * @param capacity Initial capacity (has to be a power of two).
+         */
+        explicit ws_deque(long capacity = 256)
+        {
+            rings.push_back(std::make_unique<ring>(capacity));
+            array.store(rings.back().get(), std::memory_order_relaxed);
+        }
+
+        ws_deque(ws_deque const&)            = delete;
+        ws_deque& operator=(ws_deque const&) = delete;
+
+        /// Push an element at the bottom (owner only).
+        void push(T* x)
+        {
+            long const b = bottom.load(std::memory_order_relaxed);
+            long const t = top.load(std::memory_order_acquire);
+            ring*      a = array.load(std::memory_order_relaxed);
+            if (b - t > a->capacity() - 1)
+                a = grow(a, t, b);
+            a->put(b, x);
+            bottom.store(b + 1, std::memory_order_release);
+        }
+
+        /// Pop an element from the bottom (owner only). Returns a nullptr if the deque is empty.
+        T* pop() noexcept
+        {
+            long const b = bottom.load(std::memory_order_relaxed) - 1;
+            ring*      a = array.load(std::memory_order_relaxed);
+            bottom.store(b, std::memory_order_seq_cst);
+            long t = top.load(std::memory_order_seq_cst);
+            if (t > b)
+            {
+                // empty
+                bottom.store(b + 1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            T* x = a->get(b);
+            if (t == b)
+            {
+                // last element: race against the thieves
+                if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                    x = nullptr;
+                bottom.store(b + 1, std::memory_order_relaxed);
+            }
+            return x;
+        }
+
+        /// Steal an element from the top (any thread). Returns a nullptr if the deque is empty or if the race was lost.
+        T* steal() noexcept
+        {
+            long t       = top.load(std::memory_order_seq_cst);
+            long const b = bottom.load(std::memory_order_seq_cst);
+            if (t >= b)
+                return nullptr;
+            ring* a = array.load(std::memory_order_acquire);
+            T*    x = a->get(t);
+            if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                return nullptr;
+            return x;
+        }
+
+        /// Approximate check if the deque is empty.
+        [[nodiscard]] bool empty() const noexcept { return bottom.load(std::memory_order_relaxed) <= top.load(std::memory_order_relaxed); }
+    };
+
+} // namespace enda::parallel::detail
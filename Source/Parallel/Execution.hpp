@@ -0,0 +1,244 @@
+/**
+ * @file Execution.hpp
+ *
+ * @brief Provides execution policies and helpers to run array kernels in parallel.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Layout/Collapse.hpp"
+#include "Parallel/ThreadPool.hpp"
+
+namespace enda::execution
+{
+    /// Execution policy: run the kernel sequentially on the calling thread.
+    struct sequenced_policy
+    {};
+
+    /// Execution policy: run the kernel on the threads of the global enda::parallel::thread_pool.
+    struct parallel_policy
+    {};
+
+    /// Execution policy: run the kernel in parallel if the array is larger than enda::parallel::get_threshold().
+    struct automatic_policy
+    {};
+
+    /// Global enda::execution::sequenced_policy object.
+    inline constexpr sequenced_policy seq {};
+
+    /// Global enda::execution::parallel_policy object.
+    inline constexpr parallel_policy par {};
+
+    /// Global enda::execution::automatic_policy object.
+    inline constexpr automatic_policy automatic {};
+
+    /// Check if a type is one of the enda execution policies.
+    template<typename P>
+    concept ExecutionPolicy = std::same_as<std::remove_cvref_t<P>, sequenced_policy> or std::same_as<std::remove_cvref_t<P>, parallel_policy> or
+                              std::same_as<std::remove_cvref_t<P>, automatic_policy>;
+
+} // namespace enda::execution
+
+namespace enda::parallel
+{
+    namespace detail
+    {
+        // Minimum number of elements for which array kernels run in parallel by default.
+        inline std::atomic<long> threshold {1l << 18};
+
+        // Execution policy forced on the current thread (0: automatic, 1: sequential, 2: parallel).
+        inline thread_local int forced_policy = 0;
+
+    } // namespace detail
+
+    /// Get the number of threads used by the parallel array kernels.
+    inline int get_num_threads() noexcept { return thread_pool::instance().size(); }
+
+    /**
+     * @brief Set the number of threads used by the parallel array kernels.
+     * @details The default is given by the environment variable `ENDA_NUM_THREADS` or the number of hardware threads.
+     * Setting it to 1 disables the parallel execution.
+     * @param n Number of threads (including the calling thread).
+     */
+    inline void set_num_threads(int n) { thread_pool::instance().resize(std::max(1, n)); }
+
+    /**
+     * @brief Pin the worker threads of the global pool to hardware threads or release them.
+     * @details The default is given by the environment variable `ENDA_PROC_BIND` (see also
+     * enda::parallel::thread_pool::set_affinity).
+     * @param pin True to pin the worker threads.
+     */
+    inline void set_thread_affinity(bool pin) { thread_pool::instance().set_affinity(pin); }
+
+    /// Get the minimum number of elements for which array kernels run in parallel by default.
+    inline long get_threshold() noexcept { return detail::threshold.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Set the minimum number of elements for which array kernels run in parallel by default.
+     * @param n Number of elements.
+     */
+    inline void set_threshold(long n) noexcept { detail::threshold.store(n, std::memory_order_relaxed); }
+
+    /**
+     * @brief Decide if a kernel of a given size should run in parallel.
+     *
+     * @param size Number of elements processed by the kernel.
+     * @return True if a enda::execution::parallel_policy is forced on the current thread or if the size exceeds the
+     * threshold (and no enda::execution::sequenced_policy is forced), and if more than one thread is available.
+     */
+    inline bool use_parallel(long size) noexcept
+    {
+        if (detail::forced_policy == 1 or detail::in_parallel_region)
+            return false;
+        if (detail::forced_policy == 0 and size < get_threshold())
+            return false;
+        return get_num_threads() > 1;
+    }
+
+    /**
+     * @brief RAII guard forcing an execution policy on the current thread.
+     *
+     * @details While the guard is alive, all array kernels called from the current thread use the given policy instead of
+     * deciding automatically based on their size.
+     */
+    class policy_guard
+    {
+    public:
+        explicit policy_guard(execution::sequenced_policy) noexcept : old(std::exchange(detail::forced_policy, 1)) {}
+        explicit policy_guard(execution::parallel_policy) noexcept : old(std::exchange(detail::forced_policy, 2)) {}
+        explicit policy_guard(execution::automatic_policy) noexcept : old(std::exchange(detail::forced_policy, 0)) {}
+        policy_guard(policy_guard const&)            = delete;
+        policy_guard& operator=(policy_guard const&) = delete;
+        ~policy_guard() { detail::forced_policy = old; }
+
+    private:
+        int old;
+    };
+
+    /**
+     * @brief Split the range `[0, n)` into contiguous chunks and process them with the global thread pool.
+     *
+     * @details Static chunking: the range is divided into (at most) one chunk per thread of nearly equal size. If the
+     * range is smaller than `2 * min_chunk` or there is only one thread, `f(0, n)` is called directly.
+     *
+     * @tparam F Callable type.
+     * @param n Size of the range.
+     * @param f Callable object taking the half-open range `[begin, end)` of a chunk.
+     * @param min_chunk Minimum size of a chunk.
+     */
+    template<typename F>
+    void for_chunks(long n, F&& f, long min_chunk = 1)
+    { // NOLINT (we do not want to forward here)
+        auto& pool          = thread_pool::instance();
+        const long n_chunks = std::min<long>(pool.size(), n / std::max(1l, min_chunk));
+        if (n_chunks <= 1)
+        {
+            f(0l, n);
+            return;
+        }
+        pool.run(n_chunks, [&](long c) { f(c * n / n_chunks, (c + 1) * n / n_chunks); });
+    }
+
+    /**
+     * @brief Run a kernel on a collapsed layout, split into chunks along its slowest dimension if the layout is large
+     * enough (see enda::parallel::use_parallel).
+     *
+     * @tparam N Number of layouts.
+     * @tparam R Rank of the layouts.
+     * @tparam F Callable type.
+     * @param cl enda::detail::collapsed_layout object.
+     * @param f Callable object taking a sub-layout and the offsets (one per layout) of its first element.
+     */
+    template<size_t N, size_t R, typename F>
+    void for_collapsed_chunks(enda::detail::collapsed_layout<N, R> const& cl, F&& f)
+    { // NOLINT (we do not want to forward here)
+        long size = 1;
+        for (int k = 0; k < cl.rank; ++k)
+            size *= cl.lengths[k];
+        if (!use_parallel(size))
+        {
+            f(cl, std::array<long, N> {});
+            return;
+        }
+        for_chunks(cl.lengths[0], [&](long begin, long end) {
+            auto [sub, off] = enda::detail::slice_outer(cl, begin, end);
+            f(sub, off);
+        });
+    }
+
+    /**
+     * @brief Reduce the range `[0, n)` in parallel chunks and combine the partial results in a tree.
+     *
+     * @details The range is split into (at most) one chunk per thread (see enda::parallel::for_chunks). Each chunk is
+     * reduced by `f(begin, end)` and the partial results are combined pairwise with `comb`, i.e. in a binary tree whose
+     * shape only depends on the number of chunks.
+     *
+     * @tparam R Result type.
+     * @tparam F Callable type.
+     * @tparam C Callable type of the combination.
+     * @param n Size of the range.
+     * @param id Identity element of the combination.
+     * @param f Callable object taking the half-open range `[begin, end)` of a chunk and returning its partial result.
+     * @param comb Callable object combining two partial results.
+     * @param min_chunk Minimum size of a chunk.
+     * @return Result of the reduction.
+     */
+    template<typename R, typename F, typename C>
+    R reduce_chunks(long n, R const& id, F&& f, C&& comb, long min_chunk = 1)
+    { // NOLINT (we do not want to forward here)
+        auto& pool          = thread_pool::instance();
+        const long n_chunks = std::min<long>(pool.size(), n / std::max(1l, min_chunk));
+        if (n_chunks <= 1)
+            return f(0l, n);
+
+        std::vector<R> partials(n_chunks, id);
+        pool.run(n_chunks, [&](long c) { partials[c] = f(c * n / n_chunks, (c + 1) * n / n_chunks); });
+        for (long w = 1; w < n_chunks; w *= 2)
+            for (long c = 0; c + w < n_chunks; c += 2 * w)
+                partials[c] = comb(partials[c], partials[c + w]);
+        return partials[0];
+    }
+
+    /**
+     * @brief Reduce a collapsed layout, split into chunks along its slowest dimension if the layout is large enough (see
+     * enda::parallel::use_parallel and enda::parallel::reduce_chunks).
+     *
+     * @tparam N Number of layouts.
+     * @tparam R Rank of the layouts.
+     * @tparam T Result type.
+     * @tparam F Callable type.
+     * @tparam C Callable type of the combination.
+     * @param cl enda::detail::collapsed_layout object.
+     * @param id Identity element of the combination.
+     * @param f Callable object taking a sub-layout and the offsets of its first element and returning its partial result.
+     * @param comb Callable object combining two partial results.
+     * @return Result of the reduction.
+     */
+    template<size_t N, size_t R, typename T, typename F, typename C>
+    T reduce_collapsed_chunks(enda::detail::collapsed_layout<N, R> const& cl, T const& id, F&& f, C&& comb)
+    { // NOLINT (we do not want to forward here)
+        long size = 1;
+        for (int k = 0; k < cl.rank; ++k)
+            size *= cl.lengths[k];
+        if (!use_parallel(size))
+            return f(cl, std::array<long, N> {});
+        return reduce_chunks(
+            cl.lengths[0],
+            id,
+            [&](long begin, long end) {
+                auto [sub, off] = enda::detail::slice_outer(cl, begin, end);
+                return f(sub, off);
+            },
+            comb);
+    }
+
+} // namespace enda::parallel
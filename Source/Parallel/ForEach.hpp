@@ -0,0 +1,293 @@
+/**
+ * @file ForEach.hpp
+ *
+ * @brief Provides parallel `for_each` functions over multi-dimensional index spaces.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "Layout/Permutation.hpp"
+#include "Parallel/Execution.hpp"
+#include "Parallel/ThreadPool.hpp"
+
+namespace enda::parallel
+{
+    /**
+     * @brief Scheduling of the index space of enda::parallel::parallel_for_each among the threads.
+     *
+     * @details The index space is linearized in traversal order and split into chunks whose boundaries are multiples of
+     * `grain` (except for the end of the index space). With the default grain of 64 indices, a kernel writing to a
+     * cache-line aligned array in traversal order never writes to the same cache line from two different chunks, as long as
+     * the elements are at least one byte large.
+     *
+     * - `static_chunks`: one chunk of nearly equal size per thread (lowest overhead, best for uniform work).
+     * - `dynamic_chunks`: the threads grab chunks of `chunk` indices from a shared counter until all are processed (best
+     * for irregular work).
+     * - `guided_chunks`: like `dynamic_chunks`, but the chunk size is proportional to the remaining work divided by the
+     * number of threads and decreases down to `chunk`.
+     */
+    struct schedule
+    {
+        /// Kind of scheduling.
+        enum class kind_t
+        {
+            static_chunks,
+            dynamic_chunks,
+            guided_chunks
+        };
+
+        /// Kind of scheduling.
+        kind_t kind = kind_t::static_chunks;
+
+        /// (Minimum) number of indices per chunk for dynamic and guided scheduling (0: chosen automatically).
+        long chunk = 0;
+
+        /// Chunk boundaries are multiples of the grain.
+        long grain = 64;
+
+        /// Static scheduling.
+        static constexpr schedule static_chunks(long grain = 64) noexcept { return {kind_t::static_chunks, 0, grain}; }
+
+        /// Dynamic scheduling with a given chunk size.
+        static constexpr schedule dynamic_chunks(long chunk = 0, long grain = 64) noexcept { return {kind_t::dynamic_chunks, chunk, grain}; }
+
+        /// Guided scheduling with a given minimum chunk size.
+        static constexpr schedule guided_chunks(long chunk = 0, long grain = 64) noexcept { return {kind_t::guided_chunks, chunk, grain}; }
+    };
+
+    namespace detail
+    {
+        // Multi-dimensional index space linearized in the traversal order given by an encoded stride order.
+        template<uint64_t StrideOrder, size_t R>
+        struct linear_index_space
+        {
+            // Dimension corresponding to the k-th slowest traversal position.
+            static constexpr std::array<int, R> order = (StrideOrder == 0 ? permutations::identity<R>() : decode<R>(StrideOrder));
+
+            // Innermost dimension.
+            static constexpr int J = order[R - 1];
+
+            // Extents in traversal order (slowest first).
+            std::array<long, R> ext {};
+
+            // Construct the index space from a shape.
+            template<std::integral Int>
+            explicit linear_index_space(std::array<Int, R> const& shape)
+            {
+                for (size_t k = 0; k < R; ++k)
+                    ext[k] = shape[order[k]];
+            }
+
+            // Total number of indices.
+            [[nodiscard]] long size() const noexcept
+            {
+                long s = 1;
+                for (auto e : ext)
+                    s *= e;
+                return s;
+            }
+
+            // Call f(idxs...) for all linear indices in [begin, end).
+            template<typename F>
+            void for_range(long begin, long end, F& f) const
+            {
+                if (begin >= end)
+                    return;
+
+                // multi-dimensional index of the first element
+                std::array<long, R> idxs {};
+                long                lin = begin;
+                for (int k = static_cast<int>(R) - 1; k >= 0; --k)
+                {
+                    idxs[order[k]] = lin % ext[k];
+                    lin /= ext[k];
+                }
+
+                // runs along the innermost dimension (the loop variable is passed directly to keep it in a register)
+                auto run = [&]<size_t... Is>(std::index_sequence<Is...>, long i0, long i1) {
+                    for (long i = i0; i < i1; ++i)
+                        f((Is == J ? i : idxs[Is])...);
+                };
+                for (long n = end - begin; n > 0;)
+                {
+                    long const len = std::min(n, ext[R - 1] - idxs[J]);
+                    run(std::make_index_sequence<R> {}, idxs[J], idxs[J] + len);
+                    n -= len;
+                    if (n == 0)
+                        break;
+
+                    // carry over to the slower dimensions
+                    idxs[J] = 0;
+                    for (int k = static_cast<int>(R) - 2; k >= 0; --k)
+                    {
+                        if (++idxs[order[k]] < ext[k])
+                            break;
+                        idxs[order[k]] = 0;
+                    }
+                }
+            }
+        };
+
+        // Round n down to a multiple of g.
+        inline long round_down(long n, long g) noexcept { return n / g * g; }
+
+        // Distribute [0, n) among the threads of the global pool according to a schedule: calls g(task, begin, end) for
+        // every chunk, where task is the index of the pool task (in [0, n_tasks)) processing it.
+        template<typename G>
+        void schedule_chunks(long n, schedule const& sched, long n_tasks, G&& g)
+        { // NOLINT (we do not want to forward here)
+            auto&      pool  = thread_pool::instance();
+            long const grain = std::max(1l, sched.grain);
+
+            if (sched.kind == schedule::kind_t::static_chunks)
+            {
+                // split in units of whole grains, i.e. the chunks differ by at most one grain
+                long const n_grains = (n + grain - 1) / grain;
+                pool.run(n_tasks, [&](long t) {
+                    long const b = t * n_grains / n_tasks * grain;
+                    long const e = std::min(n, (t + 1) * n_grains / n_tasks * grain);
+                    g(t, b, e);
+                });
+                return;
+            }
+
+            // dynamic and guided scheduling share an atomic counter (on its own cache line)
+            struct alignas(64) counter_t
+            {
+                std::atomic<long> next {0};
+            } counter;
+            long const min_chunk = std::max(grain, round_down(sched.chunk > 0 ? sched.chunk : n / (8 * n_tasks), grain));
+            bool const guided    = (sched.kind == schedule::kind_t::guided_chunks);
+
+            pool.run(n_tasks, [&](long t) {
+                while (true)
+                {
+                    long b = counter.next.load(std::memory_order_relaxed);
+                    long e = 0;
+                    do {
+                        if (b >= n)
+                            return;
+                        long const c = (guided ? std::max(min_chunk, round_down((n - b) / (2 * n_tasks), grain)) : min_chunk);
+                        e            = std::min(n, b + c);
+                    } while (!counter.next.compare_exchange_weak(b, e, std::memory_order_relaxed));
+                    g(t, b, e);
+                }
+            });
+        }
+
+        // Number of pool tasks used for an index space of a given size (0 if it should run sequentially).
+        inline long number_of_tasks(long size, schedule const& sched) noexcept
+        {
+            if (!use_parallel(size))
+                return 0;
+            return std::min<long>(get_num_threads(), (size + std::max(1l, sched.grain) - 1) / std::max(1l, sched.grain));
+        }
+
+        // Value stored on its own cache line(s) to avoid false sharing between threads.
+        template<typename T>
+        struct alignas(64) padded
+        {
+            T value;
+        };
+
+    } // namespace detail
+
+    /**
+     * @brief Loop in parallel over all possible index values of a given shape and apply a function to them.
+     *
+     * @details The index space is traversed in the order given by the encoded `StrideOrder` (C-order by default), i.e. if
+     * the stride order of an array is given, each thread processes a range of consecutive elements in memory. All
+     * dimensions are collapsed into a single linear index space, which is split into chunks according to the given
+     * enda::parallel::schedule, so that shapes with a small slowest dimension are still well balanced.
+     *
+     * The loop runs in parallel only if enda::parallel::use_parallel is true for the size of the shape (see also
+     * enda::parallel::policy_guard). Otherwise it is equivalent to enda::for_each_ordered.
+     *
+     * Every index is visited exactly once. Writes to disjoint memory locations in `f` are therefore free of data races and
+     * all of them are visible to the calling thread when the function returns.
+     *
+     * @tparam StrideOrder Encoded stride order.
+     * @tparam F Callable type.
+     * @tparam R Number of dimensions.
+     * @tparam Int Integer type used in the shape array.
+     * @param shape Shape to loop over (index bounds).
+     * @param f Callable object, must be callable as `f(long, ..., long)` with `R` arguments from multiple threads.
+     * @param sched Scheduling of the chunks.
+     */
+    template<uint64_t StrideOrder = 0, typename F, auto R, std::integral Int = long>
+    void parallel_for_each(std::array<Int, R> const& shape, F&& f, schedule const& sched = {})
+    { // NOLINT (we do not want to forward here)
+        auto const space   = detail::linear_index_space<StrideOrder, R>(shape);
+        long const size    = space.size();
+        long const n_tasks = detail::number_of_tasks(size, sched);
+        if (n_tasks <= 1)
+        {
+            space.for_range(0, size, f);
+            return;
+        }
+        detail::schedule_chunks(size, sched, n_tasks, [&](long, long b, long e) { space.for_range(b, e, f); });
+    }
+
+    /**
+     * @brief Reduce in parallel over all possible index values of a given shape.
+     *
+     * @details Works like enda::parallel::parallel_for_each, but every task accumulates into its own copy of the result,
+     * initialized with `id` and stored on separate cache lines, by calling `f(acc, idxs...)`. The partial results are
+     * combined with `comb` in the order of the tasks. For static scheduling, the result is therefore deterministic for a
+     * fixed number of threads.
+     *
+     * @tparam StrideOrder Encoded stride order.
+     * @tparam T Result type.
+     * @tparam F Callable type.
+     * @tparam C Callable type of the combination.
+     * @tparam R Number of dimensions.
+     * @tparam Int Integer type used in the shape array.
+     * @param shape Shape to loop over (index bounds).
+     * @param id Identity element of the combination.
+     * @param f Callable object, must be callable as `f(T&, long, ..., long)` with `R` index arguments.
+     * @param comb Callable object combining two partial results.
+     * @param sched Scheduling of the chunks.
+     * @return Result of the reduction.
+     */
+    template<uint64_t StrideOrder = 0, typename T, typename F, typename C, auto R, std::integral Int = long>
+    T parallel_reduce_each(std::array<Int, R> const& shape, T const& id, F&& f, C&& comb, schedule const& sched = {})
+    { // NOLINT (we do not want to forward here)
+        auto const space   = detail::linear_index_space<StrideOrder, R>(shape);
+        long const size    = space.size();
+        long const n_tasks = detail::number_of_tasks(size, sched);
+        if (n_tasks <= 1)
+        {
+            T    acc = id;
+            auto g   = [&](auto... is) { f(acc, is...); };
+            space.for_range(0, size, g);
+            return acc;
+        }
+
+        std::vector<detail::padded<T>> partials(n_tasks, detail::padded<T> {id});
+        detail::schedule_chunks(size, sched, n_tasks, [&](long t, long b, long e) {
+            auto g = [&, &acc = partials[t].value](auto... is) { f(acc, is...); };
+            space.for_range(b, e, g);
+        });
+        T res = std::move(partials[0].value);
+        for (long t = 1; t < n_tasks; ++t)
+            res = comb(res, partials[t].value);
+        return res;
+    }
+
+} // namespace enda::parallel
+
+namespace enda
+{
+    // The parallel loops are also available directly in the enda namespace.
+    using parallel::parallel_for_each;
+    using parallel::parallel_reduce_each;
+
+} // namespace enda
@@ -0,0 +1,176 @@
+/**
+ * @file TaskGroup.hpp
+ *
+ * @brief Provides structured fork-join parallelism (task groups, parallel_invoke and parallel_for) on top of the
+ * enda::parallel::thread_pool.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <exception>
+#include <utility>
+
+#include "Parallel/ThreadPool.hpp"
+
+namespace enda::parallel
+{
+    /**
+     * @brief Group of tasks with a structured join.
+     *
+     * @details Tasks added with enda::parallel::task_group::run are executed by the threads of a
+     * enda::parallel::thread_pool (by default the global one). enda::parallel::task_group::wait blocks until all of them
+     * have finished and rethrows the first exception thrown by one of them. The waiting thread executes pending tasks in
+     * the meantime. Tasks may add further tasks to the same group or use their own groups (nested parallelism).
+     *
+     * The destructor waits for all tasks as well (exceptions are then discarded), i.e. no task outlives its group.
+     */
+    class task_group
+    {
+    public:
+        /// Construct a task group using the global thread pool.
+        task_group() : task_group(thread_pool::instance()) {}
+
+        /**
+         * @brief Construct a task group using a given thread pool.
+         * @param pool Thread pool.
+         */
+        explicit task_group(thread_pool& pool) noexcept : pool(pool) { jc.pool = &pool; }
+
+        task_group(task_group const&)            = delete;
+        task_group& operator=(task_group const&) = delete;
+
+        // Destructor waits for all tasks.
+        ~task_group()
+        {
+            pool.help_until([this]() { return jc.pending.load(std::memory_order_seq_cst) == 0; });
+        }
+
+        /**
+         * @brief Add a task to the group.
+         *
+         * @details If the pool has a single thread, the task is executed immediately.
+         *
+         * @tparam F Callable type.
+         * @param f Callable object taking no arguments (copied/moved into the task).
+         */
+        template<typename F>
+        void run(F&& f)
+        {
+            if (pool.size() == 1)
+            {
+                call(f);
+                return;
+            }
+            pool.spawn(std::forward<F>(f), jc);
+        }
+
+        /**
+         * @brief Execute a callable object on the calling thread and wait for all tasks of the group.
+         *
+         * @tparam F Callable type.
+         * @param f Callable object taking no arguments.
+         */
+        template<typename F>
+        void run_and_wait(F&& f)
+        { // NOLINT (we do not want to forward here)
+            call(f);
+            wait();
+        }
+
+        /// Wait for all tasks of the group and rethrow the first exception thrown by one of them.
+        void wait() { pool.wait(jc); }
+
+    private:
+        // Call f and store its exception in the join counter.
+        template<typename F>
+        void call(F& f)
+        {
+            try
+            {
+                f();
+            }
+            catch (...)
+            {
+                jc.set_error(std::current_exception());
+            }
+        }
+
+        thread_pool&         pool;
+        detail::join_counter jc;
+    };
+
+    /**
+     * @brief Execute callable objects in parallel and wait for all of them.
+     *
+     * @details All but the first callable object are spawned as tasks of a enda::parallel::task_group, the first one is
+     * executed by the calling thread. The first exception thrown by one of them is rethrown after all have finished.
+     *
+     * @tparam F0 Type of the first callable object.
+     * @tparam Fs Types of the other callable objects.
+     * @param f0 First callable object.
+     * @param fs Other callable objects.
+     */
+    template<typename F0, typename... Fs>
+    void parallel_invoke(F0&& f0, Fs&&... fs)
+    {
+        task_group g;
+        (g.run(std::forward<Fs>(fs)), ...);
+        g.run_and_wait(f0);
+    }
+
+    namespace detail
+    {
+        // Split [begin, end) recursively in halves, spawning the upper halves, until the ranges are not larger than grain.
+        template<typename F>
+        void parallel_for_split(task_group& g, long begin, long end, F const& f, long grain)
+        {
+            while (end - begin > grain)
+            {
+                long const mid = begin + (end - begin) / 2;
+                g.run([&g, &f, mid, end, grain]() { parallel_for_split(g, mid, end, f, grain); });
+                end = mid;
+            }
+            for (long i = begin; i < end; ++i)
+                f(i);
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Execute `f(i)` for all `i` in `[begin, end)` in parallel.
+     *
+     * @details The range is split recursively in halves (the upper halves are spawned as tasks, the lower halves are
+     * processed by the current thread) until the ranges contain at most `grain` indices. Idle threads steal the largest
+     * remaining ranges, which balances irregular work automatically. The first exception thrown by `f` is rethrown after
+     * all indices have been processed.
+     *
+     * @tparam F Callable type.
+     * @param begin First index.
+     * @param end One past the last index.
+     * @param f Callable object taking an index.
+     * @param grain Maximum number of indices processed sequentially by one task.
+     */
+    template<typename F>
+    void parallel_for(long begin, long end, F&& f, long grain = 1)
+    { // NOLINT (we do not want to forward here)
+        grain = std::max(1l, grain);
+        if (end - begin <= grain or thread_pool::instance().size() == 1)
+        {
+            for (long i = begin; i < end; ++i)
+                f(i);
+            return;
+        }
+        task_group g;
+        g.run_and_wait([&]() { detail::parallel_for_split(g, begin, end, f, grain); });
+    }
+
+} // namespace enda::parallel
+
+namespace enda
+{
+    // The fork-join helpers are also available directly in the enda namespace.
+    using parallel::parallel_for;
+    using parallel::parallel_invoke;
+
+} // namespace enda
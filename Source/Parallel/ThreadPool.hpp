@@ -0,0 +1,535 @@
+/**
+ * @file ThreadPool.hpp
+ *
+ * @brief Provides the work-stealing thread pool shared by all parallel array kernels.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+#include "Parallel/Deque.hpp"
+#include "Singleton.hpp"
+
+namespace enda::parallel
+{
+    class thread_pool;
+
+    namespace detail
+    {
+        // Is the current thread executing a task of a enda::parallel::thread_pool?
+        inline thread_local bool in_parallel_region = false;
+
+        // Default number of threads: ENDA_NUM_THREADS environment variable or the number of hardware threads.
+        inline int default_num_threads() noexcept
+        {
+            if (char const* env = std::getenv("ENDA_NUM_THREADS"))
+            {
+                const int n = std::atoi(env);
+                if (n > 0)
+                    return n;
+            }
+            return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        }
+
+        // Default thread affinity: pin the workers if the ENDA_PROC_BIND environment variable is "true" or "1".
+        inline bool default_proc_bind() noexcept
+        {
+            char const* env = std::getenv("ENDA_PROC_BIND");
+            return env != nullptr and (std::strcmp(env, "true") == 0 or std::strcmp(env, "1") == 0);
+        }
+
+        // Type erased unit of work, executed (and destroyed) by exec.
+        struct task
+        {
+            void (*exec)(task*) = nullptr;
+        };
+
+        // Number of unfinished tasks of a structured fork-join and the first exception thrown by one of them.
+        struct join_counter
+        {
+            // Pool executing the tasks.
+            thread_pool* pool = nullptr;
+
+            // Number of unfinished tasks.
+            std::atomic<long> pending {0};
+
+            // Set once the first exception has been stored.
+            std::atomic<bool> has_error {false};
+
+            // First exception thrown by a task.
+            std::exception_ptr error;
+
+            // Store the current exception if it is the first one.
+            void set_error(std::exception_ptr e) noexcept
+            {
+                if (!has_error.exchange(true, std::memory_order_relaxed))
+                    error = std::move(e);
+            }
+
+            // Mark one task as finished (defined below).
+            void finish_one() noexcept;
+        };
+
+        // Heap allocated task calling a callable object and signalling a join counter.
+        template<typename F>
+        struct callable_task : task
+        {
+            callable_task(F f_, join_counter* jc_) : task {&execute}, f(std::move(f_)), jc(jc_) {}
+
+            static void execute(task* t) noexcept
+            {
+                auto* self = static_cast<callable_task*>(t);
+                auto* jc   = self->jc;
+                try
+                {
+                    self->f();
+                }
+                catch (...)
+                {
+                    jc->set_error(std::current_exception());
+                }
+                delete self;
+                jc->finish_one();
+            }
+
+            F             f;
+            join_counter* jc;
+        };
+
+        // Worker thread of a enda::parallel::thread_pool.
+        struct worker_t
+        {
+            thread_pool*   pool = nullptr;
+            ws_deque<task> deque;
+            std::thread    thread;
+            uint64_t       rng = 0;
+        };
+
+        // Worker state of the current thread (nullptr for threads not owned by a pool).
+        inline thread_local worker_t* this_worker = nullptr;
+
+        // Pause instruction inside spin loops.
+        inline void cpu_relax() noexcept
+        {
+#if defined(__x86_64__) || defined(__i386__)
+            __builtin_ia32_pause();
+#elif defined(__aarch64__)
+            asm volatile("yield");
+#endif
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Work-stealing thread pool with a fixed number of threads.
+     *
+     * @details The pool consists of `size() - 1` worker threads and the calling thread, which takes part in the execution
+     * of the jobs it submits. Every worker owns a Chase-Lev deque (see enda::parallel::detail::ws_deque). Tasks spawned by
+     * a worker are pushed to its own deque and executed in LIFO order. Idle workers steal the oldest tasks of randomly
+     * chosen victims. Tasks spawned by other threads go through a shared injection queue. Workers without work spin
+     * briefly and then sleep until new tasks arrive.
+     *
+     * A thread waiting for its tasks to finish (see enda::parallel::thread_pool::run or enda::parallel::task_group)
+     * executes other pending tasks in the meantime. Nested parallelism is therefore handled by the same fixed set of
+     * threads without oversubscription.
+     *
+     * The global pool used by the array kernels is accessible via enda::parallel::thread_pool::instance().
+     */
+    class thread_pool : public enda::singleton<thread_pool>
+    {
+        friend class enda::singleton<thread_pool>;
+
+    public:
+        /**
+         * @brief Construct a thread pool with a given number of threads.
+         * @param n_threads Total number of threads (including the calling thread).
+         * @param pin Pin the worker threads to the hardware threads `1, 2, ...` (Linux only).
+         */
+        explicit thread_pool(int n_threads, bool pin = false) { start(n_threads, pin); }
+
+        thread_pool(thread_pool const&)            = delete;
+        thread_pool& operator=(thread_pool const&) = delete;
+
+        // Destructor joins all worker threads.
+        ~thread_pool() { stop(); }
+
+        /// Get the number of threads (including the calling thread).
+        [[nodiscard]] int size() const noexcept { return static_cast<int>(workers.size()) + 1; }
+
+        /// Check if the worker threads are pinned to hardware threads.
+        [[nodiscard]] bool pinned() const noexcept { return pin_threads; }
+
+        /**
+         * @brief Change the number of threads.
+         * @details Must not be called while tasks are running.
+         * @param n_threads Total number of threads (including the calling thread).
+         */
+        void resize(int n_threads)
+        {
+            stop();
+            start(n_threads, pin_threads);
+        }
+
+        /**
+         * @brief Pin the worker threads to hardware threads or release them.
+         *
+         * @details Worker `i` (starting at 1, the calling thread is 0) is pinned to the hardware thread `i` modulo the
+         * number of hardware threads. Only supported on Linux, elsewhere this is a no-op. Must not be called while tasks
+         * are running.
+         *
+         * @param pin True to pin the workers, false to let the OS schedule them freely.
+         */
+        void set_affinity(bool pin)
+        {
+            int const n = size();
+            stop();
+            start(n, pin);
+        }
+
+        /**
+         * @brief Execute `f(i)` for all `i` in `[0, n_tasks)` and wait for completion.
+         *
+         * @details The task indices are distributed dynamically among the calling thread and up to `size() - 1` helper
+         * tasks. If the pool has a single thread or if there is only one task, all tasks are executed sequentially by the
+         * calling thread. Calls from within a running task are allowed and share the threads of the pool. The first
+         * exception thrown by a task is rethrown after all tasks have finished.
+         *
+         * @tparam F Callable type.
+         * @param n_tasks Number of tasks.
+         * @param f Callable object taking the task index.
+         */
+        template<typename F>
+        void run(long n_tasks, F&& f)
+        { // NOLINT (we do not want to forward here)
+            if (n_tasks <= 0)
+                return;
+            if (n_tasks == 1 or workers.empty())
+            {
+                for (long i = 0; i < n_tasks; ++i)
+                    f(i);
+                return;
+            }
+
+            detail::join_counter jc;
+            std::atomic<long>    next {0};
+            auto                 drain = [&]() {
+                for (long i = next.fetch_add(1, std::memory_order_relaxed); i < n_tasks; i = next.fetch_add(1, std::memory_order_relaxed))
+                {
+                    try
+                    {
+                        f(i);
+                    }
+                    catch (...)
+                    {
+                        jc.set_error(std::current_exception());
+                    }
+                }
+            };
+
+            // helpers for the other threads, the calling thread participates
+            jc.pool              = this;
+            long const n_helpers = std::min<long>(n_tasks, size()) - 1;
+            try
+            {
+                for (long h = 0; h < n_helpers; ++h)
+                    spawn(drain, jc);
+            }
+            catch (...)
+            {
+                // the tasks spawned so far refer to jc and drain: finish them before rethrowing
+                jc.set_error(std::current_exception());
+            }
+            {
+                const bool was_in_region   = detail::in_parallel_region;
+                detail::in_parallel_region = true;
+                drain();
+                detail::in_parallel_region = was_in_region;
+            }
+            wait(jc);
+        }
+
+        /**
+         * @brief Spawn a task executing a callable object.
+         *
+         * @details The task is pushed to the deque of the current worker or, for threads not belonging to the pool, to
+         * the injection queue. The pending count of the join counter is incremented before the task becomes visible.
+         *
+         * @tparam F Callable type.
+         * @param f Callable object (copied/moved into the task).
+         * @param jc Join counter signalled when the task has finished.
+         */
+        template<typename F>
+        void spawn(F&& f, detail::join_counter& jc)
+        {
+            jc.pending.fetch_add(1, std::memory_order_relaxed);
+            push(new detail::callable_task<std::decay_t<F>>(std::forward<F>(f), &jc));
+        }
+
+        /**
+         * @brief Wait until all tasks of a join counter have finished, executing other tasks in the meantime.
+         * @details Rethrows the first exception thrown by one of the tasks.
+         * @param jc Join counter.
+         */
+        void wait(detail::join_counter& jc)
+        {
+            help_until([&jc]() { return jc.pending.load(std::memory_order_seq_cst) == 0; });
+            if (jc.error)
+                std::rethrow_exception(std::exchange(jc.error, nullptr));
+        }
+
+        /**
+         * @brief Execute pending tasks until a condition is true.
+         *
+         * @details The thread first tries its own deque, then the injection queue, then other workers. If no task is found
+         * for a while, it sleeps until new tasks are spawned or a join counter of the pool reaches zero.
+         *
+         * @tparam P Callable type.
+         * @param done Callable object returning true when the thread should stop.
+         */
+        template<typename P>
+        void help_until(P const& done)
+        {
+            const bool was_in_region   = detail::in_parallel_region;
+            detail::in_parallel_region = true;
+            int idle                   = 0;
+            while (!done())
+            {
+                if (try_execute_one())
+                {
+                    idle = 0;
+                    continue;
+                }
+                if (++idle < 64)
+                {
+                    detail::cpu_relax();
+                    continue;
+                }
+                if (idle < 128)
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                // no work found: sleep until something changes (the epoch is read before the final check)
+                const uint64_t e0 = epoch.load(std::memory_order_seq_cst);
+                if (try_execute_one())
+                {
+                    idle = 0;
+                    continue;
+                }
+                std::unique_lock lock(sleep_mtx);
+                n_sleeping.fetch_add(1, std::memory_order_seq_cst);
+                cv.wait(lock, [&]() { return done() or epoch.load(std::memory_order_seq_cst) != e0; });
+                n_sleeping.fetch_sub(1, std::memory_order_relaxed);
+                idle = 0;
+            }
+            detail::in_parallel_region = was_in_region;
+        }
+
+        // Wake up sleeping threads (after a join counter reached zero or new tasks were spawned).
+        void notify(bool all) noexcept
+        {
+            if (n_sleeping.load(std::memory_order_seq_cst) > 0)
+            {
+                std::lock_guard lock(sleep_mtx);
+                if (all)
+                    cv.notify_all();
+                else
+                    cv.notify_one();
+            }
+        }
+
+    private:
+        // Default constructor used by the singleton: uses enda::parallel::detail::default_num_threads and
+        // enda::parallel::detail::default_proc_bind. The global pool is created on first use inside noexcept functions
+        // (e.g. enda::parallel::use_parallel), so if the worker threads cannot be started, it does not throw but runs all
+        // tasks on the calling thread.
+        thread_pool()
+        {
+            try
+            {
+                start(detail::default_num_threads(), detail::default_proc_bind());
+            }
+            catch (...)
+            {
+                stopping.store(false, std::memory_order_relaxed);
+            }
+        }
+
+        // Spawn the worker threads.
+        void start(int n_threads, bool pin)
+        {
+            pin_threads = pin;
+            stopping.store(false, std::memory_order_relaxed);
+            for (int t = 1; t < n_threads; ++t)
+            {
+                auto w  = std::make_unique<detail::worker_t>();
+                w->pool = this;
+                w->rng  = 0x9E3779B97F4A7C15ull * static_cast<uint64_t>(t);
+                workers.push_back(std::move(w));
+            }
+            int const n_hw = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+            try
+            {
+                for (int t = 1; t < n_threads; ++t)
+                {
+                    auto* w   = workers[t - 1].get();
+                    w->thread = std::thread([this, w]() { worker_loop(w); });
+#if defined(__linux__)
+                    if (pin)
+                    {
+                        cpu_set_t set;
+                        CPU_ZERO(&set);
+                        CPU_SET(t % n_hw, &set);
+                        pthread_setaffinity_np(w->thread.native_handle(), sizeof(cpu_set_t), &set);
+                    }
+#else
+                    (void)n_hw;
+#endif
+                }
+            }
+            catch (...)
+            {
+                // join the threads started so far and leave the pool without workers
+                stop();
+                throw;
+            }
+        }
+
+        // Join the worker threads.
+        void stop()
+        {
+            stopping.store(true, std::memory_order_seq_cst);
+            epoch.fetch_add(1, std::memory_order_seq_cst);
+            {
+                std::lock_guard lock(sleep_mtx);
+                cv.notify_all();
+            }
+            for (auto& w : workers)
+                if (w->thread.joinable())
+                    w->thread.join();
+            workers.clear();
+        }
+
+        // Main loop of a worker thread.
+        void worker_loop(detail::worker_t* w)
+        {
+            detail::this_worker = w;
+            help_until([this]() { return stopping.load(std::memory_order_relaxed); });
+            detail::this_worker = nullptr;
+        }
+
+        // Make a task available to the other threads.
+        void push(detail::task* t)
+        {
+            if (detail::this_worker != nullptr and detail::this_worker->pool == this)
+            {
+                detail::this_worker->deque.push(t);
+            }
+            else
+            {
+                std::lock_guard lock(inject_mtx);
+                injected.push_back(t);
+                n_injected.fetch_add(1, std::memory_order_release);
+            }
+            epoch.fetch_add(1, std::memory_order_seq_cst);
+            notify(false);
+        }
+
+        // Take a task from the injection queue.
+        detail::task* pop_injected()
+        {
+            if (n_injected.load(std::memory_order_acquire) == 0)
+                return nullptr;
+            std::lock_guard lock(inject_mtx);
+            if (injected.empty())
+                return nullptr;
+            auto* t = injected.front();
+            injected.pop_front();
+            n_injected.fetch_sub(1, std::memory_order_relaxed);
+            return t;
+        }
+
+        // Steal a task from a randomly chosen worker.
+        detail::task* steal(detail::worker_t* self)
+        {
+            auto const n = static_cast<uint64_t>(workers.size());
+            uint64_t   r = 0;
+            if (self != nullptr)
+            {
+                // xorshift
+                self->rng ^= self->rng << 13;
+                self->rng ^= self->rng >> 7;
+                self->rng ^= self->rng << 17;
+                r = self->rng;
+            }
+            else
+            {
+                r = steal_hint.fetch_add(1, std::memory_order_relaxed);
+            }
+            for (uint64_t k = 0; k < n; ++k)
+            {
+                auto* v = workers[(r + k) % n].get();
+                if (v == self)
+                    continue;
+                if (auto* t = v->deque.steal())
+                    return t;
+            }
+            return nullptr;
+        }
+
+        // Find and execute one task. Returns false if none was found.
+        bool try_execute_one()
+        {
+            detail::worker_t* self = (detail::this_worker != nullptr and detail::this_worker->pool == this ? detail::this_worker : nullptr);
+            detail::task*     t    = (self != nullptr ? self->deque.pop() : nullptr);
+            if (t == nullptr)
+                t = pop_injected();
+            if (t == nullptr)
+                t = steal(self);
+            if (t == nullptr)
+                return false;
+            t->exec(t);
+            return true;
+        }
+
+        std::vector<std::unique_ptr<detail::worker_t>> workers;
+        std::mutex                                     inject_mtx;
+        std::deque<detail::task*>                      injected;
+        std::atomic<long>                              n_injected {0};
+        std::atomic<uint64_t>                          steal_hint {0};
+        std::mutex                                     sleep_mtx;
+        std::condition_variable                        cv;
+        std::atomic<uint64_t>                          epoch {0};
+        std::atomic<int>                               n_sleeping {0};
+        std::atomic<bool>                              stopping {false};
+        bool                                           pin_threads = false;
+    };
+
+    inline void detail::join_counter::finish_one() noexcept
+    {
+        thread_pool* p = pool;
+        if (pending.fetch_sub(1, std::memory_order_seq_cst) == 1)
+            p->notify(true);
+    }
+
+} // namespace enda::parallel
@@ -84,6 +84,9 @@ namespace enda
     template<char OP, ArrayOrScalar L, ArrayOrScalar R>
     struct expr;
 
+    template<Array L, Array R>
+    struct expr_matmul;
+
     template<char OP, Array A>
     std::ostream& operator<<(std::ostream& sout, expr_unary<OP, A> const& ex)
     {
@@ -96,6 +99,12 @@ namespace enda
         return sout << "(" << ex.l << " " << OP << " " << ex.r << ")";
     }
 
+    template<Array L, Array R>
+    std::ostream& operator<<(std::ostream& sout, expr_matmul<L, R> const& ex)
+    {
+        return sout << "(" << ex.l << " * " << ex.r << ")";
+    }
+
     template<typename F, typename... As>
     std::ostream& operator<<(std::ostream& sout, expr_call<F, As...> const&)
     {
@@ -0,0 +1,891 @@
+/**
+ * @file Sparse.hpp
+ *
+ * @brief Provides sparse matrices in coordinate (COO) and compressed row/column (CSR/CSC) formats and their products with
+ * dense vectors and matrices.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "BasicArray.hpp"
+#include "BasicFunctions.hpp"
+#include "Concepts.hpp"
+#include "Declarations.hpp"
+#include "Layout/Range.hpp"
+#include "Macros.hpp"
+#include "Mem/AddressSpace.hpp"
+#include "Parallel/Execution.hpp"
+#include "Traits.hpp"
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+    #include <immintrin.h>
+#endif
+
+namespace enda
+{
+    /**
+     * @brief Sparse matrix in coordinate (COO) format, i.e. a list of `(row, column, value)` triplets.
+     *
+     * @details The triplets are stored in the order in which they are added and duplicates are allowed (their values are
+     * summed). It is mainly meant to assemble a matrix which is then converted to an enda::compressed_matrix for
+     * products, but products with COO matrices are supported as well.
+     *
+     * @tparam T Value type.
+     */
+    template<typename T>
+    class coo_matrix
+    {
+        // Number of rows and columns.
+        long nr = 0;
+        long nc = 0;
+
+        // Row indices, column indices and values of the triplets.
+        std::vector<long> ri;
+        std::vector<long> ci;
+        std::vector<T> v;
+
+    public:
+        /// Value type.
+        using value_type = T;
+
+        /// Default constructor creates an empty 0 x 0 matrix.
+        coo_matrix() = default;
+
+        /**
+         * @brief Construct an empty matrix (no triplets) of a given shape.
+         *
+         * @param nrows Number of rows.
+         * @param ncols Number of columns.
+         */
+        coo_matrix(long nrows, long ncols) : nr(nrows), nc(ncols) { EXPECTS(nrows >= 0 and ncols >= 0); }
+
+        /**
+         * @brief Construct a matrix from triplets.
+         *
+         * @param nrows Number of rows.
+         * @param ncols Number of columns.
+         * @param rows Row indices.
+         * @param cols Column indices.
+         * @param vals Values.
+         */
+        coo_matrix(long nrows, long ncols, std::vector<long> rows, std::vector<long> cols, std::vector<T> vals)
+            : nr(nrows), nc(ncols), ri(std::move(rows)), ci(std::move(cols)), v(std::move(vals))
+        {
+            EXPECTS(ri.size() == v.size() and ci.size() == v.size());
+#ifndef NDEBUG
+            for (size_t k = 0; k < v.size(); ++k)
+                EXPECTS(ri[k] >= 0 and ri[k] < nr and ci[k] >= 0 and ci[k] < nc);
+#endif
+        }
+
+        /**
+         * @brief Construct a matrix from the non-zero elements of a dense matrix/view (in C-order).
+         *
+         * @tparam A enda::ArrayOfRank<2> type.
+         * @param a Dense matrix/view.
+         */
+        template<ArrayOfRank<2> A>
+        explicit coo_matrix(A const& a) : nr(a.shape()[0]), nc(a.shape()[1])
+        {
+            for (long i = 0; i < nr; ++i)
+                for (long j = 0; j < nc; ++j)
+                    if (auto const x = a(i, j); x != T {})
+                        push_back(i, j, x);
+        }
+
+        /**
+         * @brief Reserve memory for a given number of triplets.
+         * @param n Number of triplets.
+         */
+        void reserve(long n)
+        {
+            ri.reserve(n);
+            ci.reserve(n);
+            v.reserve(n);
+        }
+
+        /**
+         * @brief Add a triplet.
+         *
+         * @param i Row index.
+         * @param j Column index.
+         * @param x Value (added to previous values at the same position).
+         */
+        void push_back(long i, long j, T const& x)
+        {
+            EXPECTS(i >= 0 and i < nr and j >= 0 and j < nc);
+            ri.push_back(i);
+            ci.push_back(j);
+            v.push_back(x);
+        }
+
+        /// Remove all triplets (keeps the shape).
+        void clear() noexcept
+        {
+            ri.clear();
+            ci.clear();
+            v.clear();
+        }
+
+        /// Get the shape of the matrix.
+        [[nodiscard]] std::array<long, 2> shape() const noexcept { return {nr, nc}; }
+
+        /**
+         * @brief Get the extent of a dimension.
+         *
+         * @param i Dimension (0 or 1).
+         * @return Number of rows or columns.
+         */
+        [[nodiscard]] long extent(int i) const noexcept { return (i == 0 ? nr : nc); }
+
+        /// Get the number of stored triplets (duplicates included).
+        [[nodiscard]] long nnz() const noexcept { return static_cast<long>(v.size()); }
+
+        /// Get the row indices of the triplets.
+        [[nodiscard]] std::span<long const> row_indices() const noexcept { return ri; }
+
+        /// Get the column indices of the triplets.
+        [[nodiscard]] std::span<long const> col_indices() const noexcept { return ci; }
+
+        /// Get the values of the triplets.
+        [[nodiscard]] std::span<T const> values() const noexcept { return v; }
+
+        /// Get the values of the triplets (mutable version).
+        [[nodiscard]] std::span<T> values() noexcept { return v; }
+
+        /// Get a dense matrix with the same elements.
+        [[nodiscard]] matrix<T> to_dense() const
+        {
+            auto res = matrix<T>::zeros(nr, nc);
+            for (long k = 0; k < nnz(); ++k)
+                res(ri[k], ci[k]) += v[k];
+            return res;
+        }
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief Compress triplets into the outer pointers, inner indices and values of an enda::compressed_matrix.
+         *
+         * @details A counting sort by the outer index distributes the triplets into their slices in `O(nnz + n_outer)`.
+         * Each slice is then stably sorted by the inner index (unless it already is, e.g. for triplets generated slice by
+         * slice) and duplicates are summed in place. Sorting the short slices separately keeps the working set in cache,
+         * unlike a second global pass over the triplets.
+         */
+        template<typename T>
+        void compress_triplets(long n_outer,
+                               std::span<long const> outer,
+                               std::span<long const> inner,
+                               std::span<T const> vals,
+                               array<long, 1>& ptr,
+                               array<long, 1>& idx,
+                               array<T, 1>& val)
+        {
+            long const nnz = static_cast<long>(vals.size());
+
+            // counting sort by the outer index
+            ptr = zeros<long>(n_outer + 1);
+            for (long k = 0; k < nnz; ++k)
+                ++ptr(outer[k] + 1);
+            for (long o = 0; o < n_outer; ++o)
+                ptr(o + 1) += ptr(o);
+            std::vector<long> pos(ptr.begin(), ptr.end() - 1);
+            idx = array<long, 1>(nnz);
+            val = array<T, 1>(nnz);
+            for (long k = 0; k < nnz; ++k)
+            {
+                long const p = pos[outer[k]]++;
+                idx(p)       = inner[k];
+                val(p)       = vals[k];
+            }
+
+            // stable sort of each slice by the inner index
+            std::vector<std::pair<long, T>> tmp;
+            for (long o = 0; o < n_outer; ++o)
+            {
+                long* const ib = idx.data() + ptr(o);
+                T* const vb    = val.data() + ptr(o);
+                long const n   = ptr(o + 1) - ptr(o);
+                if (std::is_sorted(ib, ib + n)) continue;
+                if (n <= 32)
+                {
+                    // insertion sort
+                    for (long p = 1; p < n; ++p)
+                    {
+                        long const i = ib[p];
+                        T const v    = vb[p];
+                        long q       = p;
+                        for (; q > 0 and ib[q - 1] > i; --q)
+                        {
+                            ib[q] = ib[q - 1];
+                            vb[q] = vb[q - 1];
+                        }
+                        ib[q] = i;
+                        vb[q] = v;
+                    }
+                }
+                else
+                {
+                    tmp.resize(n);
+                    for (long p = 0; p < n; ++p)
+                        tmp[p] = {ib[p], vb[p]};
+                    std::ranges::stable_sort(tmp, std::less<> {}, [](auto const& x) { return x.first; });
+                    for (long p = 0; p < n; ++p)
+                        std::tie(ib[p], vb[p]) = tmp[p];
+                }
+            }
+
+            // sum duplicates
+            long w = 0;
+            for (long o = 0; o < n_outer; ++o)
+            {
+                long const b = ptr(o), e = ptr(o + 1);
+                ptr(o)       = w;
+                for (long p = b; p < e; ++p)
+                {
+                    if (w > ptr(o) and idx(w - 1) == idx(p))
+                    {
+                        val(w - 1) += val(p);
+                    }
+                    else
+                    {
+                        idx(w) = idx(p);
+                        val(w) = val(p);
+                        ++w;
+                    }
+                }
+            }
+            ptr(n_outer) = w;
+            if (w < nnz)
+            {
+                idx = array<long, 1>(idx(range(0, w)));
+                val = array<T, 1>(val(range(0, w)));
+            }
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Sparse matrix in compressed sparse row (CSR) or compressed sparse column (CSC) format.
+     *
+     * @details For a CSR matrix (`Major == 'R'`), the rows are the outer and the columns the inner dimension, for a CSC
+     * matrix (`Major == 'C'`) it is the other way around. The non-zero elements of the outer slice `o` are stored in
+     * `values()(range(p[o], p[o + 1]))` where `p = outer_ptr()`, their inner indices in the same range of
+     * `inner_indices()`. Within each slice, the inner indices are sorted and unique.
+     *
+     * The index and value arrays are enda::array objects, i.e. they can be viewed and passed around like any other array.
+     * The sparsity structure is fixed after construction but the values can be modified (see values()).
+     *
+     * Products with dense vectors and matrices are provided by enda::linalg::spmv and enda::linalg::spmm. Products with
+     * CSR matrices are parallelized over the rows, balanced by their number of non-zeros.
+     *
+     * @tparam T Value type.
+     * @tparam Major 'R' for CSR and 'C' for CSC.
+     */
+    template<typename T, char Major = 'R'>
+    class compressed_matrix
+    {
+        static_assert(Major == 'R' or Major == 'C', "Error in enda::compressed_matrix: Major must be 'R' or 'C'");
+
+        template<typename U, char M>
+        friend class compressed_matrix;
+
+        // Number of rows and columns.
+        long nr = 0;
+        long nc = 0;
+
+        // Outer pointers (size outer_size() + 1).
+        array<long, 1> ptr = zeros<long>(1);
+
+        // Inner indices of the non-zero elements.
+        array<long, 1> idx = array<long, 1>(0);
+
+        // Values of the non-zero elements.
+        array<T, 1> val = array<T, 1>(0);
+
+        // Number of outer and inner slices.
+        [[nodiscard]] long n_outer() const noexcept { return (Major == 'R' ? nr : nc); }
+        [[nodiscard]] long n_inner() const noexcept { return (Major == 'R' ? nc : nr); }
+
+        // Build the matrix from triplets.
+        void assign_triplets(std::span<long const> rows, std::span<long const> cols, std::span<T const> vals)
+        {
+            if constexpr (Major == 'R')
+                detail::compress_triplets<T>(nr, rows, cols, vals, ptr, idx, val);
+            else
+                detail::compress_triplets<T>(nc, cols, rows, vals, ptr, idx, val);
+        }
+
+    public:
+        /// Value type.
+        using value_type = T;
+
+        /// Is it a CSR matrix?
+        static constexpr bool is_row_major = (Major == 'R');
+
+        /// Default constructor creates an empty 0 x 0 matrix.
+        compressed_matrix() = default;
+
+        /**
+         * @brief Construct a matrix of a given shape without non-zero elements.
+         *
+         * @param nrows Number of rows.
+         * @param ncols Number of columns.
+         */
+        compressed_matrix(long nrows, long ncols) : nr(nrows), nc(ncols), ptr(zeros<long>(n_outer() + 1)) { EXPECTS(nrows >= 0 and ncols >= 0); }
+
+        /**
+         * @brief Construct a matrix from its compressed representation.
+         *
+         * @details The inner indices of each outer slice must be sorted and unique.
+         *
+         * @param nrows Number of rows.
+         * @param ncols Number of columns.
+         * @param outer_ptr Outer pointers (size `nrows + 1` for CSR and `ncols + 1` for CSC).
+         * @param inner_idx Inner indices of the non-zero elements.
+         * @param values Values of the non-zero elements.
+         */
+        compressed_matrix(long nrows, long ncols, array<long, 1> outer_ptr, array<long, 1> inner_idx, array<T, 1> values)
+            : nr(nrows), nc(ncols), ptr(std::move(outer_ptr)), idx(std::move(inner_idx)), val(std::move(values))
+        {
+            EXPECTS(ptr.size() == n_outer() + 1 and ptr(0) == 0 and ptr(n_outer()) == val.size() and idx.size() == val.size());
+#ifndef NDEBUG
+            for (long o = 0; o < n_outer(); ++o)
+            {
+                EXPECTS(ptr(o) <= ptr(o + 1));
+                for (long p = ptr(o); p < ptr(o + 1); ++p)
+                    EXPECTS(idx(p) >= 0 and idx(p) < n_inner() and (p == ptr(o) or idx(p - 1) < idx(p)));
+            }
+#endif
+        }
+
+        /**
+         * @brief Construct a matrix from a COO matrix (duplicates are summed).
+         * @param coo enda::coo_matrix object.
+         */
+        explicit compressed_matrix(coo_matrix<T> const& coo) : nr(coo.extent(0)), nc(coo.extent(1))
+        {
+            assign_triplets(coo.row_indices(), coo.col_indices(), coo.values());
+        }
+
+        /**
+         * @brief Construct a matrix from the non-zero elements of a dense matrix/view.
+         *
+         * @tparam A enda::ArrayOfRank<2> type.
+         * @param a Dense matrix/view.
+         */
+        template<ArrayOfRank<2> A>
+        explicit compressed_matrix(A const& a) : nr(a.shape()[0]), nc(a.shape()[1])
+        {
+            std::vector<long> ps(1, 0), is;
+            std::vector<T> vs;
+            for (long o = 0; o < n_outer(); ++o)
+            {
+                for (long i = 0; i < n_inner(); ++i)
+                {
+                    auto const x = (Major == 'R' ? a(o, i) : a(i, o));
+                    if (x != T {})
+                    {
+                        is.push_back(i);
+                        vs.push_back(x);
+                    }
+                }
+                ps.push_back(static_cast<long>(vs.size()));
+            }
+            ptr = array<long, 1>(std::array<long, 1> {n_outer() + 1});
+            std::copy(ps.begin(), ps.end(), ptr.begin());
+            idx = array<long, 1>(std::array<long, 1> {static_cast<long>(is.size())});
+            std::copy(is.begin(), is.end(), idx.begin());
+            val = array<T, 1>(std::array<long, 1> {static_cast<long>(vs.size())});
+            std::copy(vs.begin(), vs.end(), val.begin());
+        }
+
+        /**
+         * @brief Convert between CSR and CSC.
+         *
+         * @tparam M Major of the other matrix.
+         * @param m enda::compressed_matrix in the other format.
+         */
+        template<char M>
+            requires(M != Major)
+        explicit compressed_matrix(compressed_matrix<T, M> const& m) : nr(m.nr), nc(m.nc)
+        {
+            // expand the outer pointers of m, its outer indices are our inner indices and vice versa
+            std::vector<long> outer_of_m(m.nnz());
+            for (long o = 0; o < m.n_outer(); ++o)
+                std::fill(outer_of_m.begin() + m.ptr(o), outer_of_m.begin() + m.ptr(o + 1), o);
+            detail::compress_triplets<T>(n_outer(),
+                                         std::span<long const>(m.idx.data(), m.nnz()),
+                                         outer_of_m,
+                                         std::span<T const>(m.val.data(), m.nnz()),
+                                         ptr,
+                                         idx,
+                                         val);
+        }
+
+        /// Get the shape of the matrix.
+        [[nodiscard]] std::array<long, 2> shape() const noexcept { return {nr, nc}; }
+
+        /**
+         * @brief Get the extent of a dimension.
+         *
+         * @param i Dimension (0 or 1).
+         * @return Number of rows or columns.
+         */
+        [[nodiscard]] long extent(int i) const noexcept { return (i == 0 ? nr : nc); }
+
+        /// Get the number of outer slices (rows for CSR and columns for CSC).
+        [[nodiscard]] long outer_size() const noexcept { return n_outer(); }
+
+        /// Get the number of stored non-zero elements.
+        [[nodiscard]] long nnz() const noexcept { return val.size(); }
+
+        /// Get a view of the outer pointers.
+        [[nodiscard]] auto outer_ptr() const noexcept { return ptr(); }
+
+        /// Get a view of the inner indices of the non-zero elements.
+        [[nodiscard]] auto inner_indices() const noexcept { return idx(); }
+
+        /// Get a view of the values of the non-zero elements.
+        [[nodiscard]] auto values() const noexcept { return val(); }
+
+        /// Get a view of the values of the non-zero elements (mutable version).
+        [[nodiscard]] auto values() noexcept { return val(); }
+
+        /**
+         * @brief Get an element of the matrix (binary search in its outer slice).
+         *
+         * @param i Row index.
+         * @param j Column index.
+         * @return Value of the element (zero if it is not stored).
+         */
+        [[nodiscard]] T operator()(long i, long j) const
+        {
+            EXPECTS(i >= 0 and i < nr and j >= 0 and j < nc);
+            long const o = (Major == 'R' ? i : j), in = (Major == 'R' ? j : i);
+            auto const* b  = idx.data() + ptr(o);
+            auto const* e  = idx.data() + ptr(o + 1);
+            auto const* it = std::lower_bound(b, e, in);
+            return (it != e and *it == in ? val(it - idx.data()) : T {});
+        }
+
+        /**
+         * @brief Get the transpose of the matrix.
+         * @details The CSR representation of a matrix is the CSC representation of its transpose and vice versa, i.e. the
+         * arrays are simply copied.
+         * @return enda::compressed_matrix in the other format.
+         */
+        [[nodiscard]] compressed_matrix<T, (Major == 'R' ? 'C' : 'R')> transpose() const { return {nc, nr, ptr, idx, val}; }
+
+        /// Get a dense matrix with the same elements.
+        [[nodiscard]] matrix<T> to_dense() const
+        {
+            auto res = matrix<T>::zeros(nr, nc);
+            for (long o = 0; o < n_outer(); ++o)
+                for (long p = ptr(o); p < ptr(o + 1); ++p)
+                {
+                    if constexpr (Major == 'R')
+                        res(o, idx(p)) = val(p);
+                    else
+                        res(idx(p), o) = val(p);
+                }
+            return res;
+        }
+
+        /// Get a COO matrix with the same elements.
+        [[nodiscard]] coo_matrix<T> to_coo() const
+        {
+            auto res = coo_matrix<T>(nr, nc);
+            res.reserve(nnz());
+            for (long o = 0; o < n_outer(); ++o)
+                for (long p = ptr(o); p < ptr(o + 1); ++p)
+                {
+                    if constexpr (Major == 'R')
+                        res.push_back(o, idx(p), val(p));
+                    else
+                        res.push_back(idx(p), o, val(p));
+                }
+            return res;
+        }
+    };
+
+    /**
+     * @brief Alias template of an enda::compressed_matrix in CSR format.
+     * @tparam T Value type.
+     */
+    template<typename T>
+    using csr_matrix = compressed_matrix<T, 'R'>;
+
+    /**
+     * @brief Alias template of an enda::compressed_matrix in CSC format.
+     * @tparam T Value type.
+     */
+    template<typename T>
+    using csc_matrix = compressed_matrix<T, 'C'>;
+
+    /**
+     * @brief Constexpr variable that is true if the type is an enda::coo_matrix or an enda::compressed_matrix.
+     * @tparam S Type to check.
+     */
+    template<typename S>
+    inline constexpr bool is_sparse_matrix_v = false;
+
+    // Specialization of enda::is_sparse_matrix_v for enda::coo_matrix.
+    template<typename T>
+    inline constexpr bool is_sparse_matrix_v<coo_matrix<T>> = true;
+
+    // Specialization of enda::is_sparse_matrix_v for enda::compressed_matrix.
+    template<typename T, char Major>
+    inline constexpr bool is_sparse_matrix_v<compressed_matrix<T, Major>> = true;
+
+} // namespace enda
+
+namespace enda::linalg
+{
+    namespace detail
+    {
+        // Is the type a dense operand with value type T for a sparse product (host memory, arbitrary strides)?
+        template<typename A, typename T, int R>
+        inline constexpr bool is_sparse_operand_v = MemoryArrayOfRank<A, R> and mem::on_host<A> and std::is_same_v<std::remove_const_t<get_value_t<A>>, T>;
+
+        // Run a kernel on chunks [o0, o1) of the outer slices of a compressed matrix. If the product is large enough to
+        // run in parallel, the chunks are chosen such that each one has (nearly) the same number of non-zeros plus
+        // outer slices, i.e. the same amount of work, and outer slices are never split.
+        template<typename F>
+        void for_nnz_balanced_chunks(long n_outer, long const* ptr, long work, F&& f)
+        { // NOLINT (we do not want to forward here)
+            auto& pool          = parallel::thread_pool::instance();
+            long const n_chunks = std::min<long>(pool.size(), n_outer);
+            if (!parallel::use_parallel(work) or n_chunks <= 1)
+            {
+                f(0l, n_outer);
+                return;
+            }
+            long const total = ptr[n_outer] + n_outer;
+            auto const outer = std::views::iota(0l, n_outer);
+            std::vector<long> bounds(n_chunks + 1, n_outer);
+            bounds[0] = 0;
+            for (long c = 1; c < n_chunks; ++c)
+            {
+                long const target = c * total / n_chunks;
+                auto const it     = std::ranges::partition_point(outer, [&](long o) { return ptr[o] + o < target; });
+                bounds[c]         = (it == outer.end() ? n_outer : *it);
+            }
+            pool.run(n_chunks, [&](long c) { f(bounds[c], bounds[c + 1]); });
+        }
+
+        // Sparse dot product sum_k val[k] * x[idx[k] * incx] for k < n.
+        template<typename T>
+        T sparse_dot(T const* RESTRICT val, long const* RESTRICT idx, T const* RESTRICT x, long incx, long n)
+        {
+            long k = 0;
+            T res  = T {0};
+#if defined(__AVX512F__) || defined(__AVX2__)
+            if constexpr (std::is_same_v<T, double> and sizeof(long) == 8)
+            {
+                if (incx == 1)
+                {
+    #if defined(__AVX512F__)
+                    __m512d acc = _mm512_setzero_pd();
+                    for (; k + 8 <= n; k += 8)
+                        acc = _mm512_fmadd_pd(_mm512_loadu_pd(val + k), _mm512_i64gather_pd(_mm512_loadu_si512(idx + k), x, 8), acc);
+                    if (k < n)
+                    {
+                        // masked tail
+                        auto const m     = static_cast<__mmask8>((1u << (n - k)) - 1);
+                        __m512i const iv = _mm512_maskz_loadu_epi64(m, idx + k);
+                        acc = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(m, val + k), _mm512_mask_i64gather_pd(_mm512_setzero_pd(), m, iv, x, 8), acc);
+                    }
+                    return _mm512_reduce_add_pd(acc);
+    #else
+                    __m256d acc = _mm256_setzero_pd();
+                    for (; k + 4 <= n; k += 4)
+                    {
+                        __m256d const xv = _mm256_i64gather_pd(x, _mm256_loadu_si256(reinterpret_cast<__m256i const*>(idx + k)), 8);
+        #if defined(__FMA__)
+                        acc = _mm256_fmadd_pd(_mm256_loadu_pd(val + k), xv, acc);
+        #else
+                        acc = _mm256_add_pd(acc, _mm256_mul_pd(_mm256_loadu_pd(val + k), xv));
+        #endif
+                    }
+                    __m128d const s = _mm_add_pd(_mm256_castpd256_pd128(acc), _mm256_extractf128_pd(acc, 1));
+                    res             = _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+    #endif
+                }
+            }
+#endif
+            // independent accumulators to hide the latency of the additions
+            T r1 = T {0}, r2 = T {0}, r3 = T {0};
+            for (; k + 4 <= n; k += 4)
+            {
+                res += val[k] * x[idx[k] * incx];
+                r1 += val[k + 1] * x[idx[k + 1] * incx];
+                r2 += val[k + 2] * x[idx[k + 2] * incx];
+                r3 += val[k + 3] * x[idx[k + 3] * incx];
+            }
+            for (; k < n; ++k)
+                res += val[k] * x[idx[k] * incx];
+            return (res + r1) + (r2 + r3);
+        }
+
+        // y[i * incy] = alpha * (A x)_i + beta * y[i * incy] for the rows [r0, r1) of a CSR matrix.
+        template<typename T>
+        void csr_spmv_rows(long r0, long r1, T alpha, long const* ptr, long const* idx, T const* val, T const* x, long incx, T beta, T* y, long incy)
+        {
+            for (long i = r0; i < r1; ++i)
+            {
+                T const s = alpha * sparse_dot(val + ptr[i], idx + ptr[i], x, incx, ptr[i + 1] - ptr[i]);
+                y[i * incy] = (beta == T {0} ? s : s + beta * y[i * incy]);
+            }
+        }
+
+        // y = beta * y (without reading y if beta == 0).
+        template<typename T>
+        void scale_vector(T beta, T* y, long incy, long n)
+        {
+            for (long i = 0; i < n; ++i)
+                y[i * incy] = (beta == T {0} ? T {0} : beta * y[i * incy]);
+        }
+
+        // C(i, :) = alpha * (A B)(i, :) + beta * C(i, :) for the rows [r0, r1) of a CSR matrix A and matrices B and C with
+        // unit column strides. The rows of B are added to the row of C with contiguous axpy operations.
+        template<typename T>
+        void csr_spmm_rows(long r0, long r1, long n, T alpha, long const* ptr, long const* idx, T const* val, T const* b, long bs0, T beta, T* c, long cs0)
+        {
+            for (long i = r0; i < r1; ++i)
+            {
+                T* RESTRICT ci = c + i * cs0;
+                scale_vector(beta, ci, 1, n);
+                for (long p = ptr[i]; p < ptr[i + 1]; ++p)
+                {
+                    T const a             = alpha * val[p];
+                    T const* RESTRICT bk = b + idx[p] * bs0;
+                    for (long j = 0; j < n; ++j)
+                        ci[j] += a * bk[j];
+                }
+            }
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Sparse matrix-vector product `y = alpha * a * x + beta * y`.
+     *
+     * @details For CSR matrices, the rows are processed independently: each element of `y` is a sparse dot product
+     * (vectorized with AVX2/AVX-512 gathers for contiguous `double` vectors) and large products run in parallel with
+     * row chunks of equal numbers of non-zeros. For CSC matrices, the columns of `a` are scaled and added to `y`, which
+     * is done sequentially. The vector `y` must not overlap with `x` and it is not read if `beta == 0`.
+     *
+     * @tparam T Value type.
+     * @tparam Major Major of the compressed matrix.
+     * @tparam X enda::MemoryArrayOfRank<1> type.
+     * @tparam Y enda::MemoryArrayOfRank<1> type.
+     * @param alpha Scalar factor of the product.
+     * @param a Sparse matrix.
+     * @param x Vector.
+     * @param beta Scalar factor of `y`.
+     * @param y Result vector.
+     */
+    template<typename T, char Major, typename X, typename Y>
+    void spmv(std::type_identity_t<T> alpha, compressed_matrix<T, Major> const& a, X const& x, std::type_identity_t<T> beta, Y&& y)
+        requires(detail::is_sparse_operand_v<X, T, 1> and detail::is_sparse_operand_v<std::remove_cvref_t<Y>, T, 1>)
+    {
+        EXPECTS(a.extent(0) == y.size() and a.extent(1) == x.size());
+        long const* ptr  = a.outer_ptr().data();
+        long const* idx  = a.inner_indices().data();
+        T const* val     = a.values().data();
+        long const incx  = x.indexmap().strides()[0];
+        long const incy  = y.indexmap().strides()[0];
+        T const* xp      = x.data();
+        T* yp            = y.data();
+        if constexpr (Major == 'R')
+        {
+            detail::for_nnz_balanced_chunks(a.outer_size(), ptr, a.nnz() + a.outer_size(), [&](long r0, long r1) {
+                detail::csr_spmv_rows(r0, r1, alpha, ptr, idx, val, xp, incx, beta, yp, incy);
+            });
+        }
+        else
+        {
+            detail::scale_vector(beta, yp, incy, a.extent(0));
+            for (long j = 0; j < a.extent(1); ++j)
+            {
+                T const s = alpha * xp[j * incx];
+                for (long p = ptr[j]; p < ptr[j + 1]; ++p)
+                    yp[idx[p] * incy] += val[p] * s;
+            }
+        }
+    }
+
+    /**
+     * @brief Sparse matrix-vector product `y = alpha * a * x + beta * y` with a COO matrix (sequential).
+     *
+     * @tparam T Value type.
+     * @tparam X enda::MemoryArrayOfRank<1> type.
+     * @tparam Y enda::MemoryArrayOfRank<1> type.
+     * @param alpha Scalar factor of the product.
+     * @param a Sparse matrix.
+     * @param x Vector.
+     * @param beta Scalar factor of `y`.
+     * @param y Result vector.
+     */
+    template<typename T, typename X, typename Y>
+    void spmv(std::type_identity_t<T> alpha, coo_matrix<T> const& a, X const& x, std::type_identity_t<T> beta, Y&& y)
+        requires(detail::is_sparse_operand_v<X, T, 1> and detail::is_sparse_operand_v<std::remove_cvref_t<Y>, T, 1>)
+    {
+        EXPECTS(a.extent(0) == y.size() and a.extent(1) == x.size());
+        long const incx = x.indexmap().strides()[0];
+        long const incy = y.indexmap().strides()[0];
+        T const* xp     = x.data();
+        T* yp           = y.data();
+        auto const ri = a.row_indices(), ci = a.col_indices();
+        auto const v  = a.values();
+        detail::scale_vector(beta, yp, incy, a.extent(0));
+        for (long k = 0; k < a.nnz(); ++k)
+            yp[ri[k] * incy] += alpha * v[k] * xp[ci[k] * incx];
+    }
+
+    /**
+     * @brief Sparse matrix-dense matrix product `c = alpha * a * b + beta * c`.
+     *
+     * @details For CSR matrices, each row of `c` is accumulated from the rows of `b` selected by the non-zeros of the
+     * corresponding row of `a`, which streams through contiguous memory if `b` and `c` are in C-order. Otherwise, the
+     * product is computed column by column as a sequence of SpMVs. Large products run
+     * in parallel with row chunks of equal numbers of non-zeros. For CSC matrices, the rows of `b` are scattered to the
+     * rows of `c` sequentially. The matrix `c` must not overlap with `b` and it is not read if `beta == 0`.
+     *
+     * @tparam T Value type.
+     * @tparam Major Major of the compressed matrix.
+     * @tparam B enda::MemoryArrayOfRank<2> type.
+     * @tparam C enda::MemoryArrayOfRank<2> type.
+     * @param alpha Scalar factor of the product.
+     * @param a Sparse matrix.
+     * @param b Dense matrix.
+     * @param beta Scalar factor of `c`.
+     * @param c Result matrix.
+     */
+    template<typename T, char Major, typename B, typename C>
+    void spmm(std::type_identity_t<T> alpha, compressed_matrix<T, Major> const& a, B const& b, std::type_identity_t<T> beta, C&& c)
+        requires(detail::is_sparse_operand_v<B, T, 2> and detail::is_sparse_operand_v<std::remove_cvref_t<C>, T, 2>)
+    {
+        long const m = c.shape()[0], n = c.shape()[1];
+        EXPECTS(a.extent(0) == m and a.extent(1) == b.shape()[0] and b.shape()[1] == n);
+        long const* ptr = a.outer_ptr().data();
+        long const* idx = a.inner_indices().data();
+        T const* val    = a.values().data();
+        auto const bs   = b.indexmap().strides();
+        auto const cs   = c.indexmap().strides();
+        T const* bp     = b.data();
+        T* cp           = c.data();
+        if constexpr (Major == 'R')
+        {
+            detail::for_nnz_balanced_chunks(m, ptr, (a.nnz() + m) * n, [&](long r0, long r1) {
+                if (bs[1] == 1 and cs[1] == 1)
+                {
+                    detail::csr_spmm_rows(r0, r1, n, alpha, ptr, idx, val, bp, bs[0], beta, cp, cs[0]);
+                }
+                else
+                {
+                    // the rows of b and c are strided (e.g. Fortran order): one SpMV per column is more cache friendly
+                    for (long j = 0; j < n; ++j)
+                        detail::csr_spmv_rows(r0, r1, alpha, ptr, idx, val, bp + j * bs[1], bs[0], beta, cp + j * cs[1], cs[0]);
+                }
+            });
+        }
+        else
+        {
+            for (long i = 0; i < m; ++i)
+                detail::scale_vector(beta, cp + i * cs[0], cs[1], n);
+            for (long k = 0; k < a.extent(1); ++k)
+                for (long p = ptr[k]; p < ptr[k + 1]; ++p)
+                {
+                    T const s = alpha * val[p];
+                    for (long j = 0; j < n; ++j)
+                        cp[idx[p] * cs[0] + j * cs[1]] += s * bp[k * bs[0] + j * bs[1]];
+                }
+        }
+    }
+
+    /**
+     * @brief Sparse matrix-dense matrix product `c = alpha * a * b + beta * c` with a COO matrix (sequential).
+     *
+     * @tparam T Value type.
+     * @tparam B enda::MemoryArrayOfRank<2> type.
+     * @tparam C enda::MemoryArrayOfRank<2> type.
+     * @param alpha Scalar factor of the product.
+     * @param a Sparse matrix.
+     * @param b Dense matrix.
+     * @param beta Scalar factor of `c`.
+     * @param c Result matrix.
+     */
+    template<typename T, typename B, typename C>
+    void spmm(std::type_identity_t<T> alpha, coo_matrix<T> const& a, B const& b, std::type_identity_t<T> beta, C&& c)
+        requires(detail::is_sparse_operand_v<B, T, 2> and detail::is_sparse_operand_v<std::remove_cvref_t<C>, T, 2>)
+    {
+        long const m = c.shape()[0], n = c.shape()[1];
+        EXPECTS(a.extent(0) == m and a.extent(1) == b.shape()[0] and b.shape()[1] == n);
+        auto const bs = b.indexmap().strides();
+        auto const cs = c.indexmap().strides();
+        auto const ri = a.row_indices(), ci = a.col_indices();
+        auto const v  = a.values();
+        for (long i = 0; i < m; ++i)
+            detail::scale_vector(beta, c.data() + i * cs[0], cs[1], n);
+        for (long k = 0; k < a.nnz(); ++k)
+        {
+            T const s = alpha * v[k];
+            for (long j = 0; j < n; ++j)
+                c.data()[ri[k] * cs[0] + j * cs[1]] += s * b.data()[ci[k] * bs[0] + j * bs[1]];
+        }
+    }
+
+} // namespace enda::linalg
+
+namespace enda
+{
+    /**
+     * @brief Product of a sparse matrix with a dense vector or matrix.
+     *
+     * @details Operands which are not arrays/views in host memory are first evaluated. The product is computed by
+     * enda::linalg::spmv or enda::linalg::spmm.
+     *
+     * @tparam S enda::coo_matrix or enda::compressed_matrix type.
+     * @tparam A enda::ArrayOfRank<1> or enda::ArrayOfRank<2> type.
+     * @param a Sparse matrix.
+     * @param x Dense vector or matrix.
+     * @return enda::vector or enda::matrix containing the product.
+     */
+    template<typename S, typename A>
+        requires(is_sparse_matrix_v<S> and (ArrayOfRank<A, 1> or ArrayOfRank<A, 2>))
+    auto operator*(S const& a, A const& x)
+    {
+        using T = typename S::value_type;
+        if constexpr (!linalg::detail::is_sparse_operand_v<A, T, get_rank<A>>)
+        {
+            if constexpr (get_rank<A> == 1)
+                return a * vector<T>(x);
+            else
+                return a * matrix<T>(x);
+        }
+        else if constexpr (get_rank<A> == 1)
+        {
+            auto y = vector<T>(a.extent(0));
+            linalg::spmv(T {1}, a, x, T {0}, y);
+            return y;
+        }
+        else
+        {
+            auto c = matrix<T>(a.extent(0), x.shape()[1]);
+            linalg::spmm(T {1}, a, x, T {0}, c);
+            return c;
+        }
+    }
+
+} // namespace enda
@@ -0,0 +1,242 @@
+/**
+ * @file SmallVector.hpp
+ *
+ * @brief Provides a vector with inline storage for a small number of elements.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <span>
+#include <type_traits>
+
+namespace enda::stdutil
+{
+    /**
+     * @brief Vector-like container which stores up to `N` elements inline and only allocates on the heap for more.
+     *
+     * @details It is meant for short sequences whose length is only known at runtime, e.g. the shape and the strides of
+     * an array with a runtime rank, which are then copied and passed around without any allocation. Only trivially
+     * copyable value types are supported. The elements are value-initialized on construction and on resize.
+     *
+     * @tparam T Value type.
+     * @tparam N Number of elements stored inline.
+     */
+    template<typename T, size_t N = 8>
+    class small_vector
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Error in enda::stdutil::small_vector: Only trivially copyable types are supported");
+
+        // Inline storage.
+        std::array<T, N> buf {};
+
+        // Heap storage (only used if the size exceeds N).
+        std::unique_ptr<T[]> heap;
+
+        // Number of elements.
+        size_t sz = 0;
+
+        // Capacity of the current storage.
+        size_t cap = N;
+
+    public:
+        /// Value type.
+        using value_type = T;
+
+        /// Size type.
+        using size_type = size_t;
+
+        /// Iterator type.
+        using iterator = T*;
+
+        /// Const iterator type.
+        using const_iterator = T const*;
+
+        /// Default constructor creates an empty vector.
+        small_vector() = default;
+
+        /**
+         * @brief Construct a vector with a given number of copies of a value.
+         *
+         * @param n Number of elements.
+         * @param x Value of the elements.
+         */
+        explicit small_vector(size_t n, T const& x = T {}) { resize(n, x); }
+
+        /**
+         * @brief Construct a vector from a range of elements.
+         *
+         * @param s std::span with the elements.
+         */
+        explicit small_vector(std::span<T const> s) { assign(s.begin(), s.end()); }
+
+        /**
+         * @brief Construct a vector from an initializer list.
+         * @param l Initializer list with the elements.
+         */
+        small_vector(std::initializer_list<T> l) { assign(l.begin(), l.end()); }
+
+        /**
+         * @brief Construct a vector from a std::array.
+         *
+         * @tparam R Size of the array.
+         * @param a std::array with the elements.
+         */
+        template<size_t R>
+        small_vector(std::array<T, R> const& a) // NOLINT (implicit conversion is intended)
+        {
+            assign(a.begin(), a.end());
+        }
+
+        /// Copy constructor.
+        small_vector(small_vector const& v) { assign(v.begin(), v.end()); }
+
+        /// Move constructor (only the heap storage is moved, inline elements are copied).
+        small_vector(small_vector&& v) noexcept : buf(v.buf), heap(std::move(v.heap)), sz(v.sz), cap(v.cap)
+        {
+            v.sz  = 0;
+            v.cap = N;
+        }
+
+        /// Copy assignment operator.
+        small_vector& operator=(small_vector const& v)
+        {
+            if (this != &v)
+                assign(v.begin(), v.end());
+            return *this;
+        }
+
+        /// Move assignment operator.
+        small_vector& operator=(small_vector&& v) noexcept
+        {
+            if (this != &v)
+            {
+                buf   = v.buf;
+                heap  = std::move(v.heap);
+                cap   = v.cap;
+                sz    = v.sz;
+                v.sz  = 0;
+                v.cap = N;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Replace the content of the vector with the elements of a range.
+         *
+         * @tparam It Iterator type.
+         * @param first Iterator to the first element.
+         * @param last Iterator past the last element.
+         */
+        template<typename It>
+        void assign(It first, It last)
+        {
+            auto const n = static_cast<size_t>(std::distance(first, last));
+            reserve(n);
+            std::copy(first, last, data());
+            sz = n;
+        }
+
+        /**
+         * @brief Make sure that the vector can hold at least a given number of elements without reallocating.
+         * @param n Requested capacity.
+         */
+        void reserve(size_t n)
+        {
+            if (n <= cap)
+                return;
+            auto p = std::make_unique<T[]>(n);
+            std::copy(begin(), end(), p.get());
+            heap = std::move(p);
+            cap  = n;
+        }
+
+        /**
+         * @brief Change the number of elements.
+         *
+         * @param n New size.
+         * @param x Value of the appended elements.
+         */
+        void resize(size_t n, T const& x = T {})
+        {
+            reserve(n);
+            std::fill(data() + std::min(sz, n), data() + n, x);
+            sz = n;
+        }
+
+        /**
+         * @brief Append an element at the end.
+         * @param x Element to append.
+         */
+        void push_back(T const& x)
+        {
+            if (sz == cap)
+            {
+                T const tmp = x; // x might refer to an element of the vector
+                reserve(2 * cap);
+                data()[sz++] = tmp;
+                return;
+            }
+            data()[sz++] = x;
+        }
+
+        /// Remove all elements (keeps the capacity).
+        void clear() noexcept { sz = 0; }
+
+        /// Get the number of elements.
+        [[nodiscard]] size_t size() const noexcept { return sz; }
+
+        /// Is the vector empty?
+        [[nodiscard]] bool empty() const noexcept { return sz == 0; }
+
+        /// Get the capacity of the current storage.
+        [[nodiscard]] size_t capacity() const noexcept { return cap; }
+
+        /// Are the elements stored inline?
+        [[nodiscard]] bool is_inline() const noexcept { return heap == nullptr; }
+
+        /// Get a pointer to the first element.
+        [[nodiscard]] T* data() noexcept { return heap ? heap.get() : buf.data(); }
+
+        /// Get a pointer to the first element (const version).
+        [[nodiscard]] T const* data() const noexcept { return heap ? heap.get() : buf.data(); }
+
+        /// Access the i-th element.
+        [[nodiscard]] T& operator[](size_t i) noexcept { return data()[i]; }
+
+        /// Access the i-th element (const version).
+        [[nodiscard]] T const& operator[](size_t i) const noexcept { return data()[i]; }
+
+        /// Access the last element.
+        [[nodiscard]] T& back() noexcept { return data()[sz - 1]; }
+
+        /// Access the last element (const version).
+        [[nodiscard]] T const& back() const noexcept { return data()[sz - 1]; }
+
+        /// Get an iterator to the first element.
+        [[nodiscard]] T* begin() noexcept { return data(); }
+
+        /// Get an iterator past the last element.
+        [[nodiscard]] T* end() noexcept { return data() + sz; }
+
+        /// Get a const iterator to the first element.
+        [[nodiscard]] T const* begin() const noexcept { return data(); }
+
+        /// Get a const iterator past the last element.
+        [[nodiscard]] T const* end() const noexcept { return data() + sz; }
+
+        /**
+         * @brief Equal-to operator.
+         *
+         * @param lhs Left hand side operand.
+         * @param rhs Right hand side operand.
+         * @return True if both vectors have the same elements.
+         */
+        friend bool operator==(small_vector const& lhs, small_vector const& rhs) { return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()); }
+    };
+
+} // namespace enda::stdutil
@@ -9,3 +9,4 @@
 #include "StdUtil/Array.hpp"
 #include "StdUtil/Complex.hpp"
 #include "StdUtil/Concepts.hpp"
+#include "StdUtil/SmallVector.hpp"
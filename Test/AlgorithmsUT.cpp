@@ -0,0 +1,297 @@
+#include "./TestCommon.hpp"
+
+#include <numeric>
+#include <vector>
+
+// Fill an array with 0, 1, 2, ... in C-order.
+template<typename A>
+void fill_with_range(A& a)
+{
+    long v = 0;
+    enda::for_each(a.shape(), [&a, &v](auto... is) { a(is...) = v++; });
+}
+
+TEST(AlgorithmsTest, SumAndProduct)
+{
+    enda::array<long, 3> a(7, 11, 13);
+    fill_with_range(a);
+    const long n = a.size();
+    EXPECT_EQ(enda::sum(a), n * (n - 1) / 2);
+    EXPECT_EQ(enda::sum(a, enda::summation::pairwise), n * (n - 1) / 2);
+
+    // views, different layouts and expressions
+    enda::array<long, 3, F_layout> b(a);
+    EXPECT_EQ(enda::sum(b), n * (n - 1) / 2);
+    EXPECT_EQ(enda::sum(transpose(a)), n * (n - 1) / 2);
+    EXPECT_EQ(enda::sum(a(range::all, 3, range(0, 13, 2))), [&]() {
+        long s = 0;
+        for (long i = 0; i < 7; ++i)
+            for (long k = 0; k < 13; k += 2)
+                s += a(i, 3, k);
+        return s;
+    }());
+    EXPECT_EQ(enda::sum(a + b), n * (n - 1));
+
+    enda::array<double, 1> c {1.5, 2.0, -1.0, 4.0};
+    EXPECT_DOUBLE_EQ(enda::product(c), -12.0);
+    EXPECT_EQ(enda::sum(enda::array<double, 2>(0, 3)), 0.0);
+}
+
+TEST(AlgorithmsTest, SumReturnType)
+{
+    // the return type is the one of fold(std::plus<>{}, a), i.e. small integers are promoted
+    enda::array<short, 1> s(300);
+    s = 200;
+    static_assert(std::is_same_v<decltype(enda::sum(s)), decltype(enda::fold(std::plus<> {}, s))>);
+    static_assert(std::is_same_v<decltype(enda::sum(s)), int>);
+    static_assert(std::is_same_v<decltype(enda::sum(enda::array<char, 1>(3))), int>);
+    static_assert(std::is_same_v<decltype(enda::sum(enda::array<double, 1>(3))), double>);
+    static_assert(std::is_same_v<decltype(enda::sum(enda::array<std::complex<float>, 1>(3))), std::complex<float>>);
+    static_assert(std::is_same_v<decltype(enda::sum<0>(enda::array<short, 2>(3, 2))), enda::array<int, 1>>);
+    EXPECT_EQ(enda::sum(s), 60000);
+    EXPECT_EQ(enda::sum(s, enda::summation::pairwise), 60000);
+}
+
+TEST(AlgorithmsTest, SumComplex)
+{
+    enda::array<dcomplex, 2> a(17, 9);
+    enda::for_each(a.shape(), [&a](long i, long j) { a(i, j) = dcomplex(i, -j); });
+    dcomplex exp = 0;
+    for (auto const& x : a)
+        exp += x;
+    EXPECT_COMPLEX_NEAR(enda::sum(a), exp, 1e-12);
+    EXPECT_COMPLEX_NEAR(enda::sum(a, enda::summation::kahan), exp, 1e-12);
+    EXPECT_COMPLEX_NEAR(enda::sum(a, enda::summation::pairwise), exp, 1e-12);
+}
+
+TEST(AlgorithmsTest, CompensatedSummation)
+{
+    // 1 followed by many small values which are lost in a naive summation
+    const long             n = 1000000;
+    enda::array<double, 1> a(n);
+    a    = 1e-16;
+    a(0) = 1.0;
+    const double exact = 1.0 + (n - 1) * 1e-16;
+
+    EXPECT_NEAR(enda::sum(a, enda::summation::kahan), exact, 1e-15);
+    EXPECT_NEAR(enda::sum(a, enda::summation::pairwise), exact, 1e-13);
+
+    double naive = 0;
+    for (long i = 0; i < n; ++i)
+        naive += a(i);
+    EXPECT_GT(std::abs(naive - exact), 1e-12);
+}
+
+TEST(AlgorithmsTest, MinMaxNorm)
+{
+    enda::array<double, 2> a(23, 19);
+    enda::for_each(a.shape(), [&a](long i, long j) { a(i, j) = std::sin(double(i * 19 + j)); });
+
+    double mx = a(0, 0), mn = a(0, 0), nrm = 0;
+    for (auto x : a)
+    {
+        mx = std::max(mx, x);
+        mn = std::min(mn, x);
+        nrm += x * x;
+    }
+    EXPECT_EQ(enda::max_element(a), mx);
+    EXPECT_EQ(enda::min_element(a), mn);
+    EXPECT_EQ(enda::max_element(transpose(a)), mx);
+    EXPECT_EQ(enda::min_element(-a), -mx);
+    EXPECT_NEAR(enda::frobenius_norm(a), std::sqrt(nrm), 1e-12);
+
+    enda::array<dcomplex, 2> b(3, 4);
+    b = dcomplex(1, 1);
+    EXPECT_NEAR(enda::frobenius_norm(b), std::sqrt(24.0), 1e-14);
+}
+
+TEST(AlgorithmsTest, AnyAll)
+{
+    enda::array<bool, 2> a(10, 10);
+    a = false;
+    EXPECT_FALSE(enda::any(a));
+    EXPECT_FALSE(enda::all(a));
+    a(7, 3) = true;
+    EXPECT_TRUE(enda::any(a));
+    a = true;
+    EXPECT_TRUE(enda::all(a));
+    EXPECT_TRUE(enda::all(a(range(0, 10, 3), range::all)));
+}
+
+TEST(AlgorithmsTest, ParallelReductions)
+{
+    const long old_threshold = enda::parallel::get_threshold();
+    enda::parallel::set_num_threads(4);
+    enda::parallel::set_threshold(0);
+
+    enda::array<long, 3> a(9, 7, 5);
+    fill_with_range(a);
+    const long n = a.size();
+    EXPECT_EQ(enda::sum(a), n * (n - 1) / 2);
+    EXPECT_EQ(enda::sum(a(range(1, 9), range::all, range(0, 4))), [&]() {
+        long s = 0;
+        enda::for_each(std::array<long, 3> {8, 7, 4}, [&](long i, long j, long k) { s += a(i + 1, j, k); });
+        return s;
+    }());
+    EXPECT_EQ(enda::sum(2 * a), n * (n - 1));
+    EXPECT_EQ(enda::max_element(a), n - 1);
+    EXPECT_EQ(enda::min_element(a + 3), 3);
+    EXPECT_EQ(enda::fold([](long r, long x) { return r + x; }, a, 0l), n * (n - 1) / 2);
+
+    enda::parallel::set_threshold(old_threshold);
+    enda::parallel::set_num_threads(enda::parallel::detail::default_num_threads());
+}
+
+// Reference implementation of a sum over dimension 1 of a rank 3 array.
+template<typename A>
+enda::array<long, 2> sum_over_1(A const& a)
+{
+    enda::array<long, 2> res(a.extent(0), a.extent(2));
+    res = 0;
+    enda::for_each(a.shape(), [&](long i, long j, long k) { res(i, k) += a(i, j, k); });
+    return res;
+}
+
+TEST(AlgorithmsTest, AxisReductions)
+{
+    enda::array<long, 3> a(6, 5, 4);
+    fill_with_range(a);
+
+    // reduce along a slow, a middle and the fastest dimension
+    EXPECT_ARRAY_EQ(enda::sum<1>(a), sum_over_1(a));
+    EXPECT_ARRAY_EQ(enda::sum<0>(a), transpose(enda::sum<2>(enda::array<long, 3>(transpose(a)))));
+    EXPECT_EQ(enda::sum<2>(a)(3, 2), a(3, 2, 0) + a(3, 2, 1) + a(3, 2, 2) + a(3, 2, 3));
+    EXPECT_EQ((enda::sum<0, 2>(a).shape()), (std::array<long, 1> {5}));
+    EXPECT_EQ(enda::sum((enda::sum<0, 2>(a))), enda::sum(a));
+    EXPECT_ARRAY_EQ(enda::sum<0>(enda::sum<2>(a)), (enda::sum<0, 2>(a)));
+
+    // different layouts, strided views and expressions
+    enda::array<long, 3, F_layout> b(a);
+    EXPECT_ARRAY_EQ(enda::sum<1>(b), sum_over_1(a));
+    EXPECT_ARRAY_EQ(enda::sum<1>(a(range(0, 6, 2), range::all, range(1, 4))), sum_over_1(a(range(0, 6, 2), range::all, range(1, 4))));
+    EXPECT_ARRAY_EQ(enda::sum<1>(a + b), (enda::array<long, 2>(2 * sum_over_1(a))));
+
+    // max, min and mean
+    enda::array<double, 2> c {{1.0, -2.0, 3.0}, {-4.0, 5.0, 0.5}};
+    EXPECT_ARRAY_EQ(enda::max_element<0>(c), (enda::array<double, 1> {1.0, 5.0, 3.0}));
+    EXPECT_ARRAY_EQ(enda::min_element<1>(c), (enda::array<double, 1> {-2.0, -4.0}));
+    EXPECT_ARRAY_EQ(enda::mean<0>(c), (enda::array<double, 1> {-1.5, 1.5, 1.75}));
+    EXPECT_DOUBLE_EQ(enda::mean(c), 3.5 / 6);
+    EXPECT_ARRAY_EQ(enda::mean<1>(enda::array<int, 2> {{1, 2}, {3, 6}}), (enda::array<double, 1> {1.5, 4.5}));
+
+    // rows of infinities
+    auto inf = std::numeric_limits<double>::infinity();
+    enda::array<double, 2> d {{-inf, -inf, -inf}, {inf, inf, inf}};
+    EXPECT_ARRAY_EQ(enda::max_element<1>(d), (enda::array<double, 1> {-inf, inf}));
+    EXPECT_ARRAY_EQ(enda::min_element<1>(d), (enda::array<double, 1> {-inf, inf}));
+    EXPECT_ARRAY_EQ(enda::max_element<0>(enda::array<double, 2>(2, 3) = -inf), (enda::array<double, 1> {-inf, -inf, -inf}));
+
+    // non-associative fold (elements are visited in increasing order along the reduced dimension)
+    auto digits = enda::fold_axes<1>([](long r, long x) { return 10 * r + x; }, enda::array<long, 2> {{1, 2, 3}, {4, 5, 6}}, 0l);
+    EXPECT_ARRAY_EQ(digits, (enda::array<long, 1> {123, 456}));
+
+    // empty reduced dimension
+    EXPECT_ARRAY_EQ(enda::sum<1>(enda::array<long, 2>(3, 0)), (enda::array<long, 1> {0, 0, 0}));
+}
+
+TEST(AlgorithmsTest, ParallelAxisReductions)
+{
+    const long old_threshold = enda::parallel::get_threshold();
+    enda::parallel::set_num_threads(4);
+    enda::parallel::set_threshold(0);
+
+    enda::array<long, 3> a(9, 7, 5);
+    fill_with_range(a);
+    enda::array<long, 3, F_layout> b(a);
+    EXPECT_ARRAY_EQ(enda::sum<1>(a), sum_over_1(a));
+    EXPECT_ARRAY_EQ(enda::sum<1>(b), sum_over_1(a));
+    EXPECT_EQ(enda::sum((enda::sum<0, 1>(a))), enda::sum(a));
+    EXPECT_EQ(enda::sum((enda::sum<1, 2>(b))), enda::sum(a));
+    EXPECT_EQ((enda::max_element<0, 1>(a)(4)), a(8, 6, 4));
+
+    enda::parallel::set_threshold(old_threshold);
+    enda::parallel::set_num_threads(enda::parallel::detail::default_num_threads());
+}
+
+TEST(AlgorithmsTest, AxisReductionsWithUnitKeptExtents)
+{
+    // all kept dimensions have extent 1, i.e. the result has a single element
+    const long old_threshold = enda::parallel::get_threshold();
+    enda::parallel::set_num_threads(4);
+    enda::array<double, 2> a(1, 5);
+    enda::array<double, 3> b(4, 1, 500);
+    fill_with_range(a);
+    fill_with_range(b);
+    for (long threshold : {0l, 1l << 40})
+    {
+        enda::parallel::set_threshold(threshold);
+        EXPECT_ARRAY_EQ(enda::sum<1>(a), (enda::array<double, 1> {10.0}));
+        EXPECT_ARRAY_EQ((enda::sum<0, 2>(b)), (enda::array<double, 1> {enda::sum(b)}));
+        EXPECT_ARRAY_EQ((enda::max_element<0, 2>(b)), (enda::array<double, 1> {1999.0}));
+    }
+    enda::parallel::set_threshold(old_threshold);
+    enda::parallel::set_num_threads(enda::parallel::detail::default_num_threads());
+}
+
+TEST(AlgorithmsTest, FindAndCount)
+{
+    enda::array<long, 3> a(4, 5, 70);
+    fill_with_range(a);
+
+    // find_if returns the first hit in memory order
+    EXPECT_EQ(enda::find_if(a, [](long x) { return x >= 1000; }), (std::array<long, 3> {2, 4, 20}));
+    EXPECT_FALSE(enda::find_if(a, [](long x) { return x < 0; }).has_value());
+    enda::array<long, 3, F_layout> b(a);
+    EXPECT_EQ(enda::find_if(b, [](long x) { return x % 350 == 71; }), (std::array<long, 3> {0, 1, 1}));
+    EXPECT_EQ(enda::find_if(b, [](long x) { return x >= 1350; }), (std::array<long, 3> {3, 4, 20}));
+    EXPECT_EQ(enda::find_if(a(range(1, 4), 2, range(0, 70, 3)), [](long x) { return x > 700; }), (std::array<long, 2> {1, 0}));
+    EXPECT_EQ(enda::find_if(a + b, [](long x) { return x == 2 * 561; }), (std::array<long, 3> {1, 3, 1}));
+
+    // count_if
+    EXPECT_EQ(enda::count_if(a, [](long x) { return x % 3 == 0; }), 467);
+    EXPECT_EQ(enda::count_if(a(range::all, 0, range::all) * 2, [](long x) { return x < 100; }), 50);
+
+    // any/all on expressions
+    enda::array<double, 2> c(50, 40);
+    c = 1.0;
+    EXPECT_FALSE(enda::any(enda::isnan(c)));
+    c(31, 7) = std::nan("");
+    EXPECT_TRUE(enda::any(enda::isnan(c)));
+    EXPECT_EQ(enda::find_if(c, [](double x) { return std::isnan(x); }), (std::array<long, 2> {31, 7}));
+    auto is_one = enda::map([](double x) { return x == 1.0; });
+    EXPECT_FALSE(enda::all(is_one(c)));
+    EXPECT_TRUE(enda::all(is_one(c(range(0, 31), range::all))));
+}
+
+TEST(AlgorithmsTest, ArgMaxArgMin)
+{
+    enda::array<double, 2> a {{1.0, 7.0, -3.0}, {7.0, 2.0, -3.0}};
+    EXPECT_EQ(enda::argmax(a), (std::array<long, 2> {0, 1}));
+    EXPECT_EQ(enda::argmin(a), (std::array<long, 2> {0, 2}));
+    EXPECT_EQ(enda::argmax(transpose(a)), (std::array<long, 2> {1, 0}));
+    EXPECT_EQ(enda::argmin(enda::array<int, 1> {3, 1, 4, 1, 5}), (std::array<long, 1> {1}));
+}
+
+TEST(AlgorithmsTest, ParallelFind)
+{
+    const long old_threshold = enda::parallel::get_threshold();
+    enda::parallel::set_num_threads(4);
+    enda::parallel::set_threshold(0);
+
+    enda::array<long, 3> a(9, 7, 50);
+    fill_with_range(a);
+    for (long v : {0l, 1l, 349l, 350l, 2000l, 3149l})
+    {
+        auto pred = [v](long x) { return x >= v; };
+        EXPECT_EQ(enda::find_if(a, pred), (std::array<long, 3> {v / 350, (v / 50) % 7, v % 50}));
+        EXPECT_EQ(enda::find_if(a * 1, pred), (std::array<long, 3> {v / 350, (v / 50) % 7, v % 50}));
+    }
+    EXPECT_FALSE(enda::find_if(a, [](long x) { return x < 0; }).has_value());
+    EXPECT_TRUE(enda::any(enda::map([](long x) { return x == 1234; })(a)));
+    EXPECT_FALSE(enda::all(enda::map([](long x) { return x > 0; })(a)));
+    EXPECT_EQ(enda::count_if(a, [](long x) { return x % 2 == 0; }), a.size() / 2);
+    EXPECT_EQ(enda::argmax(a), (std::array<long, 3> {8, 6, 49}));
+
+    enda::parallel::set_threshold(old_threshold);
+    enda::parallel::set_num_threads(enda::parallel::detail::default_num_threads());
+}
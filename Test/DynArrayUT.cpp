@@ -0,0 +1,157 @@
+#include "TestCommon.hpp"
+
+#include <numeric>
+
+TEST(DynArrayTest, ConstructAndAccess)
+{
+    enda::dyn_array<long> a({2, 3, 4});
+    EXPECT_EQ(a.rank(), 3);
+    EXPECT_EQ(a.size(), 24);
+    EXPECT_TRUE((a.shape() == enda::dyn_shape_t {2, 3, 4}));
+    EXPECT_TRUE((a.strides() == enda::dyn_shape_t {12, 4, 1}));
+    std::iota(a.data(), a.data() + a.size(), 0);
+    EXPECT_EQ(a(1, 2, 3), 23);
+    EXPECT_EQ(a(std::array<long, 3> {1, 0, 2}), 14);
+
+    enda::dyn_array<double> b({3, 2}, 1.5);
+    EXPECT_EQ(enda::sum(b), 9.0);
+
+    // default constructed arrays are empty
+    enda::dyn_array<int> e;
+    EXPECT_TRUE(e.empty());
+    EXPECT_EQ(enda::sum(e), 0);
+
+    // ranks which are not stored inline
+    enda::dyn_array<int> h(enda::dyn_shape_t(10, 2));
+    EXPECT_EQ(h.rank(), 10);
+    h = 1;
+    EXPECT_EQ(enda::sum(h), 1024);
+    h(1, 1, 1, 1, 1, 1, 1, 1, 1, 1) = 3;
+    EXPECT_EQ(h.data()[1023], 3);
+}
+
+TEST(DynArrayTest, StaticConversions)
+{
+    auto a = enda::array<double, 3>::rand(4, 5, 6);
+
+    // zero-copy view of a static array
+    enda::dyn_array_view v = a;
+    static_assert(std::is_same_v<decltype(v), enda::dyn_array_view<double>>);
+    EXPECT_EQ(v.data(), a.data());
+    EXPECT_EQ(v.rank(), 3);
+    EXPECT_EQ(v(1, 2, 3), a(1, 2, 3));
+    EXPECT_NEAR(enda::sum(v), enda::sum(a), 1e-12);
+
+    // and back
+    auto s = v.as_static<3>();
+    EXPECT_EQ(s.data(), a.data());
+    EXPECT_EQ_ARRAY(s, a);
+
+    // const views
+    auto const&                    ca = a;
+    enda::dyn_array_view           cv = ca;
+    enda::dyn_array_view<double const> cv2 = v;
+    static_assert(std::is_same_v<decltype(cv), enda::dyn_array_view<double const>>);
+    EXPECT_EQ(cv2(0, 0, 1), a(0, 0, 1));
+    static_assert(!std::is_constructible_v<enda::dyn_array_view<double>, enda::array<double, 3> const&>);
+
+    // strided views
+    auto sl  = a(enda::range(1, 4), enda::range::all, 2);
+    auto dsl = enda::dyn_array_view<double>(sl);
+    EXPECT_EQ(dsl.rank(), 2);
+    EXPECT_FALSE(dsl.is_contiguous());
+    EXPECT_EQ(dsl(2, 4), a(3, 4, 2));
+    EXPECT_EQ_ARRAY((dsl.as_static<2>()), sl);
+
+    // Fortran layout
+    enda::array<long, 2, enda::F_layout> f(3, 4);
+    for (long i = 0; i < 3; ++i)
+        for (long j = 0; j < 4; ++j)
+            f(i, j) = 10 * i + j;
+    enda::dyn_array_view df = f;
+    EXPECT_TRUE(df.is_contiguous());
+    EXPECT_EQ(df(2, 1), 21);
+    EXPECT_EQ_ARRAY((df.as_static<2, enda::F_stride_layout>()), f);
+    EXPECT_EQ(df.flatten()(1), 10);
+
+    // owning copies
+    enda::dyn_array<double> d(a + 1);
+    EXPECT_EQ(d.rank(), 3);
+    EXPECT_ARRAY_NEAR((d.as_static<3>()), (enda::array<double, 3>(a + 1)));
+    enda::array<double, 3> back = d.as_static<3>();
+    EXPECT_ARRAY_NEAR(back, (enda::array<double, 3>(a + 1)));
+    enda::dyn_array<long> dfc(df);
+    EXPECT_EQ_ARRAY((dfc.as_static<2>()), (enda::array<long, 2>(f)));
+}
+
+TEST(DynArrayTest, Assignment)
+{
+    auto a = enda::array<long, 4>(3, 4, 5, 6);
+    std::iota(a.data(), a.data() + a.size(), 0);
+
+    // copy between different memory layouts
+    enda::dyn_array<long> d({3, 4, 5, 6});
+    d = 0;
+    d.as_view() = enda::dyn_array_view<long const>(a);
+    EXPECT_EQ_ARRAY((d.as_static<4>()), a);
+
+    auto t = enda::array<long, 4>(a.shape());
+    enda::dyn_array_view<long> tv(t.data(), {6, 5, 4, 3}, {1, 6, 30, 120});
+    tv = enda::dyn_array_view<long const>(a.data(), {6, 5, 4, 3}, {1, 6, 30, 120});
+    EXPECT_EQ_ARRAY(t, a);
+
+    // permuted copy
+    enda::dyn_array<long> p({6, 5, 4, 3});
+    p = 0;
+    p.as_view() = enda::dyn_array_view<long>(a.data(), {6, 5, 4, 3}, {1, 6, 30, 120});
+    for (long i = 0; i < 3; ++i)
+        for (long j = 0; j < 4; ++j)
+            for (long k = 0; k < 5; ++k)
+                for (long l = 0; l < 6; ++l)
+                    EXPECT_EQ(p(l, k, j, i), a(i, j, k, l));
+
+    // in-place permutation through an overlapping view
+    auto s = enda::array<long, 2>(9, 9);
+    std::iota(s.data(), s.data() + s.size(), 0);
+    auto st = enda::array<long, 2>(transpose(s));
+    auto sv = enda::dyn_array_view<long>(s);
+    sv      = enda::dyn_array_view<long>(s.data(), {9, 9}, {1, 9});
+    EXPECT_EQ_ARRAY(s, st);
+
+    // assignment to strided views of high rank (more dimensions than the static kernels)
+    enda::dyn_array<int> h(enda::dyn_shape_t(7, 3));
+    h = 1;
+    enda::dyn_array_view<int> hv(h.data(), enda::dyn_shape_t(7, 2), enda::dyn_shape_t {729, 243, 81, 27, 9, 3, 1});
+    hv = 5;
+    EXPECT_EQ(enda::sum(hv), 5 * 128);
+    EXPECT_EQ(enda::sum(h), 5 * 128 + (2187 - 128));
+    enda::dyn_array<int> hc(hv);
+    EXPECT_EQ(hc.size(), 128);
+    EXPECT_EQ(enda::sum(hc), 5 * 128);
+
+    // array assignment resizes
+    enda::dyn_array<int> r;
+    r = hv;
+    EXPECT_TRUE(r.shape() == hv.shape());
+    r = hc;
+    EXPECT_EQ(enda::sum(r), 5 * 128);
+
+    // copy and move
+    auto c = h;
+    EXPECT_NE(c.data(), h.data());
+    EXPECT_EQ(enda::sum(c), enda::sum(h));
+    auto const* ptr = c.data();
+    auto        m   = std::move(c);
+    EXPECT_EQ(m.data(), ptr);
+    EXPECT_TRUE(c.empty());
+
+    // parallel kernels give the same results
+    enda::dyn_array<double> big({64, 33, 50}, 0.5);
+    {
+        enda::parallel::policy_guard g(enda::execution::par);
+        big.as_view() = enda::dyn_array_view<double>(big.as_static<3>()(enda::range::all, enda::range::all, enda::range::all));
+        EXPECT_EQ(enda::sum(big), 0.5 * big.size());
+        big = 2.0;
+        EXPECT_EQ(enda::sum(big), 2.0 * big.size());
+    }
+}
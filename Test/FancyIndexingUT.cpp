@@ -0,0 +1,179 @@
+#include "./TestCommon.hpp"
+
+#include <numeric>
+
+TEST(FancyIndexingTest, GatherWithIndexArray)
+{
+    auto a = enda::array<double, 1>(100);
+    std::iota(a.begin(), a.end(), 0.0);
+
+    // random indices, duplicates and runs of consecutive indices
+    auto idx = enda::array<long, 1> {5, 3, 3, 99, 0, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 7, 40, 41};
+    auto g   = a(idx);
+    static_assert(std::is_same_v<decltype(g), enda::gather_view<double>>);
+    EXPECT_EQ(g.size(), idx.size());
+    EXPECT_EQ(g.shape(), (std::array<long, 1> {idx.size()}));
+
+    auto b = enda::array<double, 1>(g);
+    for (long i = 0; i < idx.size(); ++i)
+        EXPECT_EQ(b(i), double(idx(i)));
+
+    // gather into a strided view
+    auto c = enda::array<double, 1>(2 * idx.size());
+    c(enda::range(0, 2 * idx.size(), 2)) = a(idx);
+    for (long i = 0; i < idx.size(); ++i)
+        EXPECT_EQ(c(2 * i), double(idx(i)));
+
+    // other integer types and lazy expressions
+    auto idx_int = enda::array<int, 1> {2, 1};
+    EXPECT_EQ_ARRAY((enda::array<double, 1>(a(idx_int))), (enda::array<double, 1> {2, 1}));
+    EXPECT_EQ_ARRAY((enda::array<double, 1>(2 * a(idx_int) + 1)), (enda::array<double, 1> {5, 3}));
+    EXPECT_EQ_ARRAY((enda::array<double, 1>(a[idx_int])), (enda::array<double, 1> {2, 1}));
+
+    // strided source
+    auto s = a(enda::range(1, 100, 3));
+    EXPECT_EQ_ARRAY((enda::array<double, 1>(s(idx_int))), (enda::array<double, 1> {7, 4}));
+
+    // const source
+    auto const& ac = a;
+    static_assert(std::is_same_v<decltype(ac(idx)), enda::gather_view<double const>>);
+    EXPECT_EQ(ac(idx)(3), 99);
+}
+
+TEST(FancyIndexingTest, GatherLongInteger)
+{
+    auto a = enda::array<long, 1>(1000);
+    std::iota(a.begin(), a.end(), 0l);
+    auto idx = enda::array<long, 1>(500);
+    for (long i = 0; i < idx.size(); ++i)
+        idx(i) = (i * 37) % 1000;
+    EXPECT_EQ_ARRAY((enda::array<long, 1>(a(idx))), idx);
+}
+
+TEST(FancyIndexingTest, GatherWithMask)
+{
+    auto a    = enda::array<double, 2>::rand(7, 9);
+    auto mask = enda::array<bool, 2>(7, 9);
+    enda::for_each(a.shape(), [&](long i, long j) { mask(i, j) = a(i, j) > 0.5; });
+
+    auto g = a(mask);
+    std::vector<double> expected;
+    enda::for_each(a.shape(), [&](long i, long j) {
+        if (mask(i, j))
+            expected.push_back(a(i, j));
+    });
+    ASSERT_EQ(g.size(), expected.size());
+    auto b = enda::array<double, 1>(g);
+    for (long i = 0; i < b.size(); ++i)
+        EXPECT_EQ(b(i), expected[i]);
+
+    // mask from a lazy expression on a view
+    auto v = a(enda::range(1, 5), enda::range::all);
+    auto m = enda::map([](double x) { return x > 0.5; })(v);
+    EXPECT_EQ(v(m).size(), std::count_if(v.begin(), v.end(), [](double x) { return x > 0.5; }));
+}
+
+TEST(FancyIndexingTest, Scatter)
+{
+    auto a   = enda::zeros<long>(50);
+    auto idx = enda::array<long, 1>(30);
+    for (long i = 0; i < 10; ++i)
+        idx(i) = 3 * i;
+    for (long i = 10; i < 30; ++i)
+        idx(i) = i + 20;
+
+    // scatter an array (runs and single elements)
+    auto b = enda::array<long, 1>(30);
+    std::iota(b.begin(), b.end(), 1l);
+    a(idx) = b;
+    for (long i = 0; i < 30; ++i)
+        EXPECT_EQ(a(idx(i)), b(i));
+    EXPECT_EQ(a(1), 0);
+
+    // scatter a scalar and a strided array
+    a(idx) = -1;
+    for (long i = 0; i < 30; ++i)
+        EXPECT_EQ(a(idx(i)), -1);
+    auto c = enda::array<long, 1>(60);
+    std::iota(c.begin(), c.end(), 0l);
+    a(idx) = c(enda::range(0, 60, 2));
+    for (long i = 0; i < 30; ++i)
+        EXPECT_EQ(a(idx(i)), 2 * i);
+
+    // scatter a lazy expression and a gather view
+    a(idx) = 2 * b;
+    for (long i = 0; i < 30; ++i)
+        EXPECT_EQ(a(idx(i)), 2 * b(i));
+    auto rev = enda::array<long, 1>(30);
+    for (long i = 0; i < 30; ++i)
+        rev(i) = 29 - i;
+    a(idx) = b(rev);
+    for (long i = 0; i < 30; ++i)
+        EXPECT_EQ(a(idx(i)), 30 - i);
+
+    // duplicates: the last element wins
+    auto d = enda::zeros<double>(4);
+    d(enda::array<long, 1> {1, 1, 1, 1, 1, 1, 1, 1, 1, 2}) = enda::array<double, 1> {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    EXPECT_EQ_ARRAY(d, (enda::array<double, 1> {0, 9, 10, 0}));
+}
+
+TEST(FancyIndexingTest, ScatterWithMask)
+{
+    auto a    = enda::array<double, 2>::rand(6, 5);
+    auto mask = enda::array<bool, 2>(6, 5);
+    enda::for_each(a.shape(), [&](long i, long j) { mask(i, j) = a(i, j) > 0.5; });
+    auto b = enda::array<double, 2>(a);
+
+    a(mask) = 0;
+    enda::for_each(a.shape(), [&](long i, long j) { EXPECT_EQ(a(i, j), (mask(i, j) ? 0.0 : b(i, j))); });
+
+    // in-place update through the same mask
+    a = b;
+    a(mask) = a(mask) * 2;
+    enda::for_each(a.shape(), [&](long i, long j) { EXPECT_EQ(a(i, j), (mask(i, j) ? 2 * b(i, j) : b(i, j))); });
+}
+
+TEST(FancyIndexingTest, OverlappingPermutation)
+{
+    // cyclic shift p = {1, ..., 9, 0} and its inverse
+    auto p = enda::array<long, 1>(10);
+    for (long i = 0; i < 10; ++i)
+        p(i) = (i + 1) % 10;
+    auto iota = enda::array<long, 1>(10);
+    std::iota(iota.begin(), iota.end(), 0l);
+    auto shifted = enda::array<long, 1> {1, 2, 3, 4, 5, 6, 7, 8, 9, 0};
+    auto rotated = enda::array<long, 1> {9, 0, 1, 2, 3, 4, 5, 6, 7, 8};
+
+    // scatter from the array itself
+    auto a = iota;
+    a(p)   = a;
+    EXPECT_EQ_ARRAY(a, rotated);
+
+    // gather into the array itself
+    auto b = iota;
+    b      = b(p);
+    EXPECT_EQ_ARRAY(b, shifted);
+
+    // partially overlapping strided views
+    auto c = enda::array<long, 1>(20);
+    std::iota(c.begin(), c.end(), 0l);
+    c(enda::range(0, 20, 2)) = c(enda::range(1, 20, 2))(p);
+    for (long i = 0; i < 10; ++i)
+        EXPECT_EQ(c(2 * i), 2 * p(i) + 1);
+    std::iota(c.begin(), c.end(), 0l);
+    c(enda::range(1, 20, 2))(p) = c(enda::range(0, 20, 2));
+    for (long i = 0; i < 10; ++i)
+        EXPECT_EQ(c(2 * p(i) + 1), 2 * i);
+}
+
+TEST(FancyIndexingTest, ParallelGather)
+{
+    enda::parallel::policy_guard guard(enda::execution::par);
+    auto a   = enda::array<double, 1>::rand(10000);
+    auto idx = enda::array<long, 1>(5000);
+    for (long i = 0; i < idx.size(); ++i)
+        idx(i) = (i < 2000 ? (i * 7919) % 10000 : i); // random indices followed by a long run
+    auto b = enda::array<double, 1>(a(idx));
+    for (long i = 0; i < idx.size(); ++i)
+        EXPECT_EQ(b(i), a(idx(i)));
+}
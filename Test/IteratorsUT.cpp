@@ -149,3 +149,133 @@ TEST(IteratorTest, bug)
         x = 10;
     }
 }
+
+//-----------------------------
+
+TEST(IteratorTest, RandomAccess)
+{
+    static_assert(std::random_access_iterator<enda::array<long, 3>::iterator>);
+    static_assert(std::random_access_iterator<enda::array<long, 3>::const_iterator>);
+    static_assert(std::random_access_iterator<enda::array<long, 1>::iterator>);
+
+    enda::array<long, 3> a(4, 6, 8);
+    for (long i = 0; i < a.size(); ++i)
+        a.data()[i] = i;
+    auto v = a(range(1, 4), range(0, 6, 2), range(1, 8, 3));
+
+    // reference traversal with the increment operator
+    std::vector<long> ref;
+    for (auto x : v)
+        ref.push_back(x);
+    EXPECT_EQ(ref.size(), v.size());
+
+    auto first = v.begin();
+    EXPECT_EQ(v.end() - first, v.size());
+    for (long n = 0; n < v.size(); ++n)
+    {
+        EXPECT_EQ(first[n], ref[n]);
+        auto it = v.end() - (v.size() - n);
+        EXPECT_EQ(*it, ref[n]);
+        EXPECT_EQ(it - first, n);
+        auto [i, j, k] = it.indices();
+        EXPECT_EQ(*it, v(i, j, k));
+        if (n > 0)
+        {
+            EXPECT_EQ(*(--it), ref[n - 1]);
+            EXPECT_TRUE(it < first + n);
+        }
+    }
+
+    // decrementing from the end
+    auto it = v.end();
+    for (long n = v.size() - 1; n >= 0; --n)
+        EXPECT_EQ(*(--it), ref[n]);
+    EXPECT_TRUE(it == first);
+}
+
+//-----------------------------
+
+TEST(IteratorTest, StdAlgorithms)
+{
+    enda::array<double, 3> a = enda::rand<>(5, 7, 9);
+    auto const             a0 = a;
+    auto                   v  = a(range(0, 5, 2), _, range(1, 9, 2));
+
+    std::vector<double> ref(v.begin(), v.end());
+    std::ranges::sort(ref);
+
+    std::nth_element(v.begin(), v.begin() + v.size() / 2, v.end());
+    EXPECT_EQ(v.begin()[v.size() / 2], ref[ref.size() / 2]);
+
+    std::sort(v.begin(), v.end());
+    EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+    EXPECT_TRUE(std::equal(v.begin(), v.end(), ref.begin()));
+    EXPECT_EQ(std::lower_bound(v.begin(), v.end(), ref[11]) - v.begin(), 11);
+
+    // elements outside of the view are untouched
+    EXPECT_ARRAY_EQ(a(1, _, _), a0(1, _, _));
+    EXPECT_ARRAY_EQ(a(_, _, 0), a0(_, _, 0));
+
+    std::reverse(v.begin(), v.end());
+    EXPECT_TRUE(std::is_sorted(v.begin(), v.end(), std::greater<> {}));
+
+    // sorting a Fortran-layout array traverses it in memory order
+    auto f = enda::array<double, 2, enda::F_layout>(enda::rand<>(6, 4));
+    std::sort(f.begin(), f.end());
+    EXPECT_TRUE(std::is_sorted(f.data(), f.data() + f.size()));
+}
+
+//-----------------------------
+
+TEST(IteratorTest, Segments)
+{
+    enda::array<long, 3> a(4, 5, 6);
+    for (long i = 0; i < a.size(); ++i)
+        a.data()[i] = i;
+
+    // collect the elements of a range segment by segment
+    auto collect = [](auto first, auto last) {
+        std::vector<long> res;
+        long              n_segments = 0;
+        enda::for_each_segment(first, last, [&](auto* p, long n, long s) {
+            ++n_segments;
+            for (long i = 0; i < n; ++i)
+                res.push_back(p[i * s]);
+        });
+        return std::pair {res, n_segments};
+    };
+
+    // strided view: segments are the runs along the last dimension
+    auto v          = a(range(0, 4, 2), range(1, 5), range(0, 6, 2));
+    auto [res, n_s] = collect(v.begin(), v.end());
+    EXPECT_TRUE(std::equal(res.begin(), res.end(), v.begin(), v.end()));
+    EXPECT_EQ(n_s, 2 * 4);
+
+    // partial ranges start and end in the middle of segments
+    for (long b = 0; b < v.size(); ++b)
+        for (long e = b; e <= v.size(); ++e)
+        {
+            auto [r, _] = collect(v.begin() + b, v.begin() + e);
+            EXPECT_TRUE(std::equal(r.begin(), r.end(), v.begin() + b, v.begin() + e));
+        }
+
+    // contiguous arrays consist of a single segment
+    long n_a = 0;
+    enda::for_each_segment(a, [&](long* p, long n, long s) {
+        EXPECT_EQ(p, a.data());
+        EXPECT_EQ(n, a.size());
+        EXPECT_EQ(s, 1);
+        ++n_a;
+    });
+    EXPECT_EQ(n_a, 1);
+
+    // contiguous segments can be used with std algorithms
+    auto w = a(_, range(1, 3), _);
+    enda::for_each_segment(w, [](long* p, long n, long s) {
+        EXPECT_EQ(s, 1);
+        std::fill(p, p + n, -1);
+    });
+    EXPECT_TRUE(std::all_of(w.begin(), w.end(), [](long x) { return x == -1; }));
+    EXPECT_EQ(a(0, 0, 0), 0);
+    EXPECT_EQ(a(3, 3, 5), 3 * 30 + 3 * 6 + 5);
+}
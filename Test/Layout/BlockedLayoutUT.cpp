@@ -0,0 +1,133 @@
+#include "../TestCommon.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <set>
+
+// Check that a blocked index map is a bijection onto a subset of [0, storage_size) and that to_idx is its inverse.
+template<typename M>
+void check_bijection(M const& m)
+{
+    std::set<long> offsets;
+    enda::for_each(m.lengths(), [&](auto... is) {
+        long const lin = m(is...);
+        EXPECT_GE(lin, 0);
+        EXPECT_LT(lin, m.storage_size());
+        EXPECT_EQ(m.to_idx(lin), (std::array<long, M::rank()> {is...}));
+        offsets.insert(lin);
+    });
+    EXPECT_EQ(offsets.size(), m.size());
+    EXPECT_GE(m.storage_size(), m.size());
+}
+
+TEST(BlockedLayoutTest, MortonIdxMap)
+{
+    check_bijection(enda::morton_idx_map<1>(std::array<long, 1> {13}));
+    check_bijection(enda::morton_idx_map<2>(std::array<long, 2> {8, 8}));
+    check_bijection(enda::morton_idx_map<2>(std::array<long, 2> {5, 7}));
+    check_bijection(enda::morton_idx_map<2>(std::array<long, 2> {100, 4}));
+    check_bijection(enda::morton_idx_map<3>(std::array<long, 3> {4, 6, 5}));
+    check_bijection(enda::morton_idx_map<4>(std::array<long, 4> {2, 3, 4, 4}));
+
+    // Z-order within a block
+    auto m = enda::morton_idx_map<2>(std::array<long, 2> {4, 4});
+    EXPECT_EQ(m.storage_size(), 16);
+    EXPECT_EQ(m(0, 0), 0);
+    EXPECT_EQ(m(0, 1), 1);
+    EXPECT_EQ(m(1, 0), 2);
+    EXPECT_EQ(m(1, 1), 3);
+    EXPECT_EQ(m(0, 2), 4);
+    EXPECT_EQ(m(2, 0), 8);
+    EXPECT_EQ(m(3, 3), 15);
+
+    // no padding for extents which are multiples of the block edge
+    EXPECT_EQ((enda::morton_idx_map<2>(std::array<long, 2> {100, 4}).storage_size()), 400);
+    EXPECT_EQ((enda::morton_idx_map<3>(std::array<long, 3> {16, 32, 8}).storage_size()), 16 * 32 * 8);
+
+    // the block edge is capped, so the padding is less than one block per dimension
+    auto big = enda::morton_idx_map<2>(std::array<long, 2> {1025, 1025});
+    EXPECT_EQ(big.block_shape(), (std::array<long, 2> {64, 64}));
+    EXPECT_EQ(big.storage_size(), 1088 * 1088);
+    EXPECT_EQ((enda::morton_idx_map<1>(std::array<long, 1> {5000}).storage_size()), 8192);
+    EXPECT_EQ((enda::morton_idx_map<3>(std::array<long, 3> {100, 100, 100}).storage_size()), 112 * 112 * 112);
+    check_bijection(enda::morton_idx_map<2>(std::array<long, 2> {130, 70}));
+}
+
+TEST(BlockedLayoutTest, TiledIdxMap)
+{
+    check_bijection(enda::tiled_idx_map<1, 4>(std::array<long, 1> {13}));
+    check_bijection(enda::tiled_idx_map<2, 4>(std::array<long, 2> {8, 8}));
+    check_bijection(enda::tiled_idx_map<2, 4>(std::array<long, 2> {5, 7}));
+    check_bijection(enda::tiled_idx_map<3, 3>(std::array<long, 3> {4, 6, 5}));
+
+    // block-local C-order
+    auto m = enda::tiled_idx_map<2, 2>(std::array<long, 2> {4, 6});
+    EXPECT_EQ(m.storage_size(), 24);
+    EXPECT_EQ(m(0, 1), 1);
+    EXPECT_EQ(m(1, 0), 2);
+    EXPECT_EQ(m(0, 2), 4);
+    EXPECT_EQ(m(2, 0), 12);
+
+    // padding
+    EXPECT_EQ((enda::tiled_idx_map<2, 4>(std::array<long, 2> {5, 7}).storage_size()), 8 * 8);
+}
+
+template<typename Layout>
+void check_blocked_array()
+{
+    // conversion from and to strided arrays
+    auto a = enda::array<double, 3>::rand(7, 9, 5);
+    auto b = enda::array<double, 3, Layout>(a);
+    EXPECT_EQ(b.shape(), a.shape());
+    enda::for_each(a.shape(), [&](auto i, auto j, auto k) { EXPECT_EQ(b(i, j, k), a(i, j, k)); });
+    auto c = enda::array<double, 3>(b);
+    EXPECT_EQ_ARRAY(c, a);
+    auto d = enda::array<double, 3, enda::F_layout>(b);
+    EXPECT_EQ_ARRAY(d, a);
+
+    // copy, assignment and expressions
+    enda::array<double, 3, Layout> e = b;
+    EXPECT_EQ_ARRAY((enda::array<double, 3>(e)), a);
+    e = 2 * b + 1;
+    EXPECT_ARRAY_NEAR((enda::array<double, 3>(e)), 2 * a + 1);
+    e() = a;
+    EXPECT_EQ_ARRAY((enda::array<double, 3>(e)), a);
+    e = 3.0;
+    EXPECT_EQ(enda::sum(e), 3.0 * a.size());
+    EXPECT_NEAR(enda::sum(b), enda::sum(a), 1e-10);
+
+    // iterators traverse in C-order
+    EXPECT_TRUE(std::equal(b.begin(), b.end(), a.begin(), a.end()));
+    EXPECT_EQ(b.end() - b.begin(), a.size());
+    auto it = b.begin() + 47;
+    EXPECT_EQ(*it, *(a.begin() + 47));
+    EXPECT_EQ(it.indices(), (std::array<long, 3> {1, 0, 2}));
+    EXPECT_EQ(*(--it), *(a.begin() + 46));
+
+    std::sort(e.begin(), e.end());
+    for (auto& x : e)
+        x = 1;
+    EXPECT_EQ(std::accumulate(e.begin(), e.end(), 0.0), double(a.size()));
+
+    // views
+    auto v = b();
+    v(1, 2, 3) = -1;
+    EXPECT_EQ(b(1, 2, 3), -1);
+}
+
+TEST(BlockedLayoutTest, MortonArray) { check_blocked_array<enda::morton_layout>(); }
+
+TEST(BlockedLayoutTest, TiledArray) { check_blocked_array<enda::tiled_layout<4>>(); }
+
+TEST(BlockedLayoutTest, BlockedToBlocked)
+{
+    auto a = enda::array<long, 2>(10, 12);
+    for (long i = 0; i < 10; ++i)
+        for (long j = 0; j < 12; ++j)
+            a(i, j) = 100 * i + j;
+    auto m = enda::array<long, 2, enda::morton_layout>(a);
+    auto t = enda::array<long, 2, enda::tiled_layout<8>>(m);
+    EXPECT_EQ_ARRAY((enda::array<long, 2>(t)), a);
+    EXPECT_EQ(t.indexmap().storage_size(), 16 * 16);
+    EXPECT_EQ(t.storage().size(), 16 * 16);
+}
@@ -0,0 +1,124 @@
+#include "../TestCommon.hpp"
+
+// Collapse the layout of a single array/view in its memory order.
+template<typename A>
+auto collapse(A const& a)
+{
+    return enda::detail::collapse_dims(a.indexmap().lengths(), a.indexmap().strides(), a.indexmap().stride_order);
+}
+
+TEST(CollapseTest, ContiguousArrays)
+{
+    enda::array<double, 3> a(3, 4, 5);
+    auto                   cl = collapse(a);
+    EXPECT_EQ(cl.rank, 1);
+    EXPECT_EQ(cl.inner_size(), 60);
+    EXPECT_EQ(cl.inner_stride(0), 1);
+
+    enda::array<double, 3, F_layout> b(3, 4, 5);
+    EXPECT_EQ(collapse(b).rank, 1);
+    EXPECT_EQ(collapse(transpose(a)).rank, 1);
+}
+
+TEST(CollapseTest, Views)
+{
+    enda::array<double, 3> a(3, 4, 5);
+
+    // middle dimension restricted: the outer dimension can not be merged
+    auto cl = collapse(a(range::all, range(0, 2), range::all));
+    EXPECT_EQ(cl.rank, 2);
+    EXPECT_EQ(cl.lengths[0], 3);
+    EXPECT_EQ(cl.lengths[1], 10);
+    EXPECT_EQ(cl.strides[0][0], 20);
+    EXPECT_EQ(cl.strides[0][1], 1);
+
+    // last dimension strided
+    auto cl2 = collapse(a(range::all, range::all, range(0, 5, 2)));
+    EXPECT_EQ(cl2.rank, 2);
+    EXPECT_EQ(cl2.inner_size(), 3);
+    EXPECT_EQ(cl2.inner_stride(0), 2);
+
+    // unit extents are dropped
+    auto cl3 = collapse(a(range(1, 2), range(0, 3), range(1, 2)));
+    EXPECT_EQ(cl3.rank, 1);
+    EXPECT_EQ(cl3.inner_size(), 3);
+    EXPECT_EQ(cl3.inner_stride(0), 5);
+
+    // a single element
+    auto cl4 = collapse(a(range(1, 2), range(2, 3), range(1, 2)));
+    EXPECT_EQ(cl4.rank, 1);
+    EXPECT_EQ(cl4.inner_size(), 1);
+}
+
+TEST(CollapseTest, TwoLayouts)
+{
+    // dimensions are only merged if they are jointly contiguous in both layouts
+    enda::array<double, 3> a(3, 4, 5), b(3, 4, 6);
+    auto                   va = a(range::all, range::all, range::all);
+    auto                   vb = b(range::all, range::all, range(0, 5));
+    auto cl = enda::detail::collapse_dims<2>(va.indexmap().lengths(), std::array {va.indexmap().strides(), vb.indexmap().strides()}, va.indexmap().stride_order);
+    EXPECT_EQ(cl.rank, 2);
+    EXPECT_EQ(cl.lengths[0], 12);
+    EXPECT_EQ(cl.lengths[1], 5);
+}
+
+TEST(CollapseTest, ForEachInnerRun)
+{
+    enda::array<long, 3> a(4, 3, 6);
+    a      = 0;
+    auto v  = a(range(0, 4, 2), range::all, range(1, 6));
+    auto cl = collapse(v);
+    EXPECT_EQ(cl.rank, 3);
+
+    long n_runs = 0;
+    enda::detail::for_each_inner_run(cl, [&](auto const& off) {
+        for (long i = 0; i < cl.inner_size(); ++i)
+            v.data()[off[0] + i * cl.inner_stride(0)] += 1;
+        ++n_runs;
+    });
+    EXPECT_EQ(n_runs, 2 * 3);
+    EXPECT_EQ(enda::sum(v), v.size());
+    EXPECT_EQ(enda::sum(a), v.size());
+}
+
+TEST(CollapseTest, KernelsOnViews)
+{
+    enda::array<long, 3> a(4, 5, 6);
+    a = 0;
+
+    // fill
+    auto v = a(range::all, range(1, 3), range::all);
+    v      = 2;
+    EXPECT_EQ(enda::sum(a), 2 * v.size());
+    EXPECT_EQ(enda::max_element(v), 2);
+
+    // copy between views with the same stride order
+    enda::array<long, 3> b(4, 5, 6);
+    b                                      = 1;
+    b(range::all, range(2, 4), range::all) = v;
+    EXPECT_EQ(enda::sum(b), 4 * 6 * 3 + 2 * v.size());
+    EXPECT_EQ_ARRAY(b(range::all, range(2, 4), range::all), v);
+
+    // copy into a strided view
+    enda::array<long, 3> c(4, 2, 12);
+    c                                          = 0;
+    c(range::all, range::all, range(0, 12, 2)) = v;
+    EXPECT_EQ(enda::sum(c), 2 * v.size());
+}
+
+TEST(CollapseTest, BlockLayout)
+{
+    enda::array<double, 3> a(3, 4, 5);
+    auto [n, bs, bstr] = get_block_layout(a(range::all, range(0, 2), range::all)).value();
+    EXPECT_EQ(n, 3);
+    EXPECT_EQ(bs, 10);
+    EXPECT_EQ(bstr, 20);
+
+    // unit extents do not prevent a block layout
+    auto [n1, bs1, bstr1] = get_block_layout(a(range(0, 3, 2), range(1, 2), range::all)).value();
+    EXPECT_EQ(n1, 2);
+    EXPECT_EQ(bs1, 5);
+    EXPECT_EQ(bstr1, 40);
+
+    EXPECT_FALSE(get_block_layout(a(range::all, range(0, 2), range(0, 5, 2))));
+}
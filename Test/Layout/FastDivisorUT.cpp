@@ -0,0 +1,60 @@
+#include "../TestCommon.hpp"
+
+#include <random>
+
+using enda::detail::fast_divisor;
+
+TEST(FastDivisorTest, SmallDivisors)
+{
+    for (long d = 1; d < 300; ++d)
+    {
+        fast_divisor fd {d};
+        EXPECT_EQ(fd.divisor(), d);
+        for (long n = 0; n < 5000; ++n)
+        {
+            EXPECT_EQ(n / fd, n / d);
+            EXPECT_EQ(n % fd, n % d);
+        }
+    }
+}
+
+TEST(FastDivisorTest, EdgeCases)
+{
+    constexpr long max = std::numeric_limits<long>::max();
+
+    // powers of two and their neighbours
+    for (int b = 0; b < 63; ++b)
+    {
+        for (long d : {(1L << b) - 1, 1L << b, (1L << b) + 1})
+        {
+            if (d <= 0) continue;
+            fast_divisor fd {d};
+            for (long n : {0L, 1L, d - 1, d, d + 1, 2 * (d / 2) + 1, max / 2, max - d, max - 1, max})
+            {
+                if (n < 0) continue;
+                EXPECT_EQ(n / fd, n / d) << "n = " << n << ", d = " << d;
+            }
+        }
+    }
+
+    // largest divisor
+    fast_divisor fd {max};
+    EXPECT_EQ(max / fd, 1);
+    EXPECT_EQ((max - 1) / fd, 0);
+}
+
+TEST(FastDivisorTest, RandomDividends)
+{
+    std::mt19937_64                     gen(42);
+    std::uniform_int_distribution<long> dist_d(1, 1L << 40), dist_n(0, std::numeric_limits<long>::max());
+    for (int i = 0; i < 1000; ++i)
+    {
+        long const   d = dist_d(gen);
+        fast_divisor fd {d};
+        for (int j = 0; j < 100; ++j)
+        {
+            long const n = dist_n(gen) >> (j % 40);
+            EXPECT_EQ(n / fd, n / d);
+        }
+    }
+}
@@ -0,0 +1,82 @@
+#include "../TestCommon.hpp"
+
+#include <vector>
+
+TEST(ForEachTest, ForEachIsCOrder)
+{
+    std::vector<std::array<long, 2>> idxs;
+    enda::for_each(std::array<long, 2> {2, 3}, [&idxs](long i, long j) { idxs.push_back({i, j}); });
+    std::vector<std::array<long, 2>> exp {{0, 0}, {0, 1}, {0, 2}, {1, 0}, {1, 1}, {1, 2}};
+    EXPECT_EQ(idxs, exp);
+}
+
+TEST(ForEachTest, OrderedCompileTime)
+{
+    std::vector<std::array<long, 3>> idxs;
+    enda::for_each_ordered<encode(std::array {2, 0, 1})>(std::array<long, 3> {2, 2, 2},
+                                                         [&idxs](long i, long j, long k) { idxs.push_back({i, j, k}); });
+    ASSERT_EQ(idxs.size(), 8);
+    // dimension 1 is the fastest, dimension 2 the slowest
+    EXPECT_EQ(idxs[0], (std::array<long, 3> {0, 0, 0}));
+    EXPECT_EQ(idxs[1], (std::array<long, 3> {0, 1, 0}));
+    EXPECT_EQ(idxs[2], (std::array<long, 3> {1, 0, 0}));
+    EXPECT_EQ(idxs[4], (std::array<long, 3> {0, 0, 1}));
+}
+
+TEST(ForEachTest, OrderedRunTime)
+{
+    std::vector<std::array<long, 3>> idxs_rt, idxs_ct;
+    auto shape = std::array<long, 3> {3, 4, 5};
+    enda::for_each_ordered(shape, std::array {1, 2, 0}, [&idxs_rt](long i, long j, long k) { idxs_rt.push_back({i, j, k}); });
+    enda::for_each_ordered<encode(std::array {1, 2, 0})>(shape, [&idxs_ct](long i, long j, long k) { idxs_ct.push_back({i, j, k}); });
+    EXPECT_EQ(idxs_rt.size(), 60);
+    EXPECT_EQ(idxs_rt, idxs_ct);
+}
+
+TEST(ForEachTest, TraversalFollowsMemoryOrder)
+{
+    // the visited addresses of a Fortran array and of a transposed view must be increasing
+    enda::array<double, 3, F_layout> a(3, 4, 5);
+    double const* last = a.data() - 1;
+    bool          ok   = true;
+    enda::for_each_ordered<enda::detail::traversal_order<decltype(a)>>(a.shape(), [&](auto... is) {
+        ok   = ok and (&a(is...) > last);
+        last = &a(is...);
+    });
+    EXPECT_TRUE(ok);
+
+    enda::array<double, 2> b(6, 7);
+    auto                   bt = transpose(b);
+    last                      = b.data() - 1;
+    enda::for_each_ordered<enda::detail::traversal_order<decltype(bt)>>(bt.shape(), [&](auto... is) {
+        ok   = ok and (&bt(is...) > last);
+        last = &bt(is...);
+    });
+    EXPECT_TRUE(ok);
+}
+
+TEST(ForEachTest, TraversalOrderOfExpressions)
+{
+    using C = enda::array<double, 2>;
+    using F = enda::array<double, 2, F_layout>;
+    EXPECT_EQ(enda::detail::traversal_order<F>, encode(std::array {1, 0}));
+    EXPECT_EQ(enda::detail::traversal_order<decltype(F {} + F {})>, encode(std::array {1, 0}));
+    // mixed stride orders fall back to C-order
+    EXPECT_EQ(enda::detail::traversal_order<decltype(F {} + C {})>, 0);
+}
+
+TEST(ForEachTest, FillAndFoldNonContiguousView)
+{
+    enda::array<long, 3, F_layout> a(4, 5, 6);
+    a      = 0;
+    auto v = a(range(0, 4, 2), range::all, range(1, 6));
+    v      = 3;
+    EXPECT_EQ(enda::sum(a), 3 * 2 * 5 * 5);
+    EXPECT_EQ(enda::sum(v), 3 * 2 * 5 * 5);
+
+    // generic elementwise assignment from an expression in the memory order of the destination
+    enda::array<long, 3, F_layout> b(2, 5, 5);
+    b = v + v;
+    EXPECT_EQ(enda::max_element(b), 6);
+    EXPECT_EQ(enda::sum(b), 6 * 2 * 5 * 5);
+}
@@ -284,3 +284,105 @@ TEST(IdxMapTest, for_each)
         EXPECT_EQ(fs.str(), "000 001 002 010 011 012 ");
     }
 }
+
+TEST(IdxMapTest, to_idx_batched)
+{
+    idx_map<3, 0, C_stride_order<3>, layout_prop_e::none>       iC {{5, 7, 3}};
+    idx_map<3, 0, Fortran_stride_order<3>, layout_prop_e::none> iF {{5, 7, 3}};
+    auto                                                        iP = iF.transpose<encode(std::array {0, 2, 1})>();
+    auto                                                        iS = iC.slice(range(0, 5, 2), _, range(1, 3)).second;
+
+    auto check = [](auto const& m) {
+        // linear indices of all elements in a shuffled order (with repetitions and more than one block)
+        std::vector<long> lin;
+        for (int rep = 0; rep < 7; ++rep)
+            for (auto i : range(m.lengths()[0]))
+                for (auto j : range(m.lengths()[1]))
+                    for (auto k : range(m.lengths()[2]))
+                        lin.push_back(m(i, j, k));
+        std::reverse(lin.begin() + lin.size() / 3, lin.end());
+
+        std::vector<std::array<long, 3>> idx(lin.size());
+        m.to_idx(lin, idx);
+        for (size_t n = 0; n < lin.size(); ++n)
+            EXPECT_TRUE(idx[n] == m.to_idx(lin[n]));
+    };
+    check(iC);
+    check(iF);
+    check(iP);
+    check(iS);
+
+    // empty batch
+    iC.to_idx(std::span<long const> {}, std::span<std::array<long, 3>> {});
+}
+
+TEST(IdxMapTest, next_idx)
+{
+    idx_map<3, 0, C_stride_order<3>, layout_prop_e::none>       iC {{2, 7, 3}};
+    idx_map<3, 0, Fortran_stride_order<3>, layout_prop_e::none> iF {{2, 7, 3}};
+
+    auto check = [](auto const& m) {
+        std::array<long, 3> idx {0, 0, 0};
+        for (long f = 1; f < m.size(); ++f)
+        {
+            EXPECT_TRUE(m.next_idx(idx));
+            EXPECT_TRUE(idx == m.to_idx(f));
+        }
+        EXPECT_FALSE(m.next_idx(idx));
+        EXPECT_TRUE(idx == (std::array<long, 3> {0, 0, 0}));
+    };
+    check(iC);
+    check(iF);
+}
+
+TEST(IdxMapTest, StaticStrides)
+{
+    // fully static and contiguous: strides are known at compile-time and not stored
+    using map_C = idx_map<3, encode(std::array<int, 3> {4, 3, 2}), C_stride_order<3>, layout_prop_e::contiguous>;
+    using map_F = idx_map<3, encode(std::array<int, 3> {4, 3, 2}), Fortran_stride_order<3>, layout_prop_e::contiguous>;
+    static_assert(map_C::has_static_strides and map_F::has_static_strides);
+    static_assert(map_C::ce_strides == std::array<long, 3> {6, 2, 1});
+    static_assert(map_F::ce_strides == std::array<long, 3> {1, 4, 12});
+    static_assert(sizeof(map_C) == 3 * sizeof(long));
+    EXPECT_EQ(map_C {}.strides(), (std::array<long, 3> {6, 2, 1}));
+    EXPECT_EQ(map_F {}.strides(), (std::array<long, 3> {1, 4, 12}));
+    EXPECT_EQ(map_C {}(3, 1, 1), 21);
+    EXPECT_EQ(map_F {}(3, 1, 1), 19);
+
+    // partially static: only the strides which do not depend on a dynamic extent are known
+    using map_P = idx_map<3, encode(std::array<int, 3> {0, 3, 2}), C_stride_order<3>, layout_prop_e::contiguous>;
+    using map_Q = idx_map<3, encode(std::array<int, 3> {4, 0, 2}), C_stride_order<3>, layout_prop_e::contiguous>;
+    static_assert(not map_P::has_static_strides);
+    static_assert(map_P::ce_strides == std::array<long, 3> {6, 2, 1});
+    static_assert(map_Q::ce_strides == std::array<long, 3> {0, 2, 1});
+    auto mq = map_Q {std::array<long, 1> {5}};
+    EXPECT_EQ(mq.strides(), (std::array<long, 3> {10, 2, 1}));
+    EXPECT_EQ(mq(3, 4, 1), 39);
+
+    // non-contiguous layouts have no compile-time strides
+    using map_N = idx_map<2, encode(std::array<int, 2> {4, 3}), C_stride_order<2>, layout_prop_e::none>;
+    static_assert(map_N::ce_strides == std::array<long, 2> {0, 0});
+    auto mn = map_N {{4, 3}, {6, 2}};
+    EXPECT_EQ(mn(1, 2), 10);
+
+    // conversion, slicing and transposition keep the maps consistent
+    auto mc  = map_C {};
+    auto mnc = idx_map<3, encode(std::array<int, 3> {4, 3, 2}), C_stride_order<3>, layout_prop_e::none> {mc};
+    EXPECT_EQ(mnc.strides(), mc.strides());
+    EXPECT_TRUE(mc == mnc);
+    auto [offset, ms] = mc.slice(2, range::all, range::all);
+    EXPECT_EQ(offset, 12);
+    EXPECT_EQ(ms.strides(), (std::array<long, 2> {2, 1}));
+    auto mt = mc.transpose<encode(std::array<int, 3> {2, 1, 0})>();
+    EXPECT_EQ(mt.strides(), (std::array<long, 3> {1, 2, 6}));
+    EXPECT_EQ(mt(1, 2, 3), mc(3, 2, 1));
+
+    // static arrays
+    enda::stack_array<long, 3, 3> a;
+    static_assert(decltype(a)::layout_t::has_static_strides);
+    for (long i = 0; i < 3; ++i)
+        for (long j = 0; j < 3; ++j)
+            a(i, j) = 10 * i + j;
+    EXPECT_EQ(a(2, 1), 21);
+    EXPECT_EQ_ARRAY((enda::array<long, 2>(transpose(a))), (enda::array<long, 2> {{0, 10, 20}, {1, 11, 21}, {2, 12, 22}}));
+}
@@ -0,0 +1,149 @@
+#include "../TestCommon.hpp"
+
+// Fill an array with values that encode their multi-dimensional index.
+template<typename A>
+void fill_with_indices(A& a)
+{
+    enda::for_each(a.shape(), [&a](auto... is) {
+        long v = 0;
+        ((v = 100 * v + is), ...);
+        a(is...) = v;
+    });
+}
+
+TEST(StridedCopyTest, TileSizeIsPowerOfTwo)
+{
+    auto b = enda::detail::transpose_tile_size<double>();
+    EXPECT_GE(b, 8);
+    EXPECT_LE(b, 64);
+    EXPECT_EQ(b & (b - 1), 0);
+}
+
+TEST(StridedCopyTest, CToFortranDouble)
+{
+    // odd sizes to exercise the remainders of the tiles and of the micro-kernel
+    enda::array<double, 2> a(67, 45);
+    fill_with_indices(a);
+
+    enda::array<double, 2, F_layout> b(67, 45);
+    b = a;
+    EXPECT_EQ_ARRAY(a, b);
+
+    enda::array<double, 2> c(67, 45);
+    c = b;
+    EXPECT_EQ_ARRAY(a, c);
+}
+
+TEST(StridedCopyTest, CToFortranComplex)
+{
+    enda::array<dcomplex, 2> a(33, 70);
+    enda::for_each(a.shape(), [&a](long i, long j) { a(i, j) = dcomplex(i, -j); });
+
+    enda::array<dcomplex, 2, F_layout> b(33, 70);
+    b = a;
+    EXPECT_EQ_ARRAY(a, b);
+}
+
+TEST(StridedCopyTest, AssignTransposedView)
+{
+    enda::array<double, 2> a(40, 29);
+    fill_with_indices(a);
+
+    enda::array<double, 2> b(29, 40);
+    b = transpose(a);
+    for (long i = 0; i < 29; ++i)
+        for (long j = 0; j < 40; ++j)
+            EXPECT_EQ(b(i, j), a(j, i));
+
+    // mixed value types
+    enda::array<long, 2> c(29, 40);
+    c = transpose(a);
+    EXPECT_EQ_ARRAY(c, b);
+}
+
+TEST(StridedCopyTest, OverlappingOperands)
+{
+    // in-place transpose by assignment
+    enda::array<double, 2> a(53, 53);
+    fill_with_indices(a);
+    auto b = enda::array<double, 2>(a);
+    a      = transpose(a);
+    EXPECT_EQ_ARRAY(a, (enda::array<double, 2>(transpose(b))));
+
+    // self assignment and partially overlapping views
+    a = a;
+    EXPECT_EQ_ARRAY(a, (enda::array<double, 2>(transpose(b))));
+    enda::array<double, 2> c(40, 40);
+    fill_with_indices(c);
+    auto d                        = enda::array<double, 2>(c);
+    c(range(0, 30), range(5, 35)) = transpose(c(range(10, 40), range(0, 30)));
+    for (long i = 0; i < 30; ++i)
+        for (long j = 0; j < 30; ++j)
+            EXPECT_EQ(c(i, j + 5), d(j + 10, i));
+
+    // in-place conjugate transpose
+    enda::matrix<dcomplex> m(37, 37);
+    enda::for_each(m.shape(), [&m](long i, long j) { m(i, j) = dcomplex(i, -j); });
+    m = dagger(m);
+    enda::for_each(m.shape(), [&m](long i, long j) { EXPECT_EQ(m(i, j), dcomplex(j, i)); });
+}
+
+TEST(StridedCopyTest, ConjugatingCopy)
+{
+    // conjugating transposed copy with and without the micro-kernel and conjugating runs
+    enda::array<dcomplex, 2> a(35, 66);
+    enda::for_each(a.shape(), [&a](long i, long j) { a(i, j) = dcomplex(i, -j); });
+    enda::array<dcomplex, 2> b(66, 35), c(35, 66);
+    enda::detail::strided_copy<true>(b.data(), b.indexmap().strides(), a.data(), transpose(a).indexmap().strides(), b.shape());
+    enda::detail::strided_copy<true>(c.data(), c.indexmap().strides(), a.data(), a.indexmap().strides(), c.shape());
+    for (long i = 0; i < 35; ++i)
+        for (long j = 0; j < 66; ++j)
+        {
+            EXPECT_EQ(b(j, i), dcomplex(i, j));
+            EXPECT_EQ(c(i, j), dcomplex(i, j));
+        }
+
+    // conjugation is a no-op for real values
+    enda::array<double, 2> d(19, 23), e(23, 19);
+    fill_with_indices(d);
+    enda::detail::strided_copy<true>(e.data(), e.indexmap().strides(), d.data(), transpose(d).indexmap().strides(), e.shape());
+    EXPECT_EQ_ARRAY(e, (enda::array<double, 2>(transpose(d))));
+}
+
+TEST(StridedCopyTest, StridedSubViews)
+{
+    enda::array<double, 2> a(50, 60);
+    fill_with_indices(a);
+    auto va = a(range(1, 50, 2), range(3, 60, 3));
+
+    enda::array<double, 2, F_layout> b(60, 70);
+    auto vb = b(range(5, 30), range(0, 57, 3));
+    vb      = va;
+    EXPECT_EQ_ARRAY(va, vb);
+}
+
+TEST(StridedCopyTest, PermutedRank3)
+{
+    enda::array<int, 3> a(7, 9, 11);
+    fill_with_indices(a);
+
+    auto p = permuted_indices_view<encode(std::array {1, 2, 0})>(a);
+    enda::array<int, 3> b(p.shape());
+    b = p;
+    EXPECT_EQ_ARRAY(b, p);
+
+    auto q = permuted_indices_view<encode(std::array {2, 0, 1})>(a);
+    enda::array<int, 3> c(q.shape());
+    c = q;
+    EXPECT_EQ_ARRAY(c, q);
+}
+
+TEST(StridedCopyTest, PermutedRank4WithUnitExtents)
+{
+    enda::array<double, 4> a(5, 1, 8, 6);
+    fill_with_indices(a);
+
+    enda::array<double, 4, F_layout> b(5, 1, 8, 6);
+    b = a;
+    EXPECT_EQ_ARRAY(a, b);
+}
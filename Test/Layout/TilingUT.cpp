@@ -0,0 +1,121 @@
+#include "../TestCommon.hpp"
+
+#include <set>
+
+TEST(TilingTest, L1DataCacheInfo)
+{
+    auto [size, line] = enda::detail::l1_data_cache_size_and_line();
+    EXPECT_GT(size, 0);
+    EXPECT_GT(line, 0);
+}
+
+TEST(TilingTest, DefaultTileShape)
+{
+    auto const [size, line_size] = enda::detail::l1_data_cache_size_and_line();
+    auto const line              = line_size / long(sizeof(double));
+
+    auto t2 = enda::default_tile_shape(std::array<long, 2> {1000, 1000});
+    EXPECT_EQ(t2[1] % line, 0);
+    EXPECT_LE(t2[0] * t2[1] * long(sizeof(double)), size);
+
+    auto t3 = enda::default_tile_shape(std::array<long, 3> {2, 500, 3});
+    EXPECT_EQ(t3[0], 2);
+    EXPECT_EQ(t3[2], 3);
+    EXPECT_GE(t3[1], 1);
+
+    // Fortran order: the first dimension is the fastest one
+    auto tf = enda::default_tile_shape(std::array<long, 2> {1000, 1000}, sizeof(double), 0);
+    EXPECT_EQ(tf[0] % line, 0);
+}
+
+TEST(TilingTest, ForEachTileVisitsEveryIndexOnce)
+{
+    std::array<long, 3> shape {7, 9, 5};
+    for (auto order : {enda::tile_order::lexicographic, enda::tile_order::morton})
+    {
+        for (auto tile : {std::array<long, 3> {2, 4, 3}, std::array<long, 3> {1, 1, 1}, std::array<long, 3> {10, 10, 10}})
+        {
+            std::set<std::array<long, 3>> visited;
+            long                          count = 0;
+            enda::for_each_tile(
+                shape, tile,
+                [&](long i, long j, long k) {
+                    visited.insert({i, j, k});
+                    ++count;
+                },
+                order);
+            EXPECT_EQ(count, 7 * 9 * 5);
+            EXPECT_EQ(visited.size(), 7 * 9 * 5);
+        }
+    }
+
+    // default tile shape
+    long count = 0;
+    enda::for_each_tile(std::array<long, 2> {33, 17}, [&](long, long) { ++count; });
+    EXPECT_EQ(count, 33 * 17);
+
+    // empty shape
+    enda::for_each_tile(std::array<long, 2> {0, 5}, std::array<long, 2> {2, 2}, [](long, long) { FAIL(); });
+}
+
+TEST(TilingTest, ForEachTileOrder)
+{
+    // indices within a tile are contiguous and tiles are visited in lexicographic order
+    std::vector<std::array<long, 2>> idxs;
+    enda::for_each_tile(std::array<long, 2> {4, 4}, std::array<long, 2> {2, 2}, [&](long i, long j) { idxs.push_back({i, j}); });
+    std::vector<std::array<long, 2>> exp {{0, 0}, {0, 1}, {1, 0}, {1, 1}, {0, 2}, {0, 3}, {1, 2}, {1, 3},
+                                          {2, 0}, {2, 1}, {3, 0}, {3, 1}, {2, 2}, {2, 3}, {3, 2}, {3, 3}};
+    EXPECT_EQ(idxs, exp);
+
+    // Z-order of the tiles with 1x1 tiles
+    idxs.clear();
+    enda::for_each_tile(std::array<long, 2> {4, 4}, std::array<long, 2> {1, 1}, [&](long i, long j) { idxs.push_back({i, j}); }, enda::tile_order::morton);
+    exp = {{0, 0}, {0, 1}, {1, 0}, {1, 1}, {0, 2}, {0, 3}, {1, 2}, {1, 3}, {2, 0}, {2, 1}, {3, 0}, {3, 1}, {2, 2}, {2, 3}, {3, 2}, {3, 3}};
+    EXPECT_EQ(idxs, exp);
+
+    // Fortran traversal order
+    idxs.clear();
+    enda::for_each_tile<enda::encode(std::array<int, 2> {1, 0})>(std::array<long, 2> {2, 2}, std::array<long, 2> {2, 2},
+                                                                  [&](long i, long j) { idxs.push_back({i, j}); });
+    exp = {{0, 0}, {1, 0}, {0, 1}, {1, 1}};
+    EXPECT_EQ(idxs, exp);
+}
+
+TEST(TilingTest, TilesCoverArray)
+{
+    for (auto order : {enda::tile_order::lexicographic, enda::tile_order::morton})
+    {
+        enda::array<long, 2> a(13, 10);
+        a() = 0;
+        auto tr = enda::tiles(a, {4, 3}, order);
+        EXPECT_EQ(tr.size(), 4 * 4);
+        for (auto t : tr)
+        {
+            EXPECT_LE(t.extent(0), 4);
+            EXPECT_LE(t.extent(1), 3);
+            t += 1;
+        }
+        EXPECT_EQ_ARRAY(a, (enda::array<long, 2>::ones(13, 10)));
+    }
+
+    // tiles are sub-views with the right offsets
+    auto a = enda::array<long, 2>(5, 5);
+    for (long i = 0; i < 5; ++i)
+        for (long j = 0; j < 5; ++j)
+            a(i, j) = 10 * i + j;
+    auto tr = enda::tiles(a, {2, 2});
+    auto r  = tr.ranges(3);
+    EXPECT_EQ(r[0].first(), 2);
+    EXPECT_EQ(r[1].first(), 0);
+    EXPECT_EQ(tr[3](1, 1), 31);
+    EXPECT_EQ(tr[8].extent(0), 1);
+    EXPECT_EQ(tr[8](0, 0), 44);
+
+    // default tile shape on a Fortran array
+    enda::array<double, 3, enda::F_layout> b(20, 7, 3);
+    b()      = 1;
+    double s = 0;
+    for (auto t : enda::tiles(b, enda::tile_order::morton))
+        s += enda::sum(t);
+    EXPECT_EQ(s, 20 * 7 * 3);
+}
@@ -0,0 +1,255 @@
+#include "./LinalgTestCommon.hpp"
+
+// Matrix S * diag(f(d)) * S^{-1}.
+template<typename T, typename F>
+auto similar_diagonal_matrix(matrix<T> const& s, vector<T> const& d, F f)
+{
+    const long n  = d.size();
+    auto       sd = matrix<T>(s);
+    for (long j = 0; j < n; ++j)
+        sd(_, j) *= f(d(j));
+    return matrix<T>(sd * inverse(s));
+}
+
+// Relative error in the Frobenius norm.
+template<typename A, typename B>
+double relative_error(A const& a, B const& ref)
+{
+    return frobenius_norm(matrix<get_value_t<B>>(a - ref)) / std::max(1.0, frobenius_norm(ref));
+}
+
+TEST(AnalyticFunctions, ExpmKnownMatrices)
+{
+    // zero and diagonal matrices
+    auto z = matrix<double>(5, 5);
+    z      = 0;
+    EXPECT_ARRAY_NEAR(expm(z), eye<double>(5), 1e-15);
+    EXPECT_EQ(expm(matrix<double>(0, 0)).size(), 0);
+
+    // nilpotent matrix: exp(N) = I + N + N^2 / 2
+    auto nil = matrix<double> {{0, 1, 2}, {0, 0, 3}, {0, 0, 0}};
+    EXPECT_ARRAY_NEAR(expm(nil), matrix<double> {{1, 1, 3.5}, {0, 1, 3}, {0, 0, 1}}, 1e-14);
+
+    // generator of rotations
+    for (double t : {0.01, 0.7, 3.0, 40.0})
+    {
+        auto g   = matrix<double> {{0, -t}, {t, 0}};
+        auto rot = matrix<double> {{std::cos(t), -std::sin(t)}, {std::sin(t), std::cos(t)}};
+        EXPECT_ARRAY_NEAR(expm(g), rot, 1e-12);
+    }
+
+    // upper triangular matrix with distinct diagonal elements
+    auto u   = matrix<double> {{1, 1}, {0, 2}};
+    auto ref = matrix<double> {{std::exp(1.0), std::exp(2.0) - std::exp(1.0)}, {0, std::exp(2.0)}};
+    EXPECT_ARRAY_NEAR(expm(u), ref, 1e-13);
+}
+
+TEST(AnalyticFunctions, ExpmGeneral)
+{
+    for (long n : {1, 3, 8, 30, 100})
+    {
+        // all Pade degrees and the squaring phase are exercised by the different norms
+        for (double scale : {1e-3, 0.1, 0.5, 1.5, 4.0, 30.0})
+        {
+            auto d = vector<double>(array<double, 1>::rand(n));
+            d      = scale * (2 * d - 1);
+            auto sm = random_matrix<double>(n);
+            auto a  = similar_diagonal_matrix(sm, d, [](double x) { return x; });
+            auto e  = similar_diagonal_matrix(sm, d, [](double x) { return std::exp(x); });
+            EXPECT_LE(relative_error(expm(a), e), 1e-10 * (1 + scale));
+        }
+
+        // exp(A) * exp(-A) = I and det(exp(A)) = exp(tr(A))
+        auto a  = matrix<dcomplex>(array<dcomplex, 2>::rand(n, n));
+        a       = (1.0 / std::sqrt(n)) * a;
+        auto ea = expm(a);
+        EXPECT_ARRAY_NEAR(matrix<dcomplex>(ea * expm(matrix<dcomplex>(-a))), eye<dcomplex>(n), 1e-11);
+        dcomplex tr = 0;
+        for (long i = 0; i < n; ++i)
+            tr += a(i, i);
+        EXPECT_LE(std::abs(determinant(ea) / std::exp(tr) - 1.0), 1e-10);
+    }
+
+    // single precision and strided views
+    auto af = matrix<float>(array<float, 2>::rand(20, 20));
+    EXPECT_LE(relative_error(matrix<double>(expm(af)), expm(matrix<double>(af))), 1e-5);
+    auto big = matrix<double>(array<double, 2>::rand(40, 40));
+    EXPECT_ARRAY_NEAR(expm(big(range(0, 40, 2), range(1, 40, 2))), expm(matrix<double>(big(range(0, 40, 2), range(1, 40, 2)))), 1e-13);
+    EXPECT_LE(relative_error(expm(transpose(big)), matrix<double>(transpose(expm(big)))), 1e-13);
+
+    // non-finite input
+    auto bad  = matrix<double>(3, 3);
+    bad       = 0;
+    bad(1, 2) = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_THROW(expm(bad), enda::runtime_error);
+}
+
+TEST(AnalyticFunctions, ExpmHermitian)
+{
+    for (long n : {1, 4, 25, 80})
+    {
+        // unitary time evolution operator exp(-i H t)
+        auto h = random_hermitian_matrix<dcomplex>(n);
+        for (double t : {0.01, 1.0, 25.0})
+        {
+            auto u = expm(matrix<dcomplex>(dcomplex(0, -t) * h));
+            EXPECT_ARRAY_NEAR(matrix<dcomplex>(dagger(u) * u), eye<dcomplex>(n), 1e-12);
+            EXPECT_ARRAY_NEAR(matrix<dcomplex>(u * expm(matrix<dcomplex>(dcomplex(0, t) * h))), eye<dcomplex>(n), 1e-12);
+        }
+
+        // exp(H) is Hermitian positive definite with eigenvalues exp(w)
+        auto hr = random_hermitian_matrix<double>(n);
+        hr      = (1.0 / std::sqrt(n)) * hr;
+        auto e  = expm(hr);
+        EXPECT_EQ(max_element(abs(matrix<double>(e - transpose(e)))), 0.0);
+        auto w  = linalg::eigvalsh(hr);
+        auto we = linalg::eigvalsh(e);
+        for (long i = 0; i < n; ++i)
+            EXPECT_NEAR(we(i), std::exp(w(i)), 1e-13 * n * std::exp(w(n - 1)));
+    }
+}
+
+TEST(AnalyticFunctions, Sqrtm)
+{
+    for (long n : {1, 2, 9, 40, 90})
+    {
+        // general real and complex matrices
+        auto a = random_matrix<double>(n);
+        auto x = sqrtm(a);
+        EXPECT_LE(relative_error(matrix<double>(x * x), a), 1e-12);
+        auto c  = random_matrix<dcomplex>(n);
+        auto xc = sqrtm(c);
+        EXPECT_LE(relative_error(matrix<dcomplex>(xc * xc), c), 1e-12);
+
+        // Hermitian positive definite matrix gives a Hermitian square root
+        auto h  = random_hermitian_matrix<dcomplex>(n);
+        auto hp = matrix<dcomplex>(h * h + eye<dcomplex>(n));
+        auto xh = sqrtm(hp);
+        EXPECT_ARRAY_NEAR(xh, matrix<dcomplex>(dagger(xh)), 1e-12 * frobenius_norm(xh));
+        EXPECT_LE(relative_error(matrix<dcomplex>(xh * xh), hp), 1e-12);
+
+        // known eigenvalues
+        auto d = vector<double>(array<double, 1>::rand(n));
+        d      = d + 0.1;
+        auto sm = random_matrix<double>(n);
+        auto s  = similar_diagonal_matrix(sm, d, [](double x) { return x; });
+        auto r  = similar_diagonal_matrix(sm, d, [](double x) { return std::sqrt(x); });
+        EXPECT_LE(relative_error(sqrtm(s), r), 1e-10);
+    }
+
+    // complex eigenvalues of a real matrix and singular Hermitian matrices
+    auto rot = matrix<double> {{0, -4}, {4, 0}};
+    EXPECT_ARRAY_NEAR(sqrtm(rot), matrix<double> {{std::sqrt(2.0), -std::sqrt(2.0)}, {std::sqrt(2.0), std::sqrt(2.0)}}, 1e-13);
+    auto z = matrix<double>(4, 4);
+    z      = 0;
+    EXPECT_ARRAY_NEAR(sqrtm(z), z, 1e-15);
+
+    // real matrices with negative eigenvalues have no real square root
+    auto neg = matrix<double> {{-1, 0}, {0, 2}};
+    EXPECT_THROW(sqrtm(neg), enda::runtime_error);
+    auto negc = sqrtm(matrix<dcomplex>(neg));
+    EXPECT_ARRAY_NEAR(negc, matrix<dcomplex> {{dcomplex(0, 1), 0}, {0, std::sqrt(2.0)}}, 1e-14);
+    auto nonsym = matrix<double> {{-1, 1}, {0, -2}};
+    EXPECT_THROW(sqrtm(nonsym), enda::runtime_error);
+}
+
+TEST(AnalyticFunctions, Logm)
+{
+    for (long n : {1, 3, 12, 50})
+    {
+        // logm is the inverse of expm for matrices with eigenvalues whose imaginary parts are in (-pi, pi)
+        auto b  = matrix<dcomplex>(array<dcomplex, 2>::rand(n, n));
+        b       = (1.0 / n) * b;
+        auto lb = logm(expm(b));
+        EXPECT_LE(relative_error(lb, b), 1e-10);
+
+        auto a = random_matrix<double>(n);
+        EXPECT_LE(relative_error(expm(logm(a)), a), 1e-10);
+
+        // known eigenvalues
+        auto d = vector<double>(array<double, 1>::rand(n));
+        d      = 0.05 + 20 * d;
+        auto sm = random_matrix<double>(n);
+        auto s  = similar_diagonal_matrix(sm, d, [](double x) { return x; });
+        auto r  = similar_diagonal_matrix(sm, d, [](double x) { return std::log(x); });
+        EXPECT_LE(relative_error(logm(s), r), 1e-9);
+
+        // Hermitian positive definite matrices
+        auto h  = random_hermitian_matrix<dcomplex>(n);
+        h       = (1.0 / std::sqrt(n)) * h;
+        auto eh = expm(h);
+        EXPECT_LE(relative_error(logm(eh), h), 1e-10);
+    }
+
+    // unitary matrix: log(exp(i H)) = i H for ||H|| < pi
+    auto h = random_hermitian_matrix<dcomplex>(6);
+    h      = (1.0 / frobenius_norm(h)) * h;
+    auto u = expm(matrix<dcomplex>(dcomplex(0, 1) * h));
+    EXPECT_ARRAY_NEAR(logm(u), matrix<dcomplex>(dcomplex(0, 1) * h), 1e-13);
+
+    // singular matrices and negative eigenvalues of real matrices
+    auto z = matrix<double>(3, 3);
+    z      = 0;
+    EXPECT_THROW(logm(z), enda::runtime_error);
+    EXPECT_THROW(logm(matrix<double> {{1, 2}, {0, 0}}), enda::runtime_error);
+    EXPECT_THROW(logm(matrix<double> {{-3, 0}, {0, 1}}), enda::runtime_error);
+    EXPECT_ARRAY_NEAR(logm(matrix<dcomplex> {{-1, 0}, {0, 1}}), matrix<dcomplex> {{dcomplex(0, std::numbers::pi), 0}, {0, 0}}, 1e-14);
+
+    // ill-conditioned but regular matrices give the same result with the Hermitian and with the general algorithm
+    auto ref = matrix<double> {{0, 0}, {0, std::log(1e-17)}};
+    EXPECT_ARRAY_NEAR(logm(matrix<double> {{1, 0}, {0, 1e-17}}), ref, 1e-12);
+    EXPECT_ARRAY_NEAR(logm(matrix<double> {{1, 1e-30}, {0, 1e-17}}), ref, 1e-12);
+}
+
+TEST(AnalyticFunctions, Batched)
+{
+    auto a = array<dcomplex, 3>(11, 7, 7);
+    for (long k = 0; k < 11; ++k)
+        a(k, _, _) = (k % 2 == 0 ? random_hermitian_matrix<dcomplex>(7) : random_matrix<dcomplex>(7));
+    auto e = expm(a);
+    auto s = sqrtm(a);
+    auto b = array<dcomplex, 3>(e);
+    auto l = logm(b);
+    for (long k = 0; k < 11; ++k)
+    {
+        auto ak = matrix<dcomplex>(a(k, _, _));
+        EXPECT_ARRAY_NEAR(matrix<dcomplex>(e(k, _, _)), expm(ak), 1e-12 * frobenius_norm(expm(ak)));
+        EXPECT_ARRAY_NEAR(matrix<dcomplex>(s(k, _, _)), sqrtm(ak), 1e-12);
+        EXPECT_ARRAY_NEAR(matrix<dcomplex>(l(k, _, _)), logm(matrix<dcomplex>(b(k, _, _))), 1e-12);
+    }
+
+    // strided stacks
+    auto r  = array<double, 3, F_layout>(array<double, 3>::rand(9, 4, 4));
+    auto er = expm(r);
+    for (long k = 0; k < 9; ++k)
+        EXPECT_ARRAY_NEAR(matrix<double>(er(k, _, _)), expm(matrix<double>(r(k, _, _))), 1e-13);
+}
+
+TEST(AnalyticFunctions, Parallel)
+{
+    const long old_threshold = enda::parallel::get_threshold();
+    enda::parallel::set_num_threads(4);
+    enda::parallel::set_threshold(0);
+
+    auto a = array<double, 3>(40, 6, 6);
+    for (long k = 0; k < 40; ++k)
+        a(k, _, _) = random_matrix<double>(6);
+    auto s = sqrtm(a);
+    auto e = expm(a);
+    for (long k = 0; k < 40; ++k)
+    {
+        auto ak = matrix<double>(a(k, _, _));
+        EXPECT_ARRAY_NEAR(matrix<double>(s(k, _, _)), sqrtm(ak), 1e-12);
+        EXPECT_ARRAY_NEAR(matrix<double>(e(k, _, _)), expm(ak), 1e-12 * frobenius_norm(expm(ak)));
+    }
+    auto big = random_matrix<double>(150);
+    auto x   = sqrtm(big);
+    EXPECT_LE(relative_error(matrix<double>(x * x), big), 1e-12);
+
+    // exceptions in the workers are propagated
+    a(17, _, _) = matrix<double> {{-1, 0, 0, 0, 0, 0}, {0, 1, 0, 0, 0, 0}, {0, 0, 1, 0, 0, 0}, {0, 0, 0, 1, 0, 0}, {0, 0, 0, 0, 1, 0}, {0, 0, 0, 0, 0, 1}};
+    EXPECT_THROW(sqrtm(a), enda::runtime_error);
+
+    enda::parallel::set_threshold(old_threshold);
+    enda::parallel::set_num_threads(enda::parallel::detail::default_num_threads());
+}
@@ -0,0 +1,144 @@
+#include "./LinalgTestCommon.hpp"
+
+// Fill a stack of matrices with random, well conditioned matrices.
+template<typename A>
+void fill_stack(A&& a)
+{
+    using T = get_value_t<A>;
+    for (long k = 0; k < a.shape()[0]; ++k)
+        a(k, _, _) = random_matrix<T>(a.shape()[1]);
+}
+
+// Check a batched product against the products of the individual matrices.
+template<typename C, typename A, typename B>
+void check_batched_gemm(A const& a, B const& b, double precision)
+{
+    using T          = get_value_t<C>;
+    const long batch = a.shape()[0];
+    auto       c     = C(batch, a.shape()[1], b.shape()[2]);
+    c                = T(1);
+    auto c0          = array<T, 3>(c);
+    linalg::gemm(T(2), a, b, T(3), c);
+    for (long k = 0; k < batch; ++k)
+    {
+        auto ref = matrix<T>(T(2) * matrix<T>(a(k, _, _)) * matrix<T>(b(k, _, _)) + T(3) * matrix<T>(c0(k, _, _)));
+        EXPECT_ARRAY_NEAR(matrix<T>(c(k, _, _)), ref, precision);
+    }
+
+    auto p = linalg::matmul(a, b);
+    for (long k = 0; k < batch; ++k)
+        EXPECT_ARRAY_NEAR(matrix<T>(p(k, _, _)), matrix<T>(matrix<T>(a(k, _, _)) * matrix<T>(b(k, _, _))), precision);
+}
+
+// Check the inverses of a stack of matrices.
+template<typename A>
+void check_batched_inverse(A const& a, double precision)
+{
+    using T          = get_value_t<A>;
+    const long batch = a.shape()[0], n = a.shape()[1];
+    auto       inv   = inverse(a);
+    static_assert(std::is_same_v<decltype(inv), std::remove_cvref_t<A>>);
+    auto det = determinant(a);
+    for (long k = 0; k < batch; ++k)
+    {
+        auto ak = matrix<T>(a(k, _, _));
+        EXPECT_ARRAY_NEAR(matrix<T>(ak * matrix<T>(inv(k, _, _))), eye<T>(n), precision);
+        EXPECT_NEAR(std::abs(det(k) / determinant(ak) - T(1)), 0, precision);
+    }
+
+    auto lu   = a;
+    auto ip   = array<int, 2>(batch, n);
+    auto info = linalg::getrf(lu, ip);
+    EXPECT_EQ(max_element(info), 0);
+    for (long k = 0; k < batch; ++k)
+    {
+        auto luk = matrix<T>(a(k, _, _));
+        auto ipk = vector<int>(n);
+        linalg::getrf(luk, ipk);
+        EXPECT_ARRAY_EQ(ipk, vector<int>(ip(k, _)));
+        EXPECT_ARRAY_NEAR(matrix<T>(lu(k, _, _)), luk, precision);
+    }
+}
+
+TEST(Batched, Gemm)
+{
+    // generic C ordered stacks
+    auto a = array<double, 3>::rand(37, 5, 7);
+    auto b = array<double, 3>::rand(37, 7, 3);
+    check_batched_gemm<array<double, 3>>(a, b, 1e-12);
+    auto az = array<dcomplex, 3>::rand(20, 24, 30);
+    auto bz = array<dcomplex, 3>::rand(20, 30, 20);
+    check_batched_gemm<array<dcomplex, 3>>(az, bz, 1e-12);
+
+    // interleaved stacks
+    using il_t = linalg::batch_interleaved_layout;
+    auto ai    = array<dcomplex, 3, il_t>(array<dcomplex, 3>::rand(150, 4, 6));
+    auto bi    = array<dcomplex, 3, il_t>(array<dcomplex, 3>::rand(150, 6, 5));
+    check_batched_gemm<array<dcomplex, 3, il_t>>(ai, bi, 1e-12);
+    static_assert(std::is_same_v<decltype(linalg::matmul(ai, bi)), array<dcomplex, 3, il_t>>);
+
+    // static matrix extents
+    using s43_t = linalg::static_matrix_stack_layout<4, 3>;
+    using s32_t = linalg::static_matrix_stack_layout<3, 2>;
+    auto as     = array<double, 3, s43_t>(array<double, 3>::rand(70, 4, 3));
+    auto bs     = array<double, 3, s32_t>(array<double, 3>::rand(70, 3, 2));
+    check_batched_gemm<array<double, 3, linalg::static_matrix_stack_layout<4, 2>>>(as, bs, 1e-12);
+    static_assert(std::is_same_v<decltype(linalg::matmul(as, bs)), array<double, 3, linalg::static_matrix_stack_layout<4, 2>>>);
+
+    // strided stacks and expressions
+    auto big = array<double, 3>::rand(5, 40, 6);
+    auto sv  = permuted_indices_view<encode(std::array {1, 0, 2})>(big(range(0, 5), range(0, 40, 2), range(0, 5)));
+    auto tv  = permuted_indices_view<encode(std::array {1, 0, 2})>(big(range(0, 5), range(1, 40, 2), range(1, 6)));
+    check_batched_gemm<array<double, 3>>(sv, tv, 1e-12);
+    auto p = linalg::matmul(2 * a, b);
+    for (long k = 0; k < 37; ++k)
+        EXPECT_ARRAY_NEAR(matrix<double>(p(k, _, _)), matrix<double>(2 * matrix<double>(a(k, _, _)) * matrix<double>(b(k, _, _))), 1e-12);
+}
+
+TEST(Batched, InverseAndLU)
+{
+    auto a = array<dcomplex, 3>(30, 9, 9);
+    fill_stack(a);
+    check_batched_inverse(a, 1e-12);
+
+    auto ai = array<dcomplex, 3, linalg::batch_interleaved_layout>(150, 7, 7);
+    fill_stack(ai);
+    check_batched_inverse(ai, 1e-12);
+
+    auto as = array<double, 3, linalg::static_matrix_stack_layout<5>>(40, 5, 5);
+    fill_stack(as);
+    check_batched_inverse(as, 1e-12);
+
+    // singular matrices
+    auto s           = array<double, 3, linalg::batch_interleaved_layout>(3, 2, 2);
+    s(0, _, _)       = matrix<double> {{1, 2}, {3, 4}};
+    s(1, _, _)       = matrix<double> {{1, 2}, {2, 4}};
+    s(2, _, _)       = matrix<double> {{0, 1}, {1, 0}};
+    auto ip          = array<long, 2>(3, 2);
+    auto ls          = s;
+    auto info        = linalg::getrf(ls, ip);
+    EXPECT_ARRAY_EQ(info, (vector<int> {0, 2, 0}));
+    EXPECT_THROW(inverse(s), enda::runtime_error);
+    auto fs          = array<double, 3, linalg::static_matrix_stack_layout<2>>(s);
+    EXPECT_THROW(inverse(fs), enda::runtime_error);
+}
+
+TEST(Batched, Parallel)
+{
+    const long old_threshold = enda::parallel::get_threshold();
+    enda::parallel::set_num_threads(4);
+    enda::parallel::set_threshold(0);
+
+    auto ai = array<double, 3, linalg::batch_interleaved_layout>(500, 6, 6);
+    fill_stack(ai);
+    check_batched_inverse(ai, 1e-12);
+    check_batched_gemm<array<double, 3, linalg::batch_interleaved_layout>>(ai, ai, 1e-12);
+
+    auto as = array<dcomplex, 3, linalg::static_matrix_stack_layout<3>>(300, 3, 3);
+    fill_stack(as);
+    check_batched_inverse(as, 1e-12);
+    check_batched_gemm<array<dcomplex, 3, linalg::static_matrix_stack_layout<3>>>(as, as, 1e-12);
+
+    enda::parallel::set_threshold(old_threshold);
+    enda::parallel::set_num_threads(enda::parallel::detail::default_num_threads());
+}
@@ -0,0 +1,228 @@
+#include "./LinalgTestCommon.hpp"
+
+// Random Hermitian positive definite n x n matrix.
+template<typename T>
+auto random_hpd_matrix(long n)
+{
+    auto b = matrix<T>(array<T, 2>::rand(n, n));
+    auto a = matrix<T>(b * dagger(b));
+    for (long i = 0; i < n; ++i)
+        a(i, i) += T(n);
+    return a;
+}
+
+// Check that the LU factorization of a matrix reproduces the row-interchanged matrix.
+template<typename T, typename Layout>
+void check_lu(long m, long n, double precision)
+{
+    auto a  = matrix<T>(array<T, 2>::rand(m, n));
+    auto lu = matrix<T, Layout>(a);
+    auto ip = vector<int>(std::min(m, n));
+    EXPECT_EQ(linalg::getrf(lu, ip), 0);
+
+    const long k = std::min(m, n);
+    auto       l = matrix<T>(m, k);
+    auto       u = matrix<T>(k, n);
+    l            = 0;
+    u            = 0;
+    for (long i = 0; i < m; ++i)
+        for (long j = 0; j < n; ++j)
+        {
+            if (j < i and j < k)
+                l(i, j) = lu(i, j);
+            else if (i < k)
+                u(i, j) = lu(i, j);
+        }
+    for (long i = 0; i < k; ++i)
+        l(i, i) = 1;
+
+    for (long i = 0; i < k; ++i)
+        for (long j = 0; j < n; ++j)
+            std::swap(a(i, j), a(ip(i), j));
+    EXPECT_ARRAY_NEAR(matrix<T>(l * u), a, precision);
+}
+
+TEST(Factorizations, LU)
+{
+    check_lu<double, C_layout>(5, 5, 1e-12);
+    check_lu<double, F_layout>(7, 4, 1e-12);
+    check_lu<double, C_layout>(150, 150, 1e-10);
+    check_lu<double, F_layout>(200, 130, 1e-10);
+    check_lu<double, C_layout>(90, 170, 1e-10);
+    check_lu<float, C_layout>(100, 100, 1e-3);
+    check_lu<dcomplex, F_layout>(140, 140, 1e-10);
+
+    // singular matrix
+    auto a = matrix<double> {{1, 2, 3}, {2, 4, 6}, {1, 0, 1}};
+    auto ip = vector<long>(3);
+    EXPECT_EQ(linalg::getrf(a, ip), 3);
+}
+
+TEST(Factorizations, Solve)
+{
+    for (long n : {1, 6, 70, 190})
+    {
+        auto a = random_matrix<double>(n);
+        auto b = vector<double>(array<double, 1>::rand(n));
+        auto x = linalg::solve(a, b);
+        EXPECT_ARRAY_NEAR(vector<double>(a * x), b, 1e-10);
+
+        auto bm = matrix<double>(array<double, 2>::rand(n, 3));
+        auto xm = linalg::solve(transpose(a), bm);
+        EXPECT_ARRAY_NEAR(matrix<double>(transpose(a) * xm), bm, 1e-10);
+    }
+
+    auto a = random_matrix<dcomplex>(80);
+    auto b = vector<dcomplex>(array<dcomplex, 1>::rand(80));
+    EXPECT_ARRAY_NEAR(vector<dcomplex>(a * linalg::solve(a, b)), b, 1e-10);
+
+    // in place with a strided right hand side
+    auto lu = matrix<dcomplex>(a);
+    auto ip = vector<int>(80);
+    linalg::getrf(lu, ip);
+    auto bb = matrix<dcomplex>(80, 4);
+    bb      = 0;
+    bb(_, 2) = b;
+    linalg::getrs(lu, ip, bb(_, 2));
+    EXPECT_ARRAY_NEAR(vector<dcomplex>(a * bb(_, 2)), b, 1e-10);
+
+    EXPECT_THROW(linalg::solve(matrix<double> {{1, 2}, {2, 4}}, vector<double> {1, 1}), enda::runtime_error);
+}
+
+TEST(Factorizations, InverseAndDeterminant)
+{
+    for (long n : {1, 2, 9, 64, 65, 160})
+    {
+        auto a   = random_matrix<double>(n);
+        auto inv = inverse(a);
+        EXPECT_ARRAY_NEAR(matrix<double>(a * inv), eye<double>(n), 1e-10);
+
+        matrix<double, F_layout> af(a);
+        inverse_in_place(af);
+        EXPECT_ARRAY_NEAR(af, inv, 1e-10);
+    }
+
+    auto c = random_matrix<dcomplex>(100);
+    EXPECT_ARRAY_NEAR(matrix<dcomplex>(c * inverse(c)), eye<dcomplex>(100), 1e-10);
+    EXPECT_ARRAY_NEAR(matrix<dcomplex>(2.0 / c), matrix<dcomplex>(2.0 * inverse(c)), 1e-12);
+    EXPECT_THROW(inverse(matrix<double> {{1, 2}, {2, 4}}), enda::runtime_error);
+
+    // determinants
+    EXPECT_NEAR(determinant(matrix<double> {{1, 2}, {3, 4}}), -2, 1e-13);
+    EXPECT_NEAR(determinant(matrix<double> {{0, 1, 0}, {1, 0, 0}, {0, 0, 5}}), -5, 1e-13);
+    EXPECT_EQ(determinant(matrix<double> {{1, 2}, {2, 4}}), 0);
+    auto a = matrix<dcomplex>(random_matrix<dcomplex>(90) / 90.0);
+    auto b = matrix<dcomplex>(random_matrix<dcomplex>(90) / 90.0);
+    auto d = determinant(matrix<dcomplex>(a * b)) / (determinant(a) * determinant(b));
+    EXPECT_NEAR(std::abs(d - 1.0), 0, 1e-10);
+    EXPECT_NEAR(std::abs(determinant(transpose(a)) / determinant(a) - 1.0), 0, 1e-10);
+}
+
+TEST(Factorizations, Cholesky)
+{
+    for (long n : {1, 7, 64, 150})
+    {
+        auto a = random_hpd_matrix<double>(n);
+        auto l = matrix<double, F_layout>(a);
+        EXPECT_EQ(linalg::potrf(l), 0);
+        for (long i = 0; i < n; ++i)
+            for (long j = i + 1; j < n; ++j)
+                EXPECT_EQ(l(i, j), 0);
+        EXPECT_ARRAY_NEAR(matrix<double>(l * transpose(l)), a, 1e-10);
+    }
+
+    auto a = random_hpd_matrix<dcomplex>(130);
+    auto l = matrix<dcomplex>(a);
+    EXPECT_EQ(linalg::potrf(l), 0);
+    EXPECT_ARRAY_NEAR(matrix<dcomplex>(l * dagger(l)), a, 1e-10);
+
+    auto m = matrix<double> {{1, 2}, {2, 1}};
+    EXPECT_EQ(linalg::potrf(m), 2);
+}
+
+// Check the QR factorization of a random m x n matrix (m >= n).
+template<typename T, typename Layout>
+void check_qr(long m, long n, double precision)
+{
+    auto a   = matrix<T>(array<T, 2>::rand(m, n));
+    auto q   = matrix<T, Layout>(a);
+    auto tau = vector<T>(n);
+    linalg::geqrf(q, tau);
+    auto r = matrix<T>(n, n);
+    r      = 0;
+    for (long i = 0; i < n; ++i)
+        for (long j = i; j < n; ++j)
+            r(i, j) = q(i, j);
+    linalg::orgqr(q, tau);
+    EXPECT_ARRAY_NEAR(matrix<T>(q * r), a, precision);
+    EXPECT_ARRAY_NEAR(matrix<T>(dagger(q) * q), eye<T>(n), precision);
+}
+
+TEST(Factorizations, QR)
+{
+    check_qr<double, C_layout>(6, 6, 1e-12);
+    check_qr<double, F_layout>(10, 4, 1e-12);
+    check_qr<double, C_layout>(200, 150, 1e-10);
+    check_qr<double, F_layout>(160, 160, 1e-10);
+    check_qr<dcomplex, C_layout>(150, 100, 1e-10);
+    check_qr<dcomplex, F_layout>(7, 3, 1e-12);
+}
+
+TEST(Factorizations, Batched)
+{
+    const long batch = 50, n = 8;
+    auto       a     = array<dcomplex, 3>(batch, n, n);
+    for (long k = 0; k < batch; ++k)
+        a(k, _, _) = random_matrix<dcomplex>(n);
+
+    auto inv = inverse(a);
+    auto det = determinant(a);
+    for (long k = 0; k < batch; ++k)
+    {
+        auto ak = matrix<dcomplex>(a(k, _, _));
+        EXPECT_ARRAY_NEAR(matrix<dcomplex>(ak * matrix_view<dcomplex>(inv(k, _, _))), eye<dcomplex>(n), 1e-12);
+        EXPECT_NEAR(std::abs(det(k) / determinant(ak) - 1.0), 0, 1e-12);
+    }
+
+    // strided stack
+    auto b = array<double, 3>(n, 3 * batch, n);
+    for (long k = 0; k < 3 * batch; ++k)
+        b(_, k, _) = random_matrix<double>(n);
+    auto bv  = b(_, range(0, 3 * batch, 3), _);
+    auto ref = array<double, 3>(batch, n, n);
+    for (long k = 0; k < batch; ++k)
+        ref(k, _, _) = inverse(matrix<double>(bv(_, k, _)));
+    auto stack = permuted_indices_view<encode(std::array {1, 0, 2})>(bv);
+    inverse_in_place(stack);
+    for (long k = 0; k < batch; ++k)
+        EXPECT_ARRAY_NEAR(array<double, 2>(bv(_, k, _)), array<double, 2>(ref(k, _, _)), 1e-12);
+
+    auto ip   = array<int, 2>(batch, n);
+    auto info = linalg::getrf(a, ip);
+    EXPECT_EQ(max_element(info), 0);
+}
+
+TEST(Factorizations, ParallelBatchedAndBlocked)
+{
+    const long old_threshold = enda::parallel::get_threshold();
+    enda::parallel::set_num_threads(4);
+    enda::parallel::set_threshold(0);
+
+    auto a = random_matrix<double>(260);
+    EXPECT_ARRAY_NEAR(matrix<double>(a * inverse(a)), eye<double>(260), 1e-10);
+    auto h = random_hpd_matrix<dcomplex>(200);
+    auto l = matrix<dcomplex>(h);
+    EXPECT_EQ(linalg::potrf(l), 0);
+    EXPECT_ARRAY_NEAR(matrix<dcomplex>(l * dagger(l)), h, 1e-10);
+    check_qr<double, C_layout>(300, 200, 1e-10);
+
+    auto s = array<double, 3>(200, 6, 6);
+    for (long k = 0; k < 200; ++k)
+        s(k, _, _) = random_matrix<double>(6);
+    auto inv = inverse(s);
+    for (long k = 0; k < 200; ++k)
+        EXPECT_ARRAY_NEAR(matrix<double>(matrix_view<double>(s(k, _, _)) * matrix_view<double>(inv(k, _, _))), eye<double>(6), 1e-12);
+
+    enda::parallel::set_threshold(old_threshold);
+    enda::parallel::set_num_threads(enda::parallel::detail::default_num_threads());
+}
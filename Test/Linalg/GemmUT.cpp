@@ -0,0 +1,236 @@
+#include "../TestCommon.hpp"
+
+// Reference implementation of a matrix-matrix product.
+template<typename A, typename B>
+auto naive_matmul(A const& a, B const& b)
+{
+    using T = decltype(get_value_t<A> {} * get_value_t<B> {});
+    matrix<T> c(a.extent(0), b.extent(1));
+    c = 0;
+    for (long i = 0; i < a.extent(0); ++i)
+        for (long j = 0; j < b.extent(1); ++j)
+            for (long k = 0; k < a.extent(1); ++k)
+                c(i, j) += a(i, k) * b(k, j);
+    return c;
+}
+
+// Test the product of two random matrices of a given size for all combinations of layouts.
+template<typename T>
+void check_matmul(long m, long n, long k, double precision)
+{
+    auto a = matrix<T>(array<T, 2>::rand(m, k));
+    auto b = matrix<T>(array<T, 2>::rand(k, n));
+    auto r = naive_matmul(a, b);
+
+    matrix<T, F_layout> af(a), bf(b);
+    EXPECT_ARRAY_NEAR(a * b, r, precision);
+    EXPECT_ARRAY_NEAR(af * b, r, precision);
+    EXPECT_ARRAY_NEAR(a * bf, r, precision);
+    EXPECT_ARRAY_NEAR(af * bf, r, precision);
+
+    // result with a Fortran layout and a strided result
+    matrix<T, F_layout> cf(m, n);
+    linalg::gemm(T {1}, a, bf, T {0}, cf);
+    EXPECT_ARRAY_NEAR(cf, r, precision);
+    matrix<T> big(2 * m, 3 * n);
+    big = 0;
+    auto cv = big(range(0, 2 * m, 2), range(1, 3 * n, 3));
+    linalg::gemm(T {1}, a, b, T {0}, cv);
+    EXPECT_ARRAY_NEAR(cv, r, precision);
+
+    // alpha and beta
+    matrix<T> c = r;
+    linalg::gemm(T {2}, a, b, T {-1}, c);
+    EXPECT_ARRAY_NEAR(c, r, precision);
+}
+
+TEST(Gemm, Double)
+{
+    check_matmul<double>(1, 1, 1, 1e-13);
+    check_matmul<double>(3, 5, 7, 1e-13);
+    check_matmul<double>(37, 29, 300, 1e-11);
+    check_matmul<double>(130, 70, 530, 1e-11);
+}
+
+TEST(Gemm, Float) { check_matmul<float>(67, 45, 300, 1e-3); }
+
+TEST(Gemm, Complex)
+{
+    check_matmul<dcomplex>(5, 4, 3, 1e-13);
+    check_matmul<dcomplex>(70, 33, 260, 1e-11);
+}
+
+TEST(Gemm, TransposeAndDagger)
+{
+    auto a = matrix<dcomplex>(array<dcomplex, 2>::rand(40, 30));
+    auto b = matrix<dcomplex>(array<dcomplex, 2>::rand(40, 20));
+    auto r = naive_matmul(matrix<dcomplex>(dagger(a)), b);
+    EXPECT_ARRAY_NEAR(dagger(a) * b, r, 1e-11);
+    EXPECT_ARRAY_NEAR(transpose(a) * b, naive_matmul(matrix<dcomplex>(transpose(a)), b), 1e-11);
+    EXPECT_ARRAY_NEAR(dagger(b) * a, naive_matmul(matrix<dcomplex>(dagger(b)), a), 1e-11);
+
+    // conjugation without transposition and conjugation of both operands
+    EXPECT_ARRAY_NEAR(conj(a) * transpose(a), naive_matmul(matrix<dcomplex>(conj(a)), matrix<dcomplex>(transpose(a))), 1e-11);
+    EXPECT_ARRAY_NEAR(conj(a) * dagger(a(range(0, 25), range::all)), naive_matmul(matrix<dcomplex>(conj(a)), matrix<dcomplex>(dagger(a(range(0, 25), range::all)))), 1e-11);
+
+    // real matrices
+    auto d = matrix<double>(array<double, 2>::rand(50, 60));
+    EXPECT_ARRAY_NEAR(dagger(d) * d, naive_matmul(matrix<double>(transpose(d)), d), 1e-11);
+}
+
+TEST(Gemm, MixedTypesAndExpressions)
+{
+    auto a = matrix<double>(array<double, 2>::rand(20, 30));
+    auto b = matrix<dcomplex>(array<dcomplex, 2>::rand(30, 10));
+    EXPECT_ARRAY_NEAR(a * b, naive_matmul(a, b), 1e-12);
+    EXPECT_ARRAY_NEAR((a + a) * b, naive_matmul(matrix<double>(2 * a), b), 1e-12);
+
+    matrix<long> i1 {{1, 2}, {3, 4}};
+    EXPECT_ARRAY_EQ(i1 * i1, (matrix<long> {{7, 10}, {15, 22}}));
+}
+
+TEST(Gemm, Epilogue)
+{
+    // several KC blocks: the epilogue is applied exactly once
+    auto a  = matrix<double>(array<double, 2>::rand(70, 530));
+    auto b  = matrix<double>(array<double, 2>::rand(530, 40));
+    auto r  = naive_matmul(a, b);
+    auto c  = matrix<double>(70, 40);
+    auto sq = [](double x) { return x * x; };
+    linalg::gemm(1.0, a, b, 0.0, c, sq);
+    EXPECT_ARRAY_NEAR(c, matrix<double>(map(sq)(r)), 1e-9);
+    linalg::gemm(1.0, a(range(0, 3), range::all), b, 0.0, c(range(0, 3), range::all), sq);
+    EXPECT_ARRAY_NEAR(c, matrix<double>(map(sq)(r)), 1e-9);
+
+    // stack matrices
+    stack_matrix<double, 3, 3> s1, s2, s3;
+    s1 = 2.0;
+    s2 = 3.0;
+    linalg::gemm(1.0, s1, s2, 0.0, s3, [](double x) { return x + 1; });
+    EXPECT_ARRAY_NEAR(s3, (matrix<double> {{7, 1, 1}, {1, 7, 1}, {1, 1, 7}}), 1e-14);
+}
+
+TEST(Gemm, FusedExpressions)
+{
+    auto a = matrix<double>(array<double, 2>::rand(60, 300));
+    auto b = matrix<double>(array<double, 2>::rand(300, 50));
+    auto c = matrix<double>(array<double, 2>::rand(60, 50));
+    auto r = naive_matmul(a, b);
+
+    // scaling and accumulation into the destination
+    matrix<double> d = c;
+    d                = 2.0 * a * b + 0.5 * d;
+    EXPECT_ARRAY_NEAR(d, matrix<double>(2 * r + 0.5 * c), 1e-11);
+    d = c;
+    d = a * (b * 3.0) - d * 0.5;
+    EXPECT_ARRAY_NEAR(d, matrix<double>(3 * r - 0.5 * c), 1e-11);
+    d = c;
+    d += a * b;
+    EXPECT_ARRAY_NEAR(d, matrix<double>(r + c), 1e-11);
+    d = c;
+    d -= -a * b;
+    EXPECT_ARRAY_NEAR(d, matrix<double>(r + c), 1e-11);
+
+    // accumulation of other arrays and elementwise epilogues
+    d = c - a * b;
+    EXPECT_ARRAY_NEAR(d, matrix<double>(c - r), 1e-11);
+    d = map([](double x) { return std::exp(-x); })(a * b + 2 * c);
+    EXPECT_ARRAY_NEAR(d, matrix<double>(exp(-make_array_view(r) - 2 * make_array_view(c))), 1e-11);
+
+    // strided destination, products of expressions and nested products
+    matrix<double> big(120, 150);
+    big     = 0;
+    auto dv = big(range(0, 120, 2), range(1, 150, 3));
+    dv      = -(a + a) * b;
+    EXPECT_ARRAY_NEAR(dv, matrix<double>(-2 * r), 1e-11);
+    auto e = matrix<double>(array<double, 2>::rand(50, 20));
+    d      = a * b * e;
+    EXPECT_ARRAY_NEAR(d, naive_matmul(r, e), 1e-10);
+    EXPECT_ARRAY_NEAR(matrix<double>(a * b + a * b), matrix<double>(2 * r), 1e-11);
+
+    // complex products with conjugated operands
+    auto z  = matrix<dcomplex>(array<dcomplex, 2>::rand(40, 30));
+    auto zc = matrix<dcomplex>(array<dcomplex, 2>::rand(30, 30));
+    auto zr = naive_matmul(matrix<dcomplex>(dagger(z)), z);
+    matrix<dcomplex> w = zc;
+    w                  = dcomplex(0, 1) * dagger(z) * z + 2.0 * w;
+    EXPECT_ARRAY_NEAR(w, matrix<dcomplex>(dcomplex(0, 1) * zr + 2.0 * zc), 1e-11);
+}
+
+TEST(Gemm, LazyProducts)
+{
+    auto a = matrix<double>(array<double, 2>::rand(30, 30));
+    auto b = matrix<double>(array<double, 2>::rand(30, 30));
+    auto r = naive_matmul(a, b);
+
+    // elementwise access, reductions and copies share one evaluation
+    auto p = a * b;
+    EXPECT_EQ(p.shape(), (std::array<long, 2> {30, 30}));
+    EXPECT_NEAR(p(3, 4), r(3, 4), 1e-12);
+    EXPECT_NEAR(sum(p), sum(r), 1e-10);
+    auto q = p;
+    EXPECT_EQ(&q.value(), &p.value());
+    EXPECT_ARRAY_NEAR(p(range(0, 10), 2), r(range(0, 10), 2), 1e-12);
+
+    // destination aliasing an operand
+    auto a2 = a;
+    a2      = a2 * b;
+    EXPECT_ARRAY_NEAR(a2, r, 1e-11);
+    auto b2 = b;
+    b2      = 2.0 * a * b2 + b2;
+    EXPECT_ARRAY_NEAR(b2, matrix<double>(2 * r + b), 1e-11);
+    auto a3 = a;
+    a3(range(0, 10), range::all) = a3(range(0, 10), range::all) * b;
+    EXPECT_ARRAY_NEAR(a3(range(0, 10), range::all), r(range(0, 10), range::all), 1e-11);
+
+    // resizing destination which is an operand
+    auto t = matrix<double>(array<double, 2>::rand(30, 7));
+    auto s = matrix<double>(a);
+    s      = s * t;
+    EXPECT_ARRAY_NEAR(s, naive_matmul(a, t), 1e-11);
+}
+
+TEST(Gemm, MatrixVector)
+{
+    for (long n : {3l, 100l, 700l})
+    {
+        auto a  = matrix<double>(array<double, 2>::rand(n + 1, n));
+        auto x  = vector<double>(array<double, 1>::rand(n));
+        auto r  = vector<double>(n + 1);
+        r       = 0;
+        for (long i = 0; i <= n; ++i)
+            for (long j = 0; j < n; ++j)
+                r(i) += a(i, j) * x(j);
+        matrix<double, F_layout> af(a);
+        EXPECT_ARRAY_NEAR(a * x, r, 1e-11);
+        EXPECT_ARRAY_NEAR(af * x, r, 1e-11);
+        EXPECT_ARRAY_NEAR(transpose(af)(range::all, range(0, n)) * x(range(0, n)), matrix<double>(transpose(a)(range::all, range(0, n))) * x(range(0, n)), 1e-11);
+
+        vector<double> y = r;
+        linalg::gemv(2.0, af, x, -1.0, y);
+        EXPECT_ARRAY_NEAR(y, r, 1e-11);
+    }
+
+    auto a = matrix<dcomplex>(array<dcomplex, 2>::rand(17, 9));
+    auto x = vector<dcomplex>(array<dcomplex, 1>::rand(17));
+    EXPECT_ARRAY_NEAR(dagger(a) * x, matrix<dcomplex>(dagger(a)) * x, 1e-12);
+    EXPECT_ARRAY_NEAR(conj(a) * x(range(0, 9)), matrix<dcomplex>(conj(a)) * x(range(0, 9)), 1e-12);
+}
+
+TEST(Gemm, Parallel)
+{
+    const long old_threshold = enda::parallel::get_threshold();
+    enda::parallel::set_num_threads(4);
+    enda::parallel::set_threshold(0);
+
+    check_matmul<double>(200, 150, 300, 1e-11);
+    check_matmul<double>(9, 500, 40, 1e-11);
+    check_matmul<dcomplex>(65, 80, 90, 1e-11);
+
+    auto a = matrix<double>(array<double, 2>::rand(300, 200));
+    auto x = vector<double>(array<double, 1>::rand(200));
+    EXPECT_ARRAY_NEAR(a * x, matrix<double, F_layout>(a) * x, 1e-11);
+
+    enda::parallel::set_threshold(old_threshold);
+    enda::parallel::set_num_threads(enda::parallel::detail::default_num_threads());
+}
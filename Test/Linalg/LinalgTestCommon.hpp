@@ -0,0 +1,26 @@
+/**
+ * @file LinalgTestCommon.hpp
+ * @brief Provides random test matrices shared by the linear algebra tests.
+ */
+
+#pragma once
+
+#include "../TestCommon.hpp"
+
+// Random, well conditioned n x n matrix.
+template<typename T>
+auto random_matrix(long n)
+{
+    auto a = matrix<T>(array<T, 2>::rand(n, n));
+    for (long i = 0; i < n; ++i)
+        a(i, i) += T(n);
+    return a;
+}
+
+// Random Hermitian n x n matrix.
+template<typename T>
+auto random_hermitian_matrix(long n)
+{
+    auto b = matrix<T>(array<T, 2>::rand(n, n));
+    return matrix<T>(b + dagger(b));
+}
@@ -0,0 +1,183 @@
+#include "./LinalgTestCommon.hpp"
+
+// Hermitian n x n matrix with the given eigenvalues and random eigenvectors.
+template<typename T>
+auto hermitian_matrix_with_spectrum(vector<double> const& w)
+{
+    const long n = w.size();
+    auto       q = matrix<T>(array<T, 2>::rand(n, n));
+    auto       r = vector<T>(n);
+    linalg::geqrf(q, r);
+    linalg::orgqr(q, r);
+    auto qw = matrix<T>(q);
+    for (long j = 0; j < n; ++j)
+        qw(_, j) *= T(w(j));
+    return matrix<T>(qw * dagger(q));
+}
+
+// Check the residual and the orthogonality of an eigen-decomposition.
+template<typename T, typename A>
+void check_eigh(A const& a, double precision)
+{
+    const long n       = a.shape()[0];
+    auto const [w, v]  = linalg::eigh(a);
+    auto       ref     = matrix<T>(a);
+    const auto scale   = std::max(1.0, frobenius_norm(ref));
+    auto       vw      = matrix<T>(v);
+    for (long j = 0; j < n; ++j)
+        vw(_, j) *= T(w(j));
+    EXPECT_LE(frobenius_norm(matrix<T>(ref * v - vw)), precision * scale);
+    EXPECT_ARRAY_NEAR(matrix<T>(dagger(v) * v), eye<T>(n), precision);
+    for (long i = 1; i < n; ++i)
+        EXPECT_LE(w(i - 1), w(i));
+    EXPECT_ARRAY_NEAR(linalg::eigvalsh(a), w, precision * scale);
+}
+
+// Check the reconstruction and the orthogonality of a thin SVD.
+template<typename T, typename A>
+void check_svd(A const& a, double precision)
+{
+    const long m = a.shape()[0], n = a.shape()[1], k = std::min(m, n);
+    auto const [u, s, vh] = linalg::svd(a);
+    EXPECT_EQ(u.shape(), (std::array {m, k}));
+    EXPECT_EQ(vh.shape(), (std::array {k, n}));
+    auto       ref   = matrix<T>(a);
+    const auto scale = std::max(1.0, frobenius_norm(ref));
+    auto       us    = matrix<T>(u);
+    for (long j = 0; j < k; ++j)
+        us(_, j) *= T(s(j));
+    EXPECT_LE(frobenius_norm(matrix<T>(us * vh - ref)), precision * scale);
+    EXPECT_ARRAY_NEAR(matrix<T>(dagger(u) * u), eye<T>(k), precision);
+    EXPECT_ARRAY_NEAR(matrix<T>(vh * dagger(vh)), eye<T>(k), precision);
+    for (long i = 1; i < k; ++i)
+        EXPECT_LE(s(i), s(i - 1));
+    EXPECT_ARRAY_NEAR(linalg::svdvals(a), s, precision * scale);
+}
+
+TEST(Spectral, Eigh)
+{
+    for (long n : {1, 2, 7, 26, 60, 150})
+    {
+        check_eigh<double>(random_hermitian_matrix<double>(n), 1e-11);
+        check_eigh<dcomplex>(random_hermitian_matrix<dcomplex>(n), 1e-11);
+    }
+    check_eigh<double>(matrix<double, F_layout>(random_hermitian_matrix<double>(90)), 1e-11);
+
+    // strided views and expressions
+    auto big = random_hermitian_matrix<dcomplex>(160);
+    check_eigh<dcomplex>(big(range(0, 160, 2), range(0, 160, 2)), 1e-11);
+    check_eigh<dcomplex>(2 * big, 1e-11);
+
+    // only the lower triangle is referenced
+    auto a     = random_hermitian_matrix<double>(40);
+    auto lower = a;
+    for (long i = 0; i < 40; ++i)
+        for (long j = i + 1; j < 40; ++j)
+            lower(i, j) = 1000;
+    EXPECT_ARRAY_NEAR(linalg::eigvalsh(lower), linalg::eigvalsh(a), 1e-11);
+
+    // known spectrum
+    auto w = vector<double>(array<double, 1>::rand(80));
+    std::sort(w.begin(), w.end());
+    EXPECT_ARRAY_NEAR(linalg::eigvalsh(hermitian_matrix_with_spectrum<dcomplex>(w)), w, 1e-12);
+}
+
+TEST(Spectral, EighDegenerate)
+{
+    // repeated eigenvalues exercise the deflation of the divide and conquer
+    auto w = vector<double>(120);
+    for (long i = 0; i < 120; ++i)
+        w(i) = static_cast<double>(i % 3);
+    check_eigh<double>(hermitian_matrix_with_spectrum<double>(w), 1e-11);
+    check_eigh<dcomplex>(hermitian_matrix_with_spectrum<dcomplex>(w), 1e-11);
+
+    // rank one and diagonal matrices
+    auto ones = matrix<double>(100, 100);
+    ones      = 1;
+    check_eigh<double>(ones, 1e-11);
+    auto d = matrix<double>(100, 100);
+    d      = 0;
+    for (long i = 0; i < 100; ++i)
+        d(i, i) = static_cast<double>(i % 7);
+    check_eigh<double>(d, 1e-12);
+    check_eigh<double>(eye<double>(50), 1e-12);
+}
+
+TEST(Spectral, SVD)
+{
+    for (auto [m, n] : {std::pair {1l, 1l}, {5l, 5l}, {40l, 40l}, {70l, 20l}, {20l, 70l}, {130l, 90l}})
+    {
+        check_svd<double>(matrix<double>(array<double, 2>::rand(m, n)), 1e-11);
+        check_svd<dcomplex>(matrix<dcomplex>(array<dcomplex, 2>::rand(m, n)), 1e-11);
+    }
+    auto big = matrix<double>(array<double, 2>::rand(100, 80));
+    check_svd<double>(big(range(0, 100, 3), range(1, 80, 2)), 1e-11);
+    check_svd<double>(transpose(big), 1e-11);
+
+    // rank deficient matrices
+    auto x = vector<dcomplex>(array<dcomplex, 1>::rand(30));
+    auto y = vector<dcomplex>(array<dcomplex, 1>::rand(20));
+    auto r = matrix<dcomplex>(30, 20);
+    for (long i = 0; i < 30; ++i)
+        for (long j = 0; j < 20; ++j)
+            r(i, j) = x(i) * std::conj(y(j));
+    check_svd<dcomplex>(r, 1e-11);
+    EXPECT_NEAR(linalg::svdvals(r)(0), std::sqrt(sum(abs2(x)) * sum(abs2(y))), 1e-11);
+    auto z = matrix<double>(6, 4);
+    z      = 0;
+    check_svd<double>(z, 1e-12);
+
+    // known singular values
+    auto s  = vector<double> {5, 4, 3, 2, 1};
+    auto a  = hermitian_matrix_with_spectrum<double>(vector<double> {-5, 4, -3, 2, 1});
+    EXPECT_ARRAY_NEAR(linalg::svdvals(a), s, 1e-12);
+}
+
+TEST(Spectral, Batched)
+{
+    auto a = array<dcomplex, 3>(13, 9, 9);
+    for (long k = 0; k < 13; ++k)
+        a(k, _, _) = random_hermitian_matrix<dcomplex>(9);
+    auto [w, v] = linalg::eigh(a);
+    for (long k = 0; k < 13; ++k)
+    {
+        auto [wk, vk] = linalg::eigh(matrix<dcomplex>(a(k, _, _)));
+        EXPECT_ARRAY_NEAR(vector<double>(w(k, _)), wk, 1e-12);
+        auto vw = matrix<dcomplex>(v(k, _, _));
+        for (long j = 0; j < 9; ++j)
+            vw(_, j) *= w(k, j);
+        EXPECT_ARRAY_NEAR(matrix<dcomplex>(matrix<dcomplex>(a(k, _, _)) * matrix<dcomplex>(v(k, _, _))), vw, 1e-11);
+    }
+
+    auto b           = array<double, 3, F_layout>(array<double, 3>::rand(11, 7, 4));
+    auto [u, s, vh]  = linalg::svd(b);
+    for (long k = 0; k < 11; ++k)
+    {
+        auto us = matrix<double>(u(k, _, _));
+        for (long j = 0; j < 4; ++j)
+            us(_, j) *= s(k, j);
+        EXPECT_ARRAY_NEAR(matrix<double>(us * matrix<double>(vh(k, _, _))), matrix<double>(b(k, _, _)), 1e-12);
+    }
+}
+
+TEST(Spectral, Parallel)
+{
+    const long old_threshold = enda::parallel::get_threshold();
+    enda::parallel::set_num_threads(4);
+    enda::parallel::set_threshold(0);
+
+    check_eigh<double>(random_hermitian_matrix<double>(200), 1e-11);
+    check_eigh<dcomplex>(random_hermitian_matrix<dcomplex>(70), 1e-11);
+    check_svd<double>(matrix<double>(array<double, 2>::rand(90, 60)), 1e-11);
+    check_svd<dcomplex>(matrix<dcomplex>(array<dcomplex, 2>::rand(30, 45)), 1e-11);
+
+    auto a = array<double, 3>(40, 6, 6);
+    for (long k = 0; k < 40; ++k)
+        a(k, _, _) = random_hermitian_matrix<double>(6);
+    auto [w, v] = linalg::eigh(a);
+    for (long k = 0; k < 40; ++k)
+        EXPECT_ARRAY_NEAR(vector<double>(w(k, _)), linalg::eigvalsh(matrix<double>(a(k, _, _))), 1e-12);
+
+    enda::parallel::set_threshold(old_threshold);
+    enda::parallel::set_num_threads(enda::parallel::detail::default_num_threads());
+}
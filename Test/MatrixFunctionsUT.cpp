@@ -155,6 +155,124 @@ TEST(Matrix, DaggerSlice)
 
 // ===============================================================
 
+TEST(Matrix, TransposeCopy)
+{
+    // odd sizes to exercise the remainders of the tiles
+    auto a  = matrix<dcomplex>(array<dcomplex, 2>::rand(131, 77));
+    auto at = transpose_copy(a);
+    auto ad = dagger_copy(a);
+    EXPECT_EQ(at.shape(), (enda::shape_t<2> {77, 131}));
+    for (long i = 0; i < 77; ++i)
+        for (long j = 0; j < 131; ++j)
+        {
+            EXPECT_EQ(at(i, j), a(j, i));
+            EXPECT_EQ(ad(i, j), std::conj(a(j, i)));
+        }
+
+    // the stride order of the argument is kept
+    auto f  = matrix<double, F_layout>(array<double, 2>::rand(40, 65));
+    auto ft = transpose_copy(f);
+    static_assert(std::is_same_v<decltype(ft), matrix<double, F_layout>>);
+    EXPECT_EQ_ARRAY(ft, matrix<double>(transpose(f)));
+    EXPECT_EQ_ARRAY(dagger_copy(f), ft);
+
+    // strided views
+    auto v = a(range(1, 131, 3), range(0, 77, 2));
+    EXPECT_EQ_ARRAY(dagger_copy(v), matrix<dcomplex>(dagger(matrix<dcomplex>(v))));
+}
+
+TEST(Matrix, AssignDagger)
+{
+    auto a = matrix<dcomplex>(array<dcomplex, 2>::rand(70, 45));
+    auto b = matrix<dcomplex>(45, 70);
+    b      = dagger(a);
+    auto c = matrix<dcomplex, F_layout>(dagger(a));
+    for (long i = 0; i < 45; ++i)
+        for (long j = 0; j < 70; ++j)
+        {
+            EXPECT_EQ(b(i, j), std::conj(a(j, i)));
+            EXPECT_EQ(c(i, j), std::conj(a(j, i)));
+        }
+
+    // conjugate without transposition and into a strided view
+    auto d = matrix<dcomplex>(70, 45);
+    d      = conj(a);
+    for (long i = 0; i < 70; ++i)
+        for (long j = 0; j < 45; ++j)
+            EXPECT_EQ(d(i, j), std::conj(a(i, j)));
+    auto e                             = matrix<dcomplex>(90, 90);
+    e(range(0, 90, 2), range(10, 80)) = dagger(a);
+    EXPECT_EQ_ARRAY(matrix<dcomplex>(e(range(0, 90, 2), range(10, 80))), b);
+}
+
+TEST(Matrix, TransposeInplace)
+{
+    for (long n : {1, 7, 64, 150})
+    {
+        // square matrices in both stride orders
+        auto a = matrix<dcomplex>(array<dcomplex, 2>::rand(n, n));
+        auto b = a;
+        transpose_inplace(b);
+        EXPECT_EQ_ARRAY(b, matrix<dcomplex>(transpose(a)));
+        b = a;
+        dagger_inplace(b);
+        EXPECT_EQ_ARRAY(b, matrix<dcomplex>(dagger(a)));
+        auto f = matrix<double, F_layout>(array<double, 2>::rand(n, n));
+        auto g = f;
+        transpose_inplace(g);
+        EXPECT_EQ_ARRAY(g, matrix<double>(transpose(f)));
+    }
+
+    // square submatrices with and without a unit stride
+    auto a = matrix<double>(array<double, 2>::rand(100, 120));
+    auto b = a;
+    transpose_inplace(b(range(5, 95), range(20, 110)));
+    EXPECT_EQ_ARRAY(matrix<double>(b(range(5, 95), range(20, 110))), matrix<double>(transpose(a(range(5, 95), range(20, 110)))));
+    EXPECT_EQ_ARRAY(b(range(0, 5), _), a(range(0, 5), _));
+    b = a;
+    transpose_inplace(b(range(0, 100, 2), range(0, 100, 2)));
+    EXPECT_EQ_ARRAY(matrix<double>(b(range(0, 100, 2), range(0, 100, 2))), matrix<double>(transpose(a(range(0, 100, 2), range(0, 100, 2)))));
+
+    // rectangular matrices change their shape
+    for (auto [m, n] : {std::pair {1l, 9l}, {13l, 5l}, {64l, 100l}, {37l, 91l}})
+    {
+        auto r = matrix<dcomplex>(array<dcomplex, 2>::rand(m, n));
+        auto s = r;
+        dagger_inplace(s);
+        EXPECT_EQ(s.shape(), (enda::shape_t<2> {n, m}));
+        EXPECT_EQ_ARRAY(s, matrix<dcomplex>(dagger(r)));
+        auto t = array<double, 2, F_layout>(array<double, 2>::rand(m, n));
+        auto u = t;
+        transpose_inplace(u);
+        EXPECT_EQ(u.shape(), (enda::shape_t<2> {n, m}));
+        EXPECT_EQ_ARRAY(u, (array<double, 2>(transpose(t))));
+    }
+
+    // views cannot change their shape
+    auto r = matrix<double>(4, 6);
+    EXPECT_THROW(transpose_inplace(r(_, range(0, 5))), enda::runtime_error);
+}
+
+TEST(Matrix, TransposeParallel)
+{
+    const long old_threshold = enda::parallel::get_threshold();
+    enda::parallel::set_num_threads(4);
+    enda::parallel::set_threshold(0);
+
+    auto a = matrix<dcomplex>(array<dcomplex, 2>::rand(301, 301));
+    auto b = a;
+    dagger_inplace(b);
+    EXPECT_EQ_ARRAY(b, matrix<dcomplex>(dagger(a)));
+    EXPECT_EQ_ARRAY(dagger_copy(a), b);
+    auto c = matrix<double>(array<double, 2>::rand(190, 270));
+    EXPECT_EQ_ARRAY(transpose_copy(c), matrix<double>(transpose(c)));
+
+    enda::parallel::set_threshold(old_threshold);
+    enda::parallel::set_num_threads(enda::parallel::detail::default_num_threads());
+}
+
+// ===============================================================
+
 TEST(Matrix, Eye) { EXPECT_EQ_ARRAY(enda::eye<long>(3), (enda::matrix<long> {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}})); }
 
 // ===============================================================
@@ -0,0 +1,155 @@
+#include "../TestCommon.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+// Use several threads (independent of the hardware) and restore the defaults afterwards.
+class ExecutionTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        old_threshold = enda::parallel::get_threshold();
+        enda::parallel::set_num_threads(4);
+    }
+
+    void TearDown() override
+    {
+        enda::parallel::set_threshold(old_threshold);
+        enda::parallel::set_num_threads(enda::parallel::detail::default_num_threads());
+    }
+
+    long old_threshold = 0;
+};
+
+TEST_F(ExecutionTest, ThreadPoolRun)
+{
+    auto& pool = enda::parallel::thread_pool::instance();
+    EXPECT_EQ(pool.size(), 4);
+
+    std::vector<int> hits(100, 0);
+    pool.run(100, [&](long i) { hits[i] += 1; });
+    EXPECT_EQ(hits, std::vector<int>(100, 1));
+
+    // repeated jobs
+    std::atomic<long> sum = 0;
+    for (int r = 0; r < 50; ++r)
+        pool.run(8, [&](long i) { sum += i; });
+    EXPECT_EQ(sum, 50 * 28);
+}
+
+TEST_F(ExecutionTest, NestedJobsRunSequentially)
+{
+    auto&             pool = enda::parallel::thread_pool::instance();
+    std::atomic<long> n    = 0;
+    pool.run(4, [&](long) {
+        EXPECT_FALSE(enda::parallel::use_parallel(1l << 30));
+        pool.run(4, [&](long) { ++n; });
+    });
+    EXPECT_EQ(n, 16);
+}
+
+TEST_F(ExecutionTest, ExceptionsArePropagated)
+{
+    auto& pool = enda::parallel::thread_pool::instance();
+    EXPECT_THROW(pool.run(10,
+                          [](long i) {
+                              if (i == 7)
+                                  throw std::runtime_error("task failed");
+                          }),
+                 std::runtime_error);
+
+    // the pool is still usable
+    std::atomic<long> n = 0;
+    pool.run(10, [&](long) { ++n; });
+    EXPECT_EQ(n, 10);
+}
+
+TEST_F(ExecutionTest, ForChunks)
+{
+    std::vector<int> hits(1000, 0);
+    enda::parallel::for_chunks(1000, [&](long begin, long end) {
+        for (long i = begin; i < end; ++i)
+            hits[i] += 1;
+    });
+    EXPECT_EQ(hits, std::vector<int>(1000, 1));
+}
+
+TEST_F(ExecutionTest, PolicyGuardAndThreshold)
+{
+    enda::parallel::set_threshold(1000);
+    EXPECT_FALSE(enda::parallel::use_parallel(999));
+    EXPECT_TRUE(enda::parallel::use_parallel(1000));
+    {
+        enda::parallel::policy_guard guard(enda::execution::seq);
+        EXPECT_FALSE(enda::parallel::use_parallel(1l << 30));
+    }
+    {
+        enda::parallel::policy_guard guard(enda::execution::par);
+        EXPECT_TRUE(enda::parallel::use_parallel(1));
+    }
+    EXPECT_FALSE(enda::parallel::use_parallel(999));
+
+    enda::parallel::set_num_threads(1);
+    EXPECT_FALSE(enda::parallel::use_parallel(1l << 30));
+}
+
+TEST_F(ExecutionTest, ParallelFillAndAssign)
+{
+    // all kernels run in parallel
+    enda::parallel::set_threshold(0);
+
+    enda::array<long, 3> a(13, 7, 5);
+    a = 3;
+    EXPECT_EQ(enda::sum(a), 3 * a.size());
+
+    enda::array<long, 3> b(13, 7, 5);
+    enda::for_each(a.shape(), [&a](long i, long j, long k) { a(i, j, k) = 100 * i + 10 * j + k; });
+    b = a;
+    EXPECT_EQ_ARRAY(a, b);
+
+    // strided views
+    enda::array<long, 3> c(13, 7, 5);
+    c = 0;
+    c(range::all, range(1, 5), range::all) = a(range::all, range(2, 6), range::all);
+    for (long i = 0; i < 13; ++i)
+        for (long j = 1; j < 5; ++j)
+            for (long k = 0; k < 5; ++k)
+                EXPECT_EQ(c(i, j, k), a(i, j + 1, k));
+
+    // different stride orders
+    enda::array<long, 3, F_layout> d(13, 7, 5);
+    d = a;
+    EXPECT_EQ_ARRAY(a, d);
+
+    // expressions
+    enda::array<long, 3, F_layout> e(13, 7, 5);
+    e = a + 2 * d;
+    EXPECT_EQ_ARRAY(e, 3 * a);
+
+    // strided fill
+    c(range::all, range(0, 7, 2), range::all) = -1;
+    EXPECT_EQ(c(4, 2, 3), -1);
+    EXPECT_EQ(c(4, 1, 3), a(4, 2, 3));
+}
+
+TEST_F(ExecutionTest, AssignAndFillWithPolicies)
+{
+    enda::array<double, 2> a(100, 50), b(100, 50);
+    a = 1.5;
+
+    enda::assign(enda::execution::par, b, a);
+    EXPECT_EQ_ARRAY(a, b);
+
+    enda::assign(enda::execution::seq, b(range(0, 10), range::all), 2 * a(range(10, 20), range::all));
+    EXPECT_EQ(b(5, 5), 3.0);
+    EXPECT_EQ(b(15, 5), 1.5);
+
+    // fill sets all elements of a matrix (and not only the diagonal)
+    enda::matrix<double> m(20, 20);
+    enda::fill(enda::execution::par, m, 2.0);
+    EXPECT_EQ(enda::sum(m), 800.0);
+    enda::fill(enda::execution::seq, m(range(0, 10), range::all), 0.0);
+    EXPECT_EQ(enda::sum(m), 400.0);
+}
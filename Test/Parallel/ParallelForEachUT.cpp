@@ -0,0 +1,140 @@
+#include "../TestCommon.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using enda::parallel::schedule;
+
+// Use several threads (independent of the hardware) and restore the defaults afterwards.
+class ParallelForEachTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        old_threshold = enda::parallel::get_threshold();
+        enda::parallel::set_num_threads(4);
+        enda::parallel::set_threshold(0);
+    }
+
+    void TearDown() override
+    {
+        enda::parallel::set_threshold(old_threshold);
+        enda::parallel::set_num_threads(enda::parallel::detail::default_num_threads());
+    }
+
+    long old_threshold = 0;
+
+    static constexpr std::array<schedule, 5> schedules = {
+        schedule::static_chunks(), schedule::dynamic_chunks(), schedule::guided_chunks(), schedule::dynamic_chunks(1, 1), schedule::static_chunks(1)};
+};
+
+TEST_F(ParallelForEachTest, VisitsEveryIndexOnce)
+{
+    for (auto const& sched : schedules)
+    {
+        // small slowest dimension, all dimensions are collapsed
+        enda::array<int, 3> a(2, 37, 51);
+        a() = 0;
+        enda::parallel::parallel_for_each(a.shape(), [&a](long i, long j, long k) { a(i, j, k) += 1; }, sched);
+        EXPECT_EQ(enda::min_element(a), 1);
+        EXPECT_EQ(enda::max_element(a), 1);
+
+        // rank 1 and empty shapes
+        enda::array<int, 1> b(1000);
+        b() = 0;
+        enda::parallel::parallel_for_each(b.shape(), [&b](long i) { b(i) += 1; }, sched);
+        EXPECT_EQ(enda::sum(b), 1000);
+
+        long n = 0;
+        enda::parallel::parallel_for_each(std::array<long, 2> {0, 10}, [&n](long, long) { ++n; }, sched);
+        EXPECT_EQ(n, 0);
+
+        // also available in the enda namespace
+        b() = 0;
+        enda::parallel_for_each(b.shape(), [&b](long i) { b(i) += 2; }, sched);
+        EXPECT_EQ(enda::sum(b), 2000);
+    }
+}
+
+TEST_F(ParallelForEachTest, StaticChunksAreWholeGrains)
+{
+    // the static chunks consist of whole grains (except for the end of the index space) and are never empty
+    using chunks_t = std::vector<std::pair<long, long>>;
+    auto chunks    = chunks_t(3);
+    enda::parallel::detail::schedule_chunks(130, schedule::static_chunks(64), 3, [&](long t, long b, long e) { chunks[t] = {b, e}; });
+    EXPECT_EQ(chunks, (chunks_t {{0, 64}, {64, 128}, {128, 130}}));
+
+    chunks = chunks_t(4);
+    enda::parallel::detail::schedule_chunks(1000, schedule::static_chunks(10), 4, [&](long t, long b, long e) { chunks[t] = {b, e}; });
+    EXPECT_EQ(chunks, (chunks_t {{0, 250}, {250, 500}, {500, 750}, {750, 1000}}));
+
+    chunks = chunks_t(3);
+    enda::parallel::detail::schedule_chunks(500, schedule::static_chunks(64), 3, [&](long t, long b, long e) { chunks[t] = {b, e}; });
+    EXPECT_EQ(chunks, (chunks_t {{0, 128}, {128, 320}, {320, 500}}));
+}
+
+TEST_F(ParallelForEachTest, StrideOrder)
+{
+    // the index space is linearized in memory order
+    enda::array<long, 3, enda::F_layout> a(7, 11, 13);
+    constexpr auto                       so = enda::array<long, 3, enda::F_layout>::layout_t::stride_order_encoded;
+    enda::parallel::parallel_for_each<so>(a.shape(), [&](long i, long j, long k) { a(i, j, k) = &a(i, j, k) - a.data(); }, schedule::dynamic_chunks(64));
+    for (long n = 0; n < a.size(); ++n)
+        EXPECT_EQ(a.data()[n], n);
+
+    // compare to the sequential version
+    std::vector<std::array<long, 3>> seq, par(a.size());
+    enda::for_each_ordered<so>(a.shape(), [&](long i, long j, long k) { seq.push_back({i, j, k}); });
+    enda::parallel::parallel_for_each<so>(a.shape(), [&](long i, long j, long k) { par[&a(i, j, k) - a.data()] = {i, j, k}; });
+    EXPECT_TRUE(seq == par);
+}
+
+TEST_F(ParallelForEachTest, Reduce)
+{
+    auto a = enda::array<double, 3>(enda::rand<>(3, 50, 70));
+    for (auto const& sched : schedules)
+    {
+        auto s = enda::parallel::parallel_reduce_each(
+            a.shape(), 0.0, [&a](double& acc, long i, long j, long k) { acc += a(i, j, k); }, std::plus<> {}, sched);
+        EXPECT_NEAR(s, enda::sum(a), 1e-10);
+
+        auto n = enda::parallel::parallel_reduce_each(
+            a.shape(), 0l, [](long& acc, long, long, long) { ++acc; }, std::plus<> {}, sched);
+        EXPECT_EQ(n, a.size());
+    }
+
+    // static scheduling gives reproducible results
+    auto s1 = enda::parallel_reduce_each(a.shape(), 0.0, [&a](double& acc, long i, long j, long k) { acc += a(i, j, k); }, std::plus<> {});
+    auto s2 = enda::parallel::parallel_reduce_each(a.shape(), 0.0, [&a](double& acc, long i, long j, long k) { acc += a(i, j, k); }, std::plus<> {});
+    EXPECT_EQ(s1, s2);
+}
+
+TEST_F(ParallelForEachTest, SequentialFallback)
+{
+    enda::parallel::set_threshold(1l << 30);
+    std::vector<std::array<long, 2>> visited;
+    enda::parallel::parallel_for_each(std::array<long, 2> {3, 4}, [&](long i, long j) { visited.push_back({i, j}); });
+    ASSERT_EQ(visited.size(), 12);
+    for (long n = 0; n < 12; ++n)
+        EXPECT_TRUE((visited[n] == std::array<long, 2> {n / 4, n % 4}));
+
+    // forcing the parallel policy
+    enda::parallel::policy_guard guard {enda::execution::par};
+    std::atomic<long>            n = 0;
+    enda::parallel::parallel_for_each(std::array<long, 2> {30, 40}, [&](long, long) { ++n; });
+    EXPECT_EQ(n, 1200);
+}
+
+TEST_F(ParallelForEachTest, ExceptionsArePropagated)
+{
+    for (auto const& sched : schedules)
+        EXPECT_THROW(enda::parallel::parallel_for_each(
+                         std::array<long, 2> {100, 100},
+                         [](long i, long j) {
+                             if (i == 77 and j == 3)
+                                 throw std::runtime_error("failed");
+                         },
+                         sched),
+                     std::runtime_error);
+}
@@ -0,0 +1,182 @@
+#include "../TestCommon.hpp"
+
+#include <atomic>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// Use several threads (independent of the hardware) and restore the defaults afterwards.
+class TaskGroupTest : public ::testing::Test
+{
+protected:
+    void SetUp() override { enda::parallel::set_num_threads(4); }
+
+    void TearDown() override
+    {
+        enda::parallel::set_thread_affinity(false);
+        enda::parallel::set_num_threads(enda::parallel::detail::default_num_threads());
+    }
+};
+
+// Naive recursive Fibonacci numbers with nested task groups.
+static long fib(long n)
+{
+    if (n < 2)
+        return n;
+    long                       a = 0, b = 0;
+    enda::parallel::task_group g;
+    g.run([&]() { a = fib(n - 1); });
+    g.run_and_wait([&]() { b = fib(n - 2); });
+    return a + b;
+}
+
+TEST(WorkStealingDeque, OwnerAndThieves)
+{
+    enda::parallel::detail::ws_deque<long> dq(4);
+    std::vector<long>                      items(10000);
+    for (long i = 0; i < long(items.size()); ++i)
+        items[i] = i;
+
+    // owner only: LIFO, growing beyond the initial capacity
+    for (int i = 0; i < 10; ++i)
+        dq.push(&items[i]);
+    for (int i = 9; i >= 0; --i)
+        EXPECT_EQ(dq.pop(), &items[i]);
+    EXPECT_EQ(dq.pop(), nullptr);
+    EXPECT_TRUE(dq.empty());
+
+    // thieves take from the top (FIFO)
+    dq.push(&items[0]);
+    dq.push(&items[1]);
+    EXPECT_EQ(dq.steal(), &items[0]);
+    EXPECT_EQ(dq.pop(), &items[1]);
+    EXPECT_EQ(dq.steal(), nullptr);
+
+    // concurrent pushes, pops and steals: every item is taken exactly once
+    std::vector<std::atomic<int>> taken(items.size());
+    std::atomic<bool>             done = false;
+    std::vector<std::thread>      thieves;
+    for (int t = 0; t < 3; ++t)
+        thieves.emplace_back([&]() {
+            while (!done.load() or !dq.empty())
+                if (auto* p = dq.steal())
+                    ++taken[*p];
+        });
+    for (long i = 0; i < long(items.size()); ++i)
+    {
+        dq.push(&items[i]);
+        if (i % 3 == 0)
+            if (auto* p = dq.pop())
+                ++taken[*p];
+    }
+    while (auto* p = dq.pop())
+        ++taken[*p];
+    done = true;
+    for (auto& t : thieves)
+        t.join();
+    for (auto& t : taken)
+        EXPECT_EQ(t.load(), 1);
+}
+
+TEST_F(TaskGroupTest, RunAndWait)
+{
+    std::vector<int>           hits(1000, 0);
+    enda::parallel::task_group g;
+    for (int i = 0; i < 1000; ++i)
+        g.run([&hits, i]() { hits[i] += 1; });
+    g.wait();
+    EXPECT_EQ(hits, std::vector<int>(1000, 1));
+
+    // the group can be reused after a join
+    std::atomic<long> n = 0;
+    for (int i = 0; i < 10; ++i)
+        g.run([&n]() { ++n; });
+    g.wait();
+    EXPECT_EQ(n, 10);
+}
+
+TEST_F(TaskGroupTest, NestedParallelism)
+{
+    EXPECT_EQ(fib(20), 6765);
+
+    // nested parallel_for and thread_pool::run
+    std::atomic<long> n = 0;
+    enda::parallel::parallel_for(0, 20, [&](long) {
+        enda::parallel::parallel_for(0, 30, [&](long) { ++n; });
+        enda::parallel::thread_pool::instance().run(5, [&](long) { ++n; });
+    });
+    EXPECT_EQ(n, 20 * 35);
+
+    // the threads of the pool are used, no new ones are created
+    std::mutex                  mtx;
+    std::set<std::thread::id>   ids;
+    enda::parallel::parallel_for(0, 2000, [&](long) {
+        std::lock_guard lock(mtx);
+        ids.insert(std::this_thread::get_id());
+    });
+    EXPECT_LE(ids.size(), 4);
+}
+
+TEST_F(TaskGroupTest, ParallelInvokeAndFor)
+{
+    int a = 0, b = 0, c = 0;
+    enda::parallel_invoke([&]() { a = 1; }, [&]() { b = 2; }, [&]() { c = 3; });
+    EXPECT_EQ(a + b + c, 6);
+
+    for (long grain : {1l, 7l, 1000l})
+    {
+        std::vector<int> hits(999, 0);
+        enda::parallel::parallel_for(0, 999, [&hits](long i) { hits[i] += 1; }, grain);
+        EXPECT_EQ(hits, std::vector<int>(999, 1));
+    }
+
+    // empty ranges
+    enda::parallel_for(5, 5, [](long) { FAIL(); });
+}
+
+TEST_F(TaskGroupTest, ExceptionsArePropagated)
+{
+    EXPECT_THROW(enda::parallel::parallel_for(0, 1000,
+                                              [](long i) {
+                                                  if (i == 567)
+                                                      throw std::runtime_error("failed");
+                                              }),
+                 std::runtime_error);
+    EXPECT_THROW(enda::parallel::parallel_invoke([]() {}, []() { throw std::runtime_error("failed"); }), std::runtime_error);
+
+    // all tasks finish before the exception is rethrown
+    std::atomic<long>          n = 0;
+    enda::parallel::task_group g;
+    for (int i = 0; i < 100; ++i)
+        g.run([&n, i]() {
+            ++n;
+            if (i % 10 == 0)
+                throw std::logic_error("failed");
+        });
+    EXPECT_THROW(g.wait(), std::logic_error);
+    EXPECT_EQ(n, 100);
+    g.wait();
+}
+
+TEST_F(TaskGroupTest, AffinityAndSeparatePools)
+{
+    enda::parallel::set_thread_affinity(true);
+    EXPECT_TRUE(enda::parallel::thread_pool::instance().pinned());
+    EXPECT_EQ(enda::parallel::get_num_threads(), 4);
+    EXPECT_EQ(fib(15), 610);
+    enda::parallel::set_thread_affinity(false);
+    EXPECT_FALSE(enda::parallel::thread_pool::instance().pinned());
+
+    // a separate pool with its own threads
+    enda::parallel::thread_pool pool(3);
+    std::atomic<long>           n = 0;
+    {
+        enda::parallel::task_group g(pool);
+        for (int i = 0; i < 100; ++i)
+            g.run([&n]() { ++n; });
+    }
+    EXPECT_EQ(n, 100);
+    pool.run(50, [&n](long) { ++n; });
+    EXPECT_EQ(n, 150);
+}
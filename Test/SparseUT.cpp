@@ -0,0 +1,182 @@
+#include "./TestCommon.hpp"
+
+#include <random>
+
+// Random sparse matrix with a given density (as COO matrix with duplicates) and its dense counterpart.
+template<typename T>
+std::pair<coo_matrix<T>, matrix<T>> make_random_sparse(long m, long n, double density, unsigned seed = 1)
+{
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> u(0, 1);
+    std::uniform_int_distribution<long> ri(0, m - 1), ci(0, n - 1);
+    auto coo = coo_matrix<T>(m, n);
+    auto d   = matrix<T>::zeros(m, n);
+    for (long k = 0; k < static_cast<long>(density * m * n); ++k)
+    {
+        long const i = ri(gen), j = ci(gen);
+        T x          = T(u(gen) + 0.5);
+        if constexpr (is_complex_v<T>)
+            x += T(0, u(gen));
+        coo.push_back(i, j, x);
+        d(i, j) += x;
+    }
+    return {coo, d};
+}
+
+TEST(Sparse, CooMatrix)
+{
+    auto coo = coo_matrix<double>(3, 4, {0, 2, 0, 1}, {1, 3, 1, 0}, {1.0, 2.0, 3.0, 4.0});
+    EXPECT_EQ(coo.shape(), (std::array<long, 2> {3, 4}));
+    EXPECT_EQ(coo.nnz(), 4);
+    coo.push_back(2, 2, 5.0);
+    auto d = coo.to_dense();
+    EXPECT_EQ_ARRAY(d, (matrix<double> {{0, 4, 0, 0}, {4, 0, 0, 0}, {0, 0, 5, 2}}));
+    EXPECT_EQ_ARRAY((coo_matrix<double>(d).to_dense()), d);
+    EXPECT_EQ(coo_matrix<double>(d).nnz(), 4);
+}
+
+template<char Major>
+void check_compressed_construction()
+{
+    // from COO with duplicates and empty slices
+    auto coo = coo_matrix<double>(4, 5, {3, 0, 3, 0, 3, 1}, {4, 2, 0, 2, 4, 1}, {1.0, 2.0, 3.0, 4.0, 5.0, 6.0});
+    auto a   = compressed_matrix<double, Major>(coo);
+    auto d   = matrix<double> {{0, 0, 6, 0, 0}, {0, 6, 0, 0, 0}, {0, 0, 0, 0, 0}, {3, 0, 0, 0, 6}};
+    d(1, 1)  = 6;
+    EXPECT_EQ(a.nnz(), 4);
+    EXPECT_EQ_ARRAY(a.to_dense(), d);
+    for (long i = 0; i < 4; ++i)
+        for (long j = 0; j < 5; ++j)
+            EXPECT_EQ(a(i, j), d(i, j));
+
+    // structure
+    if constexpr (Major == 'R')
+    {
+        EXPECT_EQ_ARRAY(a.outer_ptr(), (array<long, 1> {0, 1, 2, 2, 4}));
+        EXPECT_EQ_ARRAY(a.inner_indices(), (array<long, 1> {2, 1, 0, 4}));
+    }
+    else
+    {
+        EXPECT_EQ_ARRAY(a.outer_ptr(), (array<long, 1> {0, 1, 2, 3, 3, 4}));
+        EXPECT_EQ_ARRAY(a.inner_indices(), (array<long, 1> {3, 1, 0, 3}));
+    }
+
+    // from dense, to COO, from the compressed representation
+    EXPECT_EQ_ARRAY((compressed_matrix<double, Major>(d).to_dense()), d);
+    EXPECT_EQ_ARRAY((compressed_matrix<double, Major>(a.to_coo()).to_dense()), d);
+    auto b = compressed_matrix<double, Major>(4, 5, array<long, 1>(a.outer_ptr()), array<long, 1>(a.inner_indices()), array<double, 1>(a.values()));
+    EXPECT_EQ_ARRAY(b.to_dense(), d);
+
+    // modify the values
+    a.values() *= 2;
+    EXPECT_EQ_ARRAY(a.to_dense(), 2 * d);
+
+    // empty matrices
+    EXPECT_EQ_ARRAY((compressed_matrix<double, Major>(3, 2).to_dense()), (matrix<double>::zeros(3, 2)));
+    EXPECT_EQ((compressed_matrix<double, Major>(coo_matrix<double>(0, 0)).nnz()), 0);
+}
+
+TEST(Sparse, CsrConstruction) { check_compressed_construction<'R'>(); }
+
+TEST(Sparse, CscConstruction) { check_compressed_construction<'C'>(); }
+
+TEST(Sparse, Conversions)
+{
+    auto [coo, d] = make_random_sparse<double>(37, 23, 0.1);
+    auto csr      = csr_matrix<double>(coo);
+    auto csc      = csc_matrix<double>(coo);
+    EXPECT_EQ_ARRAY(csr.to_dense(), d);
+    EXPECT_EQ_ARRAY(csc.to_dense(), d);
+
+    // CSR <-> CSC
+    auto csc2 = csc_matrix<double>(csr);
+    EXPECT_EQ_ARRAY(csc2.outer_ptr(), csc.outer_ptr());
+    EXPECT_EQ_ARRAY(csc2.inner_indices(), csc.inner_indices());
+    EXPECT_ARRAY_NEAR(csc2.values(), csc.values(), 1e-14);
+    EXPECT_ARRAY_NEAR((csr_matrix<double>(csc).to_dense()), d, 1e-14);
+
+    // transpose
+    auto t = csr.transpose();
+    static_assert(std::is_same_v<decltype(t), csc_matrix<double>>);
+    EXPECT_EQ_ARRAY(t.to_dense(), (matrix<double>(transpose(d))));
+}
+
+template<typename T, char Major>
+void check_products(long m, long n, double density)
+{
+    auto [coo, d] = make_random_sparse<T>(m, n, density, 3);
+    auto a        = compressed_matrix<T, Major>(coo);
+    auto x        = vector<T>(array<T, 1>::rand(n));
+    auto r        = vector<T>(d * x);
+
+    // spmv with alpha and beta
+    EXPECT_ARRAY_NEAR((a * x), r, 1e-12);
+    EXPECT_ARRAY_NEAR((coo * x), r, 1e-12);
+    auto y = vector<T>(r);
+    linalg::spmv(T {2}, a, x, T {-1}, y);
+    EXPECT_ARRAY_NEAR(y, r, 1e-12);
+    y = r;
+    linalg::spmv(T {2}, coo, x, T {-1}, y);
+    EXPECT_ARRAY_NEAR(y, r, 1e-12);
+
+    // strided vectors
+    auto big = array<T, 1>::zeros(3 * std::max(m, n));
+    big(range(0, 3 * n, 3)) = x;
+    auto yv                 = big(range(1, 3 * m, 3));
+    linalg::spmv(T {1}, a, big(range(0, 3 * n, 3)), T {0}, yv);
+    EXPECT_ARRAY_NEAR(yv, r, 1e-12);
+
+    // spmm with C and Fortran layouts
+    long const k = 7;
+    auto b       = matrix<T>(array<T, 2>::rand(n, k));
+    auto rm      = matrix<T>(d * b);
+    EXPECT_ARRAY_NEAR((a * b), rm, 1e-12);
+    EXPECT_ARRAY_NEAR((coo * b), rm, 1e-12);
+    auto bf = matrix<T, F_layout>(b);
+    auto cf = matrix<T, F_layout>(m, k);
+    linalg::spmm(T {1}, a, bf, T {0}, cf);
+    EXPECT_ARRAY_NEAR(cf, rm, 1e-12);
+    auto c = matrix<T>(rm);
+    linalg::spmm(T {2}, a, b, T {-1}, c);
+    EXPECT_ARRAY_NEAR(c, rm, 1e-12);
+
+    // lazy expressions are evaluated first
+    EXPECT_ARRAY_NEAR((a * (2 * x)), (2 * r), 1e-12);
+}
+
+TEST(Sparse, ProductsDouble)
+{
+    check_products<double, 'R'>(1, 1, 1.0);
+    check_products<double, 'R'>(50, 40, 0.05);
+    check_products<double, 'R'>(200, 300, 0.2);
+    check_products<double, 'C'>(50, 40, 0.05);
+    check_products<double, 'C'>(200, 300, 0.2);
+}
+
+TEST(Sparse, ProductsComplex)
+{
+    check_products<dcomplex, 'R'>(60, 45, 0.1);
+    check_products<dcomplex, 'C'>(60, 45, 0.1);
+}
+
+TEST(Sparse, ParallelProducts)
+{
+    // banded matrix with a few dense rows to test the balancing
+    long const n = 2000;
+    auto coo     = coo_matrix<double>(n, n);
+    for (long i = 0; i < n; ++i)
+        for (long j = std::max(0l, i - 3); j < std::min(n, i + 4); ++j)
+            coo.push_back(i, j, 1.0 + i - 0.5 * j);
+    for (long j = 0; j < n; ++j)
+        coo.push_back(17, j, 0.25);
+    auto a = csr_matrix<double>(coo);
+    auto d = coo.to_dense();
+    auto x = vector<double>(array<double, 1>::rand(n));
+    auto b = matrix<double>(array<double, 2>::rand(n, 5));
+
+    auto r  = vector<double>(d * x);
+    auto rm = matrix<double>(d * b);
+    enda::parallel::policy_guard guard(enda::execution::par);
+    EXPECT_ARRAY_NEAR((a * x), r, 1e-10);
+    EXPECT_ARRAY_NEAR((a * b), rm, 1e-10);
+}
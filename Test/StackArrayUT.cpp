@@ -79,3 +79,54 @@ TEST(Loop, Static)
 
     std::cout << a << std::endl;
 }
+
+// ==============================================================
+
+TEST(StackArray, MatrixKernels)
+{
+    auto a = enda::stack_matrix<double, 3, 3> {};
+    auto b = enda::stack_matrix<double, 3, 2> {};
+    auto x = enda::stack_vector<double, 3> {};
+    for (int i = 0; i < 3; ++i)
+    {
+        x(i) = 1 - i;
+        for (int j = 0; j < 3; ++j)
+            a(i, j) = (i == j ? 4 : 0) + i - 2 * j;
+        for (int j = 0; j < 2; ++j)
+            b(i, j) = i * j + 1;
+    }
+    auto ad = enda::matrix<double>(a);
+    auto bd = enda::matrix<double>(b);
+    auto xd = enda::vector<double>(x);
+
+    // products are stack arrays computed by the fixed-size kernels
+    auto ab = a * b;
+    static_assert(std::is_same_v<decltype(ab), enda::stack_matrix<double, 3, 2>>);
+    EXPECT_ARRAY_NEAR(ab, enda::matrix<double>(ad * bd));
+    auto ax = a * x;
+    static_assert(std::is_same_v<decltype(ax), enda::stack_vector<double, 3>>);
+    EXPECT_ARRAY_NEAR(ax, enda::vector<double>(ad * xd));
+    enda::linalg::gemm(2.0, a, b, 1.0, ab);
+    EXPECT_ARRAY_NEAR(ab, enda::matrix<double>(3 * ad * bd), 1e-12);
+
+    // strided and dynamic operands use the generic kernels
+    EXPECT_ARRAY_NEAR(enda::matrix<double>(enda::transpose(a) * b), enda::matrix<double>(enda::transpose(ad) * bd), 1e-12);
+    EXPECT_ARRAY_NEAR(enda::matrix<double>(a * bd), enda::matrix<double>(ad * bd), 1e-12);
+
+    // trace, identity, inverse and determinant
+    EXPECT_EQ(trace(a), trace(ad));
+    auto id = enda::eye<double, 3>();
+    static_assert(std::is_same_v<decltype(id), enda::stack_matrix<double, 3, 3>>);
+    EXPECT_ARRAY_NEAR(id, enda::eye<double>(3));
+    auto inv = enda::inverse(a);
+    static_assert(std::is_same_v<decltype(inv), enda::stack_matrix<double, 3, 3>>);
+    EXPECT_ARRAY_NEAR(a * inv, id, 1e-12);
+    EXPECT_NEAR(enda::determinant(a), enda::determinant(ad), 1e-12);
+    EXPECT_THROW(enda::inverse(enda::stack_matrix<double, 2, 2> {enda::matrix<double> {{1, 2}, {2, 4}}}), enda::runtime_error);
+
+    // complex
+    auto c = enda::stack_matrix<dcomplex, 2, 2> {enda::matrix<dcomplex> {{{1, 1}, {2, 0}}, {{0, 1}, {3, -1}}}};
+    auto cd = enda::matrix<dcomplex>(c);
+    EXPECT_ARRAY_NEAR(c * c, enda::matrix<dcomplex>(cd * cd), 1e-12);
+    EXPECT_ARRAY_NEAR(c * enda::inverse(c), enda::eye<dcomplex>(2), 1e-12);
+}
@@ -0,0 +1,61 @@
+#include "../TestCommon.hpp"
+
+using enda::stdutil::small_vector;
+
+TEST(SmallVectorTest, Inline)
+{
+    small_vector<long, 4> v {1, 2, 3};
+    EXPECT_EQ(v.size(), 3);
+    EXPECT_TRUE(v.is_inline());
+    EXPECT_EQ(v[2], 3);
+    v.push_back(4);
+    EXPECT_TRUE(v.is_inline());
+    EXPECT_EQ(v.back(), 4);
+
+    small_vector<long, 4> w(std::array<long, 2> {5, 6});
+    EXPECT_EQ(w.size(), 2);
+    EXPECT_FALSE(v == w);
+    w = v;
+    EXPECT_TRUE(v == w);
+
+    small_vector<long, 4> z(3, 7);
+    EXPECT_TRUE((z == small_vector<long, 4> {7, 7, 7}));
+    z.resize(1);
+    z.resize(2);
+    EXPECT_TRUE((z == small_vector<long, 4> {7, 0}));
+    EXPECT_TRUE(small_vector<long> {}.empty());
+}
+
+TEST(SmallVectorTest, Heap)
+{
+    small_vector<int, 2> v;
+    for (int i = 0; i < 100; ++i)
+        v.push_back(i);
+    EXPECT_FALSE(v.is_inline());
+    EXPECT_EQ(v.size(), 100);
+    EXPECT_GE(v.capacity(), 100);
+    for (int i = 0; i < 100; ++i)
+        EXPECT_EQ(v[i], i);
+
+    // push back an element of the vector itself
+    small_vector<int, 2> x {1, 2};
+    x.push_back(x[0]);
+    EXPECT_TRUE((x == small_vector<int, 2> {1, 2, 1}));
+
+    // copy and move
+    auto c = v;
+    EXPECT_TRUE(c == v);
+    EXPECT_NE(c.data(), v.data());
+    auto const* p = v.data();
+    auto        m = std::move(v);
+    EXPECT_EQ(m.data(), p);
+    EXPECT_TRUE(v.empty());
+    EXPECT_TRUE(v.is_inline());
+
+    // move an inline vector
+    small_vector<int, 2> s {3, 4};
+    small_vector<int, 2> t;
+    t = std::move(s);
+    EXPECT_TRUE((t == small_vector<int, 2> {3, 4}));
+    EXPECT_TRUE(std::equal(t.begin(), t.end(), std::array {3, 4}.begin()));
+}